@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# -*- gen_cjk.py -*- Generate double byte CJK encoding tables -*-
+#
+# Usage: python3 tables/gen_cjk.py > tables/cjk.h
+#
+# The mappings come from Python's own codecs, so no data files are needed.
+
+import sys
+
+# Marks undefined chars in the tables, and lead bytes in the single byte tables.
+UNMAPPED = 0xFFFF
+LEAD = 0xFFFE
+
+def decode(codec, data):
+    try:
+        text = data.decode(codec)
+    except UnicodeDecodeError:
+        return None
+
+    return ord(text) if len(text) == 1 else None
+
+def emit_array(out, ctype, name, values, per_line, digits):
+    out.write('static const %s %s[%d] = {\n' % (ctype, name, len(values)))
+
+    for i in range(0, len(values), per_line):
+        out.write('    ' + ', '.join('0x%0*X' % (digits, v) for v in values[i:i + per_line]) + ',\n')
+
+    out.write('};\n\n')
+
+# A two level table. Each lead byte with any mappings gets a row of trail_count codepoints.
+def emit_table(out, symbol, codec, prefix, leads, trail_min, trail_max):
+    trail_count = trail_max - trail_min + 1
+    lead_rows = [0] * 0x100
+    rows = []
+
+    for lead in leads:
+        row = [decode(codec, bytes(prefix + [lead, trail])) for trail in range(trail_min, trail_max + 1)]
+
+        if all(codepoint is None for codepoint in row):
+            continue
+
+        rows.extend(UNMAPPED if codepoint is None else codepoint for codepoint in row)
+        lead_rows[lead] = len(rows) // trail_count
+
+    emit_array(out, 'uint8_t', symbol + '_LEADS', lead_rows, 16, 2)
+    emit_array(out, 'uint16_t', symbol + '_ROWS', rows, 12, 4)
+
+    out.write('static const __cjk_table_t %s = { %s_LEADS, %s_ROWS, 0x%02X, %d };\n\n' % (symbol, symbol, symbol, trail_min, trail_count))
+
+# The high half of the single byte range. Lead bytes are marked, and everything else is decoded.
+def emit_single(out, symbol, codec, leads):
+    values = []
+
+    for byte in range(0x80, 0x100):
+        if byte in leads:
+            values.append(LEAD)
+        else:
+            codepoint = decode(codec, bytes([byte]))
+            values.append(UNMAPPED if codepoint is None else codepoint)
+
+    emit_array(out, 'uint16_t', symbol, values, 8, 4)
+
+# The BMP codepoints GB18030 encodes with 4 bytes, as runs of (linear index, first codepoint).
+# The linear index of b1 b2 b3 b4 is (((b1 - 0x81) * 10 + (b2 - 0x30)) * 126 + (b3 - 0x81)) * 10 + (b4 - 0x30).
+def emit_gb18030_ranges(out):
+    ranges = []
+
+    for codepoint in range(0x80, 0x10000):
+        if 0xD800 <= codepoint <= 0xDFFF:
+            continue
+
+        data = chr(codepoint).encode('gb18030')
+
+        if len(data) != 4:
+            continue
+
+        b1, b2, b3, b4 = data
+        linear = (((b1 - 0x81) * 10 + (b2 - 0x30)) * 126 + (b3 - 0x81)) * 10 + (b4 - 0x30)
+
+        if ranges and ranges[-1][0] + ranges[-1][2] == linear and ranges[-1][1] + ranges[-1][2] == codepoint:
+            ranges[-1][2] += 1
+        else:
+            ranges.append([linear, codepoint, 1])
+
+    # The last run ends at the end of the BMP part of the 4 byte space.
+    out.write('static const uint32_t CJK_GB18030_RANGES[%d][2] = {\n' % len(ranges))
+
+    for linear, codepoint, _ in ranges:
+        out.write('    { %5d, 0x%04X },\n' % (linear, codepoint))
+
+    out.write('};\n\n')
+    out.write('static const uint32_t CJK_GB18030_BMP_END = %d;\n' % (ranges[-1][0] + ranges[-1][2]))
+
+def main():
+    out = sys.stdout
+
+    title = '/* -*- cjk.h -*- Double byte CJK encoding tables (generated) -*- */'
+    bar = '/* ' + '*' * (len(title) - 6) + ' */'
+
+    out.write(bar + '\n' + title + '\n' + bar + '\n\n')
+    out.write('// Generated by tables/gen_cjk.py from Python %d.%d codecs. Do not edit.\n\n' % sys.version_info[:2])
+
+    sjis_leads = list(range(0x81, 0xA0)) + list(range(0xE0, 0xFD))
+    euc_leads = list(range(0xA1, 0xFF))
+    gb_leads = list(range(0x81, 0xFF))
+
+    # JIS X 0208 is shared by Shift_JIS and EUC-JP, and indexed by its EUC-JP bytes.
+    emit_table(out, 'CJK_JIS0208', 'euc_jp', [], euc_leads, 0xA1, 0xFE)
+    emit_table(out, 'CJK_JIS0212', 'euc_jp', [0x8F], euc_leads, 0xA1, 0xFE)
+    emit_table(out, 'CJK_CP932', 'cp932', [], sjis_leads, 0x40, 0xFC)
+    emit_table(out, 'CJK_GB18030', 'gb18030', [], gb_leads, 0x40, 0xFE)
+    emit_table(out, 'CJK_BIG5', 'big5', [], gb_leads, 0x40, 0xFE)
+
+    emit_single(out, 'CJK_SJIS_SINGLE', 'shift_jis', sjis_leads)
+    emit_single(out, 'CJK_CP932_SINGLE', 'cp932', sjis_leads)
+    emit_single(out, 'CJK_EUCJP_SINGLE', 'euc_jp', [0x8E, 0x8F] + euc_leads)
+    emit_single(out, 'CJK_GB18030_SINGLE', 'gb18030', gb_leads)
+    emit_single(out, 'CJK_BIG5_SINGLE', 'big5', gb_leads)
+
+    emit_gb18030_ranges(out)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# -*- gen_codepages.py -*- Generate single byte codepage tables -*-
+#
+# Usage: python3 tables/gen_codepages.py > tables/codepages.h
+#
+# The mappings come from Python's own codecs, so no data files are needed.
+
+import codecs
+import sys
+
+# (Python codec, names). Names are normalized the same way unicode.c does it:
+#   upper case, with '-' and '_' removed.
+CODEPAGES = [
+    ('iso8859_1',   ['ISO88591']),
+    ('iso8859_2',   ['ISO88592', 'LATIN2']),
+    ('iso8859_3',   ['ISO88593', 'LATIN3']),
+    ('iso8859_4',   ['ISO88594', 'LATIN4']),
+    ('iso8859_5',   ['ISO88595', 'CYRILLIC']),
+    ('iso8859_6',   ['ISO88596', 'ARABIC']),
+    ('iso8859_7',   ['ISO88597', 'GREEK']),
+    ('iso8859_8',   ['ISO88598', 'HEBREW']),
+    ('iso8859_9',   ['ISO88599', 'LATIN5']),
+    ('iso8859_10',  ['ISO885910', 'LATIN6']),
+    ('iso8859_11',  ['ISO885911', 'THAI']),
+    ('iso8859_13',  ['ISO885913', 'LATIN7']),
+    ('iso8859_14',  ['ISO885914', 'LATIN8']),
+    ('iso8859_15',  ['ISO885915', 'LATIN9']),
+    ('iso8859_16',  ['ISO885916', 'LATIN10']),
+    ('cp1250',      ['WINDOWS1250', 'CP1250']),
+    ('cp1251',      ['WINDOWS1251', 'CP1251']),
+    ('cp1252',      ['WINDOWS1252', 'CP1252']),
+    ('cp1253',      ['WINDOWS1253', 'CP1253']),
+    ('cp1254',      ['WINDOWS1254', 'CP1254']),
+    ('cp1255',      ['WINDOWS1255', 'CP1255']),
+    ('cp1256',      ['WINDOWS1256', 'CP1256']),
+    ('cp1257',      ['WINDOWS1257', 'CP1257']),
+    ('cp1258',      ['WINDOWS1258', 'CP1258']),
+    ('cp437',       ['IBM437', 'CP437']),
+    ('cp850',       ['IBM850', 'CP850']),
+    ('cp866',       ['IBM866', 'CP866']),
+    ('koi8_r',      ['KOI8R']),
+    ('koi8_u',      ['KOI8U']),
+    ('mac_roman',   ['MACINTOSH', 'MACROMAN']),
+    ('cp037',       ['IBM037', 'CP037', 'EBCDICCPUS']),
+    ('cp273',       ['IBM273', 'CP273']),
+    ('cp500',       ['IBM500', 'CP500']),
+    ('cp1026',      ['IBM1026', 'CP1026']),
+    ('cp1140',      ['IBM1140', 'CP1140']),
+]
+
+# Marks undefined bytes and unmapped codepoints.
+UNMAPPED = 0xFFFF
+
+def table(codec):
+    to_unicode = []
+
+    for byte in range(0x100):
+        try:
+            text = bytes([byte]).decode(codec)
+        except UnicodeDecodeError:
+            text = ''
+
+        to_unicode.append(ord(text) if len(text) == 1 else UNMAPPED)
+
+    # When two bytes decode to the same codepoint, encoding uses the first.
+    from_unicode = {}
+
+    for byte, codepoint in enumerate(to_unicode):
+        if codepoint != UNMAPPED:
+            from_unicode.setdefault(codepoint, byte)
+
+    return to_unicode, from_unicode
+
+def emit_array(out, ctype, name, values, per_line, digits):
+    out.write('static const %s %s[%d] = {\n' % (ctype, name, len(values)))
+
+    for i in range(0, len(values), per_line):
+        out.write('    ' + ', '.join('0x%0*X' % (digits, v) for v in values[i:i + per_line]) + ',\n')
+
+    out.write('};\n\n')
+
+def main():
+    out = sys.stdout
+
+    title = '/* -*- codepages.h -*- Single byte codepage tables (generated) -*- */'
+    bar = '/* ' + '*' * (len(title) - 6) + ' */'
+
+    out.write(bar + '\n' + title + '\n' + bar + '\n\n')
+    out.write('// Generated by tables/gen_codepages.py from Python %d.%d codecs. Do not edit.\n\n' % sys.version_info[:2])
+
+    entries = []
+
+    for codec, names in CODEPAGES:
+        to_unicode, from_unicode = table(codec)
+        symbol = 'CODEPAGE_' + names[0]
+
+        # The low half of the reverse mapping is a direct table, and the rest is searched.
+        from_low = [from_unicode.get(codepoint, UNMAPPED) for codepoint in range(0x100)]
+        from_high = sorted((codepoint << 8) | byte for codepoint, byte in from_unicode.items() if codepoint >= 0x100)
+
+        ascii_compatible = all(to_unicode[byte] == byte for byte in range(0x80))
+
+        emit_array(out, 'uint16_t', symbol + '_TO_UNICODE', to_unicode, 8, 4)
+        emit_array(out, 'uint16_t', symbol + '_FROM_LOW', from_low, 8, 4)
+
+        if from_high:
+            emit_array(out, 'uint32_t', symbol + '_FROM_HIGH', from_high, 6, 6)
+
+        entries.append((codec, names, symbol, len(from_high), ascii_compatible))
+
+    out.write('static const struct uniconv_codepage CODEPAGES[%d] = {\n' % len(entries))
+
+    for codec, names, symbol, high_count, ascii_compatible in entries:
+        out.write('    { "%s", %s_TO_UNICODE, %s_FROM_LOW, %s, %d, %s },\n' %
+                  (names[0], symbol, symbol, (symbol + '_FROM_HIGH') if high_count else 'NULL', high_count, 'true' if ascii_compatible else 'false'))
+
+    out.write('};\n\n')
+
+    aliases = sorted((name, i) for i, entry in enumerate(entries) for name in entry[1])
+
+    out.write('// Every name a codepage is known by, sorted for searching.\n')
+    out.write('static const struct { const char *name; size_t index; } CODEPAGE_NAMES[%d] = {\n' % len(aliases))
+
+    for name, i in aliases:
+        out.write('    { "%s", %d },\n' % (name, i))
+
+    out.write('};\n')
+
+if __name__ == '__main__':
+    main()
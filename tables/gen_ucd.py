@@ -0,0 +1,415 @@
+#!/usr/bin/env python3
+# -*- gen_ucd.py -*- Generate Unicode character property tables -*-
+#
+# Usage: python3 tables/gen_ucd.py > tables/ucd.h
+#
+# The properties come from the Unicode Character Database files in tables/ucd, which only keep the
+#   properties used here. The full files from unicode.org can be dropped in instead.
+
+import io
+import os
+import sys
+
+UCD_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'ucd')
+
+CODEPOINT_COUNT = 0x110000
+
+# General categories, numbered as in unicode.h. Unassigned codepoints come first, as the default.
+CATEGORIES = [
+    'Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Ps',
+    'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co',
+]
+
+# Scripts with fixed numbers in unicode.h. The rest follow in alphabetical order.
+FIXED_SCRIPTS = ['Unknown', 'Common', 'Inherited']
+
+# Binary properties, as (file, property, flag bit in unicode.h).
+BINARY_PROPERTIES = [
+    ('PropList.txt',                'White_Space',                  0),
+    ('DerivedCoreProperties.txt',   'Alphabetic',                   1),
+    ('DerivedCoreProperties.txt',   'Lowercase',                    2),
+    ('DerivedCoreProperties.txt',   'Uppercase',                    3),
+    ('PropList.txt',                'Ideographic',                  4),
+    ('emoji-data.txt',              'Extended_Pictographic',        5),
+    ('DerivedCoreProperties.txt',   'Default_Ignorable_Code_Point', 6),
+]
+
+# Grapheme cluster break classes, numbered as in unicode.c. Extended_Pictographic codepoints are all
+#   Other, so they get a class of their own.
+GRAPHEME_CLASSES = [
+    'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark',
+    'L', 'V', 'T', 'LV', 'LVT', 'Extended_Pictographic',
+]
+
+# Word break classes, numbered as in unicode.c. Letters and numbers which are Other (like Han, Hiragana
+#   and Thai) get a class of their own, since they make up words too. Extended_Pictographic is a flag.
+WORD_CLASSES = [
+    'Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator', 'Format', 'Katakana',
+    'Hebrew_Letter', 'ALetter', 'Single_Quote', 'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum',
+    'Numeric', 'ExtendNumLet', 'WSegSpace', 'Other_Letter',
+]
+WORD_EXTENDED_PICTOGRAPHIC = 0x20
+
+# Line break classes, numbered as in unicode.c, after the resolution of LB1: AI, SG and XX are AL, SA
+#   is CM for marks and AL otherwise, and CJ is NS. OP and CP which are East Asian wide get a flag (for
+#   LB30), and so do unassigned Extended_Pictographic codepoints (for LB30b).
+LINE_CLASSES = [
+    'AL', 'BK', 'CR', 'LF', 'NL', 'SP', 'ZW', 'ZWJ', 'CM', 'WJ', 'GL', 'BA', 'HY', 'BB', 'B2', 'CB', 'CL',
+    'CP', 'EX', 'IS', 'SY', 'OP', 'QU', 'NS', 'IN', 'HL', 'NU', 'PR', 'PO', 'ID', 'EB', 'EM', 'JL', 'JV',
+    'JT', 'H2', 'H3', 'RI',
+]
+LINE_RESOLVED = {'AI': 'AL', 'SG': 'AL', 'XX': 'AL', 'CJ': 'NS'}
+LINE_WIDE = 0x40
+LINE_RESERVED_PICTOGRAPHIC = 0x80
+
+# Codepoints which take no columns of a terminal besides nonspacing and enclosing marks (Mn and Me) and
+#   format chars (which aren't soft hyphens): the Hangul vowels and trailing consonants which join a
+#   leading consonant. Spacing marks (Mc) take a column like any other char.
+ZERO_WIDTH_RANGES = [range(0x1160, 0x1200), range(0xD7B0, 0xD800)]
+
+# Read the (first, last, fields) entries of a UCD file, skipping comments.
+def read_ucd(name):
+    with open(os.path.join(UCD_DIR, name), encoding='utf-8') as ucd:
+        for line in ucd:
+            line = line.split('#', 1)[0].strip()
+
+            if not line:
+                continue
+
+            fields = [field.strip() for field in line.split(';')]
+            first, _, last = fields[0].partition('..')
+
+            yield int(first, 16), int(last or first, 16), fields[1:]
+
+def load_enumerated(name, default):
+    values = [default] * CODEPOINT_COUNT
+
+    for first, last, fields in read_ucd(name):
+        values[first:last + 1] = [fields[0]] * (last - first + 1)
+
+    return values
+
+# Read the simple and full case foldings of every codepoint which has them. Turkic foldings are skipped.
+def load_casefolding(name):
+    simple, full = {}, {}
+
+    for codepoint, _, fields in read_ucd(name):
+        status, mapping = fields[0], [int(value, 16) for value in fields[1].split()]
+
+        if status in ('C', 'S'):
+            simple[codepoint] = mapping[0]
+
+        if status in ('C', 'F'):
+            full[codepoint] = mapping
+
+    return simple, full
+
+# Read the canonical combining classes and canonical decompositions from UnicodeData.txt.
+# Compatibility decompositions (tagged like <compat>) aren't needed for NFC and NFD.
+def load_canonical(name):
+    classes, decompositions = [0] * CODEPOINT_COUNT, {}
+
+    for codepoint, _, fields in read_ucd(name):
+        classes[codepoint] = int(fields[2])
+
+        if fields[4] and not fields[4].startswith('<'):
+            decompositions[codepoint] = [int(value, 16) for value in fields[4].split()]
+
+    return classes, decompositions
+
+def load_binary(name, prop):
+    values = [False] * CODEPOINT_COUNT
+
+    for first, last, fields in read_ucd(name):
+        if fields[0] == prop:
+            values[first:last + 1] = [True] * (last - first + 1)
+
+    return values
+
+# Split a table of values into three stages, sharing identical blocks.
+# stage1[cp >> (bits2 + bits3)] picks a block of stage2, and stage2 picks a block of stage3 holding the value.
+def split_stages(values, bits2, bits3):
+    def share(items, size):
+        blocks, index = {}, []
+
+        for i in range(0, len(items), size):
+            block = tuple(items[i:i + size])
+            index.append(blocks.setdefault(block, len(blocks)))
+
+        return [value for block in blocks for value in block], index
+
+    stage3, blocks3 = share(values, 1 << bits3)
+    stage2, stage1 = share(blocks3, 1 << bits2)
+
+    return stage1, stage2, stage3
+
+def ctype_for(values):
+    return 'uint8_t' if max(values) < 0x100 else 'uint16_t'
+
+def table_size(values):
+    return len(values) * (1 if max(values) < 0x100 else 2)
+
+# Find the smallest three stage split of a table.
+def best_split(values):
+    splits = [(bits2, bits3) for bits2 in range(3, 9) for bits3 in range(3, 9)]
+
+    return min(splits, key=lambda bits: sum(table_size(stage) for stage in split_stages(values, *bits)))
+
+def emit_array(out, ctype, name, values, per_line, digits):
+    out.write('static const %s %s[%d] = {\n' % (ctype, name, len(values)))
+
+    for i in range(0, len(values), per_line):
+        out.write('    ' + ', '.join('0x%0*X' % (digits, v) for v in values[i:i + per_line]) + ',\n')
+
+    out.write('};\n\n')
+
+# Emit a three stage table as NAME_STAGE1/2/3, with NAME_BITS2/3 giving the block sizes for __ucd_lookup.
+def emit_stages(out, name, values):
+    bits2, bits3 = best_split(values)
+    stage1, stage2, stage3 = split_stages(values, bits2, bits3)
+
+    out.write('#define %s_BITS2 %d\n' % (name, bits2))
+    out.write('#define %s_BITS3 %d\n\n' % (name, bits3))
+
+    for suffix, stage in (('_STAGE1', stage1), ('_STAGE2', stage2), ('_STAGE3', stage3)):
+        ctype = ctype_for(stage)
+        emit_array(out, ctype, name + suffix, stage, 16 if ctype == 'uint8_t' else 12, 2 if ctype == 'uint8_t' else 4)
+
+# Hangul syllables are decomposed and composed algorithmically, but their quick check values are needed.
+HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+HANGUL_VOWELS_AND_TRAILING = list(range(0x1161, 0x1176)) + list(range(0x11A8, 0x11C3))
+
+# Quick check flags, as in unicode.c. The last marks codepoints which may be reordered or composed
+#   with the one before them, so normalization can't restart at them.
+NFD_NO, NFC_NO, NFC_MAYBE, JOINS_PREVIOUS = 1, 2, 4, 8
+
+def emit_normalization(out):
+    classes, decompositions = load_canonical('UnicodeData.txt')
+    exclusions = {codepoint for codepoint, _, _ in read_ucd('CompositionExclusions.txt')}
+
+    def decompose(codepoint):
+        if codepoint not in decompositions:
+            return [codepoint]
+
+        return [value for part in decompositions[codepoint] for value in decompose(part)]
+
+    # Singletons and decompositions starting with a non-starter are never composed either.
+    compositions = {}
+
+    for codepoint, mapping in decompositions.items():
+        if codepoint in exclusions or len(mapping) == 1 or classes[codepoint] or classes[mapping[0]]:
+            continue
+
+        compositions.setdefault(mapping[0], []).append((mapping[1], codepoint))
+
+    composites = {composite for pairs in compositions.values() for _, composite in pairs}
+    flags = [0] * CODEPOINT_COUNT
+
+    for codepoint in decompositions:
+        flags[codepoint] |= NFD_NO
+
+        if codepoint not in composites:
+            flags[codepoint] |= NFC_NO
+
+    for pairs in compositions.values():
+        for second, _ in pairs:
+            flags[second] |= NFC_MAYBE
+
+    for codepoint in HANGUL_SYLLABLES:
+        flags[codepoint] |= NFD_NO
+
+    for codepoint in HANGUL_VOWELS_AND_TRAILING:
+        flags[codepoint] |= NFC_MAYBE
+
+    for codepoint in range(CODEPOINT_COUNT):
+        if classes[codepoint] or classes[decompose(codepoint)[0]] or flags[codepoint] & NFC_MAYBE:
+            flags[codepoint] |= JOINS_PREVIOUS
+
+    # Full decompositions and the compositions starting with each codepoint are stored in flat tables.
+    decomposition_table, composition_table = [], []
+    records = {(0, 0, 0, 0, 0, 0): 0}
+    indexes = []
+
+    for codepoint in range(CODEPOINT_COUNT):
+        decomposition, composition = 0, 0
+        decomposition_length, composition_count = 0, 0
+
+        if codepoint in decompositions:
+            decomposition = len(decomposition_table)
+            decomposition_table += decompose(codepoint)
+            decomposition_length = len(decomposition_table) - decomposition
+
+        if codepoint in compositions:
+            composition = len(composition_table)
+            composition_table += sorted(compositions[codepoint])
+            composition_count = len(composition_table) - composition
+
+        record = (classes[codepoint], flags[codepoint], decomposition_length, composition_count, decomposition, composition)
+        indexes.append(records.setdefault(record, len(records)))
+
+    out.write('static const struct {\n')
+    out.write('    uint8_t combining_class; uint8_t flags; uint8_t decomposition_length; uint8_t composition_count;\n')
+    out.write('    uint16_t decomposition; uint16_t composition;\n')
+    out.write('} UCD_NORMALIZATION_RECORDS[%d] = {\n' % len(records))
+
+    for record in records:
+        out.write('    { %3d, %2d, %d, %2d, %4d, %3d },\n' % record)
+
+    out.write('};\n\n')
+
+    out.write('// Full canonical decompositions, indexed by the records.\n')
+    emit_array(out, 'unipoint_t', 'UCD_DECOMPOSITIONS', decomposition_table, 8, 5)
+
+    out.write('// Canonical compositions, as (second codepoint, composite) pairs indexed by the records of first codepoints.\n')
+    out.write('static const unipoint_t UCD_COMPOSITIONS[%d][2] = {\n' % len(composition_table))
+
+    for second, composite in composition_table:
+        out.write('    { 0x%04X, 0x%04X },\n' % (second, composite))
+
+    out.write('};\n\n')
+
+    emit_stages(out, 'UCD_NORMALIZATION', indexes)
+
+def main():
+    out = io.StringIO()
+
+    title = '/* -*- ucd.h -*- Unicode character property tables (generated) -*- */'
+    bar = '/* ' + '*' * (len(title) - 6) + ' */'
+
+    out.write(bar + '\n' + title + '\n' + bar + '\n\n')
+    out.write('// Generated by tables/gen_ucd.py from the Unicode Character Database files in tables/ucd. Do not edit.\n\n')
+
+    categories = load_enumerated('DerivedGeneralCategory.txt', 'Cn')
+    scripts = load_enumerated('Scripts.txt', 'Unknown')
+    binaries = [(load_binary(name, prop), bit) for name, prop, bit in BINARY_PROPERTIES]
+
+    script_names = FIXED_SCRIPTS + sorted(set(scripts) - set(FIXED_SCRIPTS))
+    script_numbers = {name: i for i, name in enumerate(script_names)}
+    category_numbers = {name: i for i, name in enumerate(CATEGORIES)}
+
+    # Every distinct combination of properties gets a record. Codepoints index the records.
+    records = {(0, 0, 0): 0}
+    indexes = []
+
+    for codepoint in range(CODEPOINT_COUNT):
+        flags = 0
+
+        for values, bit in binaries:
+            if values[codepoint]:
+                flags |= 1 << bit
+
+        record = (category_numbers[categories[codepoint]], script_numbers[scripts[codepoint]], flags)
+        indexes.append(records.setdefault(record, len(records)))
+
+    out.write('static const unicode_properties_t UCD_PROPERTY_RECORDS[%d] = {\n' % len(records))
+
+    for category, script, flags in records:
+        out.write('    { %2d, %3d, 0x%02X },\n' % (category, script, flags))
+
+    out.write('};\n\n')
+
+    out.write('// Records for ASCII, without going through the stages.\n')
+    emit_array(out, ctype_for(indexes[:0x80]), 'UCD_PROPERTY_ASCII', indexes[:0x80], 16, 2)
+
+    emit_stages(out, 'UCD_PROPERTY', indexes)
+
+    out.write('static const char *UCD_SCRIPT_NAMES[%d] = {\n' % len(script_names))
+
+    for name in script_names:
+        out.write('    "%s",\n' % name)
+
+    out.write('};\n\n')
+
+    # Case folding records hold the difference between a codepoint and its simple folding, and the
+    #   number + 1 of its full folding in UCD_CASEFOLD_FULL when that isn't a single codepoint.
+    simple, full = load_casefolding('CaseFolding.txt')
+    expansions = sorted(codepoint for codepoint, mapping in full.items() if len(mapping) > 1)
+    expansion_numbers = {codepoint: i + 1 for i, codepoint in enumerate(expansions)}
+
+    records = {(0, 0): 0}
+    indexes = []
+
+    for codepoint in range(CODEPOINT_COUNT):
+        record = (simple.get(codepoint, codepoint) - codepoint, expansion_numbers.get(codepoint, 0))
+        indexes.append(records.setdefault(record, len(records)))
+
+    out.write('static const struct { int32_t delta; uint8_t full; } UCD_CASEFOLD_RECORDS[%d] = {\n' % len(records))
+
+    for delta, number in records:
+        out.write('    { %6d, %3d },\n' % (delta, number))
+
+    out.write('};\n\n')
+
+    out.write('// Full foldings to more than one codepoint, padded with zeros.\n')
+    out.write('static const unipoint_t UCD_CASEFOLD_FULL[%d][3] = {\n' % len(expansions))
+
+    for codepoint in expansions:
+        mapping = full[codepoint] + [0] * (3 - len(full[codepoint]))
+        out.write('    { ' + ', '.join('0x%04X' % value for value in mapping) + ' },\n')
+
+    out.write('};\n\n')
+
+    emit_stages(out, 'UCD_CASEFOLD', indexes)
+
+    emit_normalization(out)
+
+    graphemes = load_enumerated('GraphemeBreakProperty.txt', 'Other')
+
+    for codepoint, pictographic in enumerate(load_binary('emoji-data.txt', 'Extended_Pictographic')):
+        if pictographic:
+            assert graphemes[codepoint] == 'Other'
+            graphemes[codepoint] = 'Extended_Pictographic'
+
+    grapheme_numbers = {name: i for i, name in enumerate(GRAPHEME_CLASSES)}
+    emit_stages(out, 'UCD_GRAPHEME', [grapheme_numbers[name] for name in graphemes])
+
+    words = load_enumerated('WordBreakProperty.txt', 'Other')
+    word_numbers = {name: i for i, name in enumerate(WORD_CLASSES)}
+    word_values = []
+
+    for codepoint, name in enumerate(words):
+        if name == 'Other' and categories[codepoint][0] in 'LN':
+            name = 'Other_Letter'
+
+        word_values.append(word_numbers[name] | (WORD_EXTENDED_PICTOGRAPHIC if graphemes[codepoint] == 'Extended_Pictographic' else 0))
+
+    emit_stages(out, 'UCD_WORD', word_values)
+
+    lines = load_enumerated('LineBreak.txt', 'XX')
+    widths = load_enumerated('EastAsianWidth.txt', 'N')
+    line_numbers = {name: i for i, name in enumerate(LINE_CLASSES)}
+    line_values = []
+
+    for codepoint, name in enumerate(lines):
+        if name == 'SA':
+            name = ('CM' if categories[codepoint] in ('Mn', 'Mc') else 'AL')
+
+        value = line_numbers[LINE_RESOLVED.get(name, name)]
+
+        if name in ('OP', 'CP') and widths[codepoint] in ('F', 'W', 'H'):
+            value |= LINE_WIDE
+
+        if graphemes[codepoint] == 'Extended_Pictographic' and categories[codepoint] == 'Cn':
+            value |= LINE_RESERVED_PICTOGRAPHIC
+
+        line_values.append(value)
+
+    emit_stages(out, 'UCD_LINE', line_values)
+
+    # Display widths are 0, 1 or 2 columns. Nonspacing and enclosing marks and controls are 0, and
+    #   spacing marks and ambiguous codepoints are 1.
+    display_widths = []
+
+    for codepoint, category in enumerate(categories):
+        if (category in ('Mn', 'Me', 'Cc') or (category == 'Cf' and codepoint != 0xAD) or
+                any(codepoint in zero_width for zero_width in ZERO_WIDTH_RANGES)):
+            display_widths.append(0)
+        else:
+            display_widths.append(2 if widths[codepoint] in ('W', 'F') else 1)
+
+    emit_stages(out, 'UCD_WIDTH', display_widths)
+
+    sys.stdout.write(out.getvalue().rstrip('\n') + '\n')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,10300 @@
+/* *************************************************************** */
+/* -*- ucd.h -*- Unicode character property tables (generated) -*- */
+/* *************************************************************** */
+
+// Generated by tables/gen_ucd.py from the Unicode Character Database files in tables/ucd. Do not edit.
+
+static const unicode_properties_t UCD_PROPERTY_RECORDS[727] = {
+    {  0,   0, 0x00 },
+    { 26,   1, 0x00 },
+    { 26,   1, 0x01 },
+    { 23,   1, 0x01 },
+    { 18,   1, 0x00 },
+    { 20,   1, 0x00 },
+    { 14,   1, 0x00 },
+    { 15,   1, 0x00 },
+    { 19,   1, 0x00 },
+    { 13,   1, 0x00 },
+    {  9,   1, 0x00 },
+    {  1,  70, 0x0A },
+    { 21,   1, 0x00 },
+    { 12,   1, 0x00 },
+    {  2,  70, 0x06 },
+    { 22,   1, 0x00 },
+    { 22,   1, 0x20 },
+    {  5,  70, 0x06 },
+    { 16,   1, 0x00 },
+    { 27,   1, 0x40 },
+    { 11,   1, 0x00 },
+    {  2,   1, 0x06 },
+    { 17,   1, 0x00 },
+    {  5,  70, 0x02 },
+    {  3,  70, 0x02 },
+    {  4,  70, 0x06 },
+    {  4,   1, 0x02 },
+    {  4,   1, 0x06 },
+    { 21,  15, 0x00 },
+    {  6,   2, 0x00 },
+    {  6,   2, 0x06 },
+    {  6,   2, 0x40 },
+    {  1,  45, 0x0A },
+    {  2,  45, 0x06 },
+    { 21,  45, 0x00 },
+    {  4,  45, 0x06 },
+    {  1,  27, 0x0A },
+    {  2,  27, 0x06 },
+    { 19,  45, 0x00 },
+    {  1,  31, 0x0A },
+    {  2,  31, 0x06 },
+    { 22,  31, 0x00 },
+    {  6,  31, 0x00 },
+    {  8,  31, 0x00 },
+    {  1,   7, 0x0A },
+    {  4,   7, 0x02 },
+    { 18,   7, 0x00 },
+    {  2,   7, 0x06 },
+    { 13,   7, 0x00 },
+    { 22,   7, 0x00 },
+    { 20,   7, 0x00 },
+    {  6,  54, 0x00 },
+    {  6,  54, 0x02 },
+    { 13,  54, 0x00 },
+    { 18,  54, 0x00 },
+    {  5,  54, 0x02 },
+    { 27,   6, 0x00 },
+    { 27,   1, 0x00 },
+    { 19,   6, 0x00 },
+    { 18,   6, 0x00 },
+    { 20,   6, 0x00 },
+    { 22,   6, 0x00 },
+    {  6,   6, 0x02 },
+    { 27,   6, 0x40 },
+    {  5,   6, 0x02 },
+    {  6,   2, 0x02 },
+    {  6,   6, 0x00 },
+    {  9,   6, 0x00 },
+    {  4,   6, 0x02 },
+    { 18, 137, 0x00 },
+    { 27, 137, 0x00 },
+    {  5, 137, 0x02 },
+    {  6, 137, 0x02 },
+    {  6, 137, 0x00 },
+    {  5, 148, 0x02 },
+    {  6, 148, 0x02 },
+    {  9, 100, 0x00 },
+    {  5, 100, 0x02 },
+    {  6, 100, 0x00 },
+    {  4, 100, 0x02 },
+    { 22, 100, 0x00 },
+    { 18, 100, 0x00 },
+    { 20, 100, 0x00 },
+    {  5, 125, 0x02 },
+    {  6, 125, 0x02 },
+    {  6, 125, 0x00 },
+    {  4, 125, 0x02 },
+    { 18, 125, 0x00 },
+    {  5,  81, 0x02 },
+    {  6,  81, 0x00 },
+    { 18,  81, 0x00 },
+    { 21,   6, 0x00 },
+    {  6,  33, 0x02 },
+    {  7,  33, 0x02 },
+    {  5,  33, 0x02 },
+    {  6,  33, 0x00 },
+    {  9,  33, 0x00 },
+    { 18,  33, 0x00 },
+    {  4,  33, 0x02 },
+    {  5,  13, 0x02 },
+    {  6,  13, 0x02 },
+    {  7,  13, 0x02 },
+    {  6,  13, 0x00 },
+    {  9,  13, 0x00 },
+    { 20,  13, 0x00 },
+    { 11,  13, 0x00 },
+    { 22,  13, 0x00 },
+    { 18,  13, 0x00 },
+    {  6,  48, 0x02 },
+    {  7,  48, 0x02 },
+    {  5,  48, 0x02 },
+    {  6,  48, 0x00 },
+    {  9,  48, 0x00 },
+    { 18,  48, 0x00 },
+    {  6,  46, 0x02 },
+    {  7,  46, 0x02 },
+    {  5,  46, 0x02 },
+    {  6,  46, 0x00 },
+    {  9,  46, 0x00 },
+    { 18,  46, 0x00 },
+    { 20,  46, 0x00 },
+    {  6, 114, 0x02 },
+    {  7, 114, 0x02 },
+    {  5, 114, 0x02 },
+    {  6, 114, 0x00 },
+    {  9, 114, 0x00 },
+    { 22, 114, 0x00 },
+    { 11, 114, 0x00 },
+    {  6, 144, 0x02 },
+    {  5, 144, 0x02 },
+    {  7, 144, 0x02 },
+    {  6, 144, 0x00 },
+    {  9, 144, 0x00 },
+    { 11, 144, 0x00 },
+    { 22, 144, 0x00 },
+    { 20, 144, 0x00 },
+    {  6, 147, 0x02 },
+    {  7, 147, 0x02 },
+    {  6, 147, 0x00 },
+    {  5, 147, 0x02 },
+    {  9, 147, 0x00 },
+    { 18, 147, 0x00 },
+    { 11, 147, 0x00 },
+    { 22, 147, 0x00 },
+    {  5,  61, 0x02 },
+    {  6,  61, 0x02 },
+    {  7,  61, 0x02 },
+    { 18,  61, 0x00 },
+    {  6,  61, 0x00 },
+    {  9,  61, 0x00 },
+    {  6,  80, 0x02 },
+    {  7,  80, 0x02 },
+    {  5,  80, 0x02 },
+    {  6,  80, 0x00 },
+    { 22,  80, 0x00 },
+    { 11,  80, 0x00 },
+    {  9,  80, 0x00 },
+    {  6, 131, 0x02 },
+    {  7, 131, 0x02 },
+    {  5, 131, 0x02 },
+    {  6, 131, 0x00 },
+    {  9, 131, 0x00 },
+    { 18, 131, 0x00 },
+    {  5, 149, 0x02 },
+    {  6, 149, 0x02 },
+    {  4, 149, 0x02 },
+    {  6, 149, 0x00 },
+    { 18, 149, 0x00 },
+    {  9, 149, 0x00 },
+    {  5,  69, 0x02 },
+    {  6,  69, 0x02 },
+    {  6,  69, 0x00 },
+    {  4,  69, 0x02 },
+    {  9,  69, 0x00 },
+    {  5, 150, 0x02 },
+    { 22, 150, 0x00 },
+    { 18, 150, 0x00 },
+    {  6, 150, 0x00 },
+    {  9, 150, 0x00 },
+    { 11, 150, 0x00 },
+    { 14, 150, 0x00 },
+    { 15, 150, 0x00 },
+    {  7, 150, 0x00 },
+    {  6, 150, 0x02 },
+    {  7, 150, 0x02 },
+    {  5,  95, 0x02 },
+    {  7,  95, 0x02 },
+    {  6,  95, 0x02 },
+    {  6,  95, 0x00 },
+    {  9,  95, 0x00 },
+    { 18,  95, 0x00 },
+    { 22,  95, 0x00 },
+    {  1,  41, 0x0A },
+    {  2,  41, 0x06 },
+    {  4,  41, 0x02 },
+    {  5,  50, 0x02 },
+    {  5,  50, 0x42 },
+    {  5,  40, 0x02 },
+    {  6,  40, 0x00 },
+    { 18,  40, 0x00 },
+    { 11,  40, 0x00 },
+    { 22,  40, 0x00 },
+    {  1,  25, 0x0A },
+    {  2,  25, 0x06 },
+    { 13,  20, 0x00 },
+    {  5,  20, 0x02 },
+    { 22,  20, 0x00 },
+    { 18,  20, 0x00 },
+    { 23, 103, 0x01 },
+    {  5, 103, 0x02 },
+    { 14, 103, 0x00 },
+    { 15, 103, 0x00 },
+    {  5, 124, 0x02 },
+    { 10, 124, 0x02 },
+    {  5, 138, 0x02 },
+    {  6, 138, 0x02 },
+    {  6, 138, 0x00 },
+    {  7, 138, 0x00 },
+    {  5,  52, 0x02 },
+    {  6,  52, 0x02 },
+    {  7,  52, 0x00 },
+    {  5,  19, 0x02 },
+    {  6,  19, 0x02 },
+    {  5, 139, 0x02 },
+    {  6, 139, 0x02 },
+    {  5,  66, 0x02 },
+    {  6,  66, 0x40 },
+    {  7,  66, 0x02 },
+    {  6,  66, 0x02 },
+    {  6,  66, 0x00 },
+    { 18,  66, 0x00 },
+    {  4,  66, 0x02 },
+    { 20,  66, 0x00 },
+    {  9,  66, 0x00 },
+    { 11,  66, 0x00 },
+    { 18,  92, 0x00 },
+    { 13,  92, 0x00 },
+    {  6,  92, 0x40 },
+    { 27,  92, 0x40 },
+    {  9,  92, 0x00 },
+    {  5,  92, 0x02 },
+    {  4,  92, 0x02 },
+    {  6,  92, 0x02 },
+    {  5,  72, 0x02 },
+    {  6,  72, 0x02 },
+    {  7,  72, 0x02 },
+    {  6,  72, 0x00 },
+    { 22,  72, 0x00 },
+    { 18,  72, 0x00 },
+    {  9,  72, 0x00 },
+    {  5, 140, 0x02 },
+    {  5,  98, 0x02 },
+    {  9,  98, 0x00 },
+    { 11,  98, 0x00 },
+    { 22,  98, 0x00 },
+    { 22,  66, 0x00 },
+    {  5,  18, 0x02 },
+    {  6,  18, 0x02 },
+    {  7,  18, 0x02 },
+    { 18,  18, 0x00 },
+    {  5, 141, 0x02 },
+    {  7, 141, 0x02 },
+    {  6, 141, 0x02 },
+    {  6, 141, 0x00 },
+    {  9, 141, 0x00 },
+    { 18, 141, 0x00 },
+    {  4, 141, 0x02 },
+    {  8,   2, 0x00 },
+    {  6,   9, 0x02 },
+    {  7,   9, 0x02 },
+    {  5,   9, 0x02 },
+    {  6,   9, 0x00 },
+    {  7,   9, 0x00 },
+    {  9,   9, 0x00 },
+    { 18,   9, 0x00 },
+    { 22,   9, 0x00 },
+    {  6, 135, 0x02 },
+    {  7, 135, 0x02 },
+    {  5, 135, 0x02 },
+    {  7, 135, 0x00 },
+    {  6, 135, 0x00 },
+    {  9, 135, 0x00 },
+    {  5,  12, 0x02 },
+    {  6,  12, 0x00 },
+    {  7,  12, 0x02 },
+    {  6,  12, 0x02 },
+    {  7,  12, 0x00 },
+    { 18,  12, 0x00 },
+    {  5,  71, 0x02 },
+    {  7,  71, 0x02 },
+    {  6,  71, 0x02 },
+    {  6,  71, 0x00 },
+    { 18,  71, 0x00 },
+    {  9,  71, 0x00 },
+    {  9, 104, 0x00 },
+    {  5, 104, 0x02 },
+    {  4, 104, 0x02 },
+    { 18, 104, 0x00 },
+    { 18, 135, 0x00 },
+    {  7,   1, 0x00 },
+    {  5,   1, 0x02 },
+    {  4,  31, 0x06 },
+    {  3,  45, 0x02 },
+    { 27,   2, 0x40 },
+    { 24,   1, 0x01 },
+    { 25,   1, 0x01 },
+    { 18,   1, 0x20 },
+    {  0,   0, 0x40 },
+    {  1,   1, 0x0A },
+    {  2,   1, 0x26 },
+    { 10,  70, 0x0A },
+    { 10,  70, 0x06 },
+    { 10,  70, 0x02 },
+    { 19,   1, 0x20 },
+    { 22,   1, 0x0A },
+    { 22,   1, 0x2A },
+    { 22,   1, 0x06 },
+    { 22,  17, 0x00 },
+    {  1,  42, 0x0A },
+    {  2,  42, 0x06 },
+    { 22,  27, 0x00 },
+    {  6,  27, 0x00 },
+    { 18,  27, 0x00 },
+    { 11,  27, 0x00 },
+    {  5, 151, 0x02 },
+    {  4, 151, 0x02 },
+    { 18, 151, 0x00 },
+    {  6, 151, 0x00 },
+    {  6,  31, 0x02 },
+    { 22,  49, 0x00 },
+    {  4,  49, 0x02 },
+    {  5,   1, 0x12 },
+    { 10,  49, 0x12 },
+    {  7,  50, 0x00 },
+    { 13,   1, 0x20 },
+    {  5,  55, 0x02 },
+    {  4,  55, 0x02 },
+    {  5,  62, 0x02 },
+    {  4,  62, 0x02 },
+    {  5,  15, 0x02 },
+    { 22,  50, 0x00 },
+    { 22,  62, 0x00 },
+    {  5,  49, 0x12 },
+    {  5, 160, 0x02 },
+    {  4, 160, 0x02 },
+    { 22, 160, 0x00 },
+    {  5,  75, 0x02 },
+    {  4,  75, 0x02 },
+    { 18,  75, 0x00 },
+    {  5, 155, 0x02 },
+    {  4, 155, 0x02 },
+    { 18, 155, 0x00 },
+    {  9, 155, 0x00 },
+    {  5,  31, 0x02 },
+    { 18,  31, 0x00 },
+    {  4,  31, 0x02 },
+    {  5,  10, 0x02 },
+    { 10,  10, 0x02 },
+    {  6,  10, 0x00 },
+    { 18,  10, 0x00 },
+    {  4,  70, 0x02 },
+    {  5, 136, 0x02 },
+    {  6, 136, 0x02 },
+    {  6, 136, 0x00 },
+    {  7, 136, 0x02 },
+    { 22, 136, 0x00 },
+    {  5, 120, 0x02 },
+    { 18, 120, 0x00 },
+    {  7, 126, 0x02 },
+    {  5, 126, 0x02 },
+    {  6, 126, 0x00 },
+    {  6, 126, 0x02 },
+    { 18, 126, 0x00 },
+    {  9, 126, 0x00 },
+    {  9,  63, 0x00 },
+    {  5,  63, 0x02 },
+    {  6,  63, 0x02 },
+    {  6,  63, 0x00 },
+    { 18,  63, 0x00 },
+    {  5, 123, 0x02 },
+    {  6, 123, 0x02 },
+    {  7, 123, 0x02 },
+    {  7, 123, 0x00 },
+    { 18, 123, 0x00 },
+    {  6,  59, 0x02 },
+    {  7,  59, 0x02 },
+    {  5,  59, 0x02 },
+    {  6,  59, 0x00 },
+    {  7,  59, 0x00 },
+    { 18,  59, 0x00 },
+    {  9,  59, 0x00 },
+    {  4,  95, 0x02 },
+    {  5,  24, 0x02 },
+    {  6,  24, 0x02 },
+    {  7,  24, 0x02 },
+    {  9,  24, 0x00 },
+    { 18,  24, 0x00 },
+    {  5, 142, 0x02 },
+    {  6, 142, 0x02 },
+    {  6, 142, 0x00 },
+    {  4, 142, 0x02 },
+    { 18, 142, 0x00 },
+    {  5,  86, 0x02 },
+    {  7,  86, 0x02 },
+    {  6,  86, 0x02 },
+    { 18,  86, 0x00 },
+    {  4,  86, 0x02 },
+    {  6,  86, 0x00 },
+    {  7,  86, 0x00 },
+    {  9,  86, 0x00 },
+    { 28,   0, 0x00 },
+    { 29,   0, 0x00 },
+    { 19,  54, 0x00 },
+    {  5,  74, 0x02 },
+    { 10,  45, 0x02 },
+    { 11,  45, 0x00 },
+    { 22,  45, 0x00 },
+    {  5,  76, 0x02 },
+    {  5,  21, 0x02 },
+    {  5, 106, 0x02 },
+    { 11, 106, 0x00 },
+    {  5,  43, 0x02 },
+    { 10,  43, 0x02 },
+    {  5, 108, 0x02 },
+    {  6, 108, 0x02 },
+    {  5, 154, 0x02 },
+    { 18, 154, 0x00 },
+    {  5, 109, 0x02 },
+    { 18, 109, 0x00 },
+    { 10, 109, 0x02 },
+    {  1,  32, 0x0A },
+    {  2,  32, 0x06 },
+    {  5, 128, 0x02 },
+    {  5, 116, 0x02 },
+    {  9, 116, 0x00 },
+    {  1, 115, 0x0A },
+    {  2, 115, 0x06 },
+    {  5,  38, 0x02 },
+    {  5,  22, 0x02 },
+    { 18,  22, 0x00 },
+    {  1, 156, 0x0A },
+    {  2, 156, 0x06 },
+    {  5,  73, 0x02 },
+    {  5,  29, 0x02 },
+    {  5,  56, 0x02 },
+    { 18,  56, 0x00 },
+    { 11,  56, 0x00 },
+    {  5, 118, 0x02 },
+    { 22, 118, 0x00 },
+    { 11, 118, 0x00 },
+    {  5,  96, 0x02 },
+    { 11,  96, 0x00 },
+    {  5,  53, 0x02 },
+    { 11,  53, 0x00 },
+    {  5, 121, 0x02 },
+    { 11, 121, 0x00 },
+    { 18, 121, 0x00 },
+    {  5,  77, 0x02 },
+    { 18,  77, 0x00 },
+    {  5,  89, 0x02 },
+    {  5,  88, 0x02 },
+    { 11,  88, 0x00 },
+    {  5,  64, 0x02 },
+    {  6,  64, 0x02 },
+    {  6,  64, 0x00 },
+    { 11,  64, 0x00 },
+    { 18,  64, 0x00 },
+    {  5, 111, 0x02 },
+    { 11, 111, 0x00 },
+    { 18, 111, 0x00 },
+    {  5, 107, 0x02 },
+    { 11, 107, 0x00 },
+    {  5,  82, 0x02 },
+    { 22,  82, 0x00 },
+    {  6,  82, 0x00 },
+    { 11,  82, 0x00 },
+    { 18,  82, 0x00 },
+    {  5,   8, 0x02 },
+    { 18,   8, 0x00 },
+    {  5,  58, 0x02 },
+    { 11,  58, 0x00 },
+    {  5,  57, 0x02 },
+    { 11,  57, 0x00 },
+    {  5, 122, 0x02 },
+    { 18, 122, 0x00 },
+    { 11, 122, 0x00 },
+    {  5, 112, 0x02 },
+    {  1, 105, 0x0A },
+    {  2, 105, 0x06 },
+    { 11, 105, 0x00 },
+    {  5,  51, 0x02 },
+    {  6,  51, 0x02 },
+    {  9,  51, 0x00 },
+    { 11,   6, 0x00 },
+    {  5, 159, 0x02 },
+    {  6, 159, 0x02 },
+    { 13, 159, 0x00 },
+    {  5, 110, 0x02 },
+    { 11, 110, 0x00 },
+    {  5, 132, 0x02 },
+    {  6, 132, 0x00 },
+    { 11, 132, 0x00 },
+    { 18, 132, 0x00 },
+    {  5, 113, 0x02 },
+    {  6, 113, 0x00 },
+    { 18, 113, 0x00 },
+    {  5,  26, 0x02 },
+    { 11,  26, 0x00 },
+    {  5,  39, 0x02 },
+    {  7,  16, 0x02 },
+    {  6,  16, 0x02 },
+    {  5,  16, 0x02 },
+    {  6,  16, 0x00 },
+    { 18,  16, 0x00 },
+    { 11,  16, 0x00 },
+    {  9,  16, 0x00 },
+    {  6,  60, 0x00 },
+    {  7,  60, 0x02 },
+    {  5,  60, 0x02 },
+    {  6,  60, 0x02 },
+    { 18,  60, 0x00 },
+    { 27,  60, 0x00 },
+    {  5, 133, 0x02 },
+    {  9, 133, 0x00 },
+    {  6,  23, 0x02 },
+    {  5,  23, 0x02 },
+    {  7,  23, 0x02 },
+    {  6,  23, 0x00 },
+    {  9,  23, 0x00 },
+    { 18,  23, 0x00 },
+    {  5,  78, 0x02 },
+    {  6,  78, 0x00 },
+    { 18,  78, 0x00 },
+    {  6, 127, 0x02 },
+    {  7, 127, 0x02 },
+    {  5, 127, 0x02 },
+    {  7, 127, 0x00 },
+    { 18, 127, 0x00 },
+    {  6, 127, 0x00 },
+    {  9, 127, 0x00 },
+    { 11, 131, 0x00 },
+    {  5,  67, 0x02 },
+    {  7,  67, 0x02 },
+    {  6,  67, 0x02 },
+    {  7,  67, 0x00 },
+    {  6,  67, 0x00 },
+    { 18,  67, 0x00 },
+    {  5,  94, 0x02 },
+    { 18,  94, 0x00 },
+    {  5,  68, 0x02 },
+    {  6,  68, 0x02 },
+    {  7,  68, 0x02 },
+    {  6,  68, 0x00 },
+    {  9,  68, 0x00 },
+    {  6,  44, 0x02 },
+    {  7,  44, 0x02 },
+    {  5,  44, 0x02 },
+    {  6,  44, 0x00 },
+    {  7,  44, 0x00 },
+    {  5,  99, 0x02 },
+    {  7,  99, 0x02 },
+    {  6,  99, 0x02 },
+    {  6,  99, 0x00 },
+    { 18,  99, 0x00 },
+    {  9,  99, 0x00 },
+    {  5, 152, 0x02 },
+    {  7, 152, 0x02 },
+    {  6, 152, 0x02 },
+    {  6, 152, 0x00 },
+    { 18, 152, 0x00 },
+    {  9, 152, 0x00 },
+    {  5, 129, 0x02 },
+    {  7, 129, 0x02 },
+    {  6, 129, 0x02 },
+    {  6, 129, 0x00 },
+    { 18, 129, 0x00 },
+    {  5,  91, 0x02 },
+    {  7,  91, 0x02 },
+    {  6,  91, 0x02 },
+    {  6,  91, 0x00 },
+    { 18,  91, 0x00 },
+    {  9,  91, 0x00 },
+    {  5, 143, 0x02 },
+    {  6, 143, 0x02 },
+    {  7, 143, 0x02 },
+    {  7, 143, 0x00 },
+    {  6, 143, 0x00 },
+    { 18, 143, 0x00 },
+    {  9, 143, 0x00 },
+    {  5,   4, 0x02 },
+    {  6,   4, 0x02 },
+    {  7,   4, 0x02 },
+    {  6,   4, 0x00 },
+    {  9,   4, 0x00 },
+    { 11,   4, 0x00 },
+    { 18,   4, 0x00 },
+    { 22,   4, 0x00 },
+    {  5,  35, 0x02 },
+    {  7,  35, 0x02 },
+    {  6,  35, 0x02 },
+    {  6,  35, 0x00 },
+    { 18,  35, 0x00 },
+    {  1, 158, 0x0A },
+    {  2, 158, 0x06 },
+    {  9, 158, 0x00 },
+    { 11, 158, 0x00 },
+    {  5, 158, 0x02 },
+    {  5,  34, 0x02 },
+    {  7,  34, 0x02 },
+    {  6,  34, 0x02 },
+    {  7,  34, 0x00 },
+    {  6,  34, 0x00 },
+    { 18,  34, 0x00 },
+    {  9,  34, 0x00 },
+    {  5,  97, 0x02 },
+    {  7,  97, 0x02 },
+    {  6,  97, 0x02 },
+    {  6,  97, 0x00 },
+    { 18,  97, 0x00 },
+    {  5, 161, 0x02 },
+    {  6, 161, 0x02 },
+    {  6, 161, 0x00 },
+    {  7, 161, 0x02 },
+    { 18, 161, 0x00 },
+    {  5, 134, 0x02 },
+    {  6, 134, 0x02 },
+    {  7, 134, 0x02 },
+    {  6, 134, 0x00 },
+    { 18, 134, 0x00 },
+    {  5, 119, 0x02 },
+    {  5,  14, 0x02 },
+    {  7,  14, 0x02 },
+    {  6,  14, 0x02 },
+    {  6,  14, 0x00 },
+    { 18,  14, 0x00 },
+    {  9,  14, 0x00 },
+    { 11,  14, 0x00 },
+    { 18,  83, 0x00 },
+    {  5,  83, 0x02 },
+    {  6,  83, 0x02 },
+    {  7,  83, 0x02 },
+    {  5,  84, 0x02 },
+    {  6,  84, 0x02 },
+    {  6,  84, 0x00 },
+    {  9,  84, 0x00 },
+    {  5,  47, 0x02 },
+    {  7,  47, 0x02 },
+    {  6,  47, 0x02 },
+    {  6,  47, 0x00 },
+    {  9,  47, 0x00 },
+    {  5,  79, 0x02 },
+    {  6,  79, 0x02 },
+    {  7,  79, 0x02 },
+    { 18,  79, 0x00 },
+    { 18, 144, 0x00 },
+    {  5,  28, 0x02 },
+    { 10,  28, 0x02 },
+    { 18,  28, 0x00 },
+    {  5,  30, 0x02 },
+    { 18,  30, 0x00 },
+    {  5,  37, 0x02 },
+    { 27,  37, 0x00 },
+    {  5,   5, 0x02 },
+    {  5,  93, 0x02 },
+    {  9,  93, 0x00 },
+    { 18,  93, 0x00 },
+    {  5, 145, 0x02 },
+    {  9, 145, 0x00 },
+    {  5,  11, 0x02 },
+    {  6,  11, 0x00 },
+    { 18,  11, 0x00 },
+    {  5, 117, 0x02 },
+    {  6, 117, 0x00 },
+    { 18, 117, 0x00 },
+    { 22, 117, 0x00 },
+    {  4, 117, 0x02 },
+    {  9, 117, 0x00 },
+    { 11, 117, 0x00 },
+    {  1,  85, 0x0A },
+    {  2,  85, 0x06 },
+    { 11,  85, 0x00 },
+    { 18,  85, 0x00 },
+    {  5,  90, 0x02 },
+    {  6,  90, 0x02 },
+    {  7,  90, 0x02 },
+    {  4,  90, 0x02 },
+    {  4, 146, 0x02 },
+    {  4, 101, 0x02 },
+    { 18,  49, 0x00 },
+    {  6,  65, 0x10 },
+    {  7,  49, 0x02 },
+    {  5, 146, 0x12 },
+    {  5,  65, 0x12 },
+    {  5, 101, 0x12 },
+    {  5,  36, 0x02 },
+    { 22,  36, 0x00 },
+    {  6,  36, 0x00 },
+    {  6,  36, 0x02 },
+    { 18,  36, 0x00 },
+    {  6,  45, 0x00 },
+    { 22, 130, 0x00 },
+    {  6, 130, 0x00 },
+    { 18, 130, 0x00 },
+    {  6,  42, 0x02 },
+    {  5, 102, 0x02 },
+    {  6, 102, 0x00 },
+    {  4, 102, 0x02 },
+    {  9, 102, 0x00 },
+    { 22, 102, 0x00 },
+    {  5, 153, 0x02 },
+    {  6, 153, 0x00 },
+    {  5, 157, 0x02 },
+    {  6, 157, 0x00 },
+    {  9, 157, 0x00 },
+    { 20, 157, 0x00 },
+    {  5,  87, 0x02 },
+    { 11,  87, 0x00 },
+    {  6,  87, 0x00 },
+    {  1,   3, 0x0A },
+    {  2,   3, 0x06 },
+    {  6,   3, 0x00 },
+    {  6,   3, 0x02 },
+    {  4,   3, 0x02 },
+    {  9,   3, 0x00 },
+    { 18,   3, 0x00 },
+    {  0,   0, 0x20 },
+    { 22,  55, 0x00 },
+};
+
+// Records for ASCII, without going through the stages.
+static const uint8_t UCD_PROPERTY_ASCII[128] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x06, 0x07, 0x04, 0x08, 0x04, 0x09, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x08, 0x08, 0x08, 0x04,
+    0x04, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x06, 0x04, 0x07, 0x0C, 0x0D,
+    0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x08, 0x07, 0x08, 0x01,
+};
+
+#define UCD_PROPERTY_BITS2 5
+#define UCD_PROPERTY_BITS3 3
+
+static const uint8_t UCD_PROPERTY_STAGE1[4352] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x22, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E,
+    0x2F, 0x30, 0x31, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x35, 0x36, 0x36, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x33, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x69, 0x69, 0x6A, 0x6B, 0x6C, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x70, 0x70, 0x71, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x72, 0x72, 0x73, 0x74, 0x64, 0x64, 0x75, 0x76,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x77, 0x77, 0x77, 0x79, 0x7A, 0x7B, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x7C,
+    0x7D, 0x7E, 0x7F, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x80, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8A, 0x8B, 0x64, 0x64, 0x64, 0x64, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x64, 0x64, 0x64, 0x64, 0x90, 0x91, 0x92, 0x64, 0x64, 0x93, 0x94, 0x95, 0x64,
+    0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA2, 0xA2, 0xA3,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA5, 0xA6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA7, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA8, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x33, 0x33, 0xA9, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0xAA, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0xAB, 0xAC, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xAE,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xAE,
+};
+
+static const uint16_t UCD_PROPERTY_STAGE2[5600] = {
+    0x0000, 0x0001, 0x0000, 0x0000, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008,
+    0x0009, 0x000A, 0x000A, 0x000B, 0x000C, 0x0000, 0x0000, 0x0000, 0x000D, 0x000E, 0x000F, 0x0010,
+    0x0007, 0x0007, 0x0011, 0x0012, 0x000A, 0x000A, 0x0013, 0x000A, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0015, 0x0022,
+    0x0014, 0x0014, 0x0023, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0024, 0x0025,
+    0x0026, 0x0014, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0027, 0x000A,
+    0x000A, 0x000A, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x002D, 0x002D,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0032, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003B,
+    0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043,
+    0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045,
+    0x0046, 0x0047, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0048, 0x0049, 0x0045, 0x0045,
+    0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x004A, 0x004B,
+    0x004B, 0x004B, 0x004C, 0x004D, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0051, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0058, 0x0055,
+    0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005D, 0x005D, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x0065, 0x0066, 0x0067, 0x0068, 0x0062, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D,
+    0x006D, 0x006D, 0x006E, 0x006E, 0x006F, 0x0070, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x0071, 0x0071, 0x0071, 0x0071, 0x0072, 0x0073, 0x0074, 0x0055, 0x0075, 0x0076, 0x0077, 0x0077,
+    0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081,
+    0x0082, 0x0082, 0x0082, 0x0083, 0x006D, 0x0084, 0x005D, 0x005D, 0x005D, 0x0085, 0x0086, 0x0087,
+    0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x0088, 0x0089, 0x005B, 0x008A, 0x008B, 0x005B, 0x005B,
+    0x008C, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x008D,
+    0x0092, 0x0093, 0x0094, 0x008D, 0x0095, 0x0096, 0x0097, 0x0098, 0x0098, 0x0099, 0x009A, 0x009B,
+    0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+    0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x0055,
+    0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x0055,
+    0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C3, 0x00C4, 0x00C5, 0x00C6,
+    0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x0055, 0x00CE, 0x00CF, 0x00D0, 0x00D1,
+    0x00D2, 0x00CF, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x0055, 0x00D8, 0x00D9, 0x00DA, 0x00DB,
+    0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00DF, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4,
+    0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00EC, 0x00EB, 0x00ED, 0x00EE,
+    0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x0055, 0x00F6, 0x00F7, 0x00F8, 0x00F9,
+    0x00F9, 0x00F9, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102,
+    0x0103, 0x0104, 0x0105, 0x0106, 0x0104, 0x0104, 0x0107, 0x0108, 0x0105, 0x0109, 0x010A, 0x010B,
+    0x010C, 0x010D, 0x010E, 0x0055, 0x010F, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0111, 0x0112,
+    0x0113, 0x0114, 0x0115, 0x0116, 0x0055, 0x0055, 0x0055, 0x0055, 0x0117, 0x0118, 0x0119, 0x0119,
+    0x011A, 0x0119, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x0129, 0x0129,
+    0x0129, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x012C, 0x0130, 0x0130, 0x0130, 0x0131,
+    0x0132, 0x0133, 0x0134, 0x0135, 0x0055, 0x0055, 0x0055, 0x0055, 0x0136, 0x0136, 0x0136, 0x0136,
+    0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x0140, 0x0136,
+    0x0141, 0x0142, 0x013A, 0x0143, 0x0144, 0x0144, 0x0144, 0x0144, 0x0145, 0x0146, 0x0147, 0x0147,
+    0x0147, 0x0147, 0x0147, 0x0148, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x014A, 0x014B, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014D, 0x014E, 0x014D,
+    0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014D, 0x014C, 0x014C, 0x014C, 0x014C, 0x014D, 0x014E,
+    0x014D, 0x014C, 0x014E, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014D, 0x014C,
+    0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153,
+    0x014C, 0x014C, 0x0154, 0x0155, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015B, 0x015A, 0x015A,
+    0x015C, 0x015D, 0x015D, 0x015E, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F,
+    0x015F, 0x0160, 0x0161, 0x0162, 0x0163, 0x0163, 0x0164, 0x0165, 0x0166, 0x0166, 0x0167, 0x0055,
+    0x0168, 0x0168, 0x0169, 0x0055, 0x016A, 0x016B, 0x016C, 0x0055, 0x016D, 0x016D, 0x016D, 0x016D,
+    0x016D, 0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177,
+    0x0178, 0x0179, 0x017A, 0x017B, 0x017C, 0x017C, 0x017C, 0x017C, 0x017D, 0x017C, 0x017C, 0x017C,
+    0x017C, 0x017C, 0x017C, 0x017E, 0x017F, 0x017C, 0x017C, 0x017C, 0x017C, 0x0180, 0x015A, 0x015A,
+    0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x0181, 0x0055, 0x0182, 0x0182, 0x0182, 0x0183,
+    0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018A, 0x018A, 0x018A, 0x018B, 0x018C, 0x0055,
+    0x018D, 0x018D, 0x018D, 0x018D, 0x018D, 0x018E, 0x018D, 0x018D, 0x018D, 0x018F, 0x0190, 0x0191,
+    0x0192, 0x0192, 0x0192, 0x0192, 0x0193, 0x0193, 0x0194, 0x0195, 0x0196, 0x0196, 0x0196, 0x0196,
+    0x0196, 0x0196, 0x0197, 0x0198, 0x0199, 0x019A, 0x019B, 0x019C, 0x019D, 0x019E, 0x019D, 0x019E,
+    0x019F, 0x01A0, 0x0030, 0x01A1, 0x01A2, 0x01A3, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x01A4, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A6, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x01AB,
+    0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B1, 0x01B1, 0x01B2, 0x01B3, 0x01B4, 0x01B5,
+    0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01BA, 0x01BB, 0x01BB, 0x01BB, 0x01BB,
+    0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C4, 0x01C4, 0x01C4, 0x01C5,
+    0x0044, 0x01C6, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x01C7, 0x01C8, 0x0055, 0x01C9, 0x0030,
+    0x01CA, 0x01CB, 0x01CC, 0x01CD, 0x000A, 0x000A, 0x000A, 0x000A, 0x01CE, 0x01CF, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0028, 0x01D0, 0x01D1, 0x01D2, 0x000A, 0x01D3, 0x000A, 0x000A, 0x000A, 0x01D4,
+    0x0028, 0x0028, 0x0028, 0x01D5, 0x0030, 0x0030, 0x0030, 0x0030, 0x01D6, 0x01D7, 0x01D8, 0x0030,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x01D9, 0x01DA, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x003B, 0x0038, 0x01DB, 0x01DC,
+    0x003B, 0x0038, 0x003B, 0x0038, 0x01DB, 0x01DC, 0x003B, 0x01DD, 0x003B, 0x0038, 0x003B, 0x01DB,
+    0x003B, 0x01DE, 0x003B, 0x01DE, 0x003B, 0x01DE, 0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4,
+    0x003B, 0x01E5, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EC, 0x01EE,
+    0x01EF, 0x01F0, 0x01F1, 0x01F2, 0x01F3, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x0028, 0x01F9,
+    0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FB, 0x0055, 0x0030, 0x01FC, 0x01FD, 0x0030, 0x01FE, 0x0055,
+    0x01FF, 0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x01F7, 0x01F7,
+    0x0209, 0x0209, 0x020A, 0x020A, 0x020B, 0x020C, 0x020D, 0x020E, 0x020F, 0x0210, 0x0211, 0x0211,
+    0x0211, 0x0212, 0x0213, 0x0211, 0x0211, 0x0211, 0x0214, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215,
+    0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215,
+    0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215,
+    0x0215, 0x0215, 0x0215, 0x0215, 0x0211, 0x0216, 0x0211, 0x0217, 0x0218, 0x0219, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x021A, 0x0211, 0x021B, 0x0211, 0x021C,
+    0x0215, 0x0215, 0x021D, 0x0211, 0x0211, 0x021E, 0x0211, 0x0214, 0x0218, 0x021F, 0x0220, 0x0221,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0222, 0x0055, 0x0055, 0x0055, 0x0211, 0x0223, 0x0055, 0x0055,
+    0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x0224, 0x0211, 0x0211, 0x0225, 0x0226,
+    0x0227, 0x0226, 0x0228, 0x0228, 0x0228, 0x0229, 0x01F7, 0x01F7, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0217, 0x022A, 0x0211, 0x022B, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x022C, 0x022D, 0x022E, 0x022F, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0230, 0x022E, 0x022E, 0x0231, 0x0211, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x0231, 0x022E, 0x0232, 0x0233, 0x0234, 0x021B, 0x0235, 0x0211, 0x0236, 0x0237, 0x0238, 0x0211,
+    0x0239, 0x023A, 0x023B, 0x01F7, 0x01F7, 0x01F7, 0x023C, 0x0211, 0x0234, 0x0211, 0x021B, 0x021E,
+    0x023D, 0x0215, 0x0215, 0x0215, 0x023E, 0x023A, 0x0215, 0x0215, 0x023F, 0x023F, 0x023F, 0x023F,
+    0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F,
+    0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F,
+    0x023F, 0x023F, 0x023F, 0x023F, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0240, 0x0215,
+    0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0241, 0x0242, 0x0242, 0x0243,
+    0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0244, 0x0215, 0x0215, 0x0215, 0x0245,
+    0x0246, 0x0211, 0x0211, 0x0235, 0x0211, 0x0211, 0x0215, 0x0215, 0x0247, 0x0248, 0x0249, 0x0211,
+    0x0211, 0x0211, 0x024A, 0x0211, 0x0211, 0x0211, 0x024B, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x024C, 0x024C, 0x024C, 0x024C,
+    0x024C, 0x024C, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024E, 0x024F, 0x0250, 0x0251,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0252, 0x0253, 0x0254, 0x0255, 0x0147, 0x0147, 0x0147, 0x0147, 0x0256, 0x0257, 0x0258, 0x0258,
+    0x0258, 0x0258, 0x0258, 0x0258, 0x0258, 0x0259, 0x025A, 0x025B, 0x014C, 0x014C, 0x014E, 0x0055,
+    0x014E, 0x014E, 0x014E, 0x014E, 0x014E, 0x014E, 0x014E, 0x014E, 0x025C, 0x025C, 0x025C, 0x025C,
+    0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262, 0x01EC, 0x0263, 0x0264, 0x01EC, 0x0265, 0x0266,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0267, 0x0267, 0x0267, 0x0268, 0x0267, 0x0267, 0x0267, 0x0267,
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0269, 0x0055, 0x0267, 0x0267, 0x0267, 0x0267,
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267,
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x026A, 0x0055,
+    0x0055, 0x0055, 0x0211, 0x026B, 0x026C, 0x023A, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272,
+    0x0273, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0275, 0x0276,
+    0x0277, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0279,
+    0x027A, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027C, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x027D, 0x0149, 0x0149, 0x0149, 0x0149, 0x027E, 0x027F, 0x0211, 0x027B, 0x027B, 0x027B, 0x027B,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x026B, 0x0055, 0x0278, 0x0278, 0x0280, 0x0280, 0x0280, 0x0281,
+    0x01F7, 0x0282, 0x0211, 0x0211, 0x0211, 0x01F7, 0x0283, 0x01F7, 0x0280, 0x0280, 0x0280, 0x0284,
+    0x01F7, 0x0282, 0x021E, 0x0234, 0x0211, 0x0211, 0x0283, 0x01F7, 0x0211, 0x0211, 0x0285, 0x0285,
+    0x0285, 0x0285, 0x0285, 0x0286, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285,
+    0x0285, 0x0285, 0x0285, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0288, 0x0288, 0x0289, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+    0x0288, 0x028A, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028C, 0x0055, 0x028D, 0x028D,
+    0x028D, 0x028D, 0x028D, 0x028E, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F,
+    0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F,
+    0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F,
+    0x028F, 0x0290, 0x028F, 0x028F, 0x0291, 0x0292, 0x0055, 0x0055, 0x0045, 0x0045, 0x0045, 0x0045,
+    0x0045, 0x0293, 0x0294, 0x0295, 0x0045, 0x0045, 0x0045, 0x0296, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0298, 0x0299, 0x029A, 0x0055, 0x002D, 0x002D, 0x029B, 0x002B,
+    0x029C, 0x0014, 0x0016, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x029D, 0x029E,
+    0x0014, 0x029F, 0x02A0, 0x0014, 0x0014, 0x02A1, 0x02A2, 0x0014, 0x02A3, 0x02A4, 0x02A5, 0x02A6,
+    0x0055, 0x0055, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF,
+    0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B0, 0x02B1, 0x0055, 0x02B2, 0x02B3, 0x02B3, 0x02B3,
+    0x02B3, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BA, 0x02BB, 0x02BC,
+    0x02BD, 0x02BE, 0x02BF, 0x02BF, 0x02C0, 0x02C1, 0x02C2, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6,
+    0x0149, 0x0149, 0x0149, 0x02C7, 0x02C8, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02CA, 0x02CB,
+    0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x0136, 0x013A, 0x02D1, 0x02D2, 0x02D2, 0x02D2, 0x02D2,
+    0x02D2, 0x02D3, 0x02D4, 0x0055, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x0136, 0x0136, 0x02D9, 0x02DA,
+    0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x0055, 0x0055, 0x02DF,
+    0x02E0, 0x02E1, 0x02E2, 0x0055, 0x02E3, 0x02E3, 0x02E3, 0x0055, 0x014E, 0x014E, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E7, 0x02E7, 0x02E7, 0x02E7, 0x02E7,
+    0x02E7, 0x02E7, 0x02E7, 0x02E7, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E8, 0x02E9, 0x02EA, 0x02EB,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x02EC, 0x0055, 0x0149, 0x0149, 0x027E, 0x02ED, 0x0149, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x02EC, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE,
+    0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE,
+    0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE, 0x02EE,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x02F0, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x02F1,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x02F2, 0x0055, 0x02F3, 0x02F4, 0x0056, 0x02F5, 0x02F6, 0x02F7,
+    0x02F8, 0x0056, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x02F9, 0x02FA, 0x02FB, 0x0055, 0x02FC, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x005D, 0x02FD, 0x02FE, 0x02FE, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x02FF, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x0300, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x005D, 0x0301, 0x0302, 0x0302, 0x0303, 0x0304, 0x0030, 0x0305, 0x0306, 0x0242,
+    0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D,
+    0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x005D, 0x030E,
+    0x030F, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x000A, 0x000A, 0x0310,
+    0x0311, 0x0278, 0x0312, 0x0278, 0x0278, 0x0278, 0x0278, 0x0313, 0x014B, 0x0149, 0x0149, 0x027E,
+    0x0314, 0x0314, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031A, 0x031A,
+    0x031C, 0x031A, 0x031A, 0x031D, 0x031A, 0x031E, 0x031A, 0x031E, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A,
+    0x031A, 0x031A, 0x031A, 0x031F, 0x0320, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x0321, 0x0211,
+    0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0211, 0x0327,
+    0x0328, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0329,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x032A, 0x032A, 0x032A, 0x032B, 0x032C, 0x032C, 0x032C, 0x032C,
+    0x032C, 0x032C, 0x032D, 0x0055, 0x032E, 0x01F7, 0x01F7, 0x032F, 0x0330, 0x0330, 0x0330, 0x0330,
+    0x0331, 0x0332, 0x0333, 0x0333, 0x0334, 0x0335, 0x0336, 0x0336, 0x0336, 0x0336, 0x0337, 0x0338,
+    0x0339, 0x0339, 0x0339, 0x033A, 0x033B, 0x033B, 0x033B, 0x033B, 0x033C, 0x033B, 0x033D, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x033E, 0x033E, 0x033E, 0x033E, 0x033E, 0x033F, 0x033F, 0x033F,
+    0x033F, 0x033F, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0341, 0x0341, 0x0341, 0x0342,
+    0x0343, 0x0344, 0x0345, 0x0345, 0x0345, 0x0345, 0x0346, 0x0347, 0x0347, 0x0347, 0x0347, 0x0348,
+    0x0349, 0x0349, 0x0349, 0x0349, 0x0349, 0x0055, 0x034A, 0x034A, 0x034A, 0x034A, 0x034A, 0x034A,
+    0x034B, 0x034C, 0x034D, 0x034E, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0350, 0x0351, 0x0352,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0353, 0x0353, 0x0353, 0x0353,
+    0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353,
+    0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353,
+    0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0354, 0x0055,
+    0x0353, 0x0353, 0x0355, 0x0055, 0x0353, 0x0055, 0x0055, 0x0055, 0x0356, 0x0028, 0x0028, 0x0028,
+    0x0028, 0x0028, 0x0357, 0x0358, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0359, 0x035A, 0x035B, 0x035B, 0x035B, 0x035B, 0x035C, 0x035D, 0x035E, 0x035E, 0x035F, 0x0360,
+    0x0361, 0x0361, 0x0362, 0x0363, 0x0364, 0x0364, 0x0364, 0x0365, 0x0366, 0x0367, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0368, 0x0368, 0x0369, 0x036A, 0x036B, 0x036B, 0x036C, 0x036D,
+    0x036E, 0x036E, 0x036E, 0x036F, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0371, 0x0371, 0x0371, 0x0372, 0x0373, 0x0373, 0x0374, 0x0373,
+    0x0373, 0x0373, 0x0373, 0x0373, 0x0375, 0x0376, 0x0377, 0x0378, 0x0379, 0x0379, 0x037A, 0x037B,
+    0x037C, 0x037D, 0x037E, 0x037F, 0x0380, 0x0380, 0x0380, 0x0381, 0x0382, 0x0382, 0x0382, 0x0383,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0384, 0x0385, 0x0384, 0x0384, 0x0386, 0x0387, 0x0388, 0x0055,
+    0x0389, 0x0389, 0x0389, 0x0389, 0x0389, 0x0389, 0x038A, 0x038B, 0x038C, 0x038C, 0x038D, 0x038E,
+    0x038F, 0x038F, 0x0390, 0x0391, 0x0392, 0x0392, 0x0393, 0x0394, 0x0055, 0x0395, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0396, 0x0396, 0x0396, 0x0396,
+    0x0396, 0x0396, 0x0396, 0x0396, 0x0396, 0x0397, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x0398, 0x0398, 0x0399, 0x0055, 0x039A, 0x039A, 0x039A, 0x039A,
+    0x039A, 0x039A, 0x039B, 0x039C, 0x039D, 0x039D, 0x039D, 0x039D, 0x039E, 0x0055, 0x039F, 0x03A0,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x03A1, 0x03A1, 0x03A1, 0x03A2, 0x03A3, 0x03A3, 0x03A3, 0x03A3, 0x03A3, 0x03A4, 0x03A5, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x03A6, 0x03A6, 0x03A6, 0x03A7,
+    0x03A8, 0x0055, 0x03A9, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x0055, 0x0055, 0x03AE, 0x03AE,
+    0x03AF, 0x03B0, 0x0055, 0x0055, 0x0055, 0x0055, 0x03B1, 0x03B1, 0x03B2, 0x03B3, 0x0055, 0x0055,
+    0x03B4, 0x03B4, 0x03B5, 0x0055, 0x03B6, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B8,
+    0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C2, 0x03C2,
+    0x03C2, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C7, 0x03C7, 0x03C8, 0x03C9, 0x03CA,
+    0x03CB, 0x03CC, 0x03CC, 0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x0055, 0x03D2, 0x03D2,
+    0x03D2, 0x03D2, 0x03D3, 0x0055, 0x03D4, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D6, 0x03D7,
+    0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x0055, 0x03DF, 0x03DF, 0x03E0, 0x03DF,
+    0x03DF, 0x03E1, 0x03E2, 0x03E3, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E6, 0x03E8, 0x03E9, 0x03E9, 0x03E9, 0x03E9, 0x03E9, 0x03EA,
+    0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F2, 0x03F3, 0x03F4, 0x03F5,
+    0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FB, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402,
+    0x0403, 0x0055, 0x0055, 0x0055, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0405, 0x0406,
+    0x0407, 0x0055, 0x0408, 0x0409, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x040A, 0x040A, 0x040A, 0x040A, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F, 0x040F, 0x0410,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0412, 0x0413,
+    0x0414, 0x0055, 0x0415, 0x0416, 0x0417, 0x0418, 0x0055, 0x0055, 0x0419, 0x0419, 0x0419, 0x0419,
+    0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x041F, 0x041F, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0426, 0x0426, 0x0426, 0x0426,
+    0x0426, 0x0427, 0x0428, 0x0429, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x042A, 0x042A, 0x042A, 0x042A, 0x042B, 0x042B, 0x042B, 0x042B,
+    0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0433, 0x0433, 0x0434, 0x0435,
+    0x0436, 0x0055, 0x0437, 0x0438, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0439, 0x043A, 0x0439, 0x0439, 0x0439, 0x0439, 0x043B, 0x043C, 0x043D, 0x0055, 0x0055, 0x0055,
+    0x043E, 0x043F, 0x0440, 0x0440, 0x0440, 0x0440, 0x0441, 0x0442, 0x0443, 0x0055, 0x0444, 0x0445,
+    0x0446, 0x0446, 0x0446, 0x0446, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x0055, 0x015A, 0x015A,
+    0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x044C, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x044D, 0x044E, 0x044D, 0x044D, 0x044D, 0x044F, 0x0450, 0x0451,
+    0x0452, 0x0055, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0458, 0x0458, 0x0459, 0x045A,
+    0x045A, 0x045B, 0x045C, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x045D, 0x045E, 0x045F, 0x045F, 0x045F, 0x045F, 0x0460, 0x0461, 0x0462, 0x0055, 0x0463, 0x0464,
+    0x0465, 0x0466, 0x0467, 0x0467, 0x0467, 0x0468, 0x0469, 0x046A, 0x046B, 0x046C, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x046D, 0x046D, 0x046E, 0x046F, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0470, 0x0055, 0x0471, 0x0471, 0x0472, 0x0473, 0x0474, 0x0475, 0x0476, 0x0477,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0479, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x047A, 0x047A, 0x047A, 0x047A, 0x047A, 0x047A, 0x047A, 0x047A,
+    0x047A, 0x047A, 0x047A, 0x047A, 0x047A, 0x047B, 0x047C, 0x0055, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x047D, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E,
+    0x047E, 0x047E, 0x047F, 0x0055, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480,
+    0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480,
+    0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480,
+    0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0481, 0x0482, 0x0483, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0484, 0x0484, 0x0484, 0x0484,
+    0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484,
+    0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484,
+    0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484,
+    0x0485, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0486, 0x0487, 0x0487, 0x0487, 0x0488, 0x0489, 0x048A, 0x048B, 0x048B,
+    0x048B, 0x048B, 0x048B, 0x048B, 0x048B, 0x048B, 0x048B, 0x048C, 0x048D, 0x048E, 0x048F, 0x048F,
+    0x048F, 0x0490, 0x0491, 0x0055, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0493, 0x0494,
+    0x0495, 0x0055, 0x0496, 0x0497, 0x0498, 0x0492, 0x0492, 0x0499, 0x0492, 0x0492, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x049A, 0x049A, 0x049A, 0x049A,
+    0x049B, 0x049B, 0x049B, 0x049B, 0x049C, 0x049C, 0x049D, 0x049E, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x049F, 0x049F, 0x049F, 0x049F,
+    0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x04A0, 0x04A1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
+    0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x04A6, 0x0055, 0x04A7, 0x0055, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8,
+    0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8,
+    0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8,
+    0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8,
+    0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8,
+    0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x0055, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04AA, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x04A8, 0x04AB, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x04AC, 0x04AD, 0x04AE, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274,
+    0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274,
+    0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274, 0x0274,
+    0x0274, 0x0274, 0x0274, 0x0274, 0x04AF, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x04B0, 0x0055,
+    0x04B1, 0x0055, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2,
+    0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2,
+    0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2,
+    0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2, 0x04B2,
+    0x04B2, 0x04B2, 0x04B2, 0x04B3, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4,
+    0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B5, 0x04B4, 0x04B6, 0x04B4, 0x04B7, 0x04B4, 0x04B8,
+    0x04B9, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x04BA, 0x0030, 0x0030, 0x04BB, 0x0055, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x026B, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x04BC, 0x0055, 0x0211, 0x0211, 0x0211, 0x0211, 0x0222, 0x04BD, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x04BE, 0x04BF, 0x04C0, 0x04C1, 0x04C2, 0x04C3, 0x0211, 0x0211,
+    0x0211, 0x04C4, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0223, 0x0055, 0x0055,
+    0x0325, 0x0325, 0x0325, 0x0325, 0x0325, 0x0325, 0x0325, 0x0325, 0x04C5, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x01F7, 0x01F7, 0x032F, 0x0055, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0222, 0x0055, 0x01F7, 0x01F7, 0x01F7, 0x04C6,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x04C7, 0x04C7, 0x04C7, 0x04C8, 0x04C9, 0x04C9, 0x04CA, 0x04C7,
+    0x04C7, 0x04CB, 0x04CC, 0x04C9, 0x04C9, 0x04C7, 0x04C7, 0x04C7, 0x04C8, 0x04C9, 0x04C9, 0x04CD,
+    0x04CE, 0x04CF, 0x04CB, 0x04D0, 0x04D1, 0x04C9, 0x04C7, 0x04C7, 0x04C7, 0x04C8, 0x04C9, 0x04C9,
+    0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04C9, 0x04C9, 0x04C9, 0x04D6, 0x04D7, 0x04D8, 0x04D9, 0x04C9,
+    0x04C9, 0x04CA, 0x04C7, 0x04C7, 0x04CB, 0x04C9, 0x04C9, 0x04C9, 0x04C7, 0x04C7, 0x04C7, 0x04C8,
+    0x04C9, 0x04C9, 0x04CA, 0x04C7, 0x04C7, 0x04CB, 0x04C9, 0x04C9, 0x04C9, 0x04C7, 0x04C7, 0x04C7,
+    0x04C8, 0x04C9, 0x04C9, 0x04CA, 0x04C7, 0x04C7, 0x04CB, 0x04C9, 0x04C9, 0x04C9, 0x04C7, 0x04C7,
+    0x04C7, 0x04C8, 0x04C9, 0x04C9, 0x04DA, 0x04C7, 0x04C7, 0x04C7, 0x04DB, 0x04C9, 0x04C9, 0x04DC,
+    0x04DD, 0x04C7, 0x04C7, 0x04DE, 0x04C9, 0x04C9, 0x04DF, 0x04CA, 0x04C7, 0x04C7, 0x04E0, 0x04C9,
+    0x04C9, 0x04E1, 0x04E2, 0x04C7, 0x04C7, 0x04E3, 0x04C9, 0x04C9, 0x04C9, 0x04E4, 0x04C7, 0x04C7,
+    0x04C7, 0x04DB, 0x04C9, 0x04C9, 0x04DC, 0x04E5, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E7, 0x04E7, 0x04E7, 0x04E7,
+    0x04E7, 0x04E7, 0x04E8, 0x04E9, 0x04E7, 0x04E7, 0x04E7, 0x04E7, 0x04E7, 0x04EA, 0x04EB, 0x04E6,
+    0x04EC, 0x04ED, 0x0055, 0x04EE, 0x04EF, 0x04E7, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x000A, 0x04F0, 0x000A, 0x02F2, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x04F1, 0x04F2, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x04F6, 0x04F6, 0x04F6, 0x04F6,
+    0x04F6, 0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x04FC, 0x04FC,
+    0x04FC, 0x04FD, 0x0055, 0x0055, 0x04FE, 0x04FE, 0x04FE, 0x04FE, 0x04FE, 0x04FF, 0x0500, 0x0501,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x014E, 0x0502, 0x014C, 0x014E, 0x0503, 0x0503, 0x0503, 0x0503,
+    0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503,
+    0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0504, 0x0505, 0x0506, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0507, 0x0507, 0x0507, 0x0507, 0x0508, 0x0509, 0x0509, 0x0509,
+    0x050A, 0x050B, 0x050C, 0x050D, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x050E, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x050F, 0x0510, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x050E, 0x01F7, 0x01F7, 0x01F7,
+    0x01F7, 0x0511, 0x01F7, 0x0512, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0513, 0x005D, 0x005D, 0x005D, 0x0514, 0x0515, 0x0516, 0x0517,
+    0x0518, 0x0519, 0x0514, 0x051A, 0x0514, 0x0516, 0x0516, 0x051B, 0x005D, 0x051C, 0x005D, 0x051D,
+    0x051E, 0x051C, 0x005D, 0x051D, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x051F, 0x0055,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0520, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0520, 0x0521, 0x022E, 0x0522, 0x0523, 0x022E,
+    0x0523, 0x022E, 0x0523, 0x022E, 0x022E, 0x022E, 0x0524, 0x0521, 0x01F7, 0x0525, 0x0211, 0x0211,
+    0x0211, 0x021E, 0x0226, 0x0226, 0x0226, 0x0526, 0x0226, 0x0226, 0x0226, 0x0527, 0x0528, 0x0529,
+    0x0226, 0x052A, 0x021F, 0x0221, 0x0211, 0x052B, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x052C, 0x0211, 0x0211, 0x0211, 0x052D, 0x0521, 0x0211, 0x052E, 0x0211, 0x021E, 0x052F, 0x0530,
+    0x0211, 0x0531, 0x0532, 0x0521, 0x0524, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0533, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0231,
+    0x0534, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x0535, 0x022E, 0x0536, 0x022E, 0x0536, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0537, 0x0521,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0246, 0x0538,
+    0x022E, 0x0520, 0x0538, 0x0521, 0x0211, 0x0537, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0521, 0x0211, 0x0539, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0521, 0x0211, 0x0211,
+    0x0211, 0x053A, 0x0532, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0211, 0x053B, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022F, 0x022D, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E,
+    0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x022E, 0x0520, 0x0521, 0x022E, 0x0524, 0x0536, 0x0536,
+    0x0522, 0x0521, 0x022E, 0x022E, 0x022E, 0x0536, 0x022E, 0x053C, 0x0524, 0x0521, 0x022E, 0x0532,
+    0x022E, 0x0521, 0x0522, 0x0521, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x053D, 0x0211,
+    0x0211, 0x0211, 0x0211, 0x0211, 0x0211, 0x0223, 0x0055, 0x0055, 0x0055, 0x0055, 0x0004, 0x053E,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521, 0x0521,
+    0x0521, 0x0521, 0x0521, 0x053F, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0540, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x02F0,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x02F1, 0x0055, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0287, 0x0287, 0x0287, 0x0540, 0x0055, 0x0055, 0x0055, 0x0287, 0x0287, 0x0287, 0x02F0,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+    0x0287, 0x0541, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055,
+    0x0542, 0x0318, 0x0318, 0x0318, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4,
+    0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318,
+    0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0302, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318,
+    0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318,
+    0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318, 0x0318,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x0543,
+};
+
+static const uint16_t UCD_PROPERTY_STAGE3[10784] = {
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+    0x0002, 0x0002, 0x0001, 0x0001, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0004, 0x0004, 0x0004,
+    0x0006, 0x0007, 0x0004, 0x0008, 0x0004, 0x0009, 0x0004, 0x0004, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0004, 0x0004, 0x0008, 0x0008, 0x0008, 0x0004,
+    0x0004, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B,
+    0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x0006, 0x0004, 0x0007, 0x000C, 0x000D,
+    0x000C, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x0006, 0x0008, 0x0007, 0x0008, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0001, 0x0003, 0x0004, 0x0005, 0x0005,
+    0x0005, 0x0005, 0x000F, 0x0004, 0x000C, 0x0010, 0x0011, 0x0012, 0x0008, 0x0013, 0x0010, 0x000C,
+    0x000F, 0x0008, 0x0014, 0x0014, 0x000C, 0x0015, 0x0004, 0x0004, 0x000C, 0x0014, 0x0011, 0x0016,
+    0x0014, 0x0014, 0x0014, 0x0004, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x0008,
+    0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x0008, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E,
+    0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000E, 0x000B, 0x000E,
+    0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000E,
+    0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B,
+    0x000E, 0x000E, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000B,
+    0x000B, 0x000E, 0x000E, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E,
+    0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B,
+    0x000E, 0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000E, 0x000E, 0x0017,
+    0x000B, 0x000E, 0x000E, 0x000E, 0x0017, 0x0017, 0x0017, 0x0017, 0x000B, 0x0018, 0x000E, 0x000B,
+    0x0018, 0x000E, 0x000B, 0x0018, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B,
+    0x000E, 0x000E, 0x000B, 0x000E, 0x000E, 0x000B, 0x0018, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B,
+    0x000B, 0x000E, 0x000B, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000B, 0x000B,
+    0x000E, 0x000B, 0x000B, 0x000E, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x0017, 0x000E, 0x000E, 0x000E, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A,
+    0x001B, 0x001B, 0x000C, 0x000C, 0x000C, 0x000C, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A,
+    0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x001C, 0x001C, 0x001A, 0x000C, 0x001A, 0x000C,
+    0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x001E, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001F,
+    0x0020, 0x0021, 0x0020, 0x0021, 0x001A, 0x0022, 0x0020, 0x0021, 0x0000, 0x0000, 0x0023, 0x0021,
+    0x0021, 0x0021, 0x0004, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x000C, 0x0020, 0x0004,
+    0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0021, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+    0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020,
+    0x0020, 0x0021, 0x0021, 0x0021, 0x0020, 0x0021, 0x0020, 0x0021, 0x0020, 0x0021, 0x0020, 0x0021,
+    0x0020, 0x0021, 0x0024, 0x0025, 0x0024, 0x0025, 0x0024, 0x0025, 0x0024, 0x0025, 0x0024, 0x0025,
+    0x0024, 0x0025, 0x0024, 0x0025, 0x0021, 0x0021, 0x0021, 0x0021, 0x0020, 0x0021, 0x0026, 0x0020,
+    0x0021, 0x0020, 0x0020, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0027, 0x0027, 0x0027, 0x0027,
+    0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0029, 0x002A,
+    0x002A, 0x001D, 0x001D, 0x002A, 0x002B, 0x002B, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027,
+    0x0028, 0x0027, 0x0028, 0x0028, 0x0000, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C, 0x002C,
+    0x002C, 0x002C, 0x002C, 0x0000, 0x0000, 0x002D, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E,
+    0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002E, 0x0030, 0x0000,
+    0x0000, 0x0031, 0x0031, 0x0032, 0x0000, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+    0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034,
+    0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034,
+    0x0036, 0x0034, 0x0034, 0x0036, 0x0034, 0x0034, 0x0036, 0x0034, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+    0x0037, 0x0037, 0x0037, 0x0000, 0x0000, 0x0000, 0x0000, 0x0037, 0x0037, 0x0037, 0x0037, 0x0036,
+    0x0036, 0x0000, 0x0000, 0x0000, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x003A, 0x003A,
+    0x003A, 0x003B, 0x003B, 0x003C, 0x0004, 0x003B, 0x003D, 0x003D, 0x003E, 0x003E, 0x003E, 0x003E,
+    0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x0004, 0x003F, 0x003B, 0x003B, 0x0004,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x001A, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+    0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x003E, 0x003E, 0x0042, 0x003E, 0x003E, 0x003E,
+    0x003E, 0x003E, 0x003E, 0x003E, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043,
+    0x0043, 0x0043, 0x003B, 0x003B, 0x003B, 0x003B, 0x0040, 0x0040, 0x0041, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x003B, 0x0040, 0x003E, 0x003E,
+    0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x0039, 0x003D, 0x0042, 0x0042, 0x003E, 0x003E, 0x003E,
+    0x003E, 0x0044, 0x0044, 0x003E, 0x003E, 0x003D, 0x0042, 0x0042, 0x0042, 0x003E, 0x0040, 0x0040,
+    0x0043, 0x0043, 0x0040, 0x0040, 0x0040, 0x003D, 0x003D, 0x0040, 0x0045, 0x0045, 0x0045, 0x0045,
+    0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0000, 0x0046,
+    0x0047, 0x0048, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+    0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048,
+    0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0000,
+    0x0000, 0x0047, 0x0047, 0x0047, 0x004A, 0x004A, 0x004A, 0x004A, 0x004A, 0x004A, 0x004A, 0x004A,
+    0x004A, 0x004A, 0x004A, 0x004A, 0x004A, 0x004A, 0x004B, 0x004B, 0x004B, 0x004B, 0x004B, 0x004B,
+    0x004B, 0x004B, 0x004B, 0x004B, 0x004B, 0x004A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004C, 0x004D, 0x004D,
+    0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D, 0x004D,
+    0x004D, 0x004D, 0x004D, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E, 0x004E,
+    0x004F, 0x004F, 0x0050, 0x0051, 0x0051, 0x0051, 0x004F, 0x0000, 0x0000, 0x004E, 0x0052, 0x0052,
+    0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+    0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054,
+    0x0054, 0x0054, 0x0054, 0x0054, 0x0056, 0x0054, 0x0054, 0x0054, 0x0056, 0x0054, 0x0054, 0x0054,
+    0x0054, 0x0055, 0x0000, 0x0000, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057,
+    0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0000, 0x0058, 0x0058, 0x0058, 0x0058,
+    0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x0000, 0x0000, 0x005A, 0x0000,
+    0x0047, 0x0047, 0x0047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x005B, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0000, 0x0038, 0x0038, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0040, 0x0044, 0x0042, 0x0042,
+    0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x003E, 0x003E, 0x003E, 0x003E,
+    0x0042, 0x0042, 0x0039, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x0042, 0x0042,
+    0x0042, 0x0042, 0x0042, 0x0042, 0x005C, 0x005C, 0x005C, 0x005D, 0x005E, 0x005E, 0x005E, 0x005E,
+    0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005C, 0x005D,
+    0x005F, 0x005E, 0x005D, 0x005D, 0x005D, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C, 0x005C,
+    0x005C, 0x005D, 0x005D, 0x005D, 0x005D, 0x005F, 0x005D, 0x005D, 0x005E, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x005C, 0x005C, 0x005C, 0x005E, 0x005E, 0x005C, 0x005C, 0x0004, 0x0004, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0062, 0x005E, 0x005E,
+    0x005E, 0x005E, 0x005E, 0x005E, 0x0063, 0x0064, 0x0065, 0x0065, 0x0000, 0x0063, 0x0063, 0x0063,
+    0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0000, 0x0000, 0x0063, 0x0063, 0x0000, 0x0000, 0x0063,
+    0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0063, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0000, 0x0063, 0x0000,
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0000, 0x0000, 0x0066, 0x0063, 0x0065, 0x0065,
+    0x0065, 0x0064, 0x0064, 0x0064, 0x0064, 0x0000, 0x0000, 0x0065, 0x0065, 0x0000, 0x0000, 0x0065,
+    0x0065, 0x0066, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0065,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x0000, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064,
+    0x0000, 0x0000, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067,
+    0x0063, 0x0063, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x006A, 0x0068,
+    0x0063, 0x006B, 0x0066, 0x0000, 0x0000, 0x006C, 0x006C, 0x006D, 0x0000, 0x006E, 0x006E, 0x006E,
+    0x006E, 0x006E, 0x006E, 0x0000, 0x0000, 0x0000, 0x0000, 0x006E, 0x006E, 0x0000, 0x0000, 0x006E,
+    0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E,
+    0x006E, 0x0000, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x006E, 0x0000, 0x006E, 0x006E,
+    0x0000, 0x006E, 0x006E, 0x0000, 0x006E, 0x006E, 0x0000, 0x0000, 0x006F, 0x0000, 0x006D, 0x006D,
+    0x006D, 0x006C, 0x006C, 0x0000, 0x0000, 0x0000, 0x0000, 0x006C, 0x006C, 0x0000, 0x0000, 0x006C,
+    0x006C, 0x006F, 0x0000, 0x0000, 0x0000, 0x006C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x006E, 0x006E, 0x006E, 0x006E, 0x0000, 0x006E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x006C, 0x006C, 0x006E, 0x006E, 0x006E, 0x006C, 0x0071, 0x0000, 0x0000, 0x0072, 0x0072, 0x0073,
+    0x0000, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0000, 0x0074,
+    0x0074, 0x0074, 0x0000, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074,
+    0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0000, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074,
+    0x0074, 0x0000, 0x0074, 0x0074, 0x0000, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0000, 0x0000,
+    0x0075, 0x0074, 0x0073, 0x0073, 0x0073, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0000, 0x0072,
+    0x0072, 0x0073, 0x0000, 0x0073, 0x0073, 0x0075, 0x0000, 0x0000, 0x0074, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0074, 0x0074, 0x0072, 0x0072, 0x0000, 0x0000, 0x0076, 0x0076,
+    0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0077, 0x0078, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0074, 0x0072, 0x0072, 0x0072, 0x0075, 0x0075, 0x0075,
+    0x0000, 0x0079, 0x007A, 0x007A, 0x0000, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B,
+    0x007B, 0x0000, 0x0000, 0x007B, 0x007B, 0x0000, 0x0000, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B,
+    0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x0000, 0x007B, 0x007B,
+    0x007B, 0x007B, 0x007B, 0x007B, 0x007B, 0x0000, 0x007B, 0x007B, 0x0000, 0x007B, 0x007B, 0x007B,
+    0x007B, 0x007B, 0x0000, 0x0000, 0x007C, 0x007B, 0x007A, 0x0079, 0x007A, 0x0079, 0x0079, 0x0079,
+    0x0079, 0x0000, 0x0000, 0x007A, 0x007A, 0x0000, 0x0000, 0x007A, 0x007A, 0x007C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007C, 0x0079, 0x007A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x007B, 0x007B, 0x0000, 0x007B, 0x007B, 0x007B, 0x0079, 0x0079, 0x0000, 0x0000, 0x007D, 0x007D,
+    0x007D, 0x007D, 0x007D, 0x007D, 0x007D, 0x007D, 0x007D, 0x007D, 0x007E, 0x007B, 0x007F, 0x007F,
+    0x007F, 0x007F, 0x007F, 0x007F, 0x0000, 0x0000, 0x0080, 0x0081, 0x0000, 0x0081, 0x0081, 0x0081,
+    0x0081, 0x0081, 0x0081, 0x0000, 0x0000, 0x0000, 0x0081, 0x0081, 0x0081, 0x0000, 0x0081, 0x0081,
+    0x0081, 0x0081, 0x0000, 0x0000, 0x0000, 0x0081, 0x0081, 0x0000, 0x0081, 0x0000, 0x0081, 0x0081,
+    0x0000, 0x0000, 0x0000, 0x0081, 0x0081, 0x0000, 0x0000, 0x0000, 0x0081, 0x0081, 0x0081, 0x0081,
+    0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x0082,
+    0x0080, 0x0082, 0x0082, 0x0000, 0x0000, 0x0000, 0x0082, 0x0082, 0x0082, 0x0000, 0x0082, 0x0082,
+    0x0082, 0x0083, 0x0000, 0x0000, 0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+    0x0084, 0x0084, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+    0x0086, 0x0087, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0088, 0x0089, 0x0089, 0x0089,
+    0x008A, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x0000, 0x008B, 0x008B,
+    0x008B, 0x0000, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+    0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x0000, 0x0000, 0x008A, 0x008B, 0x0088, 0x0088,
+    0x0088, 0x0089, 0x0089, 0x0089, 0x0089, 0x0000, 0x0088, 0x0088, 0x0088, 0x0000, 0x0088, 0x0088,
+    0x0088, 0x008A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0088, 0x0088, 0x0000,
+    0x008B, 0x008B, 0x008B, 0x0000, 0x0000, 0x008B, 0x0000, 0x0000, 0x008B, 0x008B, 0x0088, 0x0088,
+    0x0000, 0x0000, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x008D, 0x008E, 0x008E, 0x008E, 0x008E,
+    0x008E, 0x008E, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0092, 0x0093, 0x0090, 0x0090, 0x0090,
+    0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0000, 0x0090, 0x0090, 0x0090, 0x0000, 0x0090, 0x0090,
+    0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
+    0x0090, 0x0090, 0x0090, 0x0090, 0x0000, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0000, 0x0000,
+    0x0094, 0x0090, 0x0092, 0x0091, 0x0092, 0x0092, 0x0092, 0x0092, 0x0092, 0x0000, 0x0091, 0x0092,
+    0x0092, 0x0000, 0x0092, 0x0092, 0x0091, 0x0094, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0092, 0x0092, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x0090, 0x0000,
+    0x0090, 0x0090, 0x0091, 0x0091, 0x0000, 0x0000, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095,
+    0x0095, 0x0095, 0x0095, 0x0095, 0x0000, 0x0090, 0x0090, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0096, 0x0096, 0x0097, 0x0097, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x0098, 0x0000, 0x0098, 0x0098, 0x0098, 0x0000, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0099,
+    0x0099, 0x0098, 0x0097, 0x0097, 0x0097, 0x0096, 0x0096, 0x0096, 0x0096, 0x0000, 0x0097, 0x0097,
+    0x0097, 0x0000, 0x0097, 0x0097, 0x0097, 0x0099, 0x0098, 0x009A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0098, 0x0098, 0x0098, 0x0097, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x0098,
+    0x0098, 0x0098, 0x0096, 0x0096, 0x0000, 0x0000, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C,
+    0x009C, 0x009C, 0x009C, 0x009C, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B, 0x009B,
+    0x009B, 0x009A, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0098, 0x0000, 0x009D, 0x009E, 0x009E,
+    0x0000, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F,
+    0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x0000, 0x0000, 0x0000, 0x009F, 0x009F,
+    0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F, 0x0000, 0x009F, 0x009F, 0x009F, 0x009F, 0x009F,
+    0x009F, 0x009F, 0x009F, 0x009F, 0x0000, 0x009F, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A0, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x009E, 0x009E, 0x009E, 0x009D, 0x009D, 0x009D, 0x0000, 0x009D, 0x0000,
+    0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x009E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1, 0x00A1,
+    0x0000, 0x0000, 0x009E, 0x009E, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A3, 0x00A3, 0x00A3,
+    0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3,
+    0x00A3, 0x00A4, 0x00A3, 0x00A3, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0005, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A3, 0x00A5, 0x00A6,
+    0x00A6, 0x00A6, 0x00A6, 0x00A6, 0x00A6, 0x00A4, 0x00A6, 0x00A7, 0x00A8, 0x00A8, 0x00A8, 0x00A8,
+    0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A7, 0x00A7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00A9, 0x00A9, 0x0000, 0x00A9, 0x0000, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0000,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0000, 0x00A9, 0x0000, 0x00A9, 0x00A9, 0x00AA, 0x00A9, 0x00A9,
+    0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AB, 0x00AA, 0x00AA, 0x00A9, 0x0000, 0x0000,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0000, 0x00AC, 0x0000, 0x00AB, 0x00AB, 0x00AB, 0x00AB,
+    0x00AB, 0x00AA, 0x0000, 0x0000, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD, 0x00AD,
+    0x00AD, 0x00AD, 0x0000, 0x0000, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00AE, 0x00AF, 0x00AF, 0x00AF,
+    0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
+    0x00B0, 0x00B0, 0x00B0, 0x00AF, 0x00B0, 0x00AF, 0x00AF, 0x00AF, 0x00B1, 0x00B1, 0x00AF, 0x00AF,
+    0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2,
+    0x00B2, 0x00B2, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3,
+    0x00AF, 0x00B1, 0x00AF, 0x00B1, 0x00AF, 0x00B1, 0x00B4, 0x00B5, 0x00B4, 0x00B5, 0x00B6, 0x00B6,
+    0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x0000, 0x00AE, 0x00AE, 0x00AE,
+    0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+    0x00B7, 0x00B7, 0x00B7, 0x00B8, 0x00B7, 0x00B7, 0x00B1, 0x00B1, 0x00B1, 0x00B0, 0x00B1, 0x00B1,
+    0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00AE, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+    0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x0000, 0x00AF, 0x00AF,
+    0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00B1, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF,
+    0x00AF, 0x0000, 0x00AF, 0x00AF, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x00B0, 0x00B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00BA, 0x00BA, 0x00BB, 0x00BB, 0x00BB,
+    0x00BB, 0x00BA, 0x00BB, 0x00BB, 0x00BB, 0x00BB, 0x00BB, 0x00BC, 0x00BA, 0x00BC, 0x00BC, 0x00BA,
+    0x00BA, 0x00BB, 0x00BB, 0x00B9, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD,
+    0x00BD, 0x00BD, 0x00BE, 0x00BE, 0x00BE, 0x00BE, 0x00BE, 0x00BE, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00BA, 0x00BA, 0x00BB, 0x00BB, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00BB, 0x00BB,
+    0x00BB, 0x00B9, 0x00BA, 0x00BA, 0x00BA, 0x00B9, 0x00B9, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA,
+    0x00BA, 0x00BA, 0x00B9, 0x00B9, 0x00B9, 0x00BB, 0x00BB, 0x00BB, 0x00BB, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00BB, 0x00BA, 0x00BA, 0x00BB, 0x00BB, 0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BA,
+    0x00BA, 0x00BB, 0x00B9, 0x00BA, 0x00BD, 0x00BD, 0x00BA, 0x00BA, 0x00BA, 0x00BB, 0x00BF, 0x00BF,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x0000, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C0, 0x0000, 0x0000,
+    0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x0004,
+    0x00C2, 0x00C1, 0x00C1, 0x00C1, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C4, 0x00C4, 0x00C3, 0x00C3, 0x00C3,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+    0x00C5, 0x0000, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x0000, 0x0000, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+    0x00C5, 0x00C5, 0x00C5, 0x0000, 0x00C5, 0x00C5, 0x00C5, 0x0000, 0x0000, 0x00C6, 0x00C6, 0x00C6,
+    0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C8, 0x00C8, 0x00C8,
+    0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8,
+    0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x00C8, 0x0000, 0x0000, 0x0000, 0x00C9, 0x00C9, 0x00C9, 0x00C9,
+    0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x00C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+    0x00CA, 0x00CA, 0x0000, 0x0000, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x0000, 0x0000,
+    0x00CC, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD,
+    0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CD, 0x00CE, 0x00CF, 0x00CD,
+    0x00D0, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1,
+    0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D2, 0x00D3, 0x0000, 0x0000, 0x0000,
+    0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x0004,
+    0x0004, 0x0004, 0x00D5, 0x00D5, 0x00D5, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4,
+    0x00D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D7, 0x00D7, 0x00D8, 0x00D9, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D6, 0x00DA, 0x00DA, 0x00DA, 0x00DA,
+    0x00DA, 0x00DA, 0x00DA, 0x00DA, 0x00DA, 0x00DA, 0x00DB, 0x00DB, 0x00DC, 0x0004, 0x0004, 0x0000,
+    0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DD, 0x00DE, 0x00DE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF,
+    0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x0000, 0x00DF, 0x00DF, 0x00DF, 0x0000, 0x00E0, 0x00E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1,
+    0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E2, 0x00E2, 0x00E3, 0x00E4, 0x00E4, 0x00E4, 0x00E4, 0x00E4,
+    0x00E4, 0x00E4, 0x00E3, 0x00E3, 0x00E3, 0x00E3, 0x00E3, 0x00E3, 0x00E3, 0x00E3, 0x00E4, 0x00E3,
+    0x00E3, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5, 0x00E5,
+    0x00E6, 0x00E6, 0x00E6, 0x00E7, 0x00E6, 0x00E6, 0x00E6, 0x00E8, 0x00E1, 0x00E5, 0x0000, 0x0000,
+    0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x00E9, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00EA, 0x00EA, 0x00EA, 0x00EA, 0x00EA, 0x00EA, 0x00EA, 0x00EA,
+    0x00EA, 0x00EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00EB, 0x00EB, 0x0004, 0x0004,
+    0x00EB, 0x0004, 0x00EC, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00ED, 0x00ED, 0x00ED, 0x00EE, 0x00ED,
+    0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0,
+    0x00F0, 0x00F0, 0x00F0, 0x00F1, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F2, 0x00F2, 0x00F0,
+    0x00F0, 0x00F2, 0x00F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00CD, 0x00CD, 0x00CD, 0x00CD,
+    0x00CD, 0x00CD, 0x0000, 0x0000, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3,
+    0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x0000, 0x00F4, 0x00F4, 0x00F4, 0x00F5,
+    0x00F5, 0x00F5, 0x00F5, 0x00F4, 0x00F4, 0x00F5, 0x00F5, 0x00F5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00F5, 0x00F5, 0x00F4, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F6, 0x00F6, 0x00F6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00F7, 0x0000, 0x0000, 0x0000, 0x00F8, 0x00F8, 0x00F9, 0x00F9,
+    0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00F9, 0x00FA, 0x00FA, 0x00FA, 0x00FA,
+    0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x0000, 0x0000,
+    0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x00FA, 0x0000, 0x0000, 0x0000, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+    0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00FB, 0x00FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00FC, 0x00FC, 0x00FC, 0x00FC,
+    0x00FC, 0x00FC, 0x00FC, 0x00FC, 0x00FC, 0x00FC, 0x00FD, 0x0000, 0x0000, 0x0000, 0x00FE, 0x00FE,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0101,
+    0x0101, 0x0102, 0x0102, 0x0101, 0x0000, 0x0000, 0x0103, 0x0103, 0x0104, 0x0104, 0x0104, 0x0104,
+    0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0105, 0x0106, 0x0105,
+    0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0000, 0x0107, 0x0105, 0x0106, 0x0105,
+    0x0105, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0106, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0106, 0x0106, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0107, 0x0000, 0x0000, 0x0107, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108,
+    0x0108, 0x0108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0109, 0x0109, 0x0109, 0x0109,
+    0x0109, 0x0109, 0x0109, 0x010A, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0000, 0x0000,
+    0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x010B, 0x0041, 0x0041, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x0041, 0x0041, 0x0041, 0x0000,
+    0x010C, 0x010C, 0x010C, 0x010C, 0x010D, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E,
+    0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010F, 0x010D, 0x010C, 0x010C,
+    0x010C, 0x010C, 0x010C, 0x010D, 0x010C, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010C, 0x010D,
+    0x0110, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x0000, 0x0000, 0x0000,
+    0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0112, 0x0112,
+    0x0112, 0x0112, 0x0112, 0x0112, 0x0112, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113,
+    0x0113, 0x0113, 0x0113, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F,
+    0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0112, 0x0112, 0x0000,
+    0x0114, 0x0114, 0x0115, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116,
+    0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0115, 0x0114, 0x0114, 0x0114, 0x0114, 0x0115, 0x0115,
+    0x0114, 0x0114, 0x0117, 0x0118, 0x0114, 0x0114, 0x0116, 0x0116, 0x0119, 0x0119, 0x0119, 0x0119,
+    0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116,
+    0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A, 0x011A,
+    0x011A, 0x011A, 0x011B, 0x011C, 0x011D, 0x011D, 0x011C, 0x011C, 0x011C, 0x011D, 0x011C, 0x011D,
+    0x011D, 0x011D, 0x011E, 0x011E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x011F, 0x011F, 0x011F, 0x011F, 0x0120, 0x0120, 0x0120, 0x0120, 0x0120, 0x0120, 0x0120, 0x0120,
+    0x0120, 0x0120, 0x0120, 0x0120, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121, 0x0121,
+    0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0121, 0x0121, 0x0122, 0x0123,
+    0x0000, 0x0000, 0x0000, 0x0124, 0x0124, 0x0124, 0x0124, 0x0124, 0x0125, 0x0125, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0000, 0x0000, 0x0000, 0x0120, 0x0120, 0x0120,
+    0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0127, 0x0127,
+    0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127, 0x0127,
+    0x0128, 0x0128, 0x0128, 0x0128, 0x0128, 0x0128, 0x0129, 0x0129, 0x0028, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x00C0, 0x00C0, 0x00C0,
+    0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x001D, 0x001D, 0x001D, 0x0004,
+    0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x012B, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x012C, 0x012C, 0x012C, 0x012C, 0x001D, 0x012C, 0x012C, 0x012C, 0x012C, 0x012C, 0x012C,
+    0x001D, 0x012C, 0x012C, 0x012B, 0x001D, 0x001D, 0x012C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0028,
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0023, 0x0023, 0x0023,
+    0x0023, 0x0023, 0x0019, 0x0019, 0x0019, 0x0019, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x012D, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0023, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x0041,
+    0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+    0x0041, 0x001D, 0x001D, 0x001D, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000B, 0x000E, 0x0021, 0x0021, 0x0021, 0x0021,
+    0x0021, 0x0021, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x012E, 0x012E, 0x012E, 0x012E,
+    0x012E, 0x012E, 0x012E, 0x012E, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0000, 0x0021, 0x0021,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x012E, 0x0022, 0x0021, 0x0022, 0x0022, 0x0022, 0x0021, 0x0021,
+    0x0021, 0x0000, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020, 0x012E, 0x0022, 0x0022, 0x0022,
+    0x0021, 0x0021, 0x0021, 0x0021, 0x0000, 0x0000, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0000, 0x0022, 0x0022, 0x0022, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0022, 0x0022, 0x0022,
+    0x0000, 0x0000, 0x0021, 0x0021, 0x0021, 0x0000, 0x0021, 0x0021, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x012E, 0x0022, 0x0022, 0x0000, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0003, 0x0003, 0x0003, 0x0013, 0x012F, 0x012F, 0x0013, 0x0013, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x0009, 0x0009, 0x0004, 0x0004, 0x0012, 0x0016, 0x0006, 0x0012, 0x0012, 0x0016, 0x0006, 0x0012,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0130, 0x0131, 0x0013, 0x0013,
+    0x0013, 0x0013, 0x0013, 0x0003, 0x0004, 0x0012, 0x0016, 0x0004, 0x0132, 0x0004, 0x0004, 0x000D,
+    0x000D, 0x0004, 0x0004, 0x0004, 0x0008, 0x0006, 0x0007, 0x0004, 0x0004, 0x0132, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0008, 0x0004, 0x000D, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0003, 0x0013, 0x0013, 0x0013, 0x0013,
+    0x0013, 0x0133, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+    0x0014, 0x0019, 0x0000, 0x0000, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0008, 0x0008,
+    0x0008, 0x0006, 0x0007, 0x0019, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0008, 0x0008, 0x0008, 0x0006, 0x0007, 0x0000, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0000, 0x0000, 0x0000, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+    0x0005, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x010B, 0x010B, 0x010B, 0x010B, 0x001D, 0x010B, 0x010B, 0x010B, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000F, 0x000F, 0x0134, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x0134, 0x000F, 0x000F, 0x0015, 0x0134, 0x0134, 0x0134, 0x0015, 0x0015,
+    0x0134, 0x0134, 0x0134, 0x0015, 0x000F, 0x0134, 0x000F, 0x000F, 0x0008, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x0134, 0x000F, 0x0020, 0x000F,
+    0x0134, 0x000F, 0x000B, 0x000B, 0x0134, 0x0134, 0x000F, 0x0015, 0x0134, 0x0134, 0x000B, 0x0134,
+    0x0015, 0x012C, 0x012C, 0x012C, 0x012C, 0x0135, 0x000F, 0x000F, 0x0015, 0x0015, 0x0134, 0x0134,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0134, 0x0015, 0x0015, 0x0015, 0x0015, 0x000F, 0x0008,
+    0x000F, 0x000F, 0x000E, 0x000F, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136,
+    0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x000B,
+    0x000E, 0x0138, 0x0138, 0x0138, 0x0138, 0x0014, 0x000F, 0x000F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0139, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0008, 0x0008,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x0008, 0x000F, 0x000F, 0x0008, 0x000F, 0x000F, 0x0008, 0x000F,
+    0x000F, 0x0010, 0x0010, 0x000F, 0x000F, 0x000F, 0x0008, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0008, 0x0008,
+    0x000F, 0x000F, 0x0008, 0x000F, 0x0008, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x0006, 0x0007, 0x0006, 0x0007, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x0008, 0x0008, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0010, 0x0006, 0x0007, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0008, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010,
+    0x000F, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0000, 0x000F, 0x000F, 0x000F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A,
+    0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013B, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A,
+    0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x013C, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0008,
+    0x0010, 0x0008, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0008, 0x0008, 0x0008, 0x0139,
+    0x0139, 0x0139, 0x0139, 0x0008, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x000F, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x000F,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0139,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x000F,
+    0x0010, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x000F,
+    0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010,
+    0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x000F, 0x0010,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010,
+    0x0010, 0x0010, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007,
+    0x0006, 0x0007, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x0010, 0x0010, 0x0010,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0006, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x0008, 0x0008, 0x0006, 0x0007, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0139, 0x0139, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0006,
+    0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006,
+    0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0006, 0x0007, 0x0006, 0x0007,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0006, 0x0007, 0x0008, 0x0008,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x0008, 0x000F, 0x000F, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x000F, 0x000F, 0x000F,
+    0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0000, 0x0000, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0000, 0x000F,
+    0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013E, 0x013F, 0x013F, 0x013F, 0x013F,
+    0x013F, 0x013F, 0x013F, 0x013F, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B, 0x000E, 0x000E, 0x000B,
+    0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E,
+    0x000E, 0x000B, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x0019, 0x0019, 0x000B, 0x000B,
+    0x0024, 0x0025, 0x0024, 0x0025, 0x0025, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0140, 0x0024,
+    0x0025, 0x0024, 0x0025, 0x0141, 0x0141, 0x0141, 0x0024, 0x0025, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0142, 0x0142, 0x0142, 0x0142, 0x0143, 0x0142, 0x0142, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+    0x00C1, 0x00C1, 0x0000, 0x00C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C1, 0x0000, 0x0000,
+    0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0145, 0x0146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0147, 0x0148, 0x0148, 0x0148, 0x0148,
+    0x0148, 0x0148, 0x0148, 0x0148, 0x0004, 0x0004, 0x0012, 0x0016, 0x0012, 0x0016, 0x0004, 0x0004,
+    0x0004, 0x0012, 0x0016, 0x0004, 0x0012, 0x0016, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0009, 0x0004, 0x0004, 0x0009, 0x0004, 0x0012, 0x0016, 0x0004, 0x0004,
+    0x0012, 0x0016, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x001A, 0x0004, 0x0004, 0x0009, 0x0009, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0009, 0x0004, 0x0006, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x000F, 0x000F, 0x0004, 0x0004,
+    0x0004, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0009, 0x0000, 0x0000,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0000, 0x0149,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0149, 0x0000, 0x0000, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0004, 0x0004, 0x0004, 0x000F, 0x014A, 0x014B, 0x014C,
+    0x0006, 0x0007, 0x000F, 0x000F, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007,
+    0x0009, 0x0006, 0x0007, 0x0007, 0x000F, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C, 0x014C,
+    0x014C, 0x014C, 0x001D, 0x001D, 0x001D, 0x001D, 0x014D, 0x014D, 0x014E, 0x001A, 0x001A, 0x001A,
+    0x001A, 0x001A, 0x000F, 0x000F, 0x014C, 0x014C, 0x014C, 0x014A, 0x012C, 0x0132, 0x000F, 0x000F,
+    0x0000, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F,
+    0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x0000,
+    0x0000, 0x001D, 0x001D, 0x000C, 0x000C, 0x0150, 0x0150, 0x014F, 0x0009, 0x0151, 0x0151, 0x0151,
+    0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151,
+    0x0151, 0x0151, 0x0151, 0x0004, 0x001A, 0x0152, 0x0152, 0x0151, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153, 0x0153,
+    0x0000, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x00C4, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x0000,
+    0x000F, 0x000F, 0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x000F, 0x0154, 0x0154, 0x0154, 0x0154,
+    0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0000,
+    0x0014, 0x0014, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x000F,
+    0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155, 0x0155,
+    0x0155, 0x0155, 0x0155, 0x000F, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157,
+    0x0157, 0x0158, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0157, 0x0000, 0x0000, 0x0000,
+    0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159,
+    0x0159, 0x0159, 0x0159, 0x0000, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A,
+    0x015B, 0x015B, 0x015B, 0x015B, 0x015B, 0x015B, 0x015C, 0x015C, 0x015D, 0x015D, 0x015D, 0x015D,
+    0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015E, 0x015F, 0x015F, 0x015F,
+    0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x015D, 0x015D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0161, 0x002A,
+    0x002B, 0x002B, 0x002B, 0x0162, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148,
+    0x002A, 0x002A, 0x0162, 0x0163, 0x0027, 0x0028, 0x0027, 0x0028, 0x012D, 0x012D, 0x0148, 0x0148,
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+    0x0166, 0x0166, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x000C, 0x000C, 0x000C, 0x001A, 0x000C, 0x000C, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E,
+    0x0019, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000B, 0x000E, 0x000B,
+    0x000E, 0x000B, 0x000B, 0x000E, 0x001A, 0x000C, 0x000C, 0x000B, 0x000E, 0x000B, 0x000E, 0x0017,
+    0x000B, 0x000E, 0x000B, 0x000E, 0x000E, 0x000E, 0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B,
+    0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E,
+    0x000B, 0x000E, 0x000B, 0x000E, 0x000B, 0x000B, 0x000B, 0x000B, 0x000E, 0x000B, 0x000E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000B, 0x000E, 0x0000, 0x000E, 0x0000, 0x000E, 0x000B, 0x000E,
+    0x000B, 0x000E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0168, 0x0168,
+    0x0168, 0x000B, 0x000E, 0x0017, 0x0019, 0x0019, 0x000E, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+    0x0169, 0x0169, 0x016A, 0x0169, 0x0169, 0x0169, 0x016B, 0x0169, 0x0169, 0x0169, 0x0169, 0x016A,
+    0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169,
+    0x0169, 0x0169, 0x0169, 0x016C, 0x016C, 0x016A, 0x016A, 0x016C, 0x016D, 0x016D, 0x016D, 0x016D,
+    0x016B, 0x0000, 0x0000, 0x0000, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x000F,
+    0x0005, 0x000F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016E, 0x016E, 0x016E, 0x016E,
+    0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016F, 0x016F, 0x016F, 0x016F,
+    0x0170, 0x0170, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0170, 0x0170, 0x0170, 0x0170,
+    0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170,
+    0x0172, 0x0173, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0174, 0x0174,
+    0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0175, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x005F, 0x005F, 0x005F, 0x005F, 0x005F, 0x005F, 0x005F, 0x005F,
+    0x005F, 0x005F, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x005E, 0x0061, 0x0061, 0x0061, 0x005E,
+    0x0061, 0x005E, 0x005E, 0x005C, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176,
+    0x0176, 0x0176, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177,
+    0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0177, 0x0178, 0x0178,
+    0x0178, 0x0178, 0x0178, 0x0179, 0x0179, 0x0179, 0x0004, 0x017A, 0x017B, 0x017B, 0x017B, 0x017B,
+    0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017B, 0x017C,
+    0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017C, 0x017D, 0x017E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x017F,
+    0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0181,
+    0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182, 0x0182,
+    0x0182, 0x0182, 0x0182, 0x0183, 0x0181, 0x0181, 0x0180, 0x0180, 0x0180, 0x0180, 0x0181, 0x0181,
+    0x0180, 0x0180, 0x0181, 0x0181, 0x0184, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185,
+    0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0185, 0x0000, 0x001A, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0185, 0x0185,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00BB, 0x0187, 0x00B9, 0x00BD, 0x00BD, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x0000, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188,
+    0x0188, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x018A, 0x018A, 0x0189, 0x0189, 0x018A,
+    0x018A, 0x0189, 0x0189, 0x0000, 0x0188, 0x0188, 0x0188, 0x0189, 0x0188, 0x0188, 0x0188, 0x0188,
+    0x0188, 0x0188, 0x0188, 0x0188, 0x0189, 0x018A, 0x0000, 0x0000, 0x018B, 0x018B, 0x018B, 0x018B,
+    0x018B, 0x018B, 0x018B, 0x018B, 0x018B, 0x018B, 0x0000, 0x0000, 0x018C, 0x018C, 0x018C, 0x018C,
+    0x0187, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00BF, 0x00BF, 0x00BF, 0x00B9, 0x00BA,
+    0x00BB, 0x00BA, 0x00B9, 0x00B9, 0x018D, 0x018D, 0x018D, 0x018D, 0x018D, 0x018D, 0x018D, 0x018D,
+    0x018E, 0x018D, 0x018E, 0x018E, 0x018E, 0x018D, 0x018D, 0x018E, 0x018E, 0x018D, 0x018D, 0x018D,
+    0x018D, 0x018D, 0x018E, 0x018F, 0x018D, 0x018F, 0x018D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x018D, 0x018D, 0x0190, 0x0191, 0x0191, 0x0192, 0x0192, 0x0192, 0x0192,
+    0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0193, 0x0194, 0x0194, 0x0193, 0x0193,
+    0x0195, 0x0195, 0x0192, 0x0196, 0x0196, 0x0193, 0x0197, 0x0000, 0x0000, 0x00C5, 0x00C5, 0x00C5,
+    0x00C5, 0x00C5, 0x00C5, 0x0000, 0x000E, 0x000E, 0x000E, 0x000C, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x0021, 0x000E, 0x000E, 0x000E, 0x0168, 0x000C, 0x000C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+    0x0192, 0x0192, 0x0192, 0x0193, 0x0193, 0x0194, 0x0193, 0x0193, 0x0194, 0x0193, 0x0193, 0x0195,
+    0x0198, 0x0197, 0x0000, 0x0000, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199,
+    0x0199, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x019A, 0x019A, 0x019A, 0x019A, 0x019A, 0x019A, 0x019A, 0x019A, 0x019B, 0x019B, 0x019B, 0x019B,
+    0x019B, 0x019B, 0x019B, 0x019B, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0000, 0x0000,
+    0x0156, 0x0156, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000E, 0x000E, 0x000E, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x0000, 0x0000, 0x0000, 0x0000, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0037, 0x0034, 0x0037, 0x0037, 0x019C, 0x0037, 0x0037,
+    0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0000,
+    0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0000, 0x0037, 0x0000, 0x0037, 0x0037, 0x0000, 0x0037,
+    0x0037, 0x0000, 0x0037, 0x0037, 0x0040, 0x0040, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B,
+    0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x005B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0007, 0x0006, 0x003D, 0x003D, 0x003D, 0x003D,
+    0x003D, 0x003D, 0x003D, 0x003D, 0x0000, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003D, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x003C, 0x003D, 0x003D, 0x003D, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F, 0x001F,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0006, 0x0007, 0x0004, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x002A, 0x002A,
+    0x0004, 0x0009, 0x0009, 0x000D, 0x000D, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006, 0x0007, 0x0006,
+    0x0007, 0x0004, 0x0004, 0x0006, 0x0007, 0x0004, 0x0004, 0x0004, 0x0004, 0x000D, 0x000D, 0x000D,
+    0x0004, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0009, 0x0006, 0x0007, 0x0006,
+    0x0007, 0x0006, 0x0007, 0x0004, 0x0004, 0x0004, 0x0008, 0x0009, 0x0008, 0x0008, 0x0008, 0x0000,
+    0x0004, 0x0005, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0000, 0x0013,
+    0x0000, 0x0004, 0x0004, 0x0004, 0x0005, 0x0004, 0x0004, 0x0004, 0x000E, 0x000E, 0x000E, 0x0006,
+    0x0008, 0x0007, 0x0008, 0x0006, 0x0007, 0x0004, 0x0006, 0x0007, 0x0004, 0x0004, 0x0151, 0x0151,
+    0x001A, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151,
+    0x0151, 0x0151, 0x001A, 0x001A, 0x0000, 0x0000, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+    0x0000, 0x0000, 0x00C3, 0x00C3, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0005, 0x0005, 0x0008, 0x000C,
+    0x000F, 0x0005, 0x0005, 0x0000, 0x000F, 0x0008, 0x0008, 0x0008, 0x0008, 0x000F, 0x000F, 0x0000,
+    0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0039, 0x0039, 0x0039,
+    0x000F, 0x000F, 0x0000, 0x0000, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D,
+    0x019D, 0x019D, 0x019D, 0x019D, 0x0000, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D,
+    0x019D, 0x019D, 0x019D, 0x0000, 0x019D, 0x019D, 0x019D, 0x0000, 0x019D, 0x019D, 0x0000, 0x019D,
+    0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x0000, 0x0000, 0x019D, 0x019D, 0x019D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0000, 0x0000, 0x0000, 0x000F, 0x019E, 0x019E, 0x019E, 0x019E,
+    0x019E, 0x019E, 0x019E, 0x019E, 0x019E, 0x019E, 0x019E, 0x019E, 0x019E, 0x019F, 0x019F, 0x019F,
+    0x019F, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0,
+    0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x019F, 0x019F, 0x01A0, 0x01A0, 0x01A0, 0x0000,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0000, 0x0000, 0x0000, 0x01A0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x001D, 0x0000, 0x0000,
+    0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1,
+    0x01A1, 0x0000, 0x0000, 0x0000, 0x01A2, 0x01A2, 0x01A2, 0x01A2, 0x01A2, 0x01A2, 0x01A2, 0x01A2,
+    0x01A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A3, 0x01A4, 0x01A4, 0x01A4, 0x01A4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A3, 0x01A3, 0x01A3,
+    0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A6, 0x01A5, 0x01A5,
+    0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7, 0x01A7,
+    0x01A7, 0x01A7, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01A9,
+    0x01A9, 0x01A9, 0x0000, 0x01AA, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB,
+    0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AC, 0x01AD, 0x01AD, 0x01AD,
+    0x01AD, 0x01AD, 0x0000, 0x0000, 0x01AE, 0x01AE, 0x01AE, 0x01AE, 0x01AE, 0x01AE, 0x01AE, 0x01AE,
+    0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B0, 0x01B0, 0x01B0, 0x01B0,
+    0x01B0, 0x01B0, 0x01B0, 0x01B0, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1,
+    0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x0000, 0x0000, 0x01B2, 0x01B2, 0x01B2, 0x01B2,
+    0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3, 0x01B3,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x01B4,
+    0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B5, 0x01B5, 0x01B5, 0x01B5,
+    0x01B5, 0x01B5, 0x01B5, 0x01B5, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6,
+    0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01B7, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8,
+    0x01B8, 0x01B8, 0x01B8, 0x0000, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x0000,
+    0x01B8, 0x01B8, 0x0000, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9,
+    0x01B9, 0x01B9, 0x0000, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x0000, 0x01B9,
+    0x01B9, 0x0000, 0x0000, 0x0000, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA,
+    0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x0000, 0x01BA, 0x01BA, 0x01BA, 0x01BA,
+    0x01BA, 0x01BA, 0x0000, 0x0000, 0x0019, 0x0168, 0x0168, 0x0019, 0x0019, 0x0019, 0x0000, 0x0019,
+    0x0019, 0x0000, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x0000, 0x0000,
+    0x01BB, 0x0000, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB,
+    0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x0000, 0x01BB,
+    0x01BB, 0x0000, 0x0000, 0x0000, 0x01BB, 0x0000, 0x0000, 0x01BB, 0x01BC, 0x01BC, 0x01BC, 0x01BC,
+    0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x0000, 0x01BD,
+    0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+    0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01C0,
+    0x01C0, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C4,
+    0x01C4, 0x01C4, 0x01C4, 0x0000, 0x01C4, 0x01C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C5,
+    0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+    0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C7, 0x01C7, 0x01C7, 0x01C7, 0x01C7, 0x01C7,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9,
+    0x01C9, 0x01C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CA, 0x01CB, 0x01CB, 0x01CB, 0x01CB,
+    0x01CB, 0x01CB, 0x01CB, 0x01CB, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01CD, 0x01CD, 0x01CC, 0x01CC, 0x01CD, 0x01CD, 0x01CD, 0x01CD,
+    0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x0000, 0x0000, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD, 0x01CD,
+    0x01CE, 0x01CF, 0x01CF, 0x01CF, 0x0000, 0x01CF, 0x01CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01CF, 0x01CF, 0x01CF, 0x01CF, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x0000, 0x01CE, 0x01CE, 0x01CE,
+    0x0000, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE,
+    0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x01CE, 0x0000, 0x0000,
+    0x01D0, 0x01D0, 0x01D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D0, 0x01D1, 0x01D1, 0x01D1, 0x01D1,
+    0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3,
+    0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D4, 0x01D4, 0x01D5, 0x01D6, 0x01D6, 0x01D6, 0x01D6,
+    0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D6, 0x01D7, 0x01D7, 0x01D7,
+    0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D9, 0x01D8, 0x01D8, 0x01D8,
+    0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01D8, 0x01DA, 0x01DA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01DB, 0x01DB, 0x01DB, 0x01DB, 0x01DB, 0x01DC, 0x01DC, 0x01DC, 0x01DC,
+    0x01DC, 0x01DC, 0x01DC, 0x0000, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD,
+    0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x01DD, 0x0000, 0x0000, 0x0000, 0x01DE, 0x01DE, 0x01DE,
+    0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF,
+    0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x01DF, 0x0000, 0x0000, 0x01E0, 0x01E0, 0x01E0, 0x01E0,
+    0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1,
+    0x01E1, 0x01E1, 0x01E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E2, 0x01E2, 0x01E2, 0x01E2,
+    0x01E2, 0x01E2, 0x01E2, 0x01E2, 0x01E3, 0x01E3, 0x01E3, 0x01E3, 0x01E3, 0x01E3, 0x01E3, 0x01E3,
+    0x01E3, 0x01E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E4, 0x01E4, 0x01E4,
+    0x01E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E5, 0x01E5, 0x01E5, 0x01E5, 0x01E5, 0x01E5, 0x01E5,
+    0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x01E6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7, 0x01E7,
+    0x01E7, 0x01E7, 0x01E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E8, 0x01E8, 0x01E8, 0x01E8,
+    0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01EA, 0x01EA, 0x01EA, 0x01EA,
+    0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EB, 0x01EB, 0x01EB, 0x01EB,
+    0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x01EC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED,
+    0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x01ED, 0x0000, 0x01EE, 0x01EE, 0x01EE, 0x01EE,
+    0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x0000, 0x01EF, 0x01EF, 0x01F0, 0x0000, 0x0000,
+    0x01EE, 0x01EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F1, 0x01F1, 0x01F1, 0x01F1,
+    0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F1, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F1, 0x01F3, 0x01F3, 0x01F3, 0x01F3,
+    0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F3, 0x01F4, 0x01F4,
+    0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F5, 0x01F5, 0x01F5,
+    0x01F5, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x01F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F7, 0x01F8, 0x01F8,
+    0x01F8, 0x01F8, 0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA,
+    0x01FA, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+    0x01FC, 0x01FC, 0x01FC, 0x0000, 0x01FD, 0x01FE, 0x01FD, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF,
+    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FE, 0x01FE, 0x01FE, 0x01FE,
+    0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x01FE, 0x0200, 0x0201,
+    0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0000, 0x0000, 0x0000, 0x0000, 0x0202, 0x0202,
+    0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202,
+    0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0202, 0x0203, 0x0203, 0x0203, 0x0203, 0x0203, 0x0203,
+    0x0203, 0x0203, 0x0203, 0x0203, 0x0200, 0x01FF, 0x01FF, 0x01FE, 0x01FE, 0x01FF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0204, 0x0204, 0x0205, 0x0206,
+    0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206, 0x0206,
+    0x0205, 0x0205, 0x0205, 0x0207, 0x0207, 0x0207, 0x0207, 0x0205, 0x0205, 0x0204, 0x0204, 0x0208,
+    0x0208, 0x0209, 0x0208, 0x0208, 0x0208, 0x0208, 0x0207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0209, 0x0000, 0x0000, 0x020A, 0x020A, 0x020A, 0x020A,
+    0x020A, 0x020A, 0x020A, 0x020A, 0x020A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x020C, 0x020C, 0x020C, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D,
+    0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D, 0x020D,
+    0x020D, 0x020D, 0x020D, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020E, 0x020C, 0x020C, 0x020C,
+    0x020C, 0x020C, 0x020C, 0x020F, 0x020F, 0x0000, 0x0210, 0x0210, 0x0210, 0x0210, 0x0210, 0x0210,
+    0x0210, 0x0210, 0x0210, 0x0210, 0x0211, 0x0211, 0x0211, 0x0211, 0x020D, 0x020E, 0x020E, 0x020D,
+    0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0212, 0x0213,
+    0x0214, 0x0214, 0x0212, 0x0000, 0x0215, 0x0215, 0x0216, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217,
+    0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0217, 0x0216,
+    0x0216, 0x0216, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0216,
+    0x0218, 0x0217, 0x0217, 0x0217, 0x0217, 0x0219, 0x0219, 0x0219, 0x0219, 0x021A, 0x021A, 0x021A,
+    0x021A, 0x0219, 0x0216, 0x0215, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021B,
+    0x021B, 0x021B, 0x0217, 0x0219, 0x0217, 0x0219, 0x0219, 0x0219, 0x0000, 0x021C, 0x021C, 0x021C,
+    0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C,
+    0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x0000, 0x0000, 0x0000, 0x021D, 0x021D, 0x021D, 0x021D,
+    0x021D, 0x021D, 0x021D, 0x021D, 0x021D, 0x021D, 0x0000, 0x021D, 0x021D, 0x021D, 0x021D, 0x021D,
+    0x021D, 0x021D, 0x021D, 0x021D, 0x021E, 0x021E, 0x021E, 0x021F, 0x021F, 0x021F, 0x021E, 0x021E,
+    0x021F, 0x0220, 0x0221, 0x021F, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x0222, 0x021F, 0x0000,
+    0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0000, 0x0223, 0x0000, 0x0223, 0x0223,
+    0x0223, 0x0223, 0x0000, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223,
+    0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0223, 0x0000, 0x0223, 0x0223, 0x0224, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225,
+    0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0226, 0x0227, 0x0227, 0x0227, 0x0226,
+    0x0226, 0x0226, 0x0226, 0x0226, 0x0226, 0x0228, 0x0228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0229, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x022A, 0x022A, 0x022B, 0x022B, 0x0000, 0x022C, 0x022C, 0x022C,
+    0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x0000, 0x0000, 0x022C, 0x022C, 0x0000, 0x0000, 0x022C,
+    0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C,
+    0x022C, 0x0000, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x0000, 0x022C, 0x022C,
+    0x0000, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x0000, 0x001D, 0x022D, 0x022C, 0x022B, 0x022B,
+    0x022A, 0x022B, 0x022B, 0x022B, 0x022B, 0x0000, 0x0000, 0x022B, 0x022B, 0x0000, 0x0000, 0x022B,
+    0x022B, 0x022E, 0x0000, 0x0000, 0x022C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022B, 0x022B,
+    0x0000, 0x0000, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 0x022D, 0x0000, 0x0000, 0x0000,
+    0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F,
+    0x022F, 0x0230, 0x0230, 0x0230, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231,
+    0x0230, 0x0230, 0x0232, 0x0231, 0x0231, 0x0230, 0x0232, 0x022F, 0x022F, 0x022F, 0x022F, 0x0233,
+    0x0233, 0x0233, 0x0233, 0x0233, 0x0234, 0x0234, 0x0234, 0x0234, 0x0234, 0x0234, 0x0234, 0x0234,
+    0x0234, 0x0234, 0x0233, 0x0233, 0x0000, 0x0233, 0x0232, 0x022F, 0x022F, 0x022F, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0235, 0x0235, 0x0235, 0x0235, 0x0235, 0x0235, 0x0235, 0x0235,
+    0x0236, 0x0236, 0x0236, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0236, 0x0237, 0x0236,
+    0x0236, 0x0236, 0x0236, 0x0237, 0x0237, 0x0236, 0x0238, 0x0238, 0x0235, 0x0235, 0x0239, 0x0235,
+    0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x023A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B,
+    0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023B, 0x023C, 0x023C, 0x023C, 0x023D, 0x023D,
+    0x023D, 0x023D, 0x0000, 0x0000, 0x023C, 0x023C, 0x023C, 0x023C, 0x023D, 0x023D, 0x023C, 0x023E,
+    0x023E, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F, 0x023F,
+    0x023F, 0x023F, 0x023F, 0x023F, 0x023B, 0x023B, 0x023B, 0x023B, 0x023D, 0x023D, 0x0000, 0x0000,
+    0x0240, 0x0240, 0x0240, 0x0240, 0x0240, 0x0240, 0x0240, 0x0240, 0x0241, 0x0241, 0x0241, 0x0242,
+    0x0242, 0x0242, 0x0242, 0x0242, 0x0242, 0x0242, 0x0242, 0x0241, 0x0241, 0x0242, 0x0241, 0x0243,
+    0x0242, 0x0244, 0x0244, 0x0244, 0x0240, 0x0000, 0x0000, 0x0000, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0245, 0x0245, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB,
+    0x00EB, 0x0000, 0x0000, 0x0000, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246, 0x0246,
+    0x0246, 0x0246, 0x0246, 0x0247, 0x0248, 0x0247, 0x0248, 0x0248, 0x0247, 0x0247, 0x0247, 0x0247,
+    0x0247, 0x0247, 0x0249, 0x024A, 0x0246, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x024C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D,
+    0x024D, 0x024D, 0x024D, 0x0000, 0x0000, 0x024E, 0x024E, 0x024E, 0x024F, 0x024F, 0x024E, 0x024E,
+    0x024E, 0x024E, 0x024F, 0x024E, 0x024E, 0x024E, 0x024E, 0x0250, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0252, 0x0252,
+    0x0253, 0x0253, 0x0253, 0x0254, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x024D, 0x0000,
+    0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255, 0x0255,
+    0x0256, 0x0256, 0x0256, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257, 0x0257,
+    0x0256, 0x0258, 0x0258, 0x0259, 0x0000, 0x0000, 0x0000, 0x0000, 0x025A, 0x025A, 0x025A, 0x025A,
+    0x025A, 0x025A, 0x025A, 0x025A, 0x025B, 0x025B, 0x025B, 0x025B, 0x025B, 0x025B, 0x025B, 0x025B,
+    0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025C, 0x025D, 0x025D,
+    0x025D, 0x025D, 0x025D, 0x025D, 0x025D, 0x025D, 0x025D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x025E, 0x025F, 0x025F, 0x025F, 0x025F,
+    0x025F, 0x025F, 0x025F, 0x0000, 0x0000, 0x025F, 0x0000, 0x0000, 0x025F, 0x025F, 0x025F, 0x025F,
+    0x025F, 0x025F, 0x025F, 0x025F, 0x0000, 0x025F, 0x025F, 0x0000, 0x025F, 0x025F, 0x025F, 0x025F,
+    0x025F, 0x025F, 0x025F, 0x025F, 0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x0260, 0x0000, 0x0260,
+    0x0260, 0x0000, 0x0000, 0x0261, 0x0261, 0x0262, 0x0263, 0x025F, 0x0260, 0x025F, 0x0260, 0x0263,
+    0x0264, 0x0264, 0x0264, 0x0000, 0x0265, 0x0265, 0x0265, 0x0265, 0x0265, 0x0265, 0x0265, 0x0265,
+    0x0265, 0x0265, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0266, 0x0266, 0x0266, 0x0266,
+    0x0266, 0x0266, 0x0266, 0x0266, 0x0000, 0x0000, 0x0266, 0x0266, 0x0266, 0x0266, 0x0266, 0x0266,
+    0x0266, 0x0267, 0x0267, 0x0267, 0x0268, 0x0268, 0x0268, 0x0268, 0x0000, 0x0000, 0x0268, 0x0268,
+    0x0267, 0x0267, 0x0267, 0x0267, 0x0269, 0x0266, 0x026A, 0x0266, 0x0267, 0x0000, 0x0000, 0x0000,
+    0x026B, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026C, 0x026B,
+    0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B, 0x026B,
+    0x026B, 0x026B, 0x026B, 0x026D, 0x026D, 0x026C, 0x026C, 0x026C, 0x026C, 0x026E, 0x026B, 0x026C,
+    0x026C, 0x026C, 0x026C, 0x026F, 0x026F, 0x026F, 0x026F, 0x026F, 0x026F, 0x026F, 0x026F, 0x026D,
+    0x0270, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0272, 0x0272, 0x0271, 0x0271, 0x0271,
+    0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270, 0x0270,
+    0x0270, 0x0270, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271,
+    0x0271, 0x0271, 0x0271, 0x0272, 0x0273, 0x0273, 0x0274, 0x0274, 0x0274, 0x0270, 0x0274, 0x0274,
+    0x0274, 0x0274, 0x0274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0275, 0x0275, 0x0275, 0x0275,
+    0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0000, 0x0276, 0x0276,
+    0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0277,
+    0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0000, 0x0278, 0x0278, 0x0278, 0x0278,
+    0x0278, 0x0278, 0x0277, 0x0279, 0x0276, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x0000, 0x0000,
+    0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027C, 0x027C,
+    0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C,
+    0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x0000, 0x0000, 0x0000, 0x027D, 0x027D, 0x027E, 0x027E,
+    0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E, 0x027E,
+    0x0000, 0x0000, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F,
+    0x027F, 0x027F, 0x027F, 0x027F, 0x0000, 0x0280, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F, 0x027F,
+    0x027F, 0x0280, 0x027F, 0x027F, 0x0280, 0x027F, 0x027F, 0x0000, 0x0281, 0x0281, 0x0281, 0x0281,
+    0x0281, 0x0281, 0x0281, 0x0000, 0x0281, 0x0281, 0x0000, 0x0281, 0x0281, 0x0281, 0x0281, 0x0281,
+    0x0281, 0x0281, 0x0281, 0x0281, 0x0281, 0x0281, 0x0281, 0x0281, 0x0281, 0x0282, 0x0282, 0x0282,
+    0x0282, 0x0282, 0x0282, 0x0000, 0x0000, 0x0000, 0x0282, 0x0000, 0x0282, 0x0282, 0x0000, 0x0282,
+    0x0282, 0x0282, 0x0283, 0x0282, 0x0283, 0x0283, 0x0281, 0x0282, 0x0284, 0x0284, 0x0284, 0x0284,
+    0x0284, 0x0284, 0x0284, 0x0284, 0x0284, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0000, 0x0285, 0x0285, 0x0000, 0x0285, 0x0285,
+    0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285, 0x0285,
+    0x0285, 0x0285, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0000, 0x0287, 0x0287, 0x0000, 0x0286,
+    0x0286, 0x0287, 0x0286, 0x0288, 0x0285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A,
+    0x028A, 0x028A, 0x028A, 0x028B, 0x028B, 0x028C, 0x028C, 0x028D, 0x028D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x015A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+    0x0085, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087,
+    0x0087, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+    0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x028E, 0x028F, 0x028F, 0x028F, 0x028F,
+    0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x028F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290,
+    0x0290, 0x0290, 0x0290, 0x0000, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0000, 0x0000, 0x0000,
+    0x028F, 0x028F, 0x028F, 0x028F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0292, 0x0292, 0x0292, 0x0292,
+    0x0292, 0x0292, 0x0292, 0x0292, 0x0292, 0x0293, 0x0293, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294,
+    0x0294, 0x0294, 0x0294, 0x0000, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295,
+    0x0295, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0296, 0x0296, 0x0296, 0x0296,
+    0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0000,
+    0x0164, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0297, 0x0297, 0x0297, 0x0297,
+    0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0000,
+    0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0299, 0x0299, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A,
+    0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x029A, 0x0000, 0x029B, 0x029B, 0x029B, 0x029B,
+    0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x029B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C, 0x029C,
+    0x029C, 0x029C, 0x0000, 0x0000, 0x029D, 0x029D, 0x029D, 0x029D, 0x029D, 0x029E, 0x0000, 0x0000,
+    0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x02A0, 0x02A0, 0x02A0, 0x02A0,
+    0x02A0, 0x02A0, 0x02A0, 0x02A1, 0x02A1, 0x02A1, 0x02A1, 0x02A1, 0x02A2, 0x02A2, 0x02A2, 0x02A2,
+    0x02A3, 0x02A3, 0x02A3, 0x02A3, 0x02A1, 0x02A2, 0x0000, 0x0000, 0x02A4, 0x02A4, 0x02A4, 0x02A4,
+    0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x02A4, 0x0000, 0x02A5, 0x02A5, 0x02A5, 0x02A5, 0x02A5,
+    0x02A5, 0x02A5, 0x0000, 0x029F, 0x029F, 0x029F, 0x029F, 0x029F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x029F, 0x029F, 0x029F, 0x02A6, 0x02A6, 0x02A6, 0x02A6, 0x02A6, 0x02A6, 0x02A6, 0x02A6,
+    0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A7, 0x02A8, 0x02A8, 0x02A8, 0x02A8,
+    0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A8, 0x02A9,
+    0x02A9, 0x02A9, 0x02A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02AA, 0x02AA, 0x02AA, 0x02AA,
+    0x02AA, 0x02AA, 0x02AA, 0x02AA, 0x02AA, 0x02AA, 0x02AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x02AB,
+    0x02AA, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x02AC,
+    0x02AC, 0x02AC, 0x02AC, 0x02AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02AB,
+    0x02AB, 0x02AB, 0x02AB, 0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AD,
+    0x02AD, 0x02AD, 0x02AD, 0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x014A, 0x02B1, 0x0000, 0x0000, 0x0000,
+    0x02B2, 0x02B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02B3, 0x02B3, 0x02B3, 0x02B3,
+    0x02B3, 0x02B3, 0x02B3, 0x02B3, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4,
+    0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x02B4, 0x0000, 0x0000, 0x02B3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0152, 0x0152, 0x0152, 0x0152, 0x0000, 0x0152, 0x0152, 0x0152,
+    0x0152, 0x0152, 0x0152, 0x0152, 0x0000, 0x0152, 0x0152, 0x0000, 0x0151, 0x014F, 0x014F, 0x014F,
+    0x014F, 0x014F, 0x014F, 0x014F, 0x0151, 0x0151, 0x0151, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x014F, 0x014F, 0x014F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0151, 0x0151, 0x0151, 0x0151, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B5,
+    0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x02B6, 0x02B6, 0x02B6, 0x02B6,
+    0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x0000, 0x0000, 0x0000, 0x02B6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02B6, 0x02B6, 0x0000, 0x0000, 0x02B7, 0x02B8, 0x02B9, 0x02BA,
+    0x0013, 0x0013, 0x0013, 0x0013, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x001D, 0x0000, 0x0000, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x0000,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0000, 0x0000, 0x0000, 0x000F, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x012B, 0x012B, 0x001D,
+    0x001D, 0x001D, 0x000F, 0x000F, 0x000F, 0x012B, 0x012B, 0x012B, 0x012B, 0x012B, 0x012B, 0x0013,
+    0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x001D, 0x001D, 0x001D, 0x000F, 0x000F, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x001D, 0x001D, 0x001D, 0x001D, 0x000F, 0x000F,
+    0x01A0, 0x01A0, 0x02BB, 0x02BB, 0x02BB, 0x01A0, 0x0000, 0x0000, 0x0014, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0134, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0000, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0134, 0x0000, 0x0134, 0x0134,
+    0x0000, 0x0000, 0x0134, 0x0000, 0x0000, 0x0134, 0x0134, 0x0000, 0x0000, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0000, 0x0134, 0x0134, 0x0015, 0x0015, 0x0000, 0x0015, 0x0000, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0000, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0134, 0x0134, 0x0000, 0x0134, 0x0134, 0x0134, 0x0134, 0x0000, 0x0000, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0000, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134,
+    0x0134, 0x0000, 0x0015, 0x0015, 0x0134, 0x0134, 0x0000, 0x0134, 0x0134, 0x0134, 0x0134, 0x0000,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0000, 0x0134, 0x0000, 0x0000, 0x0000, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0000, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0000, 0x0000, 0x0134, 0x0008, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0008, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0008,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0008, 0x0015, 0x0015,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0008, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0008, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0134, 0x0134,
+    0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0134, 0x0008, 0x0015, 0x0008, 0x0015, 0x0015,
+    0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0134, 0x0015, 0x0000, 0x0000, 0x000A, 0x000A,
+    0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BD, 0x02BD, 0x02BD, 0x02BD,
+    0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BC,
+    0x02BC, 0x02BC, 0x02BC, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD,
+    0x02BD, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BD, 0x02BC, 0x02BC,
+    0x02BC, 0x02BC, 0x02BC, 0x02BC, 0x02BD, 0x02BC, 0x02BC, 0x02BE, 0x02BE, 0x02BE, 0x02BE, 0x02BE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD,
+    0x0000, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x02BD, 0x000E, 0x000E, 0x0017, 0x000E,
+    0x000E, 0x000E, 0x000E, 0x000E, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x0000,
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x0000, 0x0000, 0x02BF,
+    0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x02BF, 0x0000, 0x02BF, 0x02BF, 0x0000, 0x02BF, 0x02BF,
+    0x02BF, 0x02BF, 0x02BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02C0, 0x02C0, 0x02C0, 0x02C0,
+    0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x0000, 0x0000, 0x0000,
+    0x02C1, 0x02C1, 0x02C1, 0x02C1, 0x02C1, 0x02C1, 0x02C1, 0x02C2, 0x02C2, 0x02C2, 0x02C2, 0x02C2,
+    0x02C2, 0x02C2, 0x0000, 0x0000, 0x02C3, 0x02C3, 0x02C3, 0x02C3, 0x02C3, 0x02C3, 0x02C3, 0x02C3,
+    0x02C3, 0x02C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x02C0, 0x02C4, 0x02C5, 0x02C5, 0x02C5, 0x02C5,
+    0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C5, 0x02C6, 0x0000,
+    0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7, 0x02C7,
+    0x02C8, 0x02C8, 0x02C8, 0x02C8, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9,
+    0x02C9, 0x02C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02CA, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+    0x0000, 0x00C5, 0x00C5, 0x0000, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB,
+    0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x02CB, 0x0000, 0x0000, 0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CC,
+    0x02CC, 0x02CC, 0x02CC, 0x02CC, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x0000,
+    0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CF, 0x02CF,
+    0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF,
+    0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02D0, 0x02D0, 0x02D0, 0x02D1, 0x02D0, 0x02D0, 0x02D0, 0x02D2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02D3, 0x02D3, 0x02D3, 0x02D3, 0x02D3, 0x02D3, 0x02D3, 0x02D3,
+    0x02D3, 0x02D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x02D4, 0x02D4, 0x0000, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x000F, 0x0014, 0x0014, 0x0014,
+    0x0005, 0x0014, 0x0014, 0x0014, 0x0014, 0x0000, 0x0000, 0x0000, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x000F, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0000, 0x0000,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0000,
+    0x0040, 0x0000, 0x0000, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0000, 0x0040,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040,
+    0x0000, 0x0040, 0x0000, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0000, 0x0040,
+    0x0000, 0x0040, 0x0000, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0000,
+    0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040, 0x0040, 0x0000, 0x0040, 0x0040, 0x0040,
+    0x003A, 0x003A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x02D5, 0x02D5, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x02D5, 0x02D5,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0010, 0x0010, 0x0010, 0x013A, 0x013A, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x013A, 0x013A, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x013B, 0x013B, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A,
+    0x013A, 0x013A, 0x013B, 0x013B, 0x013A, 0x013A, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x000F,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x000F, 0x000F, 0x02D6, 0x0010, 0x0010, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x000F, 0x000F, 0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x000F, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x000F, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x0010, 0x0010, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x0010, 0x0010, 0x0010, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x02D5, 0x02D5, 0x02D5,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x0010, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x000F, 0x000F, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x02D5, 0x02D5, 0x000F, 0x000F, 0x000F, 0x000F,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x000F, 0x000F, 0x000F, 0x0000, 0x000F, 0x000F, 0x000F, 0x000F, 0x000A, 0x000A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x0000, 0x0000,
+    0x0156, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0156, 0x0156, 0x0156, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0013, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133,
+    0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x0000, 0x0000,
+};
+
+static const char *UCD_SCRIPT_NAMES[162] = {
+    "Unknown",
+    "Common",
+    "Inherited",
+    "Adlam",
+    "Ahom",
+    "Anatolian_Hieroglyphs",
+    "Arabic",
+    "Armenian",
+    "Avestan",
+    "Balinese",
+    "Bamum",
+    "Bassa_Vah",
+    "Batak",
+    "Bengali",
+    "Bhaiksuki",
+    "Bopomofo",
+    "Brahmi",
+    "Braille",
+    "Buginese",
+    "Buhid",
+    "Canadian_Aboriginal",
+    "Carian",
+    "Caucasian_Albanian",
+    "Chakma",
+    "Cham",
+    "Cherokee",
+    "Chorasmian",
+    "Coptic",
+    "Cuneiform",
+    "Cypriot",
+    "Cypro_Minoan",
+    "Cyrillic",
+    "Deseret",
+    "Devanagari",
+    "Dives_Akuru",
+    "Dogra",
+    "Duployan",
+    "Egyptian_Hieroglyphs",
+    "Elbasan",
+    "Elymaic",
+    "Ethiopic",
+    "Georgian",
+    "Glagolitic",
+    "Gothic",
+    "Grantha",
+    "Greek",
+    "Gujarati",
+    "Gunjala_Gondi",
+    "Gurmukhi",
+    "Han",
+    "Hangul",
+    "Hanifi_Rohingya",
+    "Hanunoo",
+    "Hatran",
+    "Hebrew",
+    "Hiragana",
+    "Imperial_Aramaic",
+    "Inscriptional_Pahlavi",
+    "Inscriptional_Parthian",
+    "Javanese",
+    "Kaithi",
+    "Kannada",
+    "Katakana",
+    "Kayah_Li",
+    "Kharoshthi",
+    "Khitan_Small_Script",
+    "Khmer",
+    "Khojki",
+    "Khudawadi",
+    "Lao",
+    "Latin",
+    "Lepcha",
+    "Limbu",
+    "Linear_A",
+    "Linear_B",
+    "Lisu",
+    "Lycian",
+    "Lydian",
+    "Mahajani",
+    "Makasar",
+    "Malayalam",
+    "Mandaic",
+    "Manichaean",
+    "Marchen",
+    "Masaram_Gondi",
+    "Medefaidrin",
+    "Meetei_Mayek",
+    "Mende_Kikakui",
+    "Meroitic_Cursive",
+    "Meroitic_Hieroglyphs",
+    "Miao",
+    "Modi",
+    "Mongolian",
+    "Mro",
+    "Multani",
+    "Myanmar",
+    "Nabataean",
+    "Nandinagari",
+    "New_Tai_Lue",
+    "Newa",
+    "Nko",
+    "Nushu",
+    "Nyiakeng_Puachue_Hmong",
+    "Ogham",
+    "Ol_Chiki",
+    "Old_Hungarian",
+    "Old_Italic",
+    "Old_North_Arabian",
+    "Old_Permic",
+    "Old_Persian",
+    "Old_Sogdian",
+    "Old_South_Arabian",
+    "Old_Turkic",
+    "Old_Uyghur",
+    "Oriya",
+    "Osage",
+    "Osmanya",
+    "Pahawh_Hmong",
+    "Palmyrene",
+    "Pau_Cin_Hau",
+    "Phags_Pa",
+    "Phoenician",
+    "Psalter_Pahlavi",
+    "Rejang",
+    "Runic",
+    "Samaritan",
+    "Saurashtra",
+    "Sharada",
+    "Shavian",
+    "Siddham",
+    "SignWriting",
+    "Sinhala",
+    "Sogdian",
+    "Sora_Sompeng",
+    "Soyombo",
+    "Sundanese",
+    "Syloti_Nagri",
+    "Syriac",
+    "Tagalog",
+    "Tagbanwa",
+    "Tai_Le",
+    "Tai_Tham",
+    "Tai_Viet",
+    "Takri",
+    "Tamil",
+    "Tangsa",
+    "Tangut",
+    "Telugu",
+    "Thaana",
+    "Thai",
+    "Tibetan",
+    "Tifinagh",
+    "Tirhuta",
+    "Toto",
+    "Ugaritic",
+    "Vai",
+    "Vithkuqi",
+    "Wancho",
+    "Warang_Citi",
+    "Yezidi",
+    "Yi",
+    "Zanabazar_Square",
+};
+
+static const struct { int32_t delta; uint8_t full; } UCD_CASEFOLD_RECORDS[201] = {
+    {      0,   0 },
+    {     32,   0 },
+    {    775,   0 },
+    {      0,   1 },
+    {      1,   0 },
+    {      0,   2 },
+    {      0,   3 },
+    {   -121,   0 },
+    {   -268,   0 },
+    {    210,   0 },
+    {    206,   0 },
+    {    205,   0 },
+    {     79,   0 },
+    {    202,   0 },
+    {    203,   0 },
+    {    207,   0 },
+    {    211,   0 },
+    {    209,   0 },
+    {    213,   0 },
+    {    214,   0 },
+    {    218,   0 },
+    {    217,   0 },
+    {    219,   0 },
+    {      2,   0 },
+    {      0,   4 },
+    {    -97,   0 },
+    {    -56,   0 },
+    {   -130,   0 },
+    {  10795,   0 },
+    {   -163,   0 },
+    {  10792,   0 },
+    {   -195,   0 },
+    {     69,   0 },
+    {     71,   0 },
+    {    116,   0 },
+    {     38,   0 },
+    {     37,   0 },
+    {     64,   0 },
+    {     63,   0 },
+    {      0,   5 },
+    {      0,   6 },
+    {      8,   0 },
+    {    -30,   0 },
+    {    -25,   0 },
+    {    -15,   0 },
+    {    -22,   0 },
+    {    -54,   0 },
+    {    -48,   0 },
+    {    -60,   0 },
+    {    -64,   0 },
+    {     -7,   0 },
+    {     80,   0 },
+    {     15,   0 },
+    {     48,   0 },
+    {      0,   7 },
+    {   7264,   0 },
+    {     -8,   0 },
+    {  -6222,   0 },
+    {  -6221,   0 },
+    {  -6212,   0 },
+    {  -6210,   0 },
+    {  -6211,   0 },
+    {  -6204,   0 },
+    {  -6180,   0 },
+    {  35267,   0 },
+    {  -3008,   0 },
+    {      0,   8 },
+    {      0,   9 },
+    {      0,  10 },
+    {      0,  11 },
+    {      0,  12 },
+    {    -58,   0 },
+    {  -7615,  13 },
+    {      0,  14 },
+    {      0,  15 },
+    {      0,  16 },
+    {      0,  17 },
+    {      0,  18 },
+    {      0,  19 },
+    {      0,  20 },
+    {      0,  21 },
+    {      0,  22 },
+    {      0,  23 },
+    {      0,  24 },
+    {      0,  25 },
+    {     -8,  26 },
+    {     -8,  27 },
+    {     -8,  28 },
+    {     -8,  29 },
+    {     -8,  30 },
+    {     -8,  31 },
+    {     -8,  32 },
+    {     -8,  33 },
+    {      0,  34 },
+    {      0,  35 },
+    {      0,  36 },
+    {      0,  37 },
+    {      0,  38 },
+    {      0,  39 },
+    {      0,  40 },
+    {      0,  41 },
+    {     -8,  42 },
+    {     -8,  43 },
+    {     -8,  44 },
+    {     -8,  45 },
+    {     -8,  46 },
+    {     -8,  47 },
+    {     -8,  48 },
+    {     -8,  49 },
+    {      0,  50 },
+    {      0,  51 },
+    {      0,  52 },
+    {      0,  53 },
+    {      0,  54 },
+    {      0,  55 },
+    {      0,  56 },
+    {      0,  57 },
+    {     -8,  58 },
+    {     -8,  59 },
+    {     -8,  60 },
+    {     -8,  61 },
+    {     -8,  62 },
+    {     -8,  63 },
+    {     -8,  64 },
+    {     -8,  65 },
+    {      0,  66 },
+    {      0,  67 },
+    {      0,  68 },
+    {      0,  69 },
+    {      0,  70 },
+    {    -74,   0 },
+    {     -9,  71 },
+    {  -7173,   0 },
+    {      0,  72 },
+    {      0,  73 },
+    {      0,  74 },
+    {      0,  75 },
+    {      0,  76 },
+    {    -86,   0 },
+    {     -9,  77 },
+    {      0,  78 },
+    {      0,  79 },
+    {      0,  80 },
+    {      0,  81 },
+    {   -100,   0 },
+    {      0,  82 },
+    {      0,  83 },
+    {      0,  84 },
+    {      0,  85 },
+    {      0,  86 },
+    {   -112,   0 },
+    {      0,  87 },
+    {      0,  88 },
+    {      0,  89 },
+    {      0,  90 },
+    {      0,  91 },
+    {   -128,   0 },
+    {   -126,   0 },
+    {     -9,  92 },
+    {  -7517,   0 },
+    {  -8383,   0 },
+    {  -8262,   0 },
+    {     28,   0 },
+    {     16,   0 },
+    {     26,   0 },
+    { -10743,   0 },
+    {  -3814,   0 },
+    { -10727,   0 },
+    { -10780,   0 },
+    { -10749,   0 },
+    { -10783,   0 },
+    { -10782,   0 },
+    { -10815,   0 },
+    { -35332,   0 },
+    { -42280,   0 },
+    { -42308,   0 },
+    { -42319,   0 },
+    { -42315,   0 },
+    { -42305,   0 },
+    { -42258,   0 },
+    { -42282,   0 },
+    { -42261,   0 },
+    {    928,   0 },
+    { -42307,   0 },
+    { -35384,   0 },
+    { -38864,   0 },
+    {      0,  93 },
+    {      0,  94 },
+    {      0,  95 },
+    {      0,  96 },
+    {      0,  97 },
+    {      0,  98 },
+    {      0,  99 },
+    {      0, 100 },
+    {      0, 101 },
+    {      0, 102 },
+    {      0, 103 },
+    {      0, 104 },
+    {     40,   0 },
+    {     39,   0 },
+    {     34,   0 },
+};
+
+// Full foldings to more than one codepoint, padded with zeros.
+static const unipoint_t UCD_CASEFOLD_FULL[104][3] = {
+    { 0x0073, 0x0073, 0x0000 },
+    { 0x0069, 0x0307, 0x0000 },
+    { 0x02BC, 0x006E, 0x0000 },
+    { 0x006A, 0x030C, 0x0000 },
+    { 0x03B9, 0x0308, 0x0301 },
+    { 0x03C5, 0x0308, 0x0301 },
+    { 0x0565, 0x0582, 0x0000 },
+    { 0x0068, 0x0331, 0x0000 },
+    { 0x0074, 0x0308, 0x0000 },
+    { 0x0077, 0x030A, 0x0000 },
+    { 0x0079, 0x030A, 0x0000 },
+    { 0x0061, 0x02BE, 0x0000 },
+    { 0x0073, 0x0073, 0x0000 },
+    { 0x03C5, 0x0313, 0x0000 },
+    { 0x03C5, 0x0313, 0x0300 },
+    { 0x03C5, 0x0313, 0x0301 },
+    { 0x03C5, 0x0313, 0x0342 },
+    { 0x1F00, 0x03B9, 0x0000 },
+    { 0x1F01, 0x03B9, 0x0000 },
+    { 0x1F02, 0x03B9, 0x0000 },
+    { 0x1F03, 0x03B9, 0x0000 },
+    { 0x1F04, 0x03B9, 0x0000 },
+    { 0x1F05, 0x03B9, 0x0000 },
+    { 0x1F06, 0x03B9, 0x0000 },
+    { 0x1F07, 0x03B9, 0x0000 },
+    { 0x1F00, 0x03B9, 0x0000 },
+    { 0x1F01, 0x03B9, 0x0000 },
+    { 0x1F02, 0x03B9, 0x0000 },
+    { 0x1F03, 0x03B9, 0x0000 },
+    { 0x1F04, 0x03B9, 0x0000 },
+    { 0x1F05, 0x03B9, 0x0000 },
+    { 0x1F06, 0x03B9, 0x0000 },
+    { 0x1F07, 0x03B9, 0x0000 },
+    { 0x1F20, 0x03B9, 0x0000 },
+    { 0x1F21, 0x03B9, 0x0000 },
+    { 0x1F22, 0x03B9, 0x0000 },
+    { 0x1F23, 0x03B9, 0x0000 },
+    { 0x1F24, 0x03B9, 0x0000 },
+    { 0x1F25, 0x03B9, 0x0000 },
+    { 0x1F26, 0x03B9, 0x0000 },
+    { 0x1F27, 0x03B9, 0x0000 },
+    { 0x1F20, 0x03B9, 0x0000 },
+    { 0x1F21, 0x03B9, 0x0000 },
+    { 0x1F22, 0x03B9, 0x0000 },
+    { 0x1F23, 0x03B9, 0x0000 },
+    { 0x1F24, 0x03B9, 0x0000 },
+    { 0x1F25, 0x03B9, 0x0000 },
+    { 0x1F26, 0x03B9, 0x0000 },
+    { 0x1F27, 0x03B9, 0x0000 },
+    { 0x1F60, 0x03B9, 0x0000 },
+    { 0x1F61, 0x03B9, 0x0000 },
+    { 0x1F62, 0x03B9, 0x0000 },
+    { 0x1F63, 0x03B9, 0x0000 },
+    { 0x1F64, 0x03B9, 0x0000 },
+    { 0x1F65, 0x03B9, 0x0000 },
+    { 0x1F66, 0x03B9, 0x0000 },
+    { 0x1F67, 0x03B9, 0x0000 },
+    { 0x1F60, 0x03B9, 0x0000 },
+    { 0x1F61, 0x03B9, 0x0000 },
+    { 0x1F62, 0x03B9, 0x0000 },
+    { 0x1F63, 0x03B9, 0x0000 },
+    { 0x1F64, 0x03B9, 0x0000 },
+    { 0x1F65, 0x03B9, 0x0000 },
+    { 0x1F66, 0x03B9, 0x0000 },
+    { 0x1F67, 0x03B9, 0x0000 },
+    { 0x1F70, 0x03B9, 0x0000 },
+    { 0x03B1, 0x03B9, 0x0000 },
+    { 0x03AC, 0x03B9, 0x0000 },
+    { 0x03B1, 0x0342, 0x0000 },
+    { 0x03B1, 0x0342, 0x03B9 },
+    { 0x03B1, 0x03B9, 0x0000 },
+    { 0x1F74, 0x03B9, 0x0000 },
+    { 0x03B7, 0x03B9, 0x0000 },
+    { 0x03AE, 0x03B9, 0x0000 },
+    { 0x03B7, 0x0342, 0x0000 },
+    { 0x03B7, 0x0342, 0x03B9 },
+    { 0x03B7, 0x03B9, 0x0000 },
+    { 0x03B9, 0x0308, 0x0300 },
+    { 0x03B9, 0x0308, 0x0301 },
+    { 0x03B9, 0x0342, 0x0000 },
+    { 0x03B9, 0x0308, 0x0342 },
+    { 0x03C5, 0x0308, 0x0300 },
+    { 0x03C5, 0x0308, 0x0301 },
+    { 0x03C1, 0x0313, 0x0000 },
+    { 0x03C5, 0x0342, 0x0000 },
+    { 0x03C5, 0x0308, 0x0342 },
+    { 0x1F7C, 0x03B9, 0x0000 },
+    { 0x03C9, 0x03B9, 0x0000 },
+    { 0x03CE, 0x03B9, 0x0000 },
+    { 0x03C9, 0x0342, 0x0000 },
+    { 0x03C9, 0x0342, 0x03B9 },
+    { 0x03C9, 0x03B9, 0x0000 },
+    { 0x0066, 0x0066, 0x0000 },
+    { 0x0066, 0x0069, 0x0000 },
+    { 0x0066, 0x006C, 0x0000 },
+    { 0x0066, 0x0066, 0x0069 },
+    { 0x0066, 0x0066, 0x006C },
+    { 0x0073, 0x0074, 0x0000 },
+    { 0x0073, 0x0074, 0x0000 },
+    { 0x0574, 0x0576, 0x0000 },
+    { 0x0574, 0x0565, 0x0000 },
+    { 0x0574, 0x056B, 0x0000 },
+    { 0x057E, 0x0576, 0x0000 },
+    { 0x0574, 0x056D, 0x0000 },
+};
+
+#define UCD_CASEFOLD_BITS2 6
+#define UCD_CASEFOLD_BITS3 4
+
+static const uint8_t UCD_CASEFOLD_STAGE1[1088] = {
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x05, 0x06, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x09, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0B,
+    0x02, 0x0C, 0x02, 0x0D, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+};
+
+static const uint8_t UCD_CASEFOLD_STAGE2[1088] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x07, 0x08, 0x06, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x06, 0x10,
+    0x06, 0x06, 0x11, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x06, 0x1C,
+    0x1D, 0x04, 0x04, 0x00, 0x00, 0x00, 0x06, 0x06, 0x1E, 0x06, 0x06, 0x06, 0x1F, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x20, 0x21, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x25, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x28, 0x28, 0x29, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x2A, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x2B, 0x26, 0x2B, 0x2B, 0x26, 0x2C, 0x2B, 0x00, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x35, 0x36, 0x00, 0x00, 0x37, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x21, 0x21, 0x00, 0x00, 0x00, 0x3B, 0x3C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3D, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x3F, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x41, 0x06, 0x06, 0x06, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x00, 0x49,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4D, 0x4D, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x4D, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x52, 0x52, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0x54, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t UCD_CASEFOLD_STAGE3[1376] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08,
+    0x00, 0x09, 0x04, 0x00, 0x04, 0x00, 0x0A, 0x04, 0x00, 0x0B, 0x0B, 0x04, 0x00, 0x00, 0x0C, 0x0D,
+    0x0E, 0x04, 0x00, 0x0B, 0x0F, 0x00, 0x10, 0x11, 0x04, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x13,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x14, 0x04, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x14, 0x04,
+    0x00, 0x15, 0x15, 0x04, 0x00, 0x04, 0x00, 0x16, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x00, 0x17, 0x04, 0x00, 0x17, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00,
+    0x18, 0x17, 0x04, 0x00, 0x04, 0x00, 0x19, 0x1A, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x1B, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x04, 0x00, 0x1D, 0x1E, 0x00,
+    0x00, 0x04, 0x00, 0x1F, 0x20, 0x21, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x24, 0x24, 0x24, 0x00, 0x25, 0x00, 0x26, 0x26,
+    0x27, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x2A, 0x2B, 0x00, 0x00, 0x00, 0x2C, 0x2D, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x2E, 0x2F, 0x00, 0x00, 0x30, 0x31, 0x00, 0x04, 0x00, 0x32, 0x04, 0x00, 0x00, 0x1B, 0x1B, 0x1B,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x34, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+    0x39, 0x3A, 0x3B, 0x3C, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x41, 0x41, 0x41,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x00, 0x00, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+    0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C,
+    0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C,
+    0x00, 0x00, 0x7D, 0x7E, 0x7F, 0x00, 0x80, 0x81, 0x38, 0x38, 0x82, 0x82, 0x83, 0x00, 0x84, 0x00,
+    0x00, 0x00, 0x85, 0x86, 0x87, 0x00, 0x88, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8C, 0x8D, 0x00, 0x00, 0x8E, 0x8F, 0x38, 0x38, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x91, 0x92, 0x93, 0x00, 0x94, 0x95, 0x38, 0x38, 0x96, 0x96, 0x32, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x97, 0x98, 0x99, 0x00, 0x9A, 0x9B, 0x9C, 0x9C, 0x9D, 0x9D, 0x9E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0xA1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+    0x04, 0x00, 0xA5, 0xA6, 0xA7, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xA8, 0xA9, 0xAA,
+    0xAB, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xAC,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xAD, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xAE, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xAF, 0xB0, 0xB1, 0xB2, 0xAF, 0x00,
+    0xB3, 0xB4, 0xB5, 0xB6, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x2F, 0xB7, 0xB8, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0xC7, 0xC7, 0xC7, 0xC7,
+    0xC7, 0xC7, 0xC7, 0x00, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+    0xC8, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct {
+    uint8_t combining_class; uint8_t flags; uint8_t decomposition_length; uint8_t composition_count;
+    uint16_t decomposition; uint16_t composition;
+} UCD_NORMALIZATION_RECORDS[2369] = {
+    {   0,  0, 0,  0,    0,   0 },
+    {   0,  0, 0,  1,    0,   0 },
+    {   0,  0, 0,  1,    0,   1 },
+    {   0,  0, 0,  1,    0,   2 },
+    {   0,  0, 0, 16,    0,   3 },
+    {   0,  0, 0,  3,    0,  19 },
+    {   0,  0, 0,  5,    0,  22 },
+    {   0,  0, 0,  6,    0,  27 },
+    {   0,  0, 0, 17,    0,  33 },
+    {   0,  0, 0,  1,    0,  50 },
+    {   0,  0, 0,  7,    0,  51 },
+    {   0,  0, 0,  7,    0,  58 },
+    {   0,  0, 0, 15,    0,  65 },
+    {   0,  0, 0,  1,    0,  80 },
+    {   0,  0, 0,  5,    0,  81 },
+    {   0,  0, 0,  6,    0,  86 },
+    {   0,  0, 0,  3,    0,  92 },
+    {   0,  0, 0,  9,    0,  95 },
+    {   0,  0, 0, 16,    0, 104 },
+    {   0,  0, 0,  2,    0, 120 },
+    {   0,  0, 0,  8,    0, 122 },
+    {   0,  0, 0,  7,    0, 130 },
+    {   0,  0, 0,  7,    0, 137 },
+    {   0,  0, 0, 19,    0, 144 },
+    {   0,  0, 0,  2,    0, 163 },
+    {   0,  0, 0,  6,    0, 165 },
+    {   0,  0, 0,  2,    0, 171 },
+    {   0,  0, 0,  9,    0, 173 },
+    {   0,  0, 0,  6,    0, 182 },
+    {   0,  0, 0, 16,    0, 188 },
+    {   0,  0, 0,  3,    0, 204 },
+    {   0,  0, 0,  5,    0, 207 },
+    {   0,  0, 0,  6,    0, 212 },
+    {   0,  0, 0, 17,    0, 218 },
+    {   0,  0, 0,  1,    0, 235 },
+    {   0,  0, 0,  7,    0, 236 },
+    {   0,  0, 0,  8,    0, 243 },
+    {   0,  0, 0, 14,    0, 251 },
+    {   0,  0, 0,  2,    0, 265 },
+    {   0,  0, 0,  5,    0, 267 },
+    {   0,  0, 0,  6,    0, 272 },
+    {   0,  0, 0,  3,    0, 278 },
+    {   0,  0, 0,  9,    0, 281 },
+    {   0,  0, 0, 16,    0, 290 },
+    {   0,  0, 0,  2,    0, 306 },
+    {   0,  0, 0,  8,    0, 308 },
+    {   0,  0, 0,  7,    0, 316 },
+    {   0,  0, 0,  8,    0, 323 },
+    {   0,  0, 0, 19,    0, 331 },
+    {   0,  0, 0,  2,    0, 350 },
+    {   0,  0, 0,  7,    0, 352 },
+    {   0,  0, 0,  2,    0, 359 },
+    {   0,  0, 0, 10,    0, 361 },
+    {   0,  0, 0,  6,    0, 371 },
+    {   0,  0, 0,  3,    0, 377 },
+    {   0,  1, 2,  0,    0,   0 },
+    {   0,  1, 2,  0,    2,   0 },
+    {   0,  1, 2,  4,    4, 380 },
+    {   0,  1, 2,  0,    6,   0 },
+    {   0,  1, 2,  1,    8, 384 },
+    {   0,  1, 2,  1,   10, 385 },
+    {   0,  0, 0,  2,    0, 386 },
+    {   0,  1, 2,  1,   12, 388 },
+    {   0,  1, 2,  0,   14,   0 },
+    {   0,  1, 2,  0,   16,   0 },
+    {   0,  1, 2,  4,   18, 389 },
+    {   0,  1, 2,  0,   20,   0 },
+    {   0,  1, 2,  0,   22,   0 },
+    {   0,  1, 2,  0,   24,   0 },
+    {   0,  1, 2,  0,   26,   0 },
+    {   0,  1, 2,  1,   28, 393 },
+    {   0,  1, 2,  0,   30,   0 },
+    {   0,  1, 2,  0,   32,   0 },
+    {   0,  1, 2,  0,   34,   0 },
+    {   0,  1, 2,  4,   36, 394 },
+    {   0,  1, 2,  3,   38, 398 },
+    {   0,  1, 2,  1,   40, 401 },
+    {   0,  0, 0,  1,    0, 402 },
+    {   0,  1, 2,  0,   42,   0 },
+    {   0,  1, 2,  0,   44,   0 },
+    {   0,  1, 2,  0,   46,   0 },
+    {   0,  1, 2,  4,   48, 403 },
+    {   0,  1, 2,  0,   50,   0 },
+    {   0,  1, 2,  0,   52,   0 },
+    {   0,  1, 2,  0,   54,   0 },
+    {   0,  1, 2,  4,   56, 407 },
+    {   0,  1, 2,  0,   58,   0 },
+    {   0,  1, 2,  1,   60, 411 },
+    {   0,  1, 2,  1,   62, 412 },
+    {   0,  0, 0,  2,    0, 413 },
+    {   0,  1, 2,  1,   64, 415 },
+    {   0,  1, 2,  0,   66,   0 },
+    {   0,  1, 2,  0,   68,   0 },
+    {   0,  1, 2,  4,   70, 416 },
+    {   0,  1, 2,  0,   72,   0 },
+    {   0,  1, 2,  0,   74,   0 },
+    {   0,  1, 2,  0,   76,   0 },
+    {   0,  1, 2,  0,   78,   0 },
+    {   0,  1, 2,  1,   80, 420 },
+    {   0,  1, 2,  0,   82,   0 },
+    {   0,  1, 2,  0,   84,   0 },
+    {   0,  1, 2,  0,   86,   0 },
+    {   0,  1, 2,  4,   88, 421 },
+    {   0,  1, 2,  3,   90, 425 },
+    {   0,  1, 2,  1,   92, 428 },
+    {   0,  0, 0,  1,    0, 429 },
+    {   0,  1, 2,  0,   94,   0 },
+    {   0,  1, 2,  0,   96,   0 },
+    {   0,  1, 2,  0,   98,   0 },
+    {   0,  1, 2,  4,  100, 430 },
+    {   0,  1, 2,  0,  102,   0 },
+    {   0,  1, 2,  0,  104,   0 },
+    {   0,  1, 2,  0,  106,   0 },
+    {   0,  1, 2,  0,  108,   0 },
+    {   0,  1, 2,  4,  110, 434 },
+    {   0,  1, 2,  4,  112, 438 },
+    {   0,  1, 2,  0,  114,   0 },
+    {   0,  1, 2,  0,  116,   0 },
+    {   0,  1, 2,  0,  118,   0 },
+    {   0,  1, 2,  0,  120,   0 },
+    {   0,  1, 2,  0,  122,   0 },
+    {   0,  1, 2,  0,  124,   0 },
+    {   0,  1, 2,  0,  126,   0 },
+    {   0,  1, 2,  0,  128,   0 },
+    {   0,  1, 2,  0,  130,   0 },
+    {   0,  1, 2,  0,  132,   0 },
+    {   0,  1, 2,  0,  134,   0 },
+    {   0,  1, 2,  0,  136,   0 },
+    {   0,  1, 2,  2,  138, 442 },
+    {   0,  1, 2,  2,  140, 444 },
+    {   0,  1, 2,  0,  142,   0 },
+    {   0,  1, 2,  0,  144,   0 },
+    {   0,  1, 2,  0,  146,   0 },
+    {   0,  1, 2,  0,  148,   0 },
+    {   0,  1, 2,  0,  150,   0 },
+    {   0,  1, 2,  0,  152,   0 },
+    {   0,  1, 2,  0,  154,   0 },
+    {   0,  1, 2,  0,  156,   0 },
+    {   0,  1, 2,  0,  158,   0 },
+    {   0,  1, 2,  0,  160,   0 },
+    {   0,  1, 2,  0,  162,   0 },
+    {   0,  1, 2,  0,  164,   0 },
+    {   0,  1, 2,  0,  166,   0 },
+    {   0,  1, 2,  0,  168,   0 },
+    {   0,  1, 2,  0,  170,   0 },
+    {   0,  1, 2,  0,  172,   0 },
+    {   0,  1, 2,  0,  174,   0 },
+    {   0,  1, 2,  0,  176,   0 },
+    {   0,  1, 2,  0,  178,   0 },
+    {   0,  1, 2,  0,  180,   0 },
+    {   0,  1, 2,  0,  182,   0 },
+    {   0,  1, 2,  0,  184,   0 },
+    {   0,  1, 2,  0,  186,   0 },
+    {   0,  1, 2,  0,  188,   0 },
+    {   0,  1, 2,  0,  190,   0 },
+    {   0,  1, 2,  0,  192,   0 },
+    {   0,  1, 2,  0,  194,   0 },
+    {   0,  1, 2,  0,  196,   0 },
+    {   0,  1, 2,  0,  198,   0 },
+    {   0,  1, 2,  0,  200,   0 },
+    {   0,  1, 2,  0,  202,   0 },
+    {   0,  1, 2,  0,  204,   0 },
+    {   0,  1, 2,  0,  206,   0 },
+    {   0,  1, 2,  0,  208,   0 },
+    {   0,  1, 2,  0,  210,   0 },
+    {   0,  1, 2,  0,  212,   0 },
+    {   0,  1, 2,  0,  214,   0 },
+    {   0,  1, 2,  0,  216,   0 },
+    {   0,  1, 2,  0,  218,   0 },
+    {   0,  1, 2,  0,  220,   0 },
+    {   0,  1, 2,  0,  222,   0 },
+    {   0,  1, 2,  0,  224,   0 },
+    {   0,  1, 2,  0,  226,   0 },
+    {   0,  1, 2,  2,  228, 446 },
+    {   0,  1, 2,  2,  230, 448 },
+    {   0,  1, 2,  0,  232,   0 },
+    {   0,  1, 2,  0,  234,   0 },
+    {   0,  1, 2,  0,  236,   0 },
+    {   0,  1, 2,  0,  238,   0 },
+    {   0,  1, 2,  0,  240,   0 },
+    {   0,  1, 2,  0,  242,   0 },
+    {   0,  1, 2,  0,  244,   0 },
+    {   0,  1, 2,  0,  246,   0 },
+    {   0,  1, 2,  0,  248,   0 },
+    {   0,  1, 2,  0,  250,   0 },
+    {   0,  1, 2,  1,  252, 450 },
+    {   0,  1, 2,  1,  254, 451 },
+    {   0,  1, 2,  0,  256,   0 },
+    {   0,  1, 2,  0,  258,   0 },
+    {   0,  1, 2,  0,  260,   0 },
+    {   0,  1, 2,  0,  262,   0 },
+    {   0,  1, 2,  1,  264, 452 },
+    {   0,  1, 2,  1,  266, 453 },
+    {   0,  1, 2,  0,  268,   0 },
+    {   0,  1, 2,  0,  270,   0 },
+    {   0,  1, 2,  0,  272,   0 },
+    {   0,  1, 2,  0,  274,   0 },
+    {   0,  1, 2,  1,  276, 454 },
+    {   0,  1, 2,  1,  278, 455 },
+    {   0,  1, 2,  1,  280, 456 },
+    {   0,  1, 2,  1,  282, 457 },
+    {   0,  1, 2,  0,  284,   0 },
+    {   0,  1, 2,  0,  286,   0 },
+    {   0,  1, 2,  0,  288,   0 },
+    {   0,  1, 2,  0,  290,   0 },
+    {   0,  1, 2,  0,  292,   0 },
+    {   0,  1, 2,  0,  294,   0 },
+    {   0,  1, 2,  0,  296,   0 },
+    {   0,  1, 2,  0,  298,   0 },
+    {   0,  1, 2,  0,  300,   0 },
+    {   0,  1, 2,  0,  302,   0 },
+    {   0,  1, 2,  0,  304,   0 },
+    {   0,  1, 2,  0,  306,   0 },
+    {   0,  1, 2,  0,  308,   0 },
+    {   0,  1, 2,  0,  310,   0 },
+    {   0,  1, 2,  0,  312,   0 },
+    {   0,  1, 2,  0,  314,   0 },
+    {   0,  1, 2,  0,  316,   0 },
+    {   0,  1, 2,  0,  318,   0 },
+    {   0,  1, 2,  0,  320,   0 },
+    {   0,  0, 0,  1,    0, 458 },
+    {   0,  1, 2,  5,  322, 459 },
+    {   0,  1, 2,  5,  324, 464 },
+    {   0,  1, 2,  5,  326, 469 },
+    {   0,  1, 2,  5,  328, 474 },
+    {   0,  0, 0,  1,    0, 479 },
+    {   0,  1, 2,  0,  330,   0 },
+    {   0,  1, 2,  0,  332,   0 },
+    {   0,  1, 2,  0,  334,   0 },
+    {   0,  1, 2,  0,  336,   0 },
+    {   0,  1, 2,  0,  338,   0 },
+    {   0,  1, 2,  0,  340,   0 },
+    {   0,  1, 2,  0,  342,   0 },
+    {   0,  1, 2,  0,  344,   0 },
+    {   0,  1, 3,  0,  346,   0 },
+    {   0,  1, 3,  0,  349,   0 },
+    {   0,  1, 3,  0,  352,   0 },
+    {   0,  1, 3,  0,  355,   0 },
+    {   0,  1, 3,  0,  358,   0 },
+    {   0,  1, 3,  0,  361,   0 },
+    {   0,  1, 3,  0,  364,   0 },
+    {   0,  1, 3,  0,  367,   0 },
+    {   0,  1, 3,  0,  370,   0 },
+    {   0,  1, 3,  0,  373,   0 },
+    {   0,  1, 3,  0,  376,   0 },
+    {   0,  1, 3,  0,  379,   0 },
+    {   0,  1, 2,  0,  382,   0 },
+    {   0,  1, 2,  0,  384,   0 },
+    {   0,  1, 2,  0,  386,   0 },
+    {   0,  1, 2,  0,  388,   0 },
+    {   0,  1, 2,  0,  390,   0 },
+    {   0,  1, 2,  0,  392,   0 },
+    {   0,  1, 2,  1,  394, 480 },
+    {   0,  1, 2,  1,  396, 481 },
+    {   0,  1, 3,  0,  398,   0 },
+    {   0,  1, 3,  0,  401,   0 },
+    {   0,  1, 2,  0,  404,   0 },
+    {   0,  1, 2,  0,  406,   0 },
+    {   0,  1, 2,  0,  408,   0 },
+    {   0,  1, 2,  0,  410,   0 },
+    {   0,  1, 2,  0,  412,   0 },
+    {   0,  1, 2,  0,  414,   0 },
+    {   0,  1, 2,  0,  416,   0 },
+    {   0,  1, 3,  0,  418,   0 },
+    {   0,  1, 3,  0,  421,   0 },
+    {   0,  1, 2,  0,  424,   0 },
+    {   0,  1, 2,  0,  426,   0 },
+    {   0,  1, 2,  0,  428,   0 },
+    {   0,  1, 2,  0,  430,   0 },
+    {   0,  1, 2,  0,  432,   0 },
+    {   0,  1, 2,  0,  434,   0 },
+    {   0,  1, 2,  0,  436,   0 },
+    {   0,  1, 2,  0,  438,   0 },
+    {   0,  1, 2,  0,  440,   0 },
+    {   0,  1, 2,  0,  442,   0 },
+    {   0,  1, 2,  0,  444,   0 },
+    {   0,  1, 2,  0,  446,   0 },
+    {   0,  1, 2,  0,  448,   0 },
+    {   0,  1, 2,  0,  450,   0 },
+    {   0,  1, 2,  0,  452,   0 },
+    {   0,  1, 2,  0,  454,   0 },
+    {   0,  1, 2,  0,  456,   0 },
+    {   0,  1, 2,  0,  458,   0 },
+    {   0,  1, 2,  0,  460,   0 },
+    {   0,  1, 2,  0,  462,   0 },
+    {   0,  1, 2,  0,  464,   0 },
+    {   0,  1, 2,  0,  466,   0 },
+    {   0,  1, 2,  0,  468,   0 },
+    {   0,  1, 2,  0,  470,   0 },
+    {   0,  1, 2,  0,  472,   0 },
+    {   0,  1, 2,  0,  474,   0 },
+    {   0,  1, 2,  0,  476,   0 },
+    {   0,  1, 2,  0,  478,   0 },
+    {   0,  1, 2,  0,  480,   0 },
+    {   0,  1, 2,  0,  482,   0 },
+    {   0,  1, 2,  0,  484,   0 },
+    {   0,  1, 2,  0,  486,   0 },
+    {   0,  1, 2,  0,  488,   0 },
+    {   0,  1, 2,  0,  490,   0 },
+    {   0,  1, 2,  1,  492, 482 },
+    {   0,  1, 2,  1,  494, 483 },
+    {   0,  1, 2,  1,  496, 484 },
+    {   0,  1, 2,  1,  498, 485 },
+    {   0,  1, 3,  0,  500,   0 },
+    {   0,  1, 3,  0,  503,   0 },
+    {   0,  1, 3,  0,  506,   0 },
+    {   0,  1, 3,  0,  509,   0 },
+    {   0,  1, 2,  1,  512, 486 },
+    {   0,  1, 2,  1,  514, 487 },
+    {   0,  1, 3,  0,  516,   0 },
+    {   0,  1, 3,  0,  519,   0 },
+    {   0,  1, 2,  0,  522,   0 },
+    {   0,  1, 2,  0,  524,   0 },
+    {   0,  0, 0,  1,    0, 488 },
+    { 230, 12, 0,  0,    0,   0 },
+    { 230,  8, 0,  0,    0,   0 },
+    { 232,  8, 0,  0,    0,   0 },
+    { 220,  8, 0,  0,    0,   0 },
+    { 216, 12, 0,  0,    0,   0 },
+    { 202,  8, 0,  0,    0,   0 },
+    { 220, 12, 0,  0,    0,   0 },
+    { 202, 12, 0,  0,    0,   0 },
+    {   1,  8, 0,  0,    0,   0 },
+    {   1, 12, 0,  0,    0,   0 },
+    { 230, 11, 1,  0,  526,   0 },
+    { 230, 11, 1,  0,  527,   0 },
+    { 230, 11, 1,  0,  528,   0 },
+    { 230, 11, 2,  0,  529,   0 },
+    { 240, 12, 0,  0,    0,   0 },
+    { 233,  8, 0,  0,    0,   0 },
+    { 234,  8, 0,  0,    0,   0 },
+    {   0,  3, 1,  0,  531,   0 },
+    {   0,  3, 1,  0,  532,   0 },
+    {   0,  1, 2,  0,  533,   0 },
+    {   0,  1, 2,  0,  535,   0 },
+    {   0,  3, 1,  0,  537,   0 },
+    {   0,  1, 2,  0,  538,   0 },
+    {   0,  1, 2,  0,  540,   0 },
+    {   0,  1, 2,  0,  542,   0 },
+    {   0,  1, 2,  0,  544,   0 },
+    {   0,  1, 2,  0,  546,   0 },
+    {   0,  1, 2,  0,  548,   0 },
+    {   0,  1, 3,  0,  550,   0 },
+    {   0,  0, 0,  7,    0, 489 },
+    {   0,  0, 0,  4,    0, 496 },
+    {   0,  0, 0,  5,    0, 500 },
+    {   0,  0, 0,  7,    0, 505 },
+    {   0,  0, 0,  4,    0, 512 },
+    {   0,  0, 0,  1,    0, 516 },
+    {   0,  0, 0,  6,    0, 517 },
+    {   0,  0, 0,  5,    0, 523 },
+    {   0,  1, 2,  0,  553,   0 },
+    {   0,  1, 2,  0,  555,   0 },
+    {   0,  1, 2,  1,  557, 528 },
+    {   0,  1, 2,  0,  559,   0 },
+    {   0,  1, 2,  1,  561, 529 },
+    {   0,  1, 2,  0,  563,   0 },
+    {   0,  1, 3,  0,  565,   0 },
+    {   0,  0, 0,  8,    0, 530 },
+    {   0,  0, 0,  4,    0, 538 },
+    {   0,  0, 0,  6,    0, 542 },
+    {   0,  0, 0,  8,    0, 548 },
+    {   0,  0, 0,  4,    0, 556 },
+    {   0,  0, 0,  2,    0, 560 },
+    {   0,  0, 0,  8,    0, 562 },
+    {   0,  0, 0,  6,    0, 570 },
+    {   0,  1, 2,  3,  568, 576 },
+    {   0,  1, 2,  3,  570, 579 },
+    {   0,  1, 2,  0,  572,   0 },
+    {   0,  1, 2,  0,  574,   0 },
+    {   0,  1, 2,  1,  576, 582 },
+    {   0,  0, 0,  2,    0, 583 },
+    {   0,  1, 2,  0,  578,   0 },
+    {   0,  1, 2,  0,  580,   0 },
+    {   0,  1, 2,  0,  582,   0 },
+    {   0,  1, 2,  0,  584,   0 },
+    {   0,  1, 2,  0,  586,   0 },
+    {   0,  0, 0,  1,    0, 585 },
+    {   0,  1, 2,  0,  588,   0 },
+    {   0,  1, 2,  0,  590,   0 },
+    {   0,  1, 2,  0,  592,   0 },
+    {   0,  1, 2,  0,  594,   0 },
+    {   0,  0, 0,  2,    0, 586 },
+    {   0,  0, 0,  1,    0, 588 },
+    {   0,  0, 0,  3,    0, 589 },
+    {   0,  0, 0,  2,    0, 592 },
+    {   0,  0, 0,  1,    0, 594 },
+    {   0,  0, 0,  4,    0, 595 },
+    {   0,  1, 2,  0,  596,   0 },
+    {   0,  0, 0,  1,    0, 599 },
+    {   0,  0, 0,  1,    0, 600 },
+    {   0,  0, 0,  4,    0, 601 },
+    {   0,  0, 0,  1,    0, 605 },
+    {   0,  0, 0,  1,    0, 606 },
+    {   0,  0, 0,  1,    0, 607 },
+    {   0,  0, 0,  2,    0, 608 },
+    {   0,  0, 0,  1,    0, 610 },
+    {   0,  0, 0,  3,    0, 611 },
+    {   0,  0, 0,  2,    0, 614 },
+    {   0,  0, 0,  1,    0, 616 },
+    {   0,  0, 0,  4,    0, 617 },
+    {   0,  1, 2,  0,  598,   0 },
+    {   0,  0, 0,  1,    0, 621 },
+    {   0,  0, 0,  1,    0, 622 },
+    {   0,  0, 0,  4,    0, 623 },
+    {   0,  0, 0,  1,    0, 627 },
+    {   0,  0, 0,  1,    0, 628 },
+    {   0,  0, 0,  1,    0, 629 },
+    {   0,  1, 2,  0,  600,   0 },
+    {   0,  1, 2,  0,  602,   0 },
+    {   0,  1, 2,  0,  604,   0 },
+    {   0,  0, 0,  1,    0, 630 },
+    {   0,  1, 2,  0,  606,   0 },
+    {   0,  1, 2,  0,  608,   0 },
+    {   0,  1, 2,  0,  610,   0 },
+    {   0,  1, 2,  0,  612,   0 },
+    {   0,  0, 0,  1,    0, 631 },
+    {   0,  0, 0,  1,    0, 632 },
+    {   0,  1, 2,  0,  614,   0 },
+    {   0,  1, 2,  0,  616,   0 },
+    {   0,  1, 2,  0,  618,   0 },
+    {   0,  1, 2,  0,  620,   0 },
+    {   0,  1, 2,  0,  622,   0 },
+    {   0,  1, 2,  0,  624,   0 },
+    {   0,  1, 2,  0,  626,   0 },
+    {   0,  1, 2,  0,  628,   0 },
+    {   0,  1, 2,  0,  630,   0 },
+    {   0,  1, 2,  0,  632,   0 },
+    {   0,  0, 0,  1,    0, 633 },
+    {   0,  0, 0,  1,    0, 634 },
+    {   0,  1, 2,  0,  634,   0 },
+    {   0,  1, 2,  0,  636,   0 },
+    {   0,  1, 2,  0,  638,   0 },
+    {   0,  1, 2,  0,  640,   0 },
+    {   0,  1, 2,  0,  642,   0 },
+    {   0,  1, 2,  0,  644,   0 },
+    {   0,  1, 2,  0,  646,   0 },
+    {   0,  1, 2,  0,  648,   0 },
+    {   0,  1, 2,  0,  650,   0 },
+    {   0,  1, 2,  0,  652,   0 },
+    {   0,  1, 2,  0,  654,   0 },
+    {   0,  1, 2,  0,  656,   0 },
+    {   0,  0, 0,  1,    0, 635 },
+    {   0,  0, 0,  1,    0, 636 },
+    {   0,  1, 2,  0,  658,   0 },
+    {   0,  1, 2,  0,  660,   0 },
+    {   0,  1, 2,  0,  662,   0 },
+    {   0,  1, 2,  0,  664,   0 },
+    {   0,  1, 2,  0,  666,   0 },
+    {   0,  1, 2,  0,  668,   0 },
+    {   0,  1, 2,  0,  670,   0 },
+    {   0,  1, 2,  0,  672,   0 },
+    {   0,  1, 2,  0,  674,   0 },
+    {   0,  1, 2,  0,  676,   0 },
+    {   0,  1, 2,  0,  678,   0 },
+    {   0,  1, 2,  0,  680,   0 },
+    {   0,  1, 2,  0,  682,   0 },
+    {   0,  1, 2,  0,  684,   0 },
+    { 222,  8, 0,  0,    0,   0 },
+    { 228,  8, 0,  0,    0,   0 },
+    {  10,  8, 0,  0,    0,   0 },
+    {  11,  8, 0,  0,    0,   0 },
+    {  12,  8, 0,  0,    0,   0 },
+    {  13,  8, 0,  0,    0,   0 },
+    {  14,  8, 0,  0,    0,   0 },
+    {  15,  8, 0,  0,    0,   0 },
+    {  16,  8, 0,  0,    0,   0 },
+    {  17,  8, 0,  0,    0,   0 },
+    {  18,  8, 0,  0,    0,   0 },
+    {  19,  8, 0,  0,    0,   0 },
+    {  20,  8, 0,  0,    0,   0 },
+    {  21,  8, 0,  0,    0,   0 },
+    {  22,  8, 0,  0,    0,   0 },
+    {  23,  8, 0,  0,    0,   0 },
+    {  24,  8, 0,  0,    0,   0 },
+    {  25,  8, 0,  0,    0,   0 },
+    {  30,  8, 0,  0,    0,   0 },
+    {  31,  8, 0,  0,    0,   0 },
+    {  32,  8, 0,  0,    0,   0 },
+    {   0,  1, 2,  0,  686,   0 },
+    {   0,  1, 2,  0,  688,   0 },
+    {   0,  1, 2,  0,  690,   0 },
+    {   0,  1, 2,  0,  692,   0 },
+    {   0,  1, 2,  0,  694,   0 },
+    {   0,  0, 0,  3,    0, 637 },
+    {   0,  0, 0,  1,    0, 640 },
+    {   0,  0, 0,  1,    0, 641 },
+    {  27,  8, 0,  0,    0,   0 },
+    {  28,  8, 0,  0,    0,   0 },
+    {  29,  8, 0,  0,    0,   0 },
+    {  33,  8, 0,  0,    0,   0 },
+    {  34,  8, 0,  0,    0,   0 },
+    {  35,  8, 0,  0,    0,   0 },
+    {   0,  1, 2,  0,  696,   0 },
+    {   0,  0, 0,  1,    0, 642 },
+    {   0,  1, 2,  0,  698,   0 },
+    {   0,  0, 0,  1,    0, 643 },
+    {   0,  1, 2,  0,  700,   0 },
+    {   0,  0, 0,  1,    0, 644 },
+    {  36,  8, 0,  0,    0,   0 },
+    {   0,  0, 0,  1,    0, 645 },
+    {   0,  1, 2,  0,  702,   0 },
+    {   0,  0, 0,  1,    0, 646 },
+    {   0,  1, 2,  0,  704,   0 },
+    {   0,  0, 0,  1,    0, 647 },
+    {   0,  1, 2,  0,  706,   0 },
+    {   7, 12, 0,  0,    0,   0 },
+    {   9,  8, 0,  0,    0,   0 },
+    {   0,  3, 2,  0,  708,   0 },
+    {   0,  3, 2,  0,  710,   0 },
+    {   0,  3, 2,  0,  712,   0 },
+    {   0,  3, 2,  0,  714,   0 },
+    {   0,  3, 2,  0,  716,   0 },
+    {   0,  3, 2,  0,  718,   0 },
+    {   0,  3, 2,  0,  720,   0 },
+    {   0,  3, 2,  0,  722,   0 },
+    {   7,  8, 0,  0,    0,   0 },
+    {   0, 12, 0,  0,    0,   0 },
+    {   0,  0, 0,  2,    0, 648 },
+    {   0,  1, 2,  0,  724,   0 },
+    {   0,  1, 2,  0,  726,   0 },
+    {   0,  3, 2,  0,  728,   0 },
+    {   0,  3, 2,  0,  730,   0 },
+    {   0,  3, 2,  0,  732,   0 },
+    {   0,  3, 2,  0,  734,   0 },
+    {   0,  3, 2,  0,  736,   0 },
+    {   0,  3, 2,  0,  738,   0 },
+    {   0,  3, 2,  0,  740,   0 },
+    {   0,  3, 2,  0,  742,   0 },
+    {   0,  3, 2,  0,  744,   0 },
+    {   0,  0, 0,  3,    0, 650 },
+    {   0,  1, 2,  0,  746,   0 },
+    {   0,  1, 2,  0,  748,   0 },
+    {   0,  1, 2,  0,  750,   0 },
+    {   0,  3, 2,  0,  752,   0 },
+    {   0,  3, 2,  0,  754,   0 },
+    {   0,  0, 0,  1,    0, 653 },
+    {   0,  1, 2,  0,  756,   0 },
+    {   0,  0, 0,  2,    0, 654 },
+    {   0,  0, 0,  1,    0, 656 },
+    {   0,  1, 2,  0,  758,   0 },
+    {   0,  1, 2,  0,  760,   0 },
+    {   0,  1, 2,  0,  762,   0 },
+    {   0,  0, 0,  1,    0, 657 },
+    {   0,  1, 2,  0,  764,   0 },
+    {  84,  8, 0,  0,    0,   0 },
+    {  91, 12, 0,  0,    0,   0 },
+    {   0,  0, 0,  1,    0, 658 },
+    {   0,  1, 2,  0,  766,   0 },
+    {   0,  0, 0,  3,    0, 659 },
+    {   0,  1, 2,  0,  768,   0 },
+    {   0,  1, 2,  0,  770,   0 },
+    {   0,  1, 2,  1,  772, 662 },
+    {   0,  1, 3,  0,  774,   0 },
+    {   0,  0, 0,  2,    0, 663 },
+    {   0,  0, 0,  1,    0, 665 },
+    {   0,  1, 2,  0,  777,   0 },
+    {   0,  1, 2,  0,  779,   0 },
+    {   0,  1, 2,  0,  781,   0 },
+    {   9, 12, 0,  0,    0,   0 },
+    {   0,  0, 0,  3,    0, 666 },
+    {   0,  1, 2,  0,  783,   0 },
+    {   0,  1, 2,  1,  785, 669 },
+    {   0,  1, 3,  0,  787,   0 },
+    {   0,  1, 2,  0,  790,   0 },
+    { 103,  8, 0,  0,    0,   0 },
+    { 107,  8, 0,  0,    0,   0 },
+    { 118,  8, 0,  0,    0,   0 },
+    { 122,  8, 0,  0,    0,   0 },
+    { 216,  8, 0,  0,    0,   0 },
+    {   0,  3, 2,  0,  792,   0 },
+    {   0,  3, 2,  0,  794,   0 },
+    {   0,  3, 2,  0,  796,   0 },
+    {   0,  3, 2,  0,  798,   0 },
+    {   0,  3, 2,  0,  800,   0 },
+    {   0,  3, 2,  0,  802,   0 },
+    { 129,  8, 0,  0,    0,   0 },
+    { 130,  8, 0,  0,    0,   0 },
+    {   0, 11, 2,  0,  804,   0 },
+    { 132,  8, 0,  0,    0,   0 },
+    {   0, 11, 2,  0,  806,   0 },
+    {   0,  3, 2,  0,  808,   0 },
+    {   0,  3, 2,  0,  810,   0 },
+    {   0, 11, 2,  0,  812,   0 },
+    {   0,  3, 2,  0,  814,   0 },
+    {   0,  3, 2,  0,  816,   0 },
+    {   0,  3, 2,  0,  818,   0 },
+    {   0,  3, 2,  0,  820,   0 },
+    {   0,  3, 2,  0,  822,   0 },
+    {   0,  3, 2,  0,  824,   0 },
+    {   0,  0, 0,  1,    0, 670 },
+    {   0,  1, 2,  0,  826,   0 },
+    {   0,  0, 0,  1,    0, 671 },
+    {   0,  1, 2,  0,  828,   0 },
+    {   0,  0, 0,  1,    0, 672 },
+    {   0,  1, 2,  0,  830,   0 },
+    {   0,  0, 0,  1,    0, 673 },
+    {   0,  1, 2,  0,  832,   0 },
+    {   0,  0, 0,  1,    0, 674 },
+    {   0,  1, 2,  0,  834,   0 },
+    {   0,  0, 0,  1,    0, 675 },
+    {   0,  1, 2,  0,  836,   0 },
+    {   0,  0, 0,  1,    0, 676 },
+    {   0,  1, 2,  0,  838,   0 },
+    {   0,  0, 0,  1,    0, 677 },
+    {   0,  1, 2,  0,  840,   0 },
+    {   0,  0, 0,  1,    0, 678 },
+    {   0,  1, 2,  0,  842,   0 },
+    {   0,  0, 0,  1,    0, 679 },
+    {   0,  0, 0,  1,    0, 680 },
+    {   0,  1, 2,  0,  844,   0 },
+    {   0,  1, 2,  0,  846,   0 },
+    {   0,  0, 0,  1,    0, 681 },
+    {   0,  1, 2,  0,  848,   0 },
+    { 214,  8, 0,  0,    0,   0 },
+    { 218,  8, 0,  0,    0,   0 },
+    {   0,  1, 2,  0,  850,   0 },
+    {   0,  1, 2,  0,  852,   0 },
+    {   0,  1, 2,  0,  854,   0 },
+    {   0,  1, 2,  0,  856,   0 },
+    {   0,  1, 2,  0,  858,   0 },
+    {   0,  1, 2,  0,  860,   0 },
+    {   0,  1, 2,  0,  862,   0 },
+    {   0,  1, 2,  0,  864,   0 },
+    {   0,  1, 3,  0,  866,   0 },
+    {   0,  1, 3,  0,  869,   0 },
+    {   0,  1, 2,  0,  872,   0 },
+    {   0,  1, 2,  0,  874,   0 },
+    {   0,  1, 2,  0,  876,   0 },
+    {   0,  1, 2,  0,  878,   0 },
+    {   0,  1, 2,  0,  880,   0 },
+    {   0,  1, 2,  0,  882,   0 },
+    {   0,  1, 2,  0,  884,   0 },
+    {   0,  1, 2,  0,  886,   0 },
+    {   0,  1, 2,  0,  888,   0 },
+    {   0,  1, 2,  0,  890,   0 },
+    {   0,  1, 3,  0,  892,   0 },
+    {   0,  1, 3,  0,  895,   0 },
+    {   0,  1, 3,  0,  898,   0 },
+    {   0,  1, 3,  0,  901,   0 },
+    {   0,  1, 2,  0,  904,   0 },
+    {   0,  1, 2,  0,  906,   0 },
+    {   0,  1, 2,  0,  908,   0 },
+    {   0,  1, 2,  0,  910,   0 },
+    {   0,  1, 3,  0,  912,   0 },
+    {   0,  1, 3,  0,  915,   0 },
+    {   0,  1, 2,  0,  918,   0 },
+    {   0,  1, 2,  0,  920,   0 },
+    {   0,  1, 2,  0,  922,   0 },
+    {   0,  1, 2,  0,  924,   0 },
+    {   0,  1, 2,  0,  926,   0 },
+    {   0,  1, 2,  0,  928,   0 },
+    {   0,  1, 2,  0,  930,   0 },
+    {   0,  1, 2,  0,  932,   0 },
+    {   0,  1, 2,  0,  934,   0 },
+    {   0,  1, 2,  0,  936,   0 },
+    {   0,  1, 2,  0,  938,   0 },
+    {   0,  1, 2,  0,  940,   0 },
+    {   0,  1, 2,  0,  942,   0 },
+    {   0,  1, 2,  0,  944,   0 },
+    {   0,  1, 2,  0,  946,   0 },
+    {   0,  1, 2,  0,  948,   0 },
+    {   0,  1, 3,  0,  950,   0 },
+    {   0,  1, 3,  0,  953,   0 },
+    {   0,  1, 2,  0,  956,   0 },
+    {   0,  1, 2,  0,  958,   0 },
+    {   0,  1, 2,  0,  960,   0 },
+    {   0,  1, 2,  0,  962,   0 },
+    {   0,  1, 2,  0,  964,   0 },
+    {   0,  1, 2,  0,  966,   0 },
+    {   0,  1, 2,  1,  968, 682 },
+    {   0,  1, 2,  1,  970, 683 },
+    {   0,  1, 3,  0,  972,   0 },
+    {   0,  1, 3,  0,  975,   0 },
+    {   0,  1, 2,  0,  978,   0 },
+    {   0,  1, 2,  0,  980,   0 },
+    {   0,  1, 2,  0,  982,   0 },
+    {   0,  1, 2,  0,  984,   0 },
+    {   0,  1, 2,  0,  986,   0 },
+    {   0,  1, 2,  0,  988,   0 },
+    {   0,  1, 2,  0,  990,   0 },
+    {   0,  1, 2,  0,  992,   0 },
+    {   0,  1, 2,  0,  994,   0 },
+    {   0,  1, 2,  0,  996,   0 },
+    {   0,  1, 2,  0,  998,   0 },
+    {   0,  1, 2,  0, 1000,   0 },
+    {   0,  1, 2,  0, 1002,   0 },
+    {   0,  1, 2,  0, 1004,   0 },
+    {   0,  1, 2,  0, 1006,   0 },
+    {   0,  1, 2,  0, 1008,   0 },
+    {   0,  1, 2,  0, 1010,   0 },
+    {   0,  1, 2,  0, 1012,   0 },
+    {   0,  1, 3,  0, 1014,   0 },
+    {   0,  1, 3,  0, 1017,   0 },
+    {   0,  1, 3,  0, 1020,   0 },
+    {   0,  1, 3,  0, 1023,   0 },
+    {   0,  1, 3,  0, 1026,   0 },
+    {   0,  1, 3,  0, 1029,   0 },
+    {   0,  1, 3,  0, 1032,   0 },
+    {   0,  1, 3,  0, 1035,   0 },
+    {   0,  1, 2,  0, 1038,   0 },
+    {   0,  1, 2,  0, 1040,   0 },
+    {   0,  1, 2,  0, 1042,   0 },
+    {   0,  1, 2,  0, 1044,   0 },
+    {   0,  1, 2,  0, 1046,   0 },
+    {   0,  1, 2,  0, 1048,   0 },
+    {   0,  1, 2,  1, 1050, 684 },
+    {   0,  1, 2,  1, 1052, 685 },
+    {   0,  1, 3,  0, 1054,   0 },
+    {   0,  1, 3,  0, 1057,   0 },
+    {   0,  1, 2,  0, 1060,   0 },
+    {   0,  1, 2,  0, 1062,   0 },
+    {   0,  1, 2,  0, 1064,   0 },
+    {   0,  1, 2,  0, 1066,   0 },
+    {   0,  1, 2,  1, 1068, 686 },
+    {   0,  1, 2,  1, 1070, 687 },
+    {   0,  1, 3,  0, 1072,   0 },
+    {   0,  1, 3,  0, 1075,   0 },
+    {   0,  1, 3,  0, 1078,   0 },
+    {   0,  1, 3,  0, 1081,   0 },
+    {   0,  1, 3,  0, 1084,   0 },
+    {   0,  1, 3,  0, 1087,   0 },
+    {   0,  1, 2,  0, 1090,   0 },
+    {   0,  1, 2,  0, 1092,   0 },
+    {   0,  1, 2,  0, 1094,   0 },
+    {   0,  1, 2,  0, 1096,   0 },
+    {   0,  1, 2,  0, 1098,   0 },
+    {   0,  1, 2,  0, 1100,   0 },
+    {   0,  1, 2,  0, 1102,   0 },
+    {   0,  1, 2,  0, 1104,   0 },
+    {   0,  1, 2,  0, 1106,   0 },
+    {   0,  1, 2,  0, 1108,   0 },
+    {   0,  1, 2,  0, 1110,   0 },
+    {   0,  1, 2,  0, 1112,   0 },
+    {   0,  1, 2,  0, 1114,   0 },
+    {   0,  1, 2,  0, 1116,   0 },
+    {   0,  1, 3,  0, 1118,   0 },
+    {   0,  1, 3,  0, 1121,   0 },
+    {   0,  1, 3,  0, 1124,   0 },
+    {   0,  1, 3,  0, 1127,   0 },
+    {   0,  1, 2,  0, 1130,   0 },
+    {   0,  1, 2,  0, 1132,   0 },
+    {   0,  1, 2,  0, 1134,   0 },
+    {   0,  1, 2,  0, 1136,   0 },
+    {   0,  1, 2,  0, 1138,   0 },
+    {   0,  1, 2,  0, 1140,   0 },
+    {   0,  1, 2,  0, 1142,   0 },
+    {   0,  1, 2,  0, 1144,   0 },
+    {   0,  1, 2,  0, 1146,   0 },
+    {   0,  1, 2,  0, 1148,   0 },
+    {   0,  1, 2,  0, 1150,   0 },
+    {   0,  1, 2,  0, 1152,   0 },
+    {   0,  1, 2,  0, 1154,   0 },
+    {   0,  1, 2,  0, 1156,   0 },
+    {   0,  1, 2,  0, 1158,   0 },
+    {   0,  1, 2,  0, 1160,   0 },
+    {   0,  1, 2,  0, 1162,   0 },
+    {   0,  1, 2,  0, 1164,   0 },
+    {   0,  1, 2,  0, 1166,   0 },
+    {   0,  1, 2,  0, 1168,   0 },
+    {   0,  1, 2,  0, 1170,   0 },
+    {   0,  1, 2,  0, 1172,   0 },
+    {   0,  1, 2,  0, 1174,   0 },
+    {   0,  1, 2,  0, 1176,   0 },
+    {   0,  1, 2,  0, 1178,   0 },
+    {   0,  1, 2,  0, 1180,   0 },
+    {   0,  1, 2,  0, 1182,   0 },
+    {   0,  1, 2,  0, 1184,   0 },
+    {   0,  1, 2,  0, 1186,   0 },
+    {   0,  1, 2,  0, 1188,   0 },
+    {   0,  1, 2,  0, 1190,   0 },
+    {   0,  1, 2,  2, 1192, 688 },
+    {   0,  1, 2,  2, 1194, 690 },
+    {   0,  1, 2,  0, 1196,   0 },
+    {   0,  1, 2,  0, 1198,   0 },
+    {   0,  1, 3,  0, 1200,   0 },
+    {   0,  1, 3,  0, 1203,   0 },
+    {   0,  1, 3,  0, 1206,   0 },
+    {   0,  1, 3,  0, 1209,   0 },
+    {   0,  1, 3,  0, 1212,   0 },
+    {   0,  1, 3,  0, 1215,   0 },
+    {   0,  1, 3,  0, 1218,   0 },
+    {   0,  1, 3,  0, 1221,   0 },
+    {   0,  1, 3,  0, 1224,   0 },
+    {   0,  1, 3,  0, 1227,   0 },
+    {   0,  1, 3,  0, 1230,   0 },
+    {   0,  1, 3,  0, 1233,   0 },
+    {   0,  1, 3,  0, 1236,   0 },
+    {   0,  1, 3,  0, 1239,   0 },
+    {   0,  1, 3,  0, 1242,   0 },
+    {   0,  1, 3,  0, 1245,   0 },
+    {   0,  1, 3,  0, 1248,   0 },
+    {   0,  1, 3,  0, 1251,   0 },
+    {   0,  1, 3,  0, 1254,   0 },
+    {   0,  1, 3,  0, 1257,   0 },
+    {   0,  1, 2,  1, 1260, 692 },
+    {   0,  1, 2,  1, 1262, 693 },
+    {   0,  1, 2,  0, 1264,   0 },
+    {   0,  1, 2,  0, 1266,   0 },
+    {   0,  1, 2,  0, 1268,   0 },
+    {   0,  1, 2,  0, 1270,   0 },
+    {   0,  1, 3,  0, 1272,   0 },
+    {   0,  1, 3,  0, 1275,   0 },
+    {   0,  1, 3,  0, 1278,   0 },
+    {   0,  1, 3,  0, 1281,   0 },
+    {   0,  1, 3,  0, 1284,   0 },
+    {   0,  1, 3,  0, 1287,   0 },
+    {   0,  1, 3,  0, 1290,   0 },
+    {   0,  1, 3,  0, 1293,   0 },
+    {   0,  1, 3,  0, 1296,   0 },
+    {   0,  1, 3,  0, 1299,   0 },
+    {   0,  1, 2,  0, 1302,   0 },
+    {   0,  1, 2,  0, 1304,   0 },
+    {   0,  1, 2,  0, 1306,   0 },
+    {   0,  1, 2,  0, 1308,   0 },
+    {   0,  1, 2,  1, 1310, 694 },
+    {   0,  1, 2,  1, 1312, 695 },
+    {   0,  1, 2,  0, 1314,   0 },
+    {   0,  1, 2,  0, 1316,   0 },
+    {   0,  1, 3,  0, 1318,   0 },
+    {   0,  1, 3,  0, 1321,   0 },
+    {   0,  1, 3,  0, 1324,   0 },
+    {   0,  1, 3,  0, 1327,   0 },
+    {   0,  1, 3,  0, 1330,   0 },
+    {   0,  1, 3,  0, 1333,   0 },
+    {   0,  1, 3,  0, 1336,   0 },
+    {   0,  1, 3,  0, 1339,   0 },
+    {   0,  1, 3,  0, 1342,   0 },
+    {   0,  1, 3,  0, 1345,   0 },
+    {   0,  1, 3,  0, 1348,   0 },
+    {   0,  1, 3,  0, 1351,   0 },
+    {   0,  1, 3,  0, 1354,   0 },
+    {   0,  1, 3,  0, 1357,   0 },
+    {   0,  1, 3,  0, 1360,   0 },
+    {   0,  1, 3,  0, 1363,   0 },
+    {   0,  1, 3,  0, 1366,   0 },
+    {   0,  1, 3,  0, 1369,   0 },
+    {   0,  1, 3,  0, 1372,   0 },
+    {   0,  1, 3,  0, 1375,   0 },
+    {   0,  1, 2,  0, 1378,   0 },
+    {   0,  1, 2,  0, 1380,   0 },
+    {   0,  1, 2,  0, 1382,   0 },
+    {   0,  1, 2,  0, 1384,   0 },
+    {   0,  1, 3,  0, 1386,   0 },
+    {   0,  1, 3,  0, 1389,   0 },
+    {   0,  1, 3,  0, 1392,   0 },
+    {   0,  1, 3,  0, 1395,   0 },
+    {   0,  1, 3,  0, 1398,   0 },
+    {   0,  1, 3,  0, 1401,   0 },
+    {   0,  1, 3,  0, 1404,   0 },
+    {   0,  1, 3,  0, 1407,   0 },
+    {   0,  1, 3,  0, 1410,   0 },
+    {   0,  1, 3,  0, 1413,   0 },
+    {   0,  1, 2,  0, 1416,   0 },
+    {   0,  1, 2,  0, 1418,   0 },
+    {   0,  1, 2,  0, 1420,   0 },
+    {   0,  1, 2,  0, 1422,   0 },
+    {   0,  1, 2,  0, 1424,   0 },
+    {   0,  1, 2,  0, 1426,   0 },
+    {   0,  1, 2,  0, 1428,   0 },
+    {   0,  1, 2,  0, 1430,   0 },
+    {   0,  1, 2,  4, 1432, 696 },
+    {   0,  1, 2,  4, 1434, 700 },
+    {   0,  1, 3,  1, 1436, 704 },
+    {   0,  1, 3,  1, 1439, 705 },
+    {   0,  1, 3,  1, 1442, 706 },
+    {   0,  1, 3,  1, 1445, 707 },
+    {   0,  1, 3,  1, 1448, 708 },
+    {   0,  1, 3,  1, 1451, 709 },
+    {   0,  1, 2,  4, 1454, 710 },
+    {   0,  1, 2,  4, 1456, 714 },
+    {   0,  1, 3,  1, 1458, 718 },
+    {   0,  1, 3,  1, 1461, 719 },
+    {   0,  1, 3,  1, 1464, 720 },
+    {   0,  1, 3,  1, 1467, 721 },
+    {   0,  1, 3,  1, 1470, 722 },
+    {   0,  1, 3,  1, 1473, 723 },
+    {   0,  1, 2,  2, 1476, 724 },
+    {   0,  1, 2,  2, 1478, 726 },
+    {   0,  1, 3,  0, 1480,   0 },
+    {   0,  1, 3,  0, 1483,   0 },
+    {   0,  1, 3,  0, 1486,   0 },
+    {   0,  1, 3,  0, 1489,   0 },
+    {   0,  1, 2,  2, 1492, 728 },
+    {   0,  1, 2,  2, 1494, 730 },
+    {   0,  1, 3,  0, 1496,   0 },
+    {   0,  1, 3,  0, 1499,   0 },
+    {   0,  1, 3,  0, 1502,   0 },
+    {   0,  1, 3,  0, 1505,   0 },
+    {   0,  1, 2,  4, 1508, 732 },
+    {   0,  1, 2,  4, 1510, 736 },
+    {   0,  1, 3,  1, 1512, 740 },
+    {   0,  1, 3,  1, 1515, 741 },
+    {   0,  1, 3,  1, 1518, 742 },
+    {   0,  1, 3,  1, 1521, 743 },
+    {   0,  1, 3,  1, 1524, 744 },
+    {   0,  1, 3,  1, 1527, 745 },
+    {   0,  1, 2,  4, 1530, 746 },
+    {   0,  1, 2,  4, 1532, 750 },
+    {   0,  1, 3,  1, 1534, 754 },
+    {   0,  1, 3,  1, 1537, 755 },
+    {   0,  1, 3,  1, 1540, 756 },
+    {   0,  1, 3,  1, 1543, 757 },
+    {   0,  1, 3,  1, 1546, 758 },
+    {   0,  1, 3,  1, 1549, 759 },
+    {   0,  1, 2,  3, 1552, 760 },
+    {   0,  1, 2,  3, 1554, 763 },
+    {   0,  1, 3,  0, 1556,   0 },
+    {   0,  1, 3,  0, 1559,   0 },
+    {   0,  1, 3,  0, 1562,   0 },
+    {   0,  1, 3,  0, 1565,   0 },
+    {   0,  1, 3,  0, 1568,   0 },
+    {   0,  1, 3,  0, 1571,   0 },
+    {   0,  1, 2,  3, 1574, 766 },
+    {   0,  1, 2,  3, 1576, 769 },
+    {   0,  1, 3,  0, 1578,   0 },
+    {   0,  1, 3,  0, 1581,   0 },
+    {   0,  1, 3,  0, 1584,   0 },
+    {   0,  1, 3,  0, 1587,   0 },
+    {   0,  1, 3,  0, 1590,   0 },
+    {   0,  1, 3,  0, 1593,   0 },
+    {   0,  1, 2,  2, 1596, 772 },
+    {   0,  1, 2,  2, 1598, 774 },
+    {   0,  1, 3,  0, 1600,   0 },
+    {   0,  1, 3,  0, 1603,   0 },
+    {   0,  1, 3,  0, 1606,   0 },
+    {   0,  1, 3,  0, 1609,   0 },
+    {   0,  1, 2,  2, 1612, 776 },
+    {   0,  1, 2,  2, 1614, 778 },
+    {   0,  1, 3,  0, 1616,   0 },
+    {   0,  1, 3,  0, 1619,   0 },
+    {   0,  1, 3,  0, 1622,   0 },
+    {   0,  1, 3,  0, 1625,   0 },
+    {   0,  1, 2,  3, 1628, 780 },
+    {   0,  1, 2,  3, 1630, 783 },
+    {   0,  1, 3,  0, 1632,   0 },
+    {   0,  1, 3,  0, 1635,   0 },
+    {   0,  1, 3,  0, 1638,   0 },
+    {   0,  1, 3,  0, 1641,   0 },
+    {   0,  1, 3,  0, 1644,   0 },
+    {   0,  1, 3,  0, 1647,   0 },
+    {   0,  1, 2,  3, 1650, 786 },
+    {   0,  1, 3,  0, 1652,   0 },
+    {   0,  1, 3,  0, 1655,   0 },
+    {   0,  1, 3,  0, 1658,   0 },
+    {   0,  1, 2,  4, 1661, 789 },
+    {   0,  1, 2,  4, 1663, 793 },
+    {   0,  1, 3,  1, 1665, 797 },
+    {   0,  1, 3,  1, 1668, 798 },
+    {   0,  1, 3,  1, 1671, 799 },
+    {   0,  1, 3,  1, 1674, 800 },
+    {   0,  1, 3,  1, 1677, 801 },
+    {   0,  1, 3,  1, 1680, 802 },
+    {   0,  1, 2,  4, 1683, 803 },
+    {   0,  1, 2,  4, 1685, 807 },
+    {   0,  1, 3,  1, 1687, 811 },
+    {   0,  1, 3,  1, 1690, 812 },
+    {   0,  1, 3,  1, 1693, 813 },
+    {   0,  1, 3,  1, 1696, 814 },
+    {   0,  1, 3,  1, 1699, 815 },
+    {   0,  1, 3,  1, 1702, 816 },
+    {   0,  1, 2,  1, 1705, 817 },
+    {   0,  3, 2,  0, 1707,   0 },
+    {   0,  1, 2,  0, 1709,   0 },
+    {   0,  3, 2,  0, 1711,   0 },
+    {   0,  1, 2,  1, 1713, 818 },
+    {   0,  3, 2,  0, 1715,   0 },
+    {   0,  1, 2,  0, 1717,   0 },
+    {   0,  3, 2,  0, 1719,   0 },
+    {   0,  1, 2,  0, 1721,   0 },
+    {   0,  3, 2,  0, 1723,   0 },
+    {   0,  1, 2,  0, 1725,   0 },
+    {   0,  3, 2,  0, 1727,   0 },
+    {   0,  1, 2,  1, 1729, 819 },
+    {   0,  3, 2,  0, 1731,   0 },
+    {   0,  1, 3,  0, 1733,   0 },
+    {   0,  1, 3,  0, 1736,   0 },
+    {   0,  1, 4,  0, 1739,   0 },
+    {   0,  1, 4,  0, 1743,   0 },
+    {   0,  1, 4,  0, 1747,   0 },
+    {   0,  1, 4,  0, 1751,   0 },
+    {   0,  1, 4,  0, 1755,   0 },
+    {   0,  1, 4,  0, 1759,   0 },
+    {   0,  1, 3,  0, 1763,   0 },
+    {   0,  1, 3,  0, 1766,   0 },
+    {   0,  1, 4,  0, 1769,   0 },
+    {   0,  1, 4,  0, 1773,   0 },
+    {   0,  1, 4,  0, 1777,   0 },
+    {   0,  1, 4,  0, 1781,   0 },
+    {   0,  1, 4,  0, 1785,   0 },
+    {   0,  1, 4,  0, 1789,   0 },
+    {   0,  1, 3,  0, 1793,   0 },
+    {   0,  1, 3,  0, 1796,   0 },
+    {   0,  1, 4,  0, 1799,   0 },
+    {   0,  1, 4,  0, 1803,   0 },
+    {   0,  1, 4,  0, 1807,   0 },
+    {   0,  1, 4,  0, 1811,   0 },
+    {   0,  1, 4,  0, 1815,   0 },
+    {   0,  1, 4,  0, 1819,   0 },
+    {   0,  1, 3,  0, 1823,   0 },
+    {   0,  1, 3,  0, 1826,   0 },
+    {   0,  1, 4,  0, 1829,   0 },
+    {   0,  1, 4,  0, 1833,   0 },
+    {   0,  1, 4,  0, 1837,   0 },
+    {   0,  1, 4,  0, 1841,   0 },
+    {   0,  1, 4,  0, 1845,   0 },
+    {   0,  1, 4,  0, 1849,   0 },
+    {   0,  1, 3,  0, 1853,   0 },
+    {   0,  1, 3,  0, 1856,   0 },
+    {   0,  1, 4,  0, 1859,   0 },
+    {   0,  1, 4,  0, 1863,   0 },
+    {   0,  1, 4,  0, 1867,   0 },
+    {   0,  1, 4,  0, 1871,   0 },
+    {   0,  1, 4,  0, 1875,   0 },
+    {   0,  1, 4,  0, 1879,   0 },
+    {   0,  1, 3,  0, 1883,   0 },
+    {   0,  1, 3,  0, 1886,   0 },
+    {   0,  1, 4,  0, 1889,   0 },
+    {   0,  1, 4,  0, 1893,   0 },
+    {   0,  1, 4,  0, 1897,   0 },
+    {   0,  1, 4,  0, 1901,   0 },
+    {   0,  1, 4,  0, 1905,   0 },
+    {   0,  1, 4,  0, 1909,   0 },
+    {   0,  1, 2,  0, 1913,   0 },
+    {   0,  1, 2,  0, 1915,   0 },
+    {   0,  1, 3,  0, 1917,   0 },
+    {   0,  1, 2,  0, 1920,   0 },
+    {   0,  1, 3,  0, 1922,   0 },
+    {   0,  1, 2,  1, 1925, 820 },
+    {   0,  1, 3,  0, 1927,   0 },
+    {   0,  1, 2,  0, 1930,   0 },
+    {   0,  1, 2,  0, 1932,   0 },
+    {   0,  1, 2,  0, 1934,   0 },
+    {   0,  3, 2,  0, 1936,   0 },
+    {   0,  1, 2,  0, 1938,   0 },
+    {   0,  3, 1,  0, 1940,   0 },
+    {   0,  0, 0,  3,    0, 821 },
+    {   0,  1, 2,  0, 1941,   0 },
+    {   0,  1, 3,  0, 1943,   0 },
+    {   0,  1, 2,  0, 1946,   0 },
+    {   0,  1, 3,  0, 1948,   0 },
+    {   0,  1, 2,  1, 1951, 824 },
+    {   0,  1, 3,  0, 1953,   0 },
+    {   0,  1, 2,  0, 1956,   0 },
+    {   0,  3, 2,  0, 1958,   0 },
+    {   0,  1, 2,  0, 1960,   0 },
+    {   0,  3, 2,  0, 1962,   0 },
+    {   0,  1, 2,  0, 1964,   0 },
+    {   0,  1, 2,  0, 1966,   0 },
+    {   0,  1, 2,  0, 1968,   0 },
+    {   0,  1, 2,  0, 1970,   0 },
+    {   0,  1, 2,  0, 1972,   0 },
+    {   0,  1, 2,  0, 1974,   0 },
+    {   0,  1, 3,  0, 1976,   0 },
+    {   0,  3, 3,  0, 1979,   0 },
+    {   0,  1, 2,  0, 1982,   0 },
+    {   0,  1, 3,  0, 1984,   0 },
+    {   0,  1, 2,  0, 1987,   0 },
+    {   0,  1, 2,  0, 1989,   0 },
+    {   0,  1, 2,  0, 1991,   0 },
+    {   0,  3, 2,  0, 1993,   0 },
+    {   0,  1, 2,  0, 1995,   0 },
+    {   0,  1, 2,  0, 1997,   0 },
+    {   0,  1, 2,  0, 1999,   0 },
+    {   0,  1, 2,  0, 2001,   0 },
+    {   0,  1, 2,  0, 2003,   0 },
+    {   0,  1, 3,  0, 2005,   0 },
+    {   0,  3, 3,  0, 2008,   0 },
+    {   0,  1, 2,  0, 2011,   0 },
+    {   0,  1, 2,  0, 2013,   0 },
+    {   0,  1, 2,  0, 2015,   0 },
+    {   0,  1, 3,  0, 2017,   0 },
+    {   0,  1, 2,  0, 2020,   0 },
+    {   0,  1, 2,  0, 2022,   0 },
+    {   0,  1, 2,  0, 2024,   0 },
+    {   0,  3, 2,  0, 2026,   0 },
+    {   0,  1, 2,  0, 2028,   0 },
+    {   0,  1, 2,  0, 2030,   0 },
+    {   0,  3, 2,  0, 2032,   0 },
+    {   0,  3, 1,  0, 2034,   0 },
+    {   0,  1, 3,  0, 2035,   0 },
+    {   0,  1, 2,  0, 2038,   0 },
+    {   0,  1, 3,  0, 2040,   0 },
+    {   0,  1, 2,  1, 2043, 825 },
+    {   0,  1, 3,  0, 2045,   0 },
+    {   0,  1, 2,  0, 2048,   0 },
+    {   0,  3, 2,  0, 2050,   0 },
+    {   0,  1, 2,  0, 2052,   0 },
+    {   0,  3, 2,  0, 2054,   0 },
+    {   0,  1, 2,  0, 2056,   0 },
+    {   0,  3, 1,  0, 2058,   0 },
+    {   0,  0, 0,  3,    0, 826 },
+    {   0,  3, 1,  0, 2059,   0 },
+    {   0,  3, 1,  0, 2060,   0 },
+    {   0,  3, 1,  0, 2061,   0 },
+    {   0,  3, 1,  0, 2062,   0 },
+    {   0,  3, 2,  0, 2063,   0 },
+    {   0,  0, 0,  1,    0, 829 },
+    {   0,  0, 0,  1,    0, 830 },
+    {   0,  0, 0,  1,    0, 831 },
+    {   0,  1, 2,  0, 2065,   0 },
+    {   0,  1, 2,  0, 2067,   0 },
+    {   0,  1, 2,  0, 2069,   0 },
+    {   0,  1, 2,  0, 2071,   0 },
+    {   0,  1, 2,  0, 2073,   0 },
+    {   0,  1, 2,  0, 2075,   0 },
+    {   0,  0, 0,  1,    0, 832 },
+    {   0,  0, 0,  1,    0, 833 },
+    {   0,  0, 0,  1,    0, 834 },
+    {   0,  0, 0,  1,    0, 835 },
+    {   0,  1, 2,  0, 2077,   0 },
+    {   0,  0, 0,  1,    0, 836 },
+    {   0,  1, 2,  0, 2079,   0 },
+    {   0,  0, 0,  1,    0, 837 },
+    {   0,  1, 2,  0, 2081,   0 },
+    {   0,  0, 0,  1,    0, 838 },
+    {   0,  1, 2,  0, 2083,   0 },
+    {   0,  0, 0,  1,    0, 839 },
+    {   0,  1, 2,  0, 2085,   0 },
+    {   0,  0, 0,  1,    0, 840 },
+    {   0,  1, 2,  0, 2087,   0 },
+    {   0,  0, 0,  1,    0, 841 },
+    {   0,  1, 2,  0, 2089,   0 },
+    {   0,  0, 0,  1,    0, 842 },
+    {   0,  1, 2,  0, 2091,   0 },
+    {   0,  0, 0,  1,    0, 843 },
+    {   0,  1, 2,  0, 2093,   0 },
+    {   0,  0, 0,  1,    0, 844 },
+    {   0,  1, 2,  0, 2095,   0 },
+    {   0,  0, 0,  1,    0, 845 },
+    {   0,  1, 2,  0, 2097,   0 },
+    {   0,  0, 0,  1,    0, 846 },
+    {   0,  0, 0,  1,    0, 847 },
+    {   0,  1, 2,  0, 2099,   0 },
+    {   0,  1, 2,  0, 2101,   0 },
+    {   0,  1, 2,  0, 2103,   0 },
+    {   0,  1, 2,  0, 2105,   0 },
+    {   0,  1, 2,  0, 2107,   0 },
+    {   0,  0, 0,  1,    0, 848 },
+    {   0,  0, 0,  1,    0, 849 },
+    {   0,  1, 2,  0, 2109,   0 },
+    {   0,  1, 2,  0, 2111,   0 },
+    {   0,  0, 0,  1,    0, 850 },
+    {   0,  0, 0,  1,    0, 851 },
+    {   0,  1, 2,  0, 2113,   0 },
+    {   0,  1, 2,  0, 2115,   0 },
+    {   0,  0, 0,  1,    0, 852 },
+    {   0,  0, 0,  1,    0, 853 },
+    {   0,  0, 0,  1,    0, 854 },
+    {   0,  0, 0,  1,    0, 855 },
+    {   0,  1, 2,  0, 2117,   0 },
+    {   0,  1, 2,  0, 2119,   0 },
+    {   0,  0, 0,  1,    0, 856 },
+    {   0,  0, 0,  1,    0, 857 },
+    {   0,  1, 2,  0, 2121,   0 },
+    {   0,  1, 2,  0, 2123,   0 },
+    {   0,  0, 0,  1,    0, 858 },
+    {   0,  0, 0,  1,    0, 859 },
+    {   0,  1, 2,  0, 2125,   0 },
+    {   0,  1, 2,  0, 2127,   0 },
+    {   0,  0, 0,  1,    0, 860 },
+    {   0,  0, 0,  1,    0, 861 },
+    {   0,  0, 0,  1,    0, 862 },
+    {   0,  0, 0,  1,    0, 863 },
+    {   0,  0, 0,  1,    0, 864 },
+    {   0,  0, 0,  1,    0, 865 },
+    {   0,  1, 2,  0, 2129,   0 },
+    {   0,  1, 2,  0, 2131,   0 },
+    {   0,  1, 2,  0, 2133,   0 },
+    {   0,  1, 2,  0, 2135,   0 },
+    {   0,  0, 0,  1,    0, 866 },
+    {   0,  0, 0,  1,    0, 867 },
+    {   0,  0, 0,  1,    0, 868 },
+    {   0,  0, 0,  1,    0, 869 },
+    {   0,  1, 2,  0, 2137,   0 },
+    {   0,  1, 2,  0, 2139,   0 },
+    {   0,  1, 2,  0, 2141,   0 },
+    {   0,  1, 2,  0, 2143,   0 },
+    {   0,  1, 2,  0, 2145,   0 },
+    {   0,  1, 2,  0, 2147,   0 },
+    {   0,  1, 2,  0, 2149,   0 },
+    {   0,  1, 2,  0, 2151,   0 },
+    {   0,  3, 1,  0, 2153,   0 },
+    {   0,  3, 1,  0, 2154,   0 },
+    {   0,  3, 2,  0, 2155,   0 },
+    { 224,  8, 0,  0,    0,   0 },
+    {   0,  0, 0,  1,    0, 870 },
+    {   0,  0, 0,  1,    0, 871 },
+    {   0,  1, 2,  0, 2157,   0 },
+    {   0,  0, 0,  1,    0, 872 },
+    {   0,  1, 2,  0, 2159,   0 },
+    {   0,  0, 0,  1,    0, 873 },
+    {   0,  1, 2,  0, 2161,   0 },
+    {   0,  0, 0,  1,    0, 874 },
+    {   0,  1, 2,  0, 2163,   0 },
+    {   0,  0, 0,  1,    0, 875 },
+    {   0,  1, 2,  0, 2165,   0 },
+    {   0,  0, 0,  1,    0, 876 },
+    {   0,  1, 2,  0, 2167,   0 },
+    {   0,  0, 0,  1,    0, 877 },
+    {   0,  1, 2,  0, 2169,   0 },
+    {   0,  0, 0,  1,    0, 878 },
+    {   0,  1, 2,  0, 2171,   0 },
+    {   0,  0, 0,  1,    0, 879 },
+    {   0,  1, 2,  0, 2173,   0 },
+    {   0,  0, 0,  1,    0, 880 },
+    {   0,  1, 2,  0, 2175,   0 },
+    {   0,  0, 0,  1,    0, 881 },
+    {   0,  1, 2,  0, 2177,   0 },
+    {   0,  0, 0,  1,    0, 882 },
+    {   0,  1, 2,  0, 2179,   0 },
+    {   0,  0, 0,  1,    0, 883 },
+    {   0,  1, 2,  0, 2181,   0 },
+    {   0,  0, 0,  1,    0, 884 },
+    {   0,  1, 2,  0, 2183,   0 },
+    {   0,  0, 0,  1,    0, 885 },
+    {   0,  1, 2,  0, 2185,   0 },
+    {   0,  0, 0,  2,    0, 886 },
+    {   0,  1, 2,  0, 2187,   0 },
+    {   0,  1, 2,  0, 2189,   0 },
+    {   0,  0, 0,  2,    0, 888 },
+    {   0,  1, 2,  0, 2191,   0 },
+    {   0,  1, 2,  0, 2193,   0 },
+    {   0,  0, 0,  2,    0, 890 },
+    {   0,  1, 2,  0, 2195,   0 },
+    {   0,  1, 2,  0, 2197,   0 },
+    {   0,  0, 0,  2,    0, 892 },
+    {   0,  1, 2,  0, 2199,   0 },
+    {   0,  1, 2,  0, 2201,   0 },
+    {   0,  0, 0,  2,    0, 894 },
+    {   0,  1, 2,  0, 2203,   0 },
+    {   0,  1, 2,  0, 2205,   0 },
+    {   0,  1, 2,  0, 2207,   0 },
+    {   8, 12, 0,  0,    0,   0 },
+    {   0,  0, 0,  1,    0, 896 },
+    {   0,  1, 2,  0, 2209,   0 },
+    {   0,  0, 0,  1,    0, 897 },
+    {   0,  0, 0,  1,    0, 898 },
+    {   0,  1, 2,  0, 2211,   0 },
+    {   0,  0, 0,  1,    0, 899 },
+    {   0,  1, 2,  0, 2213,   0 },
+    {   0,  0, 0,  1,    0, 900 },
+    {   0,  1, 2,  0, 2215,   0 },
+    {   0,  0, 0,  1,    0, 901 },
+    {   0,  1, 2,  0, 2217,   0 },
+    {   0,  0, 0,  1,    0, 902 },
+    {   0,  1, 2,  0, 2219,   0 },
+    {   0,  0, 0,  1,    0, 903 },
+    {   0,  1, 2,  0, 2221,   0 },
+    {   0,  0, 0,  1,    0, 904 },
+    {   0,  1, 2,  0, 2223,   0 },
+    {   0,  0, 0,  1,    0, 905 },
+    {   0,  1, 2,  0, 2225,   0 },
+    {   0,  0, 0,  1,    0, 906 },
+    {   0,  1, 2,  0, 2227,   0 },
+    {   0,  0, 0,  1,    0, 907 },
+    {   0,  1, 2,  0, 2229,   0 },
+    {   0,  0, 0,  1,    0, 908 },
+    {   0,  1, 2,  0, 2231,   0 },
+    {   0,  0, 0,  1,    0, 909 },
+    {   0,  1, 2,  0, 2233,   0 },
+    {   0,  0, 0,  1,    0, 910 },
+    {   0,  1, 2,  0, 2235,   0 },
+    {   0,  0, 0,  1,    0, 911 },
+    {   0,  1, 2,  0, 2237,   0 },
+    {   0,  0, 0,  1,    0, 912 },
+    {   0,  1, 2,  0, 2239,   0 },
+    {   0,  0, 0,  2,    0, 913 },
+    {   0,  1, 2,  0, 2241,   0 },
+    {   0,  1, 2,  0, 2243,   0 },
+    {   0,  0, 0,  2,    0, 915 },
+    {   0,  1, 2,  0, 2245,   0 },
+    {   0,  1, 2,  0, 2247,   0 },
+    {   0,  0, 0,  2,    0, 917 },
+    {   0,  1, 2,  0, 2249,   0 },
+    {   0,  1, 2,  0, 2251,   0 },
+    {   0,  0, 0,  2,    0, 919 },
+    {   0,  1, 2,  0, 2253,   0 },
+    {   0,  1, 2,  0, 2255,   0 },
+    {   0,  0, 0,  2,    0, 921 },
+    {   0,  1, 2,  0, 2257,   0 },
+    {   0,  1, 2,  0, 2259,   0 },
+    {   0,  0, 0,  1,    0, 923 },
+    {   0,  0, 0,  1,    0, 924 },
+    {   0,  0, 0,  1,    0, 925 },
+    {   0,  0, 0,  1,    0, 926 },
+    {   0,  1, 2,  0, 2261,   0 },
+    {   0,  1, 2,  0, 2263,   0 },
+    {   0,  1, 2,  0, 2265,   0 },
+    {   0,  1, 2,  0, 2267,   0 },
+    {   0,  1, 2,  0, 2269,   0 },
+    {   0,  0, 0,  1,    0, 927 },
+    {   0,  1, 2,  0, 2271,   0 },
+    {   0,  1, 0,  0,    0,   0 },
+    {   0,  3, 1,  0, 2273,   0 },
+    {   0,  3, 1,  0, 2274,   0 },
+    {   0,  3, 1,  0, 2275,   0 },
+    {   0,  3, 1,  0, 2276,   0 },
+    {   0,  3, 1,  0, 2277,   0 },
+    {   0,  3, 1,  0, 2278,   0 },
+    {   0,  3, 1,  0, 2279,   0 },
+    {   0,  3, 1,  0, 2280,   0 },
+    {   0,  3, 1,  0, 2281,   0 },
+    {   0,  3, 1,  0, 2282,   0 },
+    {   0,  3, 1,  0, 2283,   0 },
+    {   0,  3, 1,  0, 2284,   0 },
+    {   0,  3, 1,  0, 2285,   0 },
+    {   0,  3, 1,  0, 2286,   0 },
+    {   0,  3, 1,  0, 2287,   0 },
+    {   0,  3, 1,  0, 2288,   0 },
+    {   0,  3, 1,  0, 2289,   0 },
+    {   0,  3, 1,  0, 2290,   0 },
+    {   0,  3, 1,  0, 2291,   0 },
+    {   0,  3, 1,  0, 2292,   0 },
+    {   0,  3, 1,  0, 2293,   0 },
+    {   0,  3, 1,  0, 2294,   0 },
+    {   0,  3, 1,  0, 2295,   0 },
+    {   0,  3, 1,  0, 2296,   0 },
+    {   0,  3, 1,  0, 2297,   0 },
+    {   0,  3, 1,  0, 2298,   0 },
+    {   0,  3, 1,  0, 2299,   0 },
+    {   0,  3, 1,  0, 2300,   0 },
+    {   0,  3, 1,  0, 2301,   0 },
+    {   0,  3, 1,  0, 2302,   0 },
+    {   0,  3, 1,  0, 2303,   0 },
+    {   0,  3, 1,  0, 2304,   0 },
+    {   0,  3, 1,  0, 2305,   0 },
+    {   0,  3, 1,  0, 2306,   0 },
+    {   0,  3, 1,  0, 2307,   0 },
+    {   0,  3, 1,  0, 2308,   0 },
+    {   0,  3, 1,  0, 2309,   0 },
+    {   0,  3, 1,  0, 2310,   0 },
+    {   0,  3, 1,  0, 2311,   0 },
+    {   0,  3, 1,  0, 2312,   0 },
+    {   0,  3, 1,  0, 2313,   0 },
+    {   0,  3, 1,  0, 2314,   0 },
+    {   0,  3, 1,  0, 2315,   0 },
+    {   0,  3, 1,  0, 2316,   0 },
+    {   0,  3, 1,  0, 2317,   0 },
+    {   0,  3, 1,  0, 2318,   0 },
+    {   0,  3, 1,  0, 2319,   0 },
+    {   0,  3, 1,  0, 2320,   0 },
+    {   0,  3, 1,  0, 2321,   0 },
+    {   0,  3, 1,  0, 2322,   0 },
+    {   0,  3, 1,  0, 2323,   0 },
+    {   0,  3, 1,  0, 2324,   0 },
+    {   0,  3, 1,  0, 2325,   0 },
+    {   0,  3, 1,  0, 2326,   0 },
+    {   0,  3, 1,  0, 2327,   0 },
+    {   0,  3, 1,  0, 2328,   0 },
+    {   0,  3, 1,  0, 2329,   0 },
+    {   0,  3, 1,  0, 2330,   0 },
+    {   0,  3, 1,  0, 2331,   0 },
+    {   0,  3, 1,  0, 2332,   0 },
+    {   0,  3, 1,  0, 2333,   0 },
+    {   0,  3, 1,  0, 2334,   0 },
+    {   0,  3, 1,  0, 2335,   0 },
+    {   0,  3, 1,  0, 2336,   0 },
+    {   0,  3, 1,  0, 2337,   0 },
+    {   0,  3, 1,  0, 2338,   0 },
+    {   0,  3, 1,  0, 2339,   0 },
+    {   0,  3, 1,  0, 2340,   0 },
+    {   0,  3, 1,  0, 2341,   0 },
+    {   0,  3, 1,  0, 2342,   0 },
+    {   0,  3, 1,  0, 2343,   0 },
+    {   0,  3, 1,  0, 2344,   0 },
+    {   0,  3, 1,  0, 2345,   0 },
+    {   0,  3, 1,  0, 2346,   0 },
+    {   0,  3, 1,  0, 2347,   0 },
+    {   0,  3, 1,  0, 2348,   0 },
+    {   0,  3, 1,  0, 2349,   0 },
+    {   0,  3, 1,  0, 2350,   0 },
+    {   0,  3, 1,  0, 2351,   0 },
+    {   0,  3, 1,  0, 2352,   0 },
+    {   0,  3, 1,  0, 2353,   0 },
+    {   0,  3, 1,  0, 2354,   0 },
+    {   0,  3, 1,  0, 2355,   0 },
+    {   0,  3, 1,  0, 2356,   0 },
+    {   0,  3, 1,  0, 2357,   0 },
+    {   0,  3, 1,  0, 2358,   0 },
+    {   0,  3, 1,  0, 2359,   0 },
+    {   0,  3, 1,  0, 2360,   0 },
+    {   0,  3, 1,  0, 2361,   0 },
+    {   0,  3, 1,  0, 2362,   0 },
+    {   0,  3, 1,  0, 2363,   0 },
+    {   0,  3, 1,  0, 2364,   0 },
+    {   0,  3, 1,  0, 2365,   0 },
+    {   0,  3, 1,  0, 2366,   0 },
+    {   0,  3, 1,  0, 2367,   0 },
+    {   0,  3, 1,  0, 2368,   0 },
+    {   0,  3, 1,  0, 2369,   0 },
+    {   0,  3, 1,  0, 2370,   0 },
+    {   0,  3, 1,  0, 2371,   0 },
+    {   0,  3, 1,  0, 2372,   0 },
+    {   0,  3, 1,  0, 2373,   0 },
+    {   0,  3, 1,  0, 2374,   0 },
+    {   0,  3, 1,  0, 2375,   0 },
+    {   0,  3, 1,  0, 2376,   0 },
+    {   0,  3, 1,  0, 2377,   0 },
+    {   0,  3, 1,  0, 2378,   0 },
+    {   0,  3, 1,  0, 2379,   0 },
+    {   0,  3, 1,  0, 2380,   0 },
+    {   0,  3, 1,  0, 2381,   0 },
+    {   0,  3, 1,  0, 2382,   0 },
+    {   0,  3, 1,  0, 2383,   0 },
+    {   0,  3, 1,  0, 2384,   0 },
+    {   0,  3, 1,  0, 2385,   0 },
+    {   0,  3, 1,  0, 2386,   0 },
+    {   0,  3, 1,  0, 2387,   0 },
+    {   0,  3, 1,  0, 2388,   0 },
+    {   0,  3, 1,  0, 2389,   0 },
+    {   0,  3, 1,  0, 2390,   0 },
+    {   0,  3, 1,  0, 2391,   0 },
+    {   0,  3, 1,  0, 2392,   0 },
+    {   0,  3, 1,  0, 2393,   0 },
+    {   0,  3, 1,  0, 2394,   0 },
+    {   0,  3, 1,  0, 2395,   0 },
+    {   0,  3, 1,  0, 2396,   0 },
+    {   0,  3, 1,  0, 2397,   0 },
+    {   0,  3, 1,  0, 2398,   0 },
+    {   0,  3, 1,  0, 2399,   0 },
+    {   0,  3, 1,  0, 2400,   0 },
+    {   0,  3, 1,  0, 2401,   0 },
+    {   0,  3, 1,  0, 2402,   0 },
+    {   0,  3, 1,  0, 2403,   0 },
+    {   0,  3, 1,  0, 2404,   0 },
+    {   0,  3, 1,  0, 2405,   0 },
+    {   0,  3, 1,  0, 2406,   0 },
+    {   0,  3, 1,  0, 2407,   0 },
+    {   0,  3, 1,  0, 2408,   0 },
+    {   0,  3, 1,  0, 2409,   0 },
+    {   0,  3, 1,  0, 2410,   0 },
+    {   0,  3, 1,  0, 2411,   0 },
+    {   0,  3, 1,  0, 2412,   0 },
+    {   0,  3, 1,  0, 2413,   0 },
+    {   0,  3, 1,  0, 2414,   0 },
+    {   0,  3, 1,  0, 2415,   0 },
+    {   0,  3, 1,  0, 2416,   0 },
+    {   0,  3, 1,  0, 2417,   0 },
+    {   0,  3, 1,  0, 2418,   0 },
+    {   0,  3, 1,  0, 2419,   0 },
+    {   0,  3, 1,  0, 2420,   0 },
+    {   0,  3, 1,  0, 2421,   0 },
+    {   0,  3, 1,  0, 2422,   0 },
+    {   0,  3, 1,  0, 2423,   0 },
+    {   0,  3, 1,  0, 2424,   0 },
+    {   0,  3, 1,  0, 2425,   0 },
+    {   0,  3, 1,  0, 2426,   0 },
+    {   0,  3, 1,  0, 2427,   0 },
+    {   0,  3, 1,  0, 2428,   0 },
+    {   0,  3, 1,  0, 2429,   0 },
+    {   0,  3, 1,  0, 2430,   0 },
+    {   0,  3, 1,  0, 2431,   0 },
+    {   0,  3, 1,  0, 2432,   0 },
+    {   0,  3, 1,  0, 2433,   0 },
+    {   0,  3, 1,  0, 2434,   0 },
+    {   0,  3, 1,  0, 2435,   0 },
+    {   0,  3, 1,  0, 2436,   0 },
+    {   0,  3, 1,  0, 2437,   0 },
+    {   0,  3, 1,  0, 2438,   0 },
+    {   0,  3, 1,  0, 2439,   0 },
+    {   0,  3, 1,  0, 2440,   0 },
+    {   0,  3, 1,  0, 2441,   0 },
+    {   0,  3, 1,  0, 2442,   0 },
+    {   0,  3, 1,  0, 2443,   0 },
+    {   0,  3, 1,  0, 2444,   0 },
+    {   0,  3, 1,  0, 2445,   0 },
+    {   0,  3, 1,  0, 2446,   0 },
+    {   0,  3, 1,  0, 2447,   0 },
+    {   0,  3, 1,  0, 2448,   0 },
+    {   0,  3, 1,  0, 2449,   0 },
+    {   0,  3, 1,  0, 2450,   0 },
+    {   0,  3, 1,  0, 2451,   0 },
+    {   0,  3, 1,  0, 2452,   0 },
+    {   0,  3, 1,  0, 2453,   0 },
+    {   0,  3, 1,  0, 2454,   0 },
+    {   0,  3, 1,  0, 2455,   0 },
+    {   0,  3, 1,  0, 2456,   0 },
+    {   0,  3, 1,  0, 2457,   0 },
+    {   0,  3, 1,  0, 2458,   0 },
+    {   0,  3, 1,  0, 2459,   0 },
+    {   0,  3, 1,  0, 2460,   0 },
+    {   0,  3, 1,  0, 2461,   0 },
+    {   0,  3, 1,  0, 2462,   0 },
+    {   0,  3, 1,  0, 2463,   0 },
+    {   0,  3, 1,  0, 2464,   0 },
+    {   0,  3, 1,  0, 2465,   0 },
+    {   0,  3, 1,  0, 2466,   0 },
+    {   0,  3, 1,  0, 2467,   0 },
+    {   0,  3, 1,  0, 2468,   0 },
+    {   0,  3, 1,  0, 2469,   0 },
+    {   0,  3, 1,  0, 2470,   0 },
+    {   0,  3, 1,  0, 2471,   0 },
+    {   0,  3, 1,  0, 2472,   0 },
+    {   0,  3, 1,  0, 2473,   0 },
+    {   0,  3, 1,  0, 2474,   0 },
+    {   0,  3, 1,  0, 2475,   0 },
+    {   0,  3, 1,  0, 2476,   0 },
+    {   0,  3, 1,  0, 2477,   0 },
+    {   0,  3, 1,  0, 2478,   0 },
+    {   0,  3, 1,  0, 2479,   0 },
+    {   0,  3, 1,  0, 2480,   0 },
+    {   0,  3, 1,  0, 2481,   0 },
+    {   0,  3, 1,  0, 2482,   0 },
+    {   0,  3, 1,  0, 2483,   0 },
+    {   0,  3, 1,  0, 2484,   0 },
+    {   0,  3, 1,  0, 2485,   0 },
+    {   0,  3, 1,  0, 2486,   0 },
+    {   0,  3, 1,  0, 2487,   0 },
+    {   0,  3, 1,  0, 2488,   0 },
+    {   0,  3, 1,  0, 2489,   0 },
+    {   0,  3, 1,  0, 2490,   0 },
+    {   0,  3, 1,  0, 2491,   0 },
+    {   0,  3, 1,  0, 2492,   0 },
+    {   0,  3, 1,  0, 2493,   0 },
+    {   0,  3, 1,  0, 2494,   0 },
+    {   0,  3, 1,  0, 2495,   0 },
+    {   0,  3, 1,  0, 2496,   0 },
+    {   0,  3, 1,  0, 2497,   0 },
+    {   0,  3, 1,  0, 2498,   0 },
+    {   0,  3, 1,  0, 2499,   0 },
+    {   0,  3, 1,  0, 2500,   0 },
+    {   0,  3, 1,  0, 2501,   0 },
+    {   0,  3, 1,  0, 2502,   0 },
+    {   0,  3, 1,  0, 2503,   0 },
+    {   0,  3, 1,  0, 2504,   0 },
+    {   0,  3, 1,  0, 2505,   0 },
+    {   0,  3, 1,  0, 2506,   0 },
+    {   0,  3, 1,  0, 2507,   0 },
+    {   0,  3, 1,  0, 2508,   0 },
+    {   0,  3, 1,  0, 2509,   0 },
+    {   0,  3, 1,  0, 2510,   0 },
+    {   0,  3, 1,  0, 2511,   0 },
+    {   0,  3, 1,  0, 2512,   0 },
+    {   0,  3, 1,  0, 2513,   0 },
+    {   0,  3, 1,  0, 2514,   0 },
+    {   0,  3, 1,  0, 2515,   0 },
+    {   0,  3, 1,  0, 2516,   0 },
+    {   0,  3, 1,  0, 2517,   0 },
+    {   0,  3, 1,  0, 2518,   0 },
+    {   0,  3, 1,  0, 2519,   0 },
+    {   0,  3, 1,  0, 2520,   0 },
+    {   0,  3, 1,  0, 2521,   0 },
+    {   0,  3, 1,  0, 2522,   0 },
+    {   0,  3, 1,  0, 2523,   0 },
+    {   0,  3, 1,  0, 2524,   0 },
+    {   0,  3, 1,  0, 2525,   0 },
+    {   0,  3, 1,  0, 2526,   0 },
+    {   0,  3, 1,  0, 2527,   0 },
+    {   0,  3, 1,  0, 2528,   0 },
+    {   0,  3, 1,  0, 2529,   0 },
+    {   0,  3, 1,  0, 2530,   0 },
+    {   0,  3, 1,  0, 2531,   0 },
+    {   0,  3, 1,  0, 2532,   0 },
+    {   0,  3, 1,  0, 2533,   0 },
+    {   0,  3, 1,  0, 2534,   0 },
+    {   0,  3, 1,  0, 2535,   0 },
+    {   0,  3, 1,  0, 2536,   0 },
+    {   0,  3, 1,  0, 2537,   0 },
+    {   0,  3, 1,  0, 2538,   0 },
+    {   0,  3, 1,  0, 2539,   0 },
+    {   0,  3, 1,  0, 2540,   0 },
+    {   0,  3, 1,  0, 2541,   0 },
+    {   0,  3, 1,  0, 2542,   0 },
+    {   0,  3, 1,  0, 2543,   0 },
+    {   0,  3, 1,  0, 2544,   0 },
+    {   0,  3, 1,  0, 2545,   0 },
+    {   0,  3, 1,  0, 2546,   0 },
+    {   0,  3, 1,  0, 2547,   0 },
+    {   0,  3, 1,  0, 2548,   0 },
+    {   0,  3, 1,  0, 2549,   0 },
+    {   0,  3, 1,  0, 2550,   0 },
+    {   0,  3, 1,  0, 2551,   0 },
+    {   0,  3, 1,  0, 2552,   0 },
+    {   0,  3, 1,  0, 2553,   0 },
+    {   0,  3, 1,  0, 2554,   0 },
+    {   0,  3, 1,  0, 2555,   0 },
+    {   0,  3, 1,  0, 2556,   0 },
+    {   0,  3, 1,  0, 2557,   0 },
+    {   0,  3, 1,  0, 2558,   0 },
+    {   0,  3, 1,  0, 2559,   0 },
+    {   0,  3, 1,  0, 2560,   0 },
+    {   0,  3, 1,  0, 2561,   0 },
+    {   0,  3, 1,  0, 2562,   0 },
+    {   0,  3, 1,  0, 2563,   0 },
+    {   0,  3, 1,  0, 2564,   0 },
+    {   0,  3, 1,  0, 2565,   0 },
+    {   0,  3, 1,  0, 2566,   0 },
+    {   0,  3, 1,  0, 2567,   0 },
+    {   0,  3, 1,  0, 2568,   0 },
+    {   0,  3, 1,  0, 2569,   0 },
+    {   0,  3, 1,  0, 2570,   0 },
+    {   0,  3, 1,  0, 2571,   0 },
+    {   0,  3, 1,  0, 2572,   0 },
+    {   0,  3, 1,  0, 2573,   0 },
+    {   0,  3, 1,  0, 2574,   0 },
+    {   0,  3, 1,  0, 2575,   0 },
+    {   0,  3, 1,  0, 2576,   0 },
+    {   0,  3, 1,  0, 2577,   0 },
+    {   0,  3, 1,  0, 2578,   0 },
+    {   0,  3, 1,  0, 2579,   0 },
+    {   0,  3, 1,  0, 2580,   0 },
+    {   0,  3, 1,  0, 2581,   0 },
+    {   0,  3, 1,  0, 2582,   0 },
+    {   0,  3, 1,  0, 2583,   0 },
+    {   0,  3, 1,  0, 2584,   0 },
+    {   0,  3, 1,  0, 2585,   0 },
+    {   0,  3, 1,  0, 2586,   0 },
+    {   0,  3, 1,  0, 2587,   0 },
+    {   0,  3, 1,  0, 2588,   0 },
+    {   0,  3, 1,  0, 2589,   0 },
+    {   0,  3, 1,  0, 2590,   0 },
+    {   0,  3, 1,  0, 2591,   0 },
+    {   0,  3, 1,  0, 2592,   0 },
+    {   0,  3, 1,  0, 2593,   0 },
+    {   0,  3, 1,  0, 2594,   0 },
+    {   0,  3, 1,  0, 2595,   0 },
+    {   0,  3, 1,  0, 2596,   0 },
+    {   0,  3, 1,  0, 2597,   0 },
+    {   0,  3, 1,  0, 2598,   0 },
+    {   0,  3, 1,  0, 2599,   0 },
+    {   0,  3, 1,  0, 2600,   0 },
+    {   0,  3, 1,  0, 2601,   0 },
+    {   0,  3, 1,  0, 2602,   0 },
+    {   0,  3, 1,  0, 2603,   0 },
+    {   0,  3, 1,  0, 2604,   0 },
+    {   0,  3, 1,  0, 2605,   0 },
+    {   0,  3, 1,  0, 2606,   0 },
+    {   0,  3, 1,  0, 2607,   0 },
+    {   0,  3, 1,  0, 2608,   0 },
+    {   0,  3, 1,  0, 2609,   0 },
+    {   0,  3, 1,  0, 2610,   0 },
+    {   0,  3, 1,  0, 2611,   0 },
+    {   0,  3, 1,  0, 2612,   0 },
+    {   0,  3, 1,  0, 2613,   0 },
+    {   0,  3, 1,  0, 2614,   0 },
+    {   0,  3, 1,  0, 2615,   0 },
+    {   0,  3, 1,  0, 2616,   0 },
+    {   0,  3, 1,  0, 2617,   0 },
+    {   0,  3, 1,  0, 2618,   0 },
+    {   0,  3, 1,  0, 2619,   0 },
+    {   0,  3, 1,  0, 2620,   0 },
+    {   0,  3, 1,  0, 2621,   0 },
+    {   0,  3, 1,  0, 2622,   0 },
+    {   0,  3, 1,  0, 2623,   0 },
+    {   0,  3, 1,  0, 2624,   0 },
+    {   0,  3, 1,  0, 2625,   0 },
+    {   0,  3, 1,  0, 2626,   0 },
+    {   0,  3, 1,  0, 2627,   0 },
+    {   0,  3, 1,  0, 2628,   0 },
+    {   0,  3, 1,  0, 2629,   0 },
+    {   0,  3, 1,  0, 2630,   0 },
+    {   0,  3, 1,  0, 2631,   0 },
+    {   0,  3, 1,  0, 2632,   0 },
+    {   0,  3, 1,  0, 2633,   0 },
+    {   0,  3, 1,  0, 2634,   0 },
+    {   0,  3, 1,  0, 2635,   0 },
+    {   0,  3, 1,  0, 2636,   0 },
+    {   0,  3, 1,  0, 2637,   0 },
+    {   0,  3, 1,  0, 2638,   0 },
+    {   0,  3, 1,  0, 2639,   0 },
+    {   0,  3, 1,  0, 2640,   0 },
+    {   0,  3, 1,  0, 2641,   0 },
+    {   0,  3, 1,  0, 2642,   0 },
+    {   0,  3, 1,  0, 2643,   0 },
+    {   0,  3, 1,  0, 2644,   0 },
+    {   0,  3, 1,  0, 2645,   0 },
+    {   0,  3, 1,  0, 2646,   0 },
+    {   0,  3, 1,  0, 2647,   0 },
+    {   0,  3, 1,  0, 2648,   0 },
+    {   0,  3, 1,  0, 2649,   0 },
+    {   0,  3, 1,  0, 2650,   0 },
+    {   0,  3, 1,  0, 2651,   0 },
+    {   0,  3, 1,  0, 2652,   0 },
+    {   0,  3, 1,  0, 2653,   0 },
+    {   0,  3, 1,  0, 2654,   0 },
+    {   0,  3, 1,  0, 2655,   0 },
+    {   0,  3, 1,  0, 2656,   0 },
+    {   0,  3, 1,  0, 2657,   0 },
+    {   0,  3, 1,  0, 2658,   0 },
+    {   0,  3, 1,  0, 2659,   0 },
+    {   0,  3, 1,  0, 2660,   0 },
+    {   0,  3, 1,  0, 2661,   0 },
+    {   0,  3, 1,  0, 2662,   0 },
+    {   0,  3, 1,  0, 2663,   0 },
+    {   0,  3, 1,  0, 2664,   0 },
+    {   0,  3, 1,  0, 2665,   0 },
+    {   0,  3, 1,  0, 2666,   0 },
+    {   0,  3, 1,  0, 2667,   0 },
+    {   0,  3, 1,  0, 2668,   0 },
+    {   0,  3, 1,  0, 2669,   0 },
+    {   0,  3, 1,  0, 2670,   0 },
+    {   0,  3, 1,  0, 2671,   0 },
+    {   0,  3, 1,  0, 2672,   0 },
+    {   0,  3, 1,  0, 2673,   0 },
+    {   0,  3, 1,  0, 2674,   0 },
+    {   0,  3, 1,  0, 2675,   0 },
+    {   0,  3, 1,  0, 2676,   0 },
+    {   0,  3, 1,  0, 2677,   0 },
+    {   0,  3, 1,  0, 2678,   0 },
+    {   0,  3, 1,  0, 2679,   0 },
+    {   0,  3, 1,  0, 2680,   0 },
+    {   0,  3, 1,  0, 2681,   0 },
+    {   0,  3, 1,  0, 2682,   0 },
+    {   0,  3, 1,  0, 2683,   0 },
+    {   0,  3, 1,  0, 2684,   0 },
+    {   0,  3, 1,  0, 2685,   0 },
+    {   0,  3, 1,  0, 2686,   0 },
+    {   0,  3, 1,  0, 2687,   0 },
+    {   0,  3, 1,  0, 2688,   0 },
+    {   0,  3, 1,  0, 2689,   0 },
+    {   0,  3, 1,  0, 2690,   0 },
+    {   0,  3, 1,  0, 2691,   0 },
+    {   0,  3, 1,  0, 2692,   0 },
+    {   0,  3, 1,  0, 2693,   0 },
+    {   0,  3, 1,  0, 2694,   0 },
+    {   0,  3, 1,  0, 2695,   0 },
+    {   0,  3, 1,  0, 2696,   0 },
+    {   0,  3, 1,  0, 2697,   0 },
+    {   0,  3, 1,  0, 2698,   0 },
+    {   0,  3, 1,  0, 2699,   0 },
+    {   0,  3, 1,  0, 2700,   0 },
+    {   0,  3, 1,  0, 2701,   0 },
+    {   0,  3, 1,  0, 2702,   0 },
+    {   0,  3, 1,  0, 2703,   0 },
+    {   0,  3, 1,  0, 2704,   0 },
+    {   0,  3, 1,  0, 2705,   0 },
+    {   0,  3, 1,  0, 2706,   0 },
+    {   0,  3, 1,  0, 2707,   0 },
+    {   0,  3, 1,  0, 2708,   0 },
+    {   0,  3, 1,  0, 2709,   0 },
+    {   0,  3, 1,  0, 2710,   0 },
+    {   0,  3, 1,  0, 2711,   0 },
+    {   0,  3, 1,  0, 2712,   0 },
+    {   0,  3, 1,  0, 2713,   0 },
+    {   0,  3, 1,  0, 2714,   0 },
+    {   0,  3, 1,  0, 2715,   0 },
+    {   0,  3, 1,  0, 2716,   0 },
+    {   0,  3, 1,  0, 2717,   0 },
+    {   0,  3, 1,  0, 2718,   0 },
+    {   0,  3, 1,  0, 2719,   0 },
+    {   0,  3, 1,  0, 2720,   0 },
+    {   0,  3, 1,  0, 2721,   0 },
+    {   0,  3, 1,  0, 2722,   0 },
+    {   0,  3, 1,  0, 2723,   0 },
+    {   0,  3, 1,  0, 2724,   0 },
+    {   0,  3, 1,  0, 2725,   0 },
+    {   0,  3, 1,  0, 2726,   0 },
+    {   0,  3, 1,  0, 2727,   0 },
+    {   0,  3, 1,  0, 2728,   0 },
+    {   0,  3, 1,  0, 2729,   0 },
+    {   0,  3, 1,  0, 2730,   0 },
+    {   0,  3, 1,  0, 2731,   0 },
+    {   0,  3, 1,  0, 2732,   0 },
+    {   0,  3, 2,  0, 2733,   0 },
+    {  26,  8, 0,  0,    0,   0 },
+    {   0,  3, 2,  0, 2735,   0 },
+    {   0,  3, 2,  0, 2737,   0 },
+    {   0,  3, 2,  0, 2739,   0 },
+    {   0,  3, 3,  0, 2741,   0 },
+    {   0,  3, 3,  0, 2744,   0 },
+    {   0,  3, 2,  0, 2747,   0 },
+    {   0,  3, 2,  0, 2749,   0 },
+    {   0,  3, 2,  0, 2751,   0 },
+    {   0,  3, 2,  0, 2753,   0 },
+    {   0,  3, 2,  0, 2755,   0 },
+    {   0,  3, 2,  0, 2757,   0 },
+    {   0,  3, 2,  0, 2759,   0 },
+    {   0,  3, 2,  0, 2761,   0 },
+    {   0,  3, 2,  0, 2763,   0 },
+    {   0,  3, 2,  0, 2765,   0 },
+    {   0,  3, 2,  0, 2767,   0 },
+    {   0,  3, 2,  0, 2769,   0 },
+    {   0,  3, 2,  0, 2771,   0 },
+    {   0,  3, 2,  0, 2773,   0 },
+    {   0,  3, 2,  0, 2775,   0 },
+    {   0,  3, 2,  0, 2777,   0 },
+    {   0,  3, 2,  0, 2779,   0 },
+    {   0,  3, 2,  0, 2781,   0 },
+    {   0,  3, 2,  0, 2783,   0 },
+    {   0,  3, 2,  0, 2785,   0 },
+    {   0,  3, 2,  0, 2787,   0 },
+    {   0,  3, 2,  0, 2789,   0 },
+    {   0,  3, 2,  0, 2791,   0 },
+    {   0,  3, 2,  0, 2793,   0 },
+    {   0,  3, 2,  0, 2795,   0 },
+    {   0,  3, 2,  0, 2797,   0 },
+    {   0,  3, 2,  0, 2799,   0 },
+    {   0,  3, 2,  0, 2801,   0 },
+    {   0,  0, 0,  1,    0, 928 },
+    {   0,  1, 2,  0, 2803,   0 },
+    {   0,  0, 0,  1,    0, 929 },
+    {   0,  1, 2,  0, 2805,   0 },
+    {   0,  0, 0,  1,    0, 930 },
+    {   0,  1, 2,  0, 2807,   0 },
+    {   0,  1, 2,  0, 2809,   0 },
+    {   0,  1, 2,  0, 2811,   0 },
+    {   0,  0, 0,  1,    0, 931 },
+    {   0,  0, 0,  1,    0, 932 },
+    {   0,  0, 0,  2,    0, 933 },
+    {   0,  1, 2,  0, 2813,   0 },
+    {   0,  1, 2,  0, 2815,   0 },
+    {   0,  0, 0,  3,    0, 935 },
+    {   0,  1, 2,  0, 2817,   0 },
+    {   0,  1, 2,  0, 2819,   0 },
+    {   0,  1, 2,  0, 2821,   0 },
+    {   0,  0, 0,  1,    0, 938 },
+    {   0,  0, 0,  1,    0, 939 },
+    {   0,  1, 2,  0, 2823,   0 },
+    {   0,  1, 2,  0, 2825,   0 },
+    {   0,  0, 0,  1,    0, 940 },
+    {   0,  1, 2,  0, 2827,   0 },
+    {   6,  8, 0,  0,    0,   0 },
+    {   0,  3, 2,  0, 2829,   0 },
+    {   0,  3, 2,  0, 2831,   0 },
+    {   0,  3, 3,  0, 2833,   0 },
+    {   0,  3, 3,  0, 2836,   0 },
+    {   0,  3, 3,  0, 2839,   0 },
+    {   0,  3, 3,  0, 2842,   0 },
+    {   0,  3, 3,  0, 2845,   0 },
+    { 226,  8, 0,  0,    0,   0 },
+    {   0,  3, 2,  0, 2848,   0 },
+    {   0,  3, 2,  0, 2850,   0 },
+    {   0,  3, 3,  0, 2852,   0 },
+    {   0,  3, 3,  0, 2855,   0 },
+    {   0,  3, 3,  0, 2858,   0 },
+    {   0,  3, 3,  0, 2861,   0 },
+    {   0,  3, 1,  0, 2864,   0 },
+    {   0,  3, 1,  0, 2865,   0 },
+    {   0,  3, 1,  0, 2866,   0 },
+    {   0,  3, 1,  0, 2867,   0 },
+    {   0,  3, 1,  0, 2868,   0 },
+    {   0,  3, 1,  0, 2869,   0 },
+    {   0,  3, 1,  0, 2870,   0 },
+    {   0,  3, 1,  0, 2871,   0 },
+    {   0,  3, 1,  0, 2872,   0 },
+    {   0,  3, 1,  0, 2873,   0 },
+    {   0,  3, 1,  0, 2874,   0 },
+    {   0,  3, 1,  0, 2875,   0 },
+    {   0,  3, 1,  0, 2876,   0 },
+    {   0,  3, 1,  0, 2877,   0 },
+    {   0,  3, 1,  0, 2878,   0 },
+    {   0,  3, 1,  0, 2879,   0 },
+    {   0,  3, 1,  0, 2880,   0 },
+    {   0,  3, 1,  0, 2881,   0 },
+    {   0,  3, 1,  0, 2882,   0 },
+    {   0,  3, 1,  0, 2883,   0 },
+    {   0,  3, 1,  0, 2884,   0 },
+    {   0,  3, 1,  0, 2885,   0 },
+    {   0,  3, 1,  0, 2886,   0 },
+    {   0,  3, 1,  0, 2887,   0 },
+    {   0,  3, 1,  0, 2888,   0 },
+    {   0,  3, 1,  0, 2889,   0 },
+    {   0,  3, 1,  0, 2890,   0 },
+    {   0,  3, 1,  0, 2891,   0 },
+    {   0,  3, 1,  0, 2892,   0 },
+    {   0,  3, 1,  0, 2893,   0 },
+    {   0,  3, 1,  0, 2894,   0 },
+    {   0,  3, 1,  0, 2895,   0 },
+    {   0,  3, 1,  0, 2896,   0 },
+    {   0,  3, 1,  0, 2897,   0 },
+    {   0,  3, 1,  0, 2898,   0 },
+    {   0,  3, 1,  0, 2899,   0 },
+    {   0,  3, 1,  0, 2900,   0 },
+    {   0,  3, 1,  0, 2901,   0 },
+    {   0,  3, 1,  0, 2902,   0 },
+    {   0,  3, 1,  0, 2903,   0 },
+    {   0,  3, 1,  0, 2904,   0 },
+    {   0,  3, 1,  0, 2905,   0 },
+    {   0,  3, 1,  0, 2906,   0 },
+    {   0,  3, 1,  0, 2907,   0 },
+    {   0,  3, 1,  0, 2908,   0 },
+    {   0,  3, 1,  0, 2909,   0 },
+    {   0,  3, 1,  0, 2910,   0 },
+    {   0,  3, 1,  0, 2911,   0 },
+    {   0,  3, 1,  0, 2912,   0 },
+    {   0,  3, 1,  0, 2913,   0 },
+    {   0,  3, 1,  0, 2914,   0 },
+    {   0,  3, 1,  0, 2915,   0 },
+    {   0,  3, 1,  0, 2916,   0 },
+    {   0,  3, 1,  0, 2917,   0 },
+    {   0,  3, 1,  0, 2918,   0 },
+    {   0,  3, 1,  0, 2919,   0 },
+    {   0,  3, 1,  0, 2920,   0 },
+    {   0,  3, 1,  0, 2921,   0 },
+    {   0,  3, 1,  0, 2922,   0 },
+    {   0,  3, 1,  0, 2923,   0 },
+    {   0,  3, 1,  0, 2924,   0 },
+    {   0,  3, 1,  0, 2925,   0 },
+    {   0,  3, 1,  0, 2926,   0 },
+    {   0,  3, 1,  0, 2927,   0 },
+    {   0,  3, 1,  0, 2928,   0 },
+    {   0,  3, 1,  0, 2929,   0 },
+    {   0,  3, 1,  0, 2930,   0 },
+    {   0,  3, 1,  0, 2931,   0 },
+    {   0,  3, 1,  0, 2932,   0 },
+    {   0,  3, 1,  0, 2933,   0 },
+    {   0,  3, 1,  0, 2934,   0 },
+    {   0,  3, 1,  0, 2935,   0 },
+    {   0,  3, 1,  0, 2936,   0 },
+    {   0,  3, 1,  0, 2937,   0 },
+    {   0,  3, 1,  0, 2938,   0 },
+    {   0,  3, 1,  0, 2939,   0 },
+    {   0,  3, 1,  0, 2940,   0 },
+    {   0,  3, 1,  0, 2941,   0 },
+    {   0,  3, 1,  0, 2942,   0 },
+    {   0,  3, 1,  0, 2943,   0 },
+    {   0,  3, 1,  0, 2944,   0 },
+    {   0,  3, 1,  0, 2945,   0 },
+    {   0,  3, 1,  0, 2946,   0 },
+    {   0,  3, 1,  0, 2947,   0 },
+    {   0,  3, 1,  0, 2948,   0 },
+    {   0,  3, 1,  0, 2949,   0 },
+    {   0,  3, 1,  0, 2950,   0 },
+    {   0,  3, 1,  0, 2951,   0 },
+    {   0,  3, 1,  0, 2952,   0 },
+    {   0,  3, 1,  0, 2953,   0 },
+    {   0,  3, 1,  0, 2954,   0 },
+    {   0,  3, 1,  0, 2955,   0 },
+    {   0,  3, 1,  0, 2956,   0 },
+    {   0,  3, 1,  0, 2957,   0 },
+    {   0,  3, 1,  0, 2958,   0 },
+    {   0,  3, 1,  0, 2959,   0 },
+    {   0,  3, 1,  0, 2960,   0 },
+    {   0,  3, 1,  0, 2961,   0 },
+    {   0,  3, 1,  0, 2962,   0 },
+    {   0,  3, 1,  0, 2963,   0 },
+    {   0,  3, 1,  0, 2964,   0 },
+    {   0,  3, 1,  0, 2965,   0 },
+    {   0,  3, 1,  0, 2966,   0 },
+    {   0,  3, 1,  0, 2967,   0 },
+    {   0,  3, 1,  0, 2968,   0 },
+    {   0,  3, 1,  0, 2969,   0 },
+    {   0,  3, 1,  0, 2970,   0 },
+    {   0,  3, 1,  0, 2971,   0 },
+    {   0,  3, 1,  0, 2972,   0 },
+    {   0,  3, 1,  0, 2973,   0 },
+    {   0,  3, 1,  0, 2974,   0 },
+    {   0,  3, 1,  0, 2975,   0 },
+    {   0,  3, 1,  0, 2976,   0 },
+    {   0,  3, 1,  0, 2977,   0 },
+    {   0,  3, 1,  0, 2978,   0 },
+    {   0,  3, 1,  0, 2979,   0 },
+    {   0,  3, 1,  0, 2980,   0 },
+    {   0,  3, 1,  0, 2981,   0 },
+    {   0,  3, 1,  0, 2982,   0 },
+    {   0,  3, 1,  0, 2983,   0 },
+    {   0,  3, 1,  0, 2984,   0 },
+    {   0,  3, 1,  0, 2985,   0 },
+    {   0,  3, 1,  0, 2986,   0 },
+    {   0,  3, 1,  0, 2987,   0 },
+    {   0,  3, 1,  0, 2988,   0 },
+    {   0,  3, 1,  0, 2989,   0 },
+    {   0,  3, 1,  0, 2990,   0 },
+    {   0,  3, 1,  0, 2991,   0 },
+    {   0,  3, 1,  0, 2992,   0 },
+    {   0,  3, 1,  0, 2993,   0 },
+    {   0,  3, 1,  0, 2994,   0 },
+    {   0,  3, 1,  0, 2995,   0 },
+    {   0,  3, 1,  0, 2996,   0 },
+    {   0,  3, 1,  0, 2997,   0 },
+    {   0,  3, 1,  0, 2998,   0 },
+    {   0,  3, 1,  0, 2999,   0 },
+    {   0,  3, 1,  0, 3000,   0 },
+    {   0,  3, 1,  0, 3001,   0 },
+    {   0,  3, 1,  0, 3002,   0 },
+    {   0,  3, 1,  0, 3003,   0 },
+    {   0,  3, 1,  0, 3004,   0 },
+    {   0,  3, 1,  0, 3005,   0 },
+    {   0,  3, 1,  0, 3006,   0 },
+    {   0,  3, 1,  0, 3007,   0 },
+    {   0,  3, 1,  0, 3008,   0 },
+    {   0,  3, 1,  0, 3009,   0 },
+    {   0,  3, 1,  0, 3010,   0 },
+    {   0,  3, 1,  0, 3011,   0 },
+    {   0,  3, 1,  0, 3012,   0 },
+    {   0,  3, 1,  0, 3013,   0 },
+    {   0,  3, 1,  0, 3014,   0 },
+    {   0,  3, 1,  0, 3015,   0 },
+    {   0,  3, 1,  0, 3016,   0 },
+    {   0,  3, 1,  0, 3017,   0 },
+    {   0,  3, 1,  0, 3018,   0 },
+    {   0,  3, 1,  0, 3019,   0 },
+    {   0,  3, 1,  0, 3020,   0 },
+    {   0,  3, 1,  0, 3021,   0 },
+    {   0,  3, 1,  0, 3022,   0 },
+    {   0,  3, 1,  0, 3023,   0 },
+    {   0,  3, 1,  0, 3024,   0 },
+    {   0,  3, 1,  0, 3025,   0 },
+    {   0,  3, 1,  0, 3026,   0 },
+    {   0,  3, 1,  0, 3027,   0 },
+    {   0,  3, 1,  0, 3028,   0 },
+    {   0,  3, 1,  0, 3029,   0 },
+    {   0,  3, 1,  0, 3030,   0 },
+    {   0,  3, 1,  0, 3031,   0 },
+    {   0,  3, 1,  0, 3032,   0 },
+    {   0,  3, 1,  0, 3033,   0 },
+    {   0,  3, 1,  0, 3034,   0 },
+    {   0,  3, 1,  0, 3035,   0 },
+    {   0,  3, 1,  0, 3036,   0 },
+    {   0,  3, 1,  0, 3037,   0 },
+    {   0,  3, 1,  0, 3038,   0 },
+    {   0,  3, 1,  0, 3039,   0 },
+    {   0,  3, 1,  0, 3040,   0 },
+    {   0,  3, 1,  0, 3041,   0 },
+    {   0,  3, 1,  0, 3042,   0 },
+    {   0,  3, 1,  0, 3043,   0 },
+    {   0,  3, 1,  0, 3044,   0 },
+    {   0,  3, 1,  0, 3045,   0 },
+    {   0,  3, 1,  0, 3046,   0 },
+    {   0,  3, 1,  0, 3047,   0 },
+    {   0,  3, 1,  0, 3048,   0 },
+    {   0,  3, 1,  0, 3049,   0 },
+    {   0,  3, 1,  0, 3050,   0 },
+    {   0,  3, 1,  0, 3051,   0 },
+    {   0,  3, 1,  0, 3052,   0 },
+    {   0,  3, 1,  0, 3053,   0 },
+    {   0,  3, 1,  0, 3054,   0 },
+    {   0,  3, 1,  0, 3055,   0 },
+    {   0,  3, 1,  0, 3056,   0 },
+    {   0,  3, 1,  0, 3057,   0 },
+    {   0,  3, 1,  0, 3058,   0 },
+    {   0,  3, 1,  0, 3059,   0 },
+    {   0,  3, 1,  0, 3060,   0 },
+    {   0,  3, 1,  0, 3061,   0 },
+    {   0,  3, 1,  0, 3062,   0 },
+    {   0,  3, 1,  0, 3063,   0 },
+    {   0,  3, 1,  0, 3064,   0 },
+    {   0,  3, 1,  0, 3065,   0 },
+    {   0,  3, 1,  0, 3066,   0 },
+    {   0,  3, 1,  0, 3067,   0 },
+    {   0,  3, 1,  0, 3068,   0 },
+    {   0,  3, 1,  0, 3069,   0 },
+    {   0,  3, 1,  0, 3070,   0 },
+    {   0,  3, 1,  0, 3071,   0 },
+    {   0,  3, 1,  0, 3072,   0 },
+    {   0,  3, 1,  0, 3073,   0 },
+    {   0,  3, 1,  0, 3074,   0 },
+    {   0,  3, 1,  0, 3075,   0 },
+    {   0,  3, 1,  0, 3076,   0 },
+    {   0,  3, 1,  0, 3077,   0 },
+    {   0,  3, 1,  0, 3078,   0 },
+    {   0,  3, 1,  0, 3079,   0 },
+    {   0,  3, 1,  0, 3080,   0 },
+    {   0,  3, 1,  0, 3081,   0 },
+    {   0,  3, 1,  0, 3082,   0 },
+    {   0,  3, 1,  0, 3083,   0 },
+    {   0,  3, 1,  0, 3084,   0 },
+    {   0,  3, 1,  0, 3085,   0 },
+    {   0,  3, 1,  0, 3086,   0 },
+    {   0,  3, 1,  0, 3087,   0 },
+    {   0,  3, 1,  0, 3088,   0 },
+    {   0,  3, 1,  0, 3089,   0 },
+    {   0,  3, 1,  0, 3090,   0 },
+    {   0,  3, 1,  0, 3091,   0 },
+    {   0,  3, 1,  0, 3092,   0 },
+    {   0,  3, 1,  0, 3093,   0 },
+    {   0,  3, 1,  0, 3094,   0 },
+    {   0,  3, 1,  0, 3095,   0 },
+    {   0,  3, 1,  0, 3096,   0 },
+    {   0,  3, 1,  0, 3097,   0 },
+    {   0,  3, 1,  0, 3098,   0 },
+    {   0,  3, 1,  0, 3099,   0 },
+    {   0,  3, 1,  0, 3100,   0 },
+    {   0,  3, 1,  0, 3101,   0 },
+    {   0,  3, 1,  0, 3102,   0 },
+    {   0,  3, 1,  0, 3103,   0 },
+    {   0,  3, 1,  0, 3104,   0 },
+    {   0,  3, 1,  0, 3105,   0 },
+    {   0,  3, 1,  0, 3106,   0 },
+    {   0,  3, 1,  0, 3107,   0 },
+    {   0,  3, 1,  0, 3108,   0 },
+    {   0,  3, 1,  0, 3109,   0 },
+    {   0,  3, 1,  0, 3110,   0 },
+    {   0,  3, 1,  0, 3111,   0 },
+    {   0,  3, 1,  0, 3112,   0 },
+    {   0,  3, 1,  0, 3113,   0 },
+    {   0,  3, 1,  0, 3114,   0 },
+    {   0,  3, 1,  0, 3115,   0 },
+    {   0,  3, 1,  0, 3116,   0 },
+    {   0,  3, 1,  0, 3117,   0 },
+    {   0,  3, 1,  0, 3118,   0 },
+    {   0,  3, 1,  0, 3119,   0 },
+    {   0,  3, 1,  0, 3120,   0 },
+    {   0,  3, 1,  0, 3121,   0 },
+    {   0,  3, 1,  0, 3122,   0 },
+    {   0,  3, 1,  0, 3123,   0 },
+    {   0,  3, 1,  0, 3124,   0 },
+    {   0,  3, 1,  0, 3125,   0 },
+    {   0,  3, 1,  0, 3126,   0 },
+    {   0,  3, 1,  0, 3127,   0 },
+    {   0,  3, 1,  0, 3128,   0 },
+    {   0,  3, 1,  0, 3129,   0 },
+    {   0,  3, 1,  0, 3130,   0 },
+    {   0,  3, 1,  0, 3131,   0 },
+    {   0,  3, 1,  0, 3132,   0 },
+    {   0,  3, 1,  0, 3133,   0 },
+    {   0,  3, 1,  0, 3134,   0 },
+    {   0,  3, 1,  0, 3135,   0 },
+    {   0,  3, 1,  0, 3136,   0 },
+    {   0,  3, 1,  0, 3137,   0 },
+    {   0,  3, 1,  0, 3138,   0 },
+    {   0,  3, 1,  0, 3139,   0 },
+    {   0,  3, 1,  0, 3140,   0 },
+    {   0,  3, 1,  0, 3141,   0 },
+    {   0,  3, 1,  0, 3142,   0 },
+    {   0,  3, 1,  0, 3143,   0 },
+    {   0,  3, 1,  0, 3144,   0 },
+    {   0,  3, 1,  0, 3145,   0 },
+    {   0,  3, 1,  0, 3146,   0 },
+    {   0,  3, 1,  0, 3147,   0 },
+    {   0,  3, 1,  0, 3148,   0 },
+    {   0,  3, 1,  0, 3149,   0 },
+    {   0,  3, 1,  0, 3150,   0 },
+    {   0,  3, 1,  0, 3151,   0 },
+    {   0,  3, 1,  0, 3152,   0 },
+    {   0,  3, 1,  0, 3153,   0 },
+    {   0,  3, 1,  0, 3154,   0 },
+    {   0,  3, 1,  0, 3155,   0 },
+    {   0,  3, 1,  0, 3156,   0 },
+    {   0,  3, 1,  0, 3157,   0 },
+    {   0,  3, 1,  0, 3158,   0 },
+    {   0,  3, 1,  0, 3159,   0 },
+    {   0,  3, 1,  0, 3160,   0 },
+    {   0,  3, 1,  0, 3161,   0 },
+    {   0,  3, 1,  0, 3162,   0 },
+    {   0,  3, 1,  0, 3163,   0 },
+    {   0,  3, 1,  0, 3164,   0 },
+    {   0,  3, 1,  0, 3165,   0 },
+    {   0,  3, 1,  0, 3166,   0 },
+    {   0,  3, 1,  0, 3167,   0 },
+    {   0,  3, 1,  0, 3168,   0 },
+    {   0,  3, 1,  0, 3169,   0 },
+    {   0,  3, 1,  0, 3170,   0 },
+    {   0,  3, 1,  0, 3171,   0 },
+    {   0,  3, 1,  0, 3172,   0 },
+    {   0,  3, 1,  0, 3173,   0 },
+    {   0,  3, 1,  0, 3174,   0 },
+    {   0,  3, 1,  0, 3175,   0 },
+    {   0,  3, 1,  0, 3176,   0 },
+    {   0,  3, 1,  0, 3177,   0 },
+    {   0,  3, 1,  0, 3178,   0 },
+    {   0,  3, 1,  0, 3179,   0 },
+    {   0,  3, 1,  0, 3180,   0 },
+    {   0,  3, 1,  0, 3181,   0 },
+    {   0,  3, 1,  0, 3182,   0 },
+    {   0,  3, 1,  0, 3183,   0 },
+    {   0,  3, 1,  0, 3184,   0 },
+    {   0,  3, 1,  0, 3185,   0 },
+    {   0,  3, 1,  0, 3186,   0 },
+    {   0,  3, 1,  0, 3187,   0 },
+    {   0,  3, 1,  0, 3188,   0 },
+    {   0,  3, 1,  0, 3189,   0 },
+    {   0,  3, 1,  0, 3190,   0 },
+    {   0,  3, 1,  0, 3191,   0 },
+    {   0,  3, 1,  0, 3192,   0 },
+    {   0,  3, 1,  0, 3193,   0 },
+    {   0,  3, 1,  0, 3194,   0 },
+    {   0,  3, 1,  0, 3195,   0 },
+    {   0,  3, 1,  0, 3196,   0 },
+    {   0,  3, 1,  0, 3197,   0 },
+    {   0,  3, 1,  0, 3198,   0 },
+    {   0,  3, 1,  0, 3199,   0 },
+    {   0,  3, 1,  0, 3200,   0 },
+    {   0,  3, 1,  0, 3201,   0 },
+    {   0,  3, 1,  0, 3202,   0 },
+    {   0,  3, 1,  0, 3203,   0 },
+    {   0,  3, 1,  0, 3204,   0 },
+    {   0,  3, 1,  0, 3205,   0 },
+    {   0,  3, 1,  0, 3206,   0 },
+    {   0,  3, 1,  0, 3207,   0 },
+    {   0,  3, 1,  0, 3208,   0 },
+    {   0,  3, 1,  0, 3209,   0 },
+    {   0,  3, 1,  0, 3210,   0 },
+    {   0,  3, 1,  0, 3211,   0 },
+    {   0,  3, 1,  0, 3212,   0 },
+    {   0,  3, 1,  0, 3213,   0 },
+    {   0,  3, 1,  0, 3214,   0 },
+    {   0,  3, 1,  0, 3215,   0 },
+    {   0,  3, 1,  0, 3216,   0 },
+    {   0,  3, 1,  0, 3217,   0 },
+    {   0,  3, 1,  0, 3218,   0 },
+    {   0,  3, 1,  0, 3219,   0 },
+    {   0,  3, 1,  0, 3220,   0 },
+    {   0,  3, 1,  0, 3221,   0 },
+    {   0,  3, 1,  0, 3222,   0 },
+    {   0,  3, 1,  0, 3223,   0 },
+    {   0,  3, 1,  0, 3224,   0 },
+    {   0,  3, 1,  0, 3225,   0 },
+    {   0,  3, 1,  0, 3226,   0 },
+    {   0,  3, 1,  0, 3227,   0 },
+    {   0,  3, 1,  0, 3228,   0 },
+    {   0,  3, 1,  0, 3229,   0 },
+    {   0,  3, 1,  0, 3230,   0 },
+    {   0,  3, 1,  0, 3231,   0 },
+    {   0,  3, 1,  0, 3232,   0 },
+    {   0,  3, 1,  0, 3233,   0 },
+    {   0,  3, 1,  0, 3234,   0 },
+    {   0,  3, 1,  0, 3235,   0 },
+    {   0,  3, 1,  0, 3236,   0 },
+    {   0,  3, 1,  0, 3237,   0 },
+    {   0,  3, 1,  0, 3238,   0 },
+    {   0,  3, 1,  0, 3239,   0 },
+    {   0,  3, 1,  0, 3240,   0 },
+    {   0,  3, 1,  0, 3241,   0 },
+    {   0,  3, 1,  0, 3242,   0 },
+    {   0,  3, 1,  0, 3243,   0 },
+    {   0,  3, 1,  0, 3244,   0 },
+    {   0,  3, 1,  0, 3245,   0 },
+    {   0,  3, 1,  0, 3246,   0 },
+    {   0,  3, 1,  0, 3247,   0 },
+    {   0,  3, 1,  0, 3248,   0 },
+    {   0,  3, 1,  0, 3249,   0 },
+    {   0,  3, 1,  0, 3250,   0 },
+    {   0,  3, 1,  0, 3251,   0 },
+    {   0,  3, 1,  0, 3252,   0 },
+    {   0,  3, 1,  0, 3253,   0 },
+    {   0,  3, 1,  0, 3254,   0 },
+    {   0,  3, 1,  0, 3255,   0 },
+    {   0,  3, 1,  0, 3256,   0 },
+    {   0,  3, 1,  0, 3257,   0 },
+    {   0,  3, 1,  0, 3258,   0 },
+    {   0,  3, 1,  0, 3259,   0 },
+    {   0,  3, 1,  0, 3260,   0 },
+    {   0,  3, 1,  0, 3261,   0 },
+    {   0,  3, 1,  0, 3262,   0 },
+    {   0,  3, 1,  0, 3263,   0 },
+    {   0,  3, 1,  0, 3264,   0 },
+    {   0,  3, 1,  0, 3265,   0 },
+    {   0,  3, 1,  0, 3266,   0 },
+    {   0,  3, 1,  0, 3267,   0 },
+    {   0,  3, 1,  0, 3268,   0 },
+    {   0,  3, 1,  0, 3269,   0 },
+    {   0,  3, 1,  0, 3270,   0 },
+    {   0,  3, 1,  0, 3271,   0 },
+    {   0,  3, 1,  0, 3272,   0 },
+    {   0,  3, 1,  0, 3273,   0 },
+    {   0,  3, 1,  0, 3274,   0 },
+    {   0,  3, 1,  0, 3275,   0 },
+    {   0,  3, 1,  0, 3276,   0 },
+    {   0,  3, 1,  0, 3277,   0 },
+    {   0,  3, 1,  0, 3278,   0 },
+    {   0,  3, 1,  0, 3279,   0 },
+    {   0,  3, 1,  0, 3280,   0 },
+    {   0,  3, 1,  0, 3281,   0 },
+    {   0,  3, 1,  0, 3282,   0 },
+    {   0,  3, 1,  0, 3283,   0 },
+    {   0,  3, 1,  0, 3284,   0 },
+    {   0,  3, 1,  0, 3285,   0 },
+    {   0,  3, 1,  0, 3286,   0 },
+    {   0,  3, 1,  0, 3287,   0 },
+    {   0,  3, 1,  0, 3288,   0 },
+    {   0,  3, 1,  0, 3289,   0 },
+    {   0,  3, 1,  0, 3290,   0 },
+    {   0,  3, 1,  0, 3291,   0 },
+    {   0,  3, 1,  0, 3292,   0 },
+    {   0,  3, 1,  0, 3293,   0 },
+    {   0,  3, 1,  0, 3294,   0 },
+    {   0,  3, 1,  0, 3295,   0 },
+    {   0,  3, 1,  0, 3296,   0 },
+    {   0,  3, 1,  0, 3297,   0 },
+    {   0,  3, 1,  0, 3298,   0 },
+    {   0,  3, 1,  0, 3299,   0 },
+    {   0,  3, 1,  0, 3300,   0 },
+    {   0,  3, 1,  0, 3301,   0 },
+    {   0,  3, 1,  0, 3302,   0 },
+    {   0,  3, 1,  0, 3303,   0 },
+    {   0,  3, 1,  0, 3304,   0 },
+    {   0,  3, 1,  0, 3305,   0 },
+    {   0,  3, 1,  0, 3306,   0 },
+    {   0,  3, 1,  0, 3307,   0 },
+    {   0,  3, 1,  0, 3308,   0 },
+    {   0,  3, 1,  0, 3309,   0 },
+    {   0,  3, 1,  0, 3310,   0 },
+    {   0,  3, 1,  0, 3311,   0 },
+    {   0,  3, 1,  0, 3312,   0 },
+    {   0,  3, 1,  0, 3313,   0 },
+    {   0,  3, 1,  0, 3314,   0 },
+    {   0,  3, 1,  0, 3315,   0 },
+    {   0,  3, 1,  0, 3316,   0 },
+    {   0,  3, 1,  0, 3317,   0 },
+    {   0,  3, 1,  0, 3318,   0 },
+    {   0,  3, 1,  0, 3319,   0 },
+    {   0,  3, 1,  0, 3320,   0 },
+    {   0,  3, 1,  0, 3321,   0 },
+    {   0,  3, 1,  0, 3322,   0 },
+    {   0,  3, 1,  0, 3323,   0 },
+    {   0,  3, 1,  0, 3324,   0 },
+    {   0,  3, 1,  0, 3325,   0 },
+    {   0,  3, 1,  0, 3326,   0 },
+    {   0,  3, 1,  0, 3327,   0 },
+    {   0,  3, 1,  0, 3328,   0 },
+    {   0,  3, 1,  0, 3329,   0 },
+    {   0,  3, 1,  0, 3330,   0 },
+    {   0,  3, 1,  0, 3331,   0 },
+    {   0,  3, 1,  0, 3332,   0 },
+    {   0,  3, 1,  0, 3333,   0 },
+    {   0,  3, 1,  0, 3334,   0 },
+    {   0,  3, 1,  0, 3335,   0 },
+    {   0,  3, 1,  0, 3336,   0 },
+    {   0,  3, 1,  0, 3337,   0 },
+    {   0,  3, 1,  0, 3338,   0 },
+    {   0,  3, 1,  0, 3339,   0 },
+    {   0,  3, 1,  0, 3340,   0 },
+    {   0,  3, 1,  0, 3341,   0 },
+    {   0,  3, 1,  0, 3342,   0 },
+    {   0,  3, 1,  0, 3343,   0 },
+    {   0,  3, 1,  0, 3344,   0 },
+    {   0,  3, 1,  0, 3345,   0 },
+    {   0,  3, 1,  0, 3346,   0 },
+    {   0,  3, 1,  0, 3347,   0 },
+    {   0,  3, 1,  0, 3348,   0 },
+    {   0,  3, 1,  0, 3349,   0 },
+    {   0,  3, 1,  0, 3350,   0 },
+    {   0,  3, 1,  0, 3351,   0 },
+    {   0,  3, 1,  0, 3352,   0 },
+    {   0,  3, 1,  0, 3353,   0 },
+    {   0,  3, 1,  0, 3354,   0 },
+    {   0,  3, 1,  0, 3355,   0 },
+    {   0,  3, 1,  0, 3356,   0 },
+    {   0,  3, 1,  0, 3357,   0 },
+    {   0,  3, 1,  0, 3358,   0 },
+    {   0,  3, 1,  0, 3359,   0 },
+    {   0,  3, 1,  0, 3360,   0 },
+    {   0,  3, 1,  0, 3361,   0 },
+    {   0,  3, 1,  0, 3362,   0 },
+    {   0,  3, 1,  0, 3363,   0 },
+    {   0,  3, 1,  0, 3364,   0 },
+    {   0,  3, 1,  0, 3365,   0 },
+    {   0,  3, 1,  0, 3366,   0 },
+    {   0,  3, 1,  0, 3367,   0 },
+    {   0,  3, 1,  0, 3368,   0 },
+    {   0,  3, 1,  0, 3369,   0 },
+    {   0,  3, 1,  0, 3370,   0 },
+    {   0,  3, 1,  0, 3371,   0 },
+    {   0,  3, 1,  0, 3372,   0 },
+    {   0,  3, 1,  0, 3373,   0 },
+    {   0,  3, 1,  0, 3374,   0 },
+    {   0,  3, 1,  0, 3375,   0 },
+    {   0,  3, 1,  0, 3376,   0 },
+    {   0,  3, 1,  0, 3377,   0 },
+    {   0,  3, 1,  0, 3378,   0 },
+    {   0,  3, 1,  0, 3379,   0 },
+    {   0,  3, 1,  0, 3380,   0 },
+    {   0,  3, 1,  0, 3381,   0 },
+    {   0,  3, 1,  0, 3382,   0 },
+    {   0,  3, 1,  0, 3383,   0 },
+    {   0,  3, 1,  0, 3384,   0 },
+    {   0,  3, 1,  0, 3385,   0 },
+    {   0,  3, 1,  0, 3386,   0 },
+    {   0,  3, 1,  0, 3387,   0 },
+    {   0,  3, 1,  0, 3388,   0 },
+    {   0,  3, 1,  0, 3389,   0 },
+    {   0,  3, 1,  0, 3390,   0 },
+    {   0,  3, 1,  0, 3391,   0 },
+    {   0,  3, 1,  0, 3392,   0 },
+    {   0,  3, 1,  0, 3393,   0 },
+    {   0,  3, 1,  0, 3394,   0 },
+    {   0,  3, 1,  0, 3395,   0 },
+    {   0,  3, 1,  0, 3396,   0 },
+    {   0,  3, 1,  0, 3397,   0 },
+    {   0,  3, 1,  0, 3398,   0 },
+    {   0,  3, 1,  0, 3399,   0 },
+    {   0,  3, 1,  0, 3400,   0 },
+    {   0,  3, 1,  0, 3401,   0 },
+    {   0,  3, 1,  0, 3402,   0 },
+    {   0,  3, 1,  0, 3403,   0 },
+    {   0,  3, 1,  0, 3404,   0 },
+    {   0,  3, 1,  0, 3405,   0 },
+};
+
+// Full canonical decompositions, indexed by the records.
+static const unipoint_t UCD_DECOMPOSITIONS[3406] = {
+    0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+    0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+    0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+    0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+    0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+    0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+    0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+    0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+    0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+    0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+    0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+    0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+    0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+    0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+    0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+    0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+    0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+    0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+    0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+    0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+    0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+    0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+    0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+    0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+    0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302,
+    0x0004B, 0x00327, 0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301,
+    0x0004C, 0x00327, 0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C,
+    0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+    0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x0004F, 0x00304, 0x0006F, 0x00304,
+    0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+    0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+    0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301,
+    0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+    0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327,
+    0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303, 0x00075, 0x00303,
+    0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+    0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B,
+    0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+    0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301,
+    0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C,
+    0x0007A, 0x0030C, 0x0004F, 0x0031B, 0x0006F, 0x0031B, 0x00055, 0x0031B,
+    0x00075, 0x0031B, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+    0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+    0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+    0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+    0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+    0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+    0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+    0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+    0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+    0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+    0x0006A, 0x0030C, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300,
+    0x0006E, 0x00300, 0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301,
+    0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301,
+    0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311,
+    0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311,
+    0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311,
+    0x0004F, 0x0030F, 0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311,
+    0x00052, 0x0030F, 0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311,
+    0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+    0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+    0x00048, 0x0030C, 0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307,
+    0x00045, 0x00327, 0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F,
+    0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304,
+    0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F,
+    0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+    0x00313, 0x00308, 0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391,
+    0x00301, 0x000B7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+    0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301, 0x003B9, 0x00308,
+    0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5,
+    0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301,
+    0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301,
+    0x003C9, 0x00301, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x00415, 0x00300,
+    0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301,
+    0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+    0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+    0x0043A, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F,
+    0x00475, 0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+    0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+    0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308,
+    0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+    0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308,
+    0x0043E, 0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308,
+    0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+    0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308,
+    0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00627, 0x00653,
+    0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654,
+    0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C,
+    0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916, 0x0093C,
+    0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+    0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7,
+    0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C,
+    0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C,
+    0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57,
+    0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6, 0x00BBE,
+    0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5,
+    0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2,
+    0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57, 0x00DD9,
+    0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF,
+    0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7,
+    0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74,
+    0x00FB2, 0x00F80, 0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+    0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+    0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x01B05, 0x01B35, 0x01B07, 0x01B35,
+    0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+    0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35,
+    0x01B42, 0x01B35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+    0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+    0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+    0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+    0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+    0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065,
+    0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+    0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330, 0x00065, 0x00330,
+    0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+    0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+    0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+    0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E,
+    0x00068, 0x0032E, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+    0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+    0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331,
+    0x0004C, 0x00323, 0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C,
+    0x00323, 0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D,
+    0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307,
+    0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307,
+    0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331,
+    0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303,
+    0x00301, 0x0006F, 0x00303, 0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F,
+    0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F, 0x00304, 0x00300,
+    0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301,
+    0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+    0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+    0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+    0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+    0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+    0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+    0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+    0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D,
+    0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+    0x00075, 0x00330, 0x00055, 0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303,
+    0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+    0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+    0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+    0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+    0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+    0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+    0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323,
+    0x0007A, 0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331,
+    0x00074, 0x00308, 0x00077, 0x0030A, 0x00079, 0x0030A, 0x0017F, 0x00307,
+    0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+    0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+    0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+    0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+    0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+    0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+    0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+    0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+    0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+    0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+    0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+    0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+    0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+    0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+    0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323,
+    0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+    0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F,
+    0x00302, 0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309,
+    0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323,
+    0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F,
+    0x0031B, 0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300,
+    0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B,
+    0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F,
+    0x0031B, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+    0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301,
+    0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B,
+    0x00309, 0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075,
+    0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323,
+    0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+    0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+    0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+    0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301,
+    0x003B1, 0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313,
+    0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+    0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+    0x00342, 0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314,
+    0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313,
+    0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+    0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+    0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314,
+    0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313,
+    0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7,
+    0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+    0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+    0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+    0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+    0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301,
+    0x003B9, 0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313,
+    0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+    0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+    0x00342, 0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314,
+    0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313,
+    0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314,
+    0x0039F, 0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313,
+    0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314,
+    0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313,
+    0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5,
+    0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5,
+    0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9,
+    0x00314, 0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9,
+    0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+    0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9,
+    0x00313, 0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301,
+    0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314,
+    0x00342, 0x003B1, 0x00300, 0x003B1, 0x00301, 0x003B5, 0x00300, 0x003B5,
+    0x00301, 0x003B7, 0x00300, 0x003B7, 0x00301, 0x003B9, 0x00300, 0x003B9,
+    0x00301, 0x003BF, 0x00300, 0x003BF, 0x00301, 0x003C5, 0x00300, 0x003C5,
+    0x00301, 0x003C9, 0x00300, 0x003C9, 0x00301, 0x003B1, 0x00313, 0x00345,
+    0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300, 0x00345, 0x003B1,
+    0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345, 0x003B1,
+    0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345, 0x003B1,
+    0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391, 0x00314,
+    0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314, 0x00300,
+    0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314, 0x00301,
+    0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314, 0x00342,
+    0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345, 0x003B7,
+    0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345, 0x003B7,
+    0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301, 0x00345, 0x003B7,
+    0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345, 0x00397,
+    0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300,
+    0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313, 0x00301,
+    0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342,
+    0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313, 0x00345,
+    0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300, 0x00345, 0x003C9,
+    0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345, 0x003C9,
+    0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345, 0x003C9,
+    0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345, 0x003A9, 0x00314,
+    0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314, 0x00300,
+    0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314, 0x00301,
+    0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9, 0x00314, 0x00342,
+    0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300, 0x00345,
+    0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342, 0x003B1,
+    0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391, 0x00300,
+    0x00391, 0x00301, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7,
+    0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7,
+    0x00342, 0x003B7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00395, 0x00301,
+    0x00397, 0x00300, 0x00397, 0x00301, 0x00397, 0x00345, 0x01FBF, 0x00300,
+    0x01FBF, 0x00301, 0x01FBF, 0x00342, 0x003B9, 0x00306, 0x003B9, 0x00304,
+    0x003B9, 0x00308, 0x00300, 0x003B9, 0x00308, 0x00301, 0x003B9, 0x00342,
+    0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+    0x00300, 0x00399, 0x00301, 0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE,
+    0x00342, 0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300,
+    0x003C5, 0x00308, 0x00301, 0x003C1, 0x00313, 0x003C1, 0x00314, 0x003C5,
+    0x00342, 0x003C5, 0x00308, 0x00342, 0x003A5, 0x00306, 0x003A5, 0x00304,
+    0x003A5, 0x00300, 0x003A5, 0x00301, 0x003A1, 0x00314, 0x000A8, 0x00300,
+    0x000A8, 0x00301, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345,
+    0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345,
+    0x0039F, 0x00300, 0x0039F, 0x00301, 0x003A9, 0x00300, 0x003A9, 0x00301,
+    0x003A9, 0x00345, 0x000B4, 0x02002, 0x02003, 0x003A9, 0x0004B, 0x00041,
+    0x0030A, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021D0,
+    0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203, 0x00338, 0x02208,
+    0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225, 0x00338, 0x0223C,
+    0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003D,
+    0x00338, 0x02261, 0x00338, 0x0224D, 0x00338, 0x0003C, 0x00338, 0x0003E,
+    0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273,
+    0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A, 0x00338, 0x0227B,
+    0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286, 0x00338, 0x02287,
+    0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9, 0x00338, 0x022AB,
+    0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291, 0x00338, 0x02292,
+    0x00338, 0x022B2, 0x00338, 0x022B3, 0x00338, 0x022B4, 0x00338, 0x022B5,
+    0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B, 0x03099, 0x0304D,
+    0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055,
+    0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D,
+    0x03099, 0x0305F, 0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066,
+    0x03099, 0x03068, 0x03099, 0x0306F, 0x03099, 0x0306F, 0x0309A, 0x03072,
+    0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075, 0x0309A, 0x03078,
+    0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046,
+    0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD, 0x03099, 0x030AF,
+    0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099, 0x030B5, 0x03099, 0x030B7,
+    0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD, 0x03099, 0x030BF,
+    0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6, 0x03099, 0x030C8,
+    0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A, 0x030D2, 0x03099, 0x030D2,
+    0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8, 0x03099, 0x030D8,
+    0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6, 0x03099, 0x030EF,
+    0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099, 0x030F2, 0x03099, 0x030FD,
+    0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1, 0x04E32, 0x053E5,
+    0x09F9C, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6, 0x07669,
+    0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B, 0x070D9,
+    0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04, 0x0721B,
+    0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9, 0x081D8,
+    0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86, 0x051B7,
+    0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606, 0x0865C,
+    0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9,
+    0x09304, 0x09E7F, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262,
+    0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F,
+    0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C,
+    0x07DBE, 0x083F1, 0x09675, 0x08B80, 0x062CF, 0x06A02, 0x08AFE, 0x04E39,
+    0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9,
+    0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449,
+    0x08AAA, 0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565,
+    0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+    0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD,
+    0x09A6A, 0x09E97, 0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74,
+    0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4,
+    0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD,
+    0x070C8, 0x088C2, 0x08AAA, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E,
+    0x07375, 0x04EE4, 0x056F9, 0x05BE7, 0x05DBA, 0x0601C, 0x073B2, 0x07469,
+    0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE,
+    0x091B4, 0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599,
+    0x06A02, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E,
+    0x05289, 0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B,
+    0x07D10, 0x0985E, 0x0516D, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA,
+    0x08F2A, 0x05F8B, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540F,
+    0x05C65, 0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79,
+    0x088CF, 0x088E1, 0x091CC, 0x096E2, 0x0533F, 0x06EBA, 0x0541D, 0x071D0,
+    0x07498, 0x085FA, 0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8,
+    0x07ACB, 0x07B20, 0x07C92, 0x072C0, 0x07099, 0x08B58, 0x04EC0, 0x08336,
+    0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6, 0x05B85, 0x06D1E, 0x066B4,
+    0x08F3B, 0x0884C, 0x0964D, 0x0898B, 0x05ED3, 0x05140, 0x055C0, 0x0585A,
+    0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965, 0x0798F,
+    0x09756, 0x07CBE, 0x07FBD, 0x08612, 0x08AF8, 0x09038, 0x090FD, 0x098EF,
+    0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7, 0x0514D,
+    0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8,
+    0x05C64, 0x05C6E, 0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2,
+    0x06691, 0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422,
+    0x07891, 0x0793E, 0x07949, 0x07948, 0x07950, 0x07956, 0x0795D, 0x0798D,
+    0x0798E, 0x07A40, 0x07A81, 0x07BC0, 0x07DF4, 0x07E09, 0x07E41, 0x07F72,
+    0x08005, 0x081ED, 0x08279, 0x08279, 0x08457, 0x08910, 0x08996, 0x08B01,
+    0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x09038, 0x096E3, 0x097FF, 0x0983B,
+    0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168, 0x04F80, 0x05145,
+    0x05180, 0x052C7, 0x052FA, 0x0559D, 0x05555, 0x05599, 0x055E2, 0x0585A,
+    0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69,
+    0x05FAD, 0x060D8, 0x0614E, 0x06108, 0x0618E, 0x06160, 0x061F2, 0x06234,
+    0x063C4, 0x0641C, 0x06452, 0x06556, 0x06674, 0x06717, 0x0671B, 0x06756,
+    0x06B79, 0x06BBA, 0x06D41, 0x06EDB, 0x06ECB, 0x06F22, 0x0701E, 0x0716E,
+    0x077A7, 0x07235, 0x072AF, 0x0732A, 0x07471, 0x07506, 0x0753B, 0x0761D,
+    0x0761F, 0x076CA, 0x076DB, 0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1,
+    0x07BC0, 0x07C7B, 0x07D5B, 0x07DF4, 0x07F3E, 0x08005, 0x08352, 0x083EF,
+    0x08779, 0x08941, 0x08986, 0x08996, 0x08ABF, 0x08AF8, 0x08ACB, 0x08B01,
+    0x08AFE, 0x08AED, 0x08B39, 0x08B8A, 0x08D08, 0x08F38, 0x09072, 0x09199,
+    0x09276, 0x0967C, 0x096E3, 0x09756, 0x097DB, 0x097FF, 0x0980B, 0x0983B,
+    0x09B12, 0x09F9C, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039,
+    0x25249, 0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x005D9, 0x005B4, 0x005F2,
+    0x005B7, 0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1,
+    0x005E9, 0x005BC, 0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0,
+    0x005BC, 0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4,
+    0x005BC, 0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9,
+    0x005BC, 0x005DA, 0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE,
+    0x005BC, 0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4,
+    0x005BC, 0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9,
+    0x005BC, 0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB,
+    0x005BF, 0x005E4, 0x005BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+    0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+    0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+    0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+    0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+    0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+    0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+    0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+    0x04E3D, 0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FAE, 0x04FBB, 0x05002,
+    0x0507A, 0x05099, 0x050E7, 0x050CF, 0x0349E, 0x2063A, 0x0514D, 0x05154,
+    0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x0518D, 0x2054B, 0x05197,
+    0x051A4, 0x04ECC, 0x051AC, 0x051B5, 0x291DF, 0x051F5, 0x05203, 0x034DF,
+    0x0523B, 0x05246, 0x05272, 0x05277, 0x03515, 0x052C7, 0x052C9, 0x052E4,
+    0x052FA, 0x05305, 0x05306, 0x05317, 0x05349, 0x05351, 0x0535A, 0x05373,
+    0x0537D, 0x0537F, 0x0537F, 0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF,
+    0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468,
+    0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599,
+    0x055AB, 0x055B3, 0x055C2, 0x05716, 0x05606, 0x05717, 0x05651, 0x05674,
+    0x05207, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831,
+    0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962,
+    0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE,
+    0x036FC, 0x05B08, 0x05B3E, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BE7,
+    0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60,
+    0x05C6E, 0x05CC0, 0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B,
+    0x05D7C, 0x05DE1, 0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69,
+    0x03862, 0x22183, 0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x05ECA, 0x2A392,
+    0x05EFE, 0x22331, 0x22331, 0x08201, 0x05F22, 0x05F22, 0x038C7, 0x232B8,
+    0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9,
+    0x06081, 0x0393A, 0x0391C, 0x06094, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+    0x0614E, 0x0614C, 0x0617A, 0x0618E, 0x061B2, 0x061A4, 0x061AF, 0x061DE,
+    0x061F2, 0x061F6, 0x06210, 0x0621B, 0x0625D, 0x062B1, 0x062D4, 0x06350,
+    0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422,
+    0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E, 0x0649D, 0x06477, 0x03A6C,
+    0x0654F, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649, 0x03B19, 0x06691,
+    0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD, 0x043D9,
+    0x06717, 0x0671B, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA,
+    0x06785, 0x06852, 0x06885, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x03B9D,
+    0x06942, 0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21,
+    0x238A7, 0x06B54, 0x03C4E, 0x06B72, 0x06B9F, 0x06BBA, 0x06BBB, 0x23A8D,
+    0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16,
+    0x06D3E, 0x06D77, 0x06D41, 0x06D69, 0x06D78, 0x06D85, 0x23D1E, 0x06D34,
+    0x06E2F, 0x06E6E, 0x03D33, 0x06ECB, 0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E,
+    0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701E, 0x0701B, 0x03D96, 0x0704A,
+    0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+    0x07228, 0x07235, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814,
+    0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x03EB8, 0x07447, 0x0745C,
+    0x07471, 0x07485, 0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92,
+    0x07570, 0x2219F, 0x07610, 0x24FA1, 0x24FB8, 0x25044, 0x03FFC, 0x04008,
+    0x076F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x0771E, 0x0771F, 0x0771F,
+    0x0774A, 0x04039, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x0788C,
+    0x078CC, 0x040E3, 0x25626, 0x07956, 0x2569A, 0x256C5, 0x0798F, 0x079EB,
+    0x0412F, 0x07A40, 0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x07AEE,
+    0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80, 0x07CD2, 0x042A0,
+    0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301, 0x07DC7, 0x07E02,
+    0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9, 0x07F7A, 0x2633E,
+    0x07F95, 0x07FFA, 0x08005, 0x264DA, 0x26523, 0x08060, 0x265A8, 0x08070,
+    0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5, 0x267A7,
+    0x267B5, 0x23393, 0x2339C, 0x08201, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+    0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+    0x082E5, 0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08457,
+    0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B,
+    0x084F1, 0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561,
+    0x26FB1, 0x270D2, 0x0456B, 0x08650, 0x0865C, 0x08667, 0x08669, 0x086A9,
+    0x08688, 0x0870E, 0x086E2, 0x08779, 0x08728, 0x0876B, 0x08786, 0x045D7,
+    0x087E1, 0x08801, 0x045F9, 0x08860, 0x08863, 0x27667, 0x088D7, 0x088DE,
+    0x04635, 0x088FA, 0x034BB, 0x278AE, 0x27966, 0x046BE, 0x046C7, 0x08AA0,
+    0x08AED, 0x08B8A, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77,
+    0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x08F38,
+    0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238,
+    0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995,
+    0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A,
+    0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x0980B, 0x0980B,
+    0x09829, 0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE,
+    0x04BCE, 0x29B30, 0x09B12, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67,
+    0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E, 0x2A291, 0x09EBB, 0x04D56, 0x09EF9,
+    0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x09F3B, 0x2A600,
+};
+
+// Canonical compositions, as (second codepoint, composite) pairs indexed by the records of first codepoints.
+static const unipoint_t UCD_COMPOSITIONS[941][2] = {
+    { 0x0338, 0x226E },
+    { 0x0338, 0x2260 },
+    { 0x0338, 0x226F },
+    { 0x0300, 0x00C0 },
+    { 0x0301, 0x00C1 },
+    { 0x0302, 0x00C2 },
+    { 0x0303, 0x00C3 },
+    { 0x0304, 0x0100 },
+    { 0x0306, 0x0102 },
+    { 0x0307, 0x0226 },
+    { 0x0308, 0x00C4 },
+    { 0x0309, 0x1EA2 },
+    { 0x030A, 0x00C5 },
+    { 0x030C, 0x01CD },
+    { 0x030F, 0x0200 },
+    { 0x0311, 0x0202 },
+    { 0x0323, 0x1EA0 },
+    { 0x0325, 0x1E00 },
+    { 0x0328, 0x0104 },
+    { 0x0307, 0x1E02 },
+    { 0x0323, 0x1E04 },
+    { 0x0331, 0x1E06 },
+    { 0x0301, 0x0106 },
+    { 0x0302, 0x0108 },
+    { 0x0307, 0x010A },
+    { 0x030C, 0x010C },
+    { 0x0327, 0x00C7 },
+    { 0x0307, 0x1E0A },
+    { 0x030C, 0x010E },
+    { 0x0323, 0x1E0C },
+    { 0x0327, 0x1E10 },
+    { 0x032D, 0x1E12 },
+    { 0x0331, 0x1E0E },
+    { 0x0300, 0x00C8 },
+    { 0x0301, 0x00C9 },
+    { 0x0302, 0x00CA },
+    { 0x0303, 0x1EBC },
+    { 0x0304, 0x0112 },
+    { 0x0306, 0x0114 },
+    { 0x0307, 0x0116 },
+    { 0x0308, 0x00CB },
+    { 0x0309, 0x1EBA },
+    { 0x030C, 0x011A },
+    { 0x030F, 0x0204 },
+    { 0x0311, 0x0206 },
+    { 0x0323, 0x1EB8 },
+    { 0x0327, 0x0228 },
+    { 0x0328, 0x0118 },
+    { 0x032D, 0x1E18 },
+    { 0x0330, 0x1E1A },
+    { 0x0307, 0x1E1E },
+    { 0x0301, 0x01F4 },
+    { 0x0302, 0x011C },
+    { 0x0304, 0x1E20 },
+    { 0x0306, 0x011E },
+    { 0x0307, 0x0120 },
+    { 0x030C, 0x01E6 },
+    { 0x0327, 0x0122 },
+    { 0x0302, 0x0124 },
+    { 0x0307, 0x1E22 },
+    { 0x0308, 0x1E26 },
+    { 0x030C, 0x021E },
+    { 0x0323, 0x1E24 },
+    { 0x0327, 0x1E28 },
+    { 0x032E, 0x1E2A },
+    { 0x0300, 0x00CC },
+    { 0x0301, 0x00CD },
+    { 0x0302, 0x00CE },
+    { 0x0303, 0x0128 },
+    { 0x0304, 0x012A },
+    { 0x0306, 0x012C },
+    { 0x0307, 0x0130 },
+    { 0x0308, 0x00CF },
+    { 0x0309, 0x1EC8 },
+    { 0x030C, 0x01CF },
+    { 0x030F, 0x0208 },
+    { 0x0311, 0x020A },
+    { 0x0323, 0x1ECA },
+    { 0x0328, 0x012E },
+    { 0x0330, 0x1E2C },
+    { 0x0302, 0x0134 },
+    { 0x0301, 0x1E30 },
+    { 0x030C, 0x01E8 },
+    { 0x0323, 0x1E32 },
+    { 0x0327, 0x0136 },
+    { 0x0331, 0x1E34 },
+    { 0x0301, 0x0139 },
+    { 0x030C, 0x013D },
+    { 0x0323, 0x1E36 },
+    { 0x0327, 0x013B },
+    { 0x032D, 0x1E3C },
+    { 0x0331, 0x1E3A },
+    { 0x0301, 0x1E3E },
+    { 0x0307, 0x1E40 },
+    { 0x0323, 0x1E42 },
+    { 0x0300, 0x01F8 },
+    { 0x0301, 0x0143 },
+    { 0x0303, 0x00D1 },
+    { 0x0307, 0x1E44 },
+    { 0x030C, 0x0147 },
+    { 0x0323, 0x1E46 },
+    { 0x0327, 0x0145 },
+    { 0x032D, 0x1E4A },
+    { 0x0331, 0x1E48 },
+    { 0x0300, 0x00D2 },
+    { 0x0301, 0x00D3 },
+    { 0x0302, 0x00D4 },
+    { 0x0303, 0x00D5 },
+    { 0x0304, 0x014C },
+    { 0x0306, 0x014E },
+    { 0x0307, 0x022E },
+    { 0x0308, 0x00D6 },
+    { 0x0309, 0x1ECE },
+    { 0x030B, 0x0150 },
+    { 0x030C, 0x01D1 },
+    { 0x030F, 0x020C },
+    { 0x0311, 0x020E },
+    { 0x031B, 0x01A0 },
+    { 0x0323, 0x1ECC },
+    { 0x0328, 0x01EA },
+    { 0x0301, 0x1E54 },
+    { 0x0307, 0x1E56 },
+    { 0x0301, 0x0154 },
+    { 0x0307, 0x1E58 },
+    { 0x030C, 0x0158 },
+    { 0x030F, 0x0210 },
+    { 0x0311, 0x0212 },
+    { 0x0323, 0x1E5A },
+    { 0x0327, 0x0156 },
+    { 0x0331, 0x1E5E },
+    { 0x0301, 0x015A },
+    { 0x0302, 0x015C },
+    { 0x0307, 0x1E60 },
+    { 0x030C, 0x0160 },
+    { 0x0323, 0x1E62 },
+    { 0x0326, 0x0218 },
+    { 0x0327, 0x015E },
+    { 0x0307, 0x1E6A },
+    { 0x030C, 0x0164 },
+    { 0x0323, 0x1E6C },
+    { 0x0326, 0x021A },
+    { 0x0327, 0x0162 },
+    { 0x032D, 0x1E70 },
+    { 0x0331, 0x1E6E },
+    { 0x0300, 0x00D9 },
+    { 0x0301, 0x00DA },
+    { 0x0302, 0x00DB },
+    { 0x0303, 0x0168 },
+    { 0x0304, 0x016A },
+    { 0x0306, 0x016C },
+    { 0x0308, 0x00DC },
+    { 0x0309, 0x1EE6 },
+    { 0x030A, 0x016E },
+    { 0x030B, 0x0170 },
+    { 0x030C, 0x01D3 },
+    { 0x030F, 0x0214 },
+    { 0x0311, 0x0216 },
+    { 0x031B, 0x01AF },
+    { 0x0323, 0x1EE4 },
+    { 0x0324, 0x1E72 },
+    { 0x0328, 0x0172 },
+    { 0x032D, 0x1E76 },
+    { 0x0330, 0x1E74 },
+    { 0x0303, 0x1E7C },
+    { 0x0323, 0x1E7E },
+    { 0x0300, 0x1E80 },
+    { 0x0301, 0x1E82 },
+    { 0x0302, 0x0174 },
+    { 0x0307, 0x1E86 },
+    { 0x0308, 0x1E84 },
+    { 0x0323, 0x1E88 },
+    { 0x0307, 0x1E8A },
+    { 0x0308, 0x1E8C },
+    { 0x0300, 0x1EF2 },
+    { 0x0301, 0x00DD },
+    { 0x0302, 0x0176 },
+    { 0x0303, 0x1EF8 },
+    { 0x0304, 0x0232 },
+    { 0x0307, 0x1E8E },
+    { 0x0308, 0x0178 },
+    { 0x0309, 0x1EF6 },
+    { 0x0323, 0x1EF4 },
+    { 0x0301, 0x0179 },
+    { 0x0302, 0x1E90 },
+    { 0x0307, 0x017B },
+    { 0x030C, 0x017D },
+    { 0x0323, 0x1E92 },
+    { 0x0331, 0x1E94 },
+    { 0x0300, 0x00E0 },
+    { 0x0301, 0x00E1 },
+    { 0x0302, 0x00E2 },
+    { 0x0303, 0x00E3 },
+    { 0x0304, 0x0101 },
+    { 0x0306, 0x0103 },
+    { 0x0307, 0x0227 },
+    { 0x0308, 0x00E4 },
+    { 0x0309, 0x1EA3 },
+    { 0x030A, 0x00E5 },
+    { 0x030C, 0x01CE },
+    { 0x030F, 0x0201 },
+    { 0x0311, 0x0203 },
+    { 0x0323, 0x1EA1 },
+    { 0x0325, 0x1E01 },
+    { 0x0328, 0x0105 },
+    { 0x0307, 0x1E03 },
+    { 0x0323, 0x1E05 },
+    { 0x0331, 0x1E07 },
+    { 0x0301, 0x0107 },
+    { 0x0302, 0x0109 },
+    { 0x0307, 0x010B },
+    { 0x030C, 0x010D },
+    { 0x0327, 0x00E7 },
+    { 0x0307, 0x1E0B },
+    { 0x030C, 0x010F },
+    { 0x0323, 0x1E0D },
+    { 0x0327, 0x1E11 },
+    { 0x032D, 0x1E13 },
+    { 0x0331, 0x1E0F },
+    { 0x0300, 0x00E8 },
+    { 0x0301, 0x00E9 },
+    { 0x0302, 0x00EA },
+    { 0x0303, 0x1EBD },
+    { 0x0304, 0x0113 },
+    { 0x0306, 0x0115 },
+    { 0x0307, 0x0117 },
+    { 0x0308, 0x00EB },
+    { 0x0309, 0x1EBB },
+    { 0x030C, 0x011B },
+    { 0x030F, 0x0205 },
+    { 0x0311, 0x0207 },
+    { 0x0323, 0x1EB9 },
+    { 0x0327, 0x0229 },
+    { 0x0328, 0x0119 },
+    { 0x032D, 0x1E19 },
+    { 0x0330, 0x1E1B },
+    { 0x0307, 0x1E1F },
+    { 0x0301, 0x01F5 },
+    { 0x0302, 0x011D },
+    { 0x0304, 0x1E21 },
+    { 0x0306, 0x011F },
+    { 0x0307, 0x0121 },
+    { 0x030C, 0x01E7 },
+    { 0x0327, 0x0123 },
+    { 0x0302, 0x0125 },
+    { 0x0307, 0x1E23 },
+    { 0x0308, 0x1E27 },
+    { 0x030C, 0x021F },
+    { 0x0323, 0x1E25 },
+    { 0x0327, 0x1E29 },
+    { 0x032E, 0x1E2B },
+    { 0x0331, 0x1E96 },
+    { 0x0300, 0x00EC },
+    { 0x0301, 0x00ED },
+    { 0x0302, 0x00EE },
+    { 0x0303, 0x0129 },
+    { 0x0304, 0x012B },
+    { 0x0306, 0x012D },
+    { 0x0308, 0x00EF },
+    { 0x0309, 0x1EC9 },
+    { 0x030C, 0x01D0 },
+    { 0x030F, 0x0209 },
+    { 0x0311, 0x020B },
+    { 0x0323, 0x1ECB },
+    { 0x0328, 0x012F },
+    { 0x0330, 0x1E2D },
+    { 0x0302, 0x0135 },
+    { 0x030C, 0x01F0 },
+    { 0x0301, 0x1E31 },
+    { 0x030C, 0x01E9 },
+    { 0x0323, 0x1E33 },
+    { 0x0327, 0x0137 },
+    { 0x0331, 0x1E35 },
+    { 0x0301, 0x013A },
+    { 0x030C, 0x013E },
+    { 0x0323, 0x1E37 },
+    { 0x0327, 0x013C },
+    { 0x032D, 0x1E3D },
+    { 0x0331, 0x1E3B },
+    { 0x0301, 0x1E3F },
+    { 0x0307, 0x1E41 },
+    { 0x0323, 0x1E43 },
+    { 0x0300, 0x01F9 },
+    { 0x0301, 0x0144 },
+    { 0x0303, 0x00F1 },
+    { 0x0307, 0x1E45 },
+    { 0x030C, 0x0148 },
+    { 0x0323, 0x1E47 },
+    { 0x0327, 0x0146 },
+    { 0x032D, 0x1E4B },
+    { 0x0331, 0x1E49 },
+    { 0x0300, 0x00F2 },
+    { 0x0301, 0x00F3 },
+    { 0x0302, 0x00F4 },
+    { 0x0303, 0x00F5 },
+    { 0x0304, 0x014D },
+    { 0x0306, 0x014F },
+    { 0x0307, 0x022F },
+    { 0x0308, 0x00F6 },
+    { 0x0309, 0x1ECF },
+    { 0x030B, 0x0151 },
+    { 0x030C, 0x01D2 },
+    { 0x030F, 0x020D },
+    { 0x0311, 0x020F },
+    { 0x031B, 0x01A1 },
+    { 0x0323, 0x1ECD },
+    { 0x0328, 0x01EB },
+    { 0x0301, 0x1E55 },
+    { 0x0307, 0x1E57 },
+    { 0x0301, 0x0155 },
+    { 0x0307, 0x1E59 },
+    { 0x030C, 0x0159 },
+    { 0x030F, 0x0211 },
+    { 0x0311, 0x0213 },
+    { 0x0323, 0x1E5B },
+    { 0x0327, 0x0157 },
+    { 0x0331, 0x1E5F },
+    { 0x0301, 0x015B },
+    { 0x0302, 0x015D },
+    { 0x0307, 0x1E61 },
+    { 0x030C, 0x0161 },
+    { 0x0323, 0x1E63 },
+    { 0x0326, 0x0219 },
+    { 0x0327, 0x015F },
+    { 0x0307, 0x1E6B },
+    { 0x0308, 0x1E97 },
+    { 0x030C, 0x0165 },
+    { 0x0323, 0x1E6D },
+    { 0x0326, 0x021B },
+    { 0x0327, 0x0163 },
+    { 0x032D, 0x1E71 },
+    { 0x0331, 0x1E6F },
+    { 0x0300, 0x00F9 },
+    { 0x0301, 0x00FA },
+    { 0x0302, 0x00FB },
+    { 0x0303, 0x0169 },
+    { 0x0304, 0x016B },
+    { 0x0306, 0x016D },
+    { 0x0308, 0x00FC },
+    { 0x0309, 0x1EE7 },
+    { 0x030A, 0x016F },
+    { 0x030B, 0x0171 },
+    { 0x030C, 0x01D4 },
+    { 0x030F, 0x0215 },
+    { 0x0311, 0x0217 },
+    { 0x031B, 0x01B0 },
+    { 0x0323, 0x1EE5 },
+    { 0x0324, 0x1E73 },
+    { 0x0328, 0x0173 },
+    { 0x032D, 0x1E77 },
+    { 0x0330, 0x1E75 },
+    { 0x0303, 0x1E7D },
+    { 0x0323, 0x1E7F },
+    { 0x0300, 0x1E81 },
+    { 0x0301, 0x1E83 },
+    { 0x0302, 0x0175 },
+    { 0x0307, 0x1E87 },
+    { 0x0308, 0x1E85 },
+    { 0x030A, 0x1E98 },
+    { 0x0323, 0x1E89 },
+    { 0x0307, 0x1E8B },
+    { 0x0308, 0x1E8D },
+    { 0x0300, 0x1EF3 },
+    { 0x0301, 0x00FD },
+    { 0x0302, 0x0177 },
+    { 0x0303, 0x1EF9 },
+    { 0x0304, 0x0233 },
+    { 0x0307, 0x1E8F },
+    { 0x0308, 0x00FF },
+    { 0x0309, 0x1EF7 },
+    { 0x030A, 0x1E99 },
+    { 0x0323, 0x1EF5 },
+    { 0x0301, 0x017A },
+    { 0x0302, 0x1E91 },
+    { 0x0307, 0x017C },
+    { 0x030C, 0x017E },
+    { 0x0323, 0x1E93 },
+    { 0x0331, 0x1E95 },
+    { 0x0300, 0x1FED },
+    { 0x0301, 0x0385 },
+    { 0x0342, 0x1FC1 },
+    { 0x0300, 0x1EA6 },
+    { 0x0301, 0x1EA4 },
+    { 0x0303, 0x1EAA },
+    { 0x0309, 0x1EA8 },
+    { 0x0304, 0x01DE },
+    { 0x0301, 0x01FA },
+    { 0x0301, 0x01FC },
+    { 0x0304, 0x01E2 },
+    { 0x0301, 0x1E08 },
+    { 0x0300, 0x1EC0 },
+    { 0x0301, 0x1EBE },
+    { 0x0303, 0x1EC4 },
+    { 0x0309, 0x1EC2 },
+    { 0x0301, 0x1E2E },
+    { 0x0300, 0x1ED2 },
+    { 0x0301, 0x1ED0 },
+    { 0x0303, 0x1ED6 },
+    { 0x0309, 0x1ED4 },
+    { 0x0301, 0x1E4C },
+    { 0x0304, 0x022C },
+    { 0x0308, 0x1E4E },
+    { 0x0304, 0x022A },
+    { 0x0301, 0x01FE },
+    { 0x0300, 0x01DB },
+    { 0x0301, 0x01D7 },
+    { 0x0304, 0x01D5 },
+    { 0x030C, 0x01D9 },
+    { 0x0300, 0x1EA7 },
+    { 0x0301, 0x1EA5 },
+    { 0x0303, 0x1EAB },
+    { 0x0309, 0x1EA9 },
+    { 0x0304, 0x01DF },
+    { 0x0301, 0x01FB },
+    { 0x0301, 0x01FD },
+    { 0x0304, 0x01E3 },
+    { 0x0301, 0x1E09 },
+    { 0x0300, 0x1EC1 },
+    { 0x0301, 0x1EBF },
+    { 0x0303, 0x1EC5 },
+    { 0x0309, 0x1EC3 },
+    { 0x0301, 0x1E2F },
+    { 0x0300, 0x1ED3 },
+    { 0x0301, 0x1ED1 },
+    { 0x0303, 0x1ED7 },
+    { 0x0309, 0x1ED5 },
+    { 0x0301, 0x1E4D },
+    { 0x0304, 0x022D },
+    { 0x0308, 0x1E4F },
+    { 0x0304, 0x022B },
+    { 0x0301, 0x01FF },
+    { 0x0300, 0x01DC },
+    { 0x0301, 0x01D8 },
+    { 0x0304, 0x01D6 },
+    { 0x030C, 0x01DA },
+    { 0x0300, 0x1EB0 },
+    { 0x0301, 0x1EAE },
+    { 0x0303, 0x1EB4 },
+    { 0x0309, 0x1EB2 },
+    { 0x0300, 0x1EB1 },
+    { 0x0301, 0x1EAF },
+    { 0x0303, 0x1EB5 },
+    { 0x0309, 0x1EB3 },
+    { 0x0300, 0x1E14 },
+    { 0x0301, 0x1E16 },
+    { 0x0300, 0x1E15 },
+    { 0x0301, 0x1E17 },
+    { 0x0300, 0x1E50 },
+    { 0x0301, 0x1E52 },
+    { 0x0300, 0x1E51 },
+    { 0x0301, 0x1E53 },
+    { 0x0307, 0x1E64 },
+    { 0x0307, 0x1E65 },
+    { 0x0307, 0x1E66 },
+    { 0x0307, 0x1E67 },
+    { 0x0301, 0x1E78 },
+    { 0x0301, 0x1E79 },
+    { 0x0308, 0x1E7A },
+    { 0x0308, 0x1E7B },
+    { 0x0307, 0x1E9B },
+    { 0x0300, 0x1EDC },
+    { 0x0301, 0x1EDA },
+    { 0x0303, 0x1EE0 },
+    { 0x0309, 0x1EDE },
+    { 0x0323, 0x1EE2 },
+    { 0x0300, 0x1EDD },
+    { 0x0301, 0x1EDB },
+    { 0x0303, 0x1EE1 },
+    { 0x0309, 0x1EDF },
+    { 0x0323, 0x1EE3 },
+    { 0x0300, 0x1EEA },
+    { 0x0301, 0x1EE8 },
+    { 0x0303, 0x1EEE },
+    { 0x0309, 0x1EEC },
+    { 0x0323, 0x1EF0 },
+    { 0x0300, 0x1EEB },
+    { 0x0301, 0x1EE9 },
+    { 0x0303, 0x1EEF },
+    { 0x0309, 0x1EED },
+    { 0x0323, 0x1EF1 },
+    { 0x030C, 0x01EE },
+    { 0x0304, 0x01EC },
+    { 0x0304, 0x01ED },
+    { 0x0304, 0x01E0 },
+    { 0x0304, 0x01E1 },
+    { 0x0306, 0x1E1C },
+    { 0x0306, 0x1E1D },
+    { 0x0304, 0x0230 },
+    { 0x0304, 0x0231 },
+    { 0x030C, 0x01EF },
+    { 0x0300, 0x1FBA },
+    { 0x0301, 0x0386 },
+    { 0x0304, 0x1FB9 },
+    { 0x0306, 0x1FB8 },
+    { 0x0313, 0x1F08 },
+    { 0x0314, 0x1F09 },
+    { 0x0345, 0x1FBC },
+    { 0x0300, 0x1FC8 },
+    { 0x0301, 0x0388 },
+    { 0x0313, 0x1F18 },
+    { 0x0314, 0x1F19 },
+    { 0x0300, 0x1FCA },
+    { 0x0301, 0x0389 },
+    { 0x0313, 0x1F28 },
+    { 0x0314, 0x1F29 },
+    { 0x0345, 0x1FCC },
+    { 0x0300, 0x1FDA },
+    { 0x0301, 0x038A },
+    { 0x0304, 0x1FD9 },
+    { 0x0306, 0x1FD8 },
+    { 0x0308, 0x03AA },
+    { 0x0313, 0x1F38 },
+    { 0x0314, 0x1F39 },
+    { 0x0300, 0x1FF8 },
+    { 0x0301, 0x038C },
+    { 0x0313, 0x1F48 },
+    { 0x0314, 0x1F49 },
+    { 0x0314, 0x1FEC },
+    { 0x0300, 0x1FEA },
+    { 0x0301, 0x038E },
+    { 0x0304, 0x1FE9 },
+    { 0x0306, 0x1FE8 },
+    { 0x0308, 0x03AB },
+    { 0x0314, 0x1F59 },
+    { 0x0300, 0x1FFA },
+    { 0x0301, 0x038F },
+    { 0x0313, 0x1F68 },
+    { 0x0314, 0x1F69 },
+    { 0x0345, 0x1FFC },
+    { 0x0345, 0x1FB4 },
+    { 0x0345, 0x1FC4 },
+    { 0x0300, 0x1F70 },
+    { 0x0301, 0x03AC },
+    { 0x0304, 0x1FB1 },
+    { 0x0306, 0x1FB0 },
+    { 0x0313, 0x1F00 },
+    { 0x0314, 0x1F01 },
+    { 0x0342, 0x1FB6 },
+    { 0x0345, 0x1FB3 },
+    { 0x0300, 0x1F72 },
+    { 0x0301, 0x03AD },
+    { 0x0313, 0x1F10 },
+    { 0x0314, 0x1F11 },
+    { 0x0300, 0x1F74 },
+    { 0x0301, 0x03AE },
+    { 0x0313, 0x1F20 },
+    { 0x0314, 0x1F21 },
+    { 0x0342, 0x1FC6 },
+    { 0x0345, 0x1FC3 },
+    { 0x0300, 0x1F76 },
+    { 0x0301, 0x03AF },
+    { 0x0304, 0x1FD1 },
+    { 0x0306, 0x1FD0 },
+    { 0x0308, 0x03CA },
+    { 0x0313, 0x1F30 },
+    { 0x0314, 0x1F31 },
+    { 0x0342, 0x1FD6 },
+    { 0x0300, 0x1F78 },
+    { 0x0301, 0x03CC },
+    { 0x0313, 0x1F40 },
+    { 0x0314, 0x1F41 },
+    { 0x0313, 0x1FE4 },
+    { 0x0314, 0x1FE5 },
+    { 0x0300, 0x1F7A },
+    { 0x0301, 0x03CD },
+    { 0x0304, 0x1FE1 },
+    { 0x0306, 0x1FE0 },
+    { 0x0308, 0x03CB },
+    { 0x0313, 0x1F50 },
+    { 0x0314, 0x1F51 },
+    { 0x0342, 0x1FE6 },
+    { 0x0300, 0x1F7C },
+    { 0x0301, 0x03CE },
+    { 0x0313, 0x1F60 },
+    { 0x0314, 0x1F61 },
+    { 0x0342, 0x1FF6 },
+    { 0x0345, 0x1FF3 },
+    { 0x0300, 0x1FD2 },
+    { 0x0301, 0x0390 },
+    { 0x0342, 0x1FD7 },
+    { 0x0300, 0x1FE2 },
+    { 0x0301, 0x03B0 },
+    { 0x0342, 0x1FE7 },
+    { 0x0345, 0x1FF4 },
+    { 0x0301, 0x03D3 },
+    { 0x0308, 0x03D4 },
+    { 0x0308, 0x0407 },
+    { 0x0306, 0x04D0 },
+    { 0x0308, 0x04D2 },
+    { 0x0301, 0x0403 },
+    { 0x0300, 0x0400 },
+    { 0x0306, 0x04D6 },
+    { 0x0308, 0x0401 },
+    { 0x0306, 0x04C1 },
+    { 0x0308, 0x04DC },
+    { 0x0308, 0x04DE },
+    { 0x0300, 0x040D },
+    { 0x0304, 0x04E2 },
+    { 0x0306, 0x0419 },
+    { 0x0308, 0x04E4 },
+    { 0x0301, 0x040C },
+    { 0x0308, 0x04E6 },
+    { 0x0304, 0x04EE },
+    { 0x0306, 0x040E },
+    { 0x0308, 0x04F0 },
+    { 0x030B, 0x04F2 },
+    { 0x0308, 0x04F4 },
+    { 0x0308, 0x04F8 },
+    { 0x0308, 0x04EC },
+    { 0x0306, 0x04D1 },
+    { 0x0308, 0x04D3 },
+    { 0x0301, 0x0453 },
+    { 0x0300, 0x0450 },
+    { 0x0306, 0x04D7 },
+    { 0x0308, 0x0451 },
+    { 0x0306, 0x04C2 },
+    { 0x0308, 0x04DD },
+    { 0x0308, 0x04DF },
+    { 0x0300, 0x045D },
+    { 0x0304, 0x04E3 },
+    { 0x0306, 0x0439 },
+    { 0x0308, 0x04E5 },
+    { 0x0301, 0x045C },
+    { 0x0308, 0x04E7 },
+    { 0x0304, 0x04EF },
+    { 0x0306, 0x045E },
+    { 0x0308, 0x04F1 },
+    { 0x030B, 0x04F3 },
+    { 0x0308, 0x04F5 },
+    { 0x0308, 0x04F9 },
+    { 0x0308, 0x04ED },
+    { 0x0308, 0x0457 },
+    { 0x030F, 0x0476 },
+    { 0x030F, 0x0477 },
+    { 0x0308, 0x04DA },
+    { 0x0308, 0x04DB },
+    { 0x0308, 0x04EA },
+    { 0x0308, 0x04EB },
+    { 0x0653, 0x0622 },
+    { 0x0654, 0x0623 },
+    { 0x0655, 0x0625 },
+    { 0x0654, 0x0624 },
+    { 0x0654, 0x0626 },
+    { 0x0654, 0x06C2 },
+    { 0x0654, 0x06D3 },
+    { 0x0654, 0x06C0 },
+    { 0x093C, 0x0929 },
+    { 0x093C, 0x0931 },
+    { 0x093C, 0x0934 },
+    { 0x09BE, 0x09CB },
+    { 0x09D7, 0x09CC },
+    { 0x0B3E, 0x0B4B },
+    { 0x0B56, 0x0B48 },
+    { 0x0B57, 0x0B4C },
+    { 0x0BD7, 0x0B94 },
+    { 0x0BBE, 0x0BCA },
+    { 0x0BD7, 0x0BCC },
+    { 0x0BBE, 0x0BCB },
+    { 0x0C56, 0x0C48 },
+    { 0x0CD5, 0x0CC0 },
+    { 0x0CC2, 0x0CCA },
+    { 0x0CD5, 0x0CC7 },
+    { 0x0CD6, 0x0CC8 },
+    { 0x0CD5, 0x0CCB },
+    { 0x0D3E, 0x0D4A },
+    { 0x0D57, 0x0D4C },
+    { 0x0D3E, 0x0D4B },
+    { 0x0DCA, 0x0DDA },
+    { 0x0DCF, 0x0DDC },
+    { 0x0DDF, 0x0DDE },
+    { 0x0DCA, 0x0DDD },
+    { 0x102E, 0x1026 },
+    { 0x1B35, 0x1B06 },
+    { 0x1B35, 0x1B08 },
+    { 0x1B35, 0x1B0A },
+    { 0x1B35, 0x1B0C },
+    { 0x1B35, 0x1B0E },
+    { 0x1B35, 0x1B12 },
+    { 0x1B35, 0x1B3B },
+    { 0x1B35, 0x1B3D },
+    { 0x1B35, 0x1B40 },
+    { 0x1B35, 0x1B41 },
+    { 0x1B35, 0x1B43 },
+    { 0x0304, 0x1E38 },
+    { 0x0304, 0x1E39 },
+    { 0x0304, 0x1E5C },
+    { 0x0304, 0x1E5D },
+    { 0x0307, 0x1E68 },
+    { 0x0307, 0x1E69 },
+    { 0x0302, 0x1EAC },
+    { 0x0306, 0x1EB6 },
+    { 0x0302, 0x1EAD },
+    { 0x0306, 0x1EB7 },
+    { 0x0302, 0x1EC6 },
+    { 0x0302, 0x1EC7 },
+    { 0x0302, 0x1ED8 },
+    { 0x0302, 0x1ED9 },
+    { 0x0300, 0x1F02 },
+    { 0x0301, 0x1F04 },
+    { 0x0342, 0x1F06 },
+    { 0x0345, 0x1F80 },
+    { 0x0300, 0x1F03 },
+    { 0x0301, 0x1F05 },
+    { 0x0342, 0x1F07 },
+    { 0x0345, 0x1F81 },
+    { 0x0345, 0x1F82 },
+    { 0x0345, 0x1F83 },
+    { 0x0345, 0x1F84 },
+    { 0x0345, 0x1F85 },
+    { 0x0345, 0x1F86 },
+    { 0x0345, 0x1F87 },
+    { 0x0300, 0x1F0A },
+    { 0x0301, 0x1F0C },
+    { 0x0342, 0x1F0E },
+    { 0x0345, 0x1F88 },
+    { 0x0300, 0x1F0B },
+    { 0x0301, 0x1F0D },
+    { 0x0342, 0x1F0F },
+    { 0x0345, 0x1F89 },
+    { 0x0345, 0x1F8A },
+    { 0x0345, 0x1F8B },
+    { 0x0345, 0x1F8C },
+    { 0x0345, 0x1F8D },
+    { 0x0345, 0x1F8E },
+    { 0x0345, 0x1F8F },
+    { 0x0300, 0x1F12 },
+    { 0x0301, 0x1F14 },
+    { 0x0300, 0x1F13 },
+    { 0x0301, 0x1F15 },
+    { 0x0300, 0x1F1A },
+    { 0x0301, 0x1F1C },
+    { 0x0300, 0x1F1B },
+    { 0x0301, 0x1F1D },
+    { 0x0300, 0x1F22 },
+    { 0x0301, 0x1F24 },
+    { 0x0342, 0x1F26 },
+    { 0x0345, 0x1F90 },
+    { 0x0300, 0x1F23 },
+    { 0x0301, 0x1F25 },
+    { 0x0342, 0x1F27 },
+    { 0x0345, 0x1F91 },
+    { 0x0345, 0x1F92 },
+    { 0x0345, 0x1F93 },
+    { 0x0345, 0x1F94 },
+    { 0x0345, 0x1F95 },
+    { 0x0345, 0x1F96 },
+    { 0x0345, 0x1F97 },
+    { 0x0300, 0x1F2A },
+    { 0x0301, 0x1F2C },
+    { 0x0342, 0x1F2E },
+    { 0x0345, 0x1F98 },
+    { 0x0300, 0x1F2B },
+    { 0x0301, 0x1F2D },
+    { 0x0342, 0x1F2F },
+    { 0x0345, 0x1F99 },
+    { 0x0345, 0x1F9A },
+    { 0x0345, 0x1F9B },
+    { 0x0345, 0x1F9C },
+    { 0x0345, 0x1F9D },
+    { 0x0345, 0x1F9E },
+    { 0x0345, 0x1F9F },
+    { 0x0300, 0x1F32 },
+    { 0x0301, 0x1F34 },
+    { 0x0342, 0x1F36 },
+    { 0x0300, 0x1F33 },
+    { 0x0301, 0x1F35 },
+    { 0x0342, 0x1F37 },
+    { 0x0300, 0x1F3A },
+    { 0x0301, 0x1F3C },
+    { 0x0342, 0x1F3E },
+    { 0x0300, 0x1F3B },
+    { 0x0301, 0x1F3D },
+    { 0x0342, 0x1F3F },
+    { 0x0300, 0x1F42 },
+    { 0x0301, 0x1F44 },
+    { 0x0300, 0x1F43 },
+    { 0x0301, 0x1F45 },
+    { 0x0300, 0x1F4A },
+    { 0x0301, 0x1F4C },
+    { 0x0300, 0x1F4B },
+    { 0x0301, 0x1F4D },
+    { 0x0300, 0x1F52 },
+    { 0x0301, 0x1F54 },
+    { 0x0342, 0x1F56 },
+    { 0x0300, 0x1F53 },
+    { 0x0301, 0x1F55 },
+    { 0x0342, 0x1F57 },
+    { 0x0300, 0x1F5B },
+    { 0x0301, 0x1F5D },
+    { 0x0342, 0x1F5F },
+    { 0x0300, 0x1F62 },
+    { 0x0301, 0x1F64 },
+    { 0x0342, 0x1F66 },
+    { 0x0345, 0x1FA0 },
+    { 0x0300, 0x1F63 },
+    { 0x0301, 0x1F65 },
+    { 0x0342, 0x1F67 },
+    { 0x0345, 0x1FA1 },
+    { 0x0345, 0x1FA2 },
+    { 0x0345, 0x1FA3 },
+    { 0x0345, 0x1FA4 },
+    { 0x0345, 0x1FA5 },
+    { 0x0345, 0x1FA6 },
+    { 0x0345, 0x1FA7 },
+    { 0x0300, 0x1F6A },
+    { 0x0301, 0x1F6C },
+    { 0x0342, 0x1F6E },
+    { 0x0345, 0x1FA8 },
+    { 0x0300, 0x1F6B },
+    { 0x0301, 0x1F6D },
+    { 0x0342, 0x1F6F },
+    { 0x0345, 0x1FA9 },
+    { 0x0345, 0x1FAA },
+    { 0x0345, 0x1FAB },
+    { 0x0345, 0x1FAC },
+    { 0x0345, 0x1FAD },
+    { 0x0345, 0x1FAE },
+    { 0x0345, 0x1FAF },
+    { 0x0345, 0x1FB2 },
+    { 0x0345, 0x1FC2 },
+    { 0x0345, 0x1FF2 },
+    { 0x0345, 0x1FB7 },
+    { 0x0300, 0x1FCD },
+    { 0x0301, 0x1FCE },
+    { 0x0342, 0x1FCF },
+    { 0x0345, 0x1FC7 },
+    { 0x0345, 0x1FF7 },
+    { 0x0300, 0x1FDD },
+    { 0x0301, 0x1FDE },
+    { 0x0342, 0x1FDF },
+    { 0x0338, 0x219A },
+    { 0x0338, 0x219B },
+    { 0x0338, 0x21AE },
+    { 0x0338, 0x21CD },
+    { 0x0338, 0x21CF },
+    { 0x0338, 0x21CE },
+    { 0x0338, 0x2204 },
+    { 0x0338, 0x2209 },
+    { 0x0338, 0x220C },
+    { 0x0338, 0x2224 },
+    { 0x0338, 0x2226 },
+    { 0x0338, 0x2241 },
+    { 0x0338, 0x2244 },
+    { 0x0338, 0x2247 },
+    { 0x0338, 0x2249 },
+    { 0x0338, 0x226D },
+    { 0x0338, 0x2262 },
+    { 0x0338, 0x2270 },
+    { 0x0338, 0x2271 },
+    { 0x0338, 0x2274 },
+    { 0x0338, 0x2275 },
+    { 0x0338, 0x2278 },
+    { 0x0338, 0x2279 },
+    { 0x0338, 0x2280 },
+    { 0x0338, 0x2281 },
+    { 0x0338, 0x22E0 },
+    { 0x0338, 0x22E1 },
+    { 0x0338, 0x2284 },
+    { 0x0338, 0x2285 },
+    { 0x0338, 0x2288 },
+    { 0x0338, 0x2289 },
+    { 0x0338, 0x22E2 },
+    { 0x0338, 0x22E3 },
+    { 0x0338, 0x22AC },
+    { 0x0338, 0x22AD },
+    { 0x0338, 0x22AE },
+    { 0x0338, 0x22AF },
+    { 0x0338, 0x22EA },
+    { 0x0338, 0x22EB },
+    { 0x0338, 0x22EC },
+    { 0x0338, 0x22ED },
+    { 0x3099, 0x3094 },
+    { 0x3099, 0x304C },
+    { 0x3099, 0x304E },
+    { 0x3099, 0x3050 },
+    { 0x3099, 0x3052 },
+    { 0x3099, 0x3054 },
+    { 0x3099, 0x3056 },
+    { 0x3099, 0x3058 },
+    { 0x3099, 0x305A },
+    { 0x3099, 0x305C },
+    { 0x3099, 0x305E },
+    { 0x3099, 0x3060 },
+    { 0x3099, 0x3062 },
+    { 0x3099, 0x3065 },
+    { 0x3099, 0x3067 },
+    { 0x3099, 0x3069 },
+    { 0x3099, 0x3070 },
+    { 0x309A, 0x3071 },
+    { 0x3099, 0x3073 },
+    { 0x309A, 0x3074 },
+    { 0x3099, 0x3076 },
+    { 0x309A, 0x3077 },
+    { 0x3099, 0x3079 },
+    { 0x309A, 0x307A },
+    { 0x3099, 0x307C },
+    { 0x309A, 0x307D },
+    { 0x3099, 0x309E },
+    { 0x3099, 0x30F4 },
+    { 0x3099, 0x30AC },
+    { 0x3099, 0x30AE },
+    { 0x3099, 0x30B0 },
+    { 0x3099, 0x30B2 },
+    { 0x3099, 0x30B4 },
+    { 0x3099, 0x30B6 },
+    { 0x3099, 0x30B8 },
+    { 0x3099, 0x30BA },
+    { 0x3099, 0x30BC },
+    { 0x3099, 0x30BE },
+    { 0x3099, 0x30C0 },
+    { 0x3099, 0x30C2 },
+    { 0x3099, 0x30C5 },
+    { 0x3099, 0x30C7 },
+    { 0x3099, 0x30C9 },
+    { 0x3099, 0x30D0 },
+    { 0x309A, 0x30D1 },
+    { 0x3099, 0x30D3 },
+    { 0x309A, 0x30D4 },
+    { 0x3099, 0x30D6 },
+    { 0x309A, 0x30D7 },
+    { 0x3099, 0x30D9 },
+    { 0x309A, 0x30DA },
+    { 0x3099, 0x30DC },
+    { 0x309A, 0x30DD },
+    { 0x3099, 0x30F7 },
+    { 0x3099, 0x30F8 },
+    { 0x3099, 0x30F9 },
+    { 0x3099, 0x30FA },
+    { 0x3099, 0x30FE },
+    { 0x110BA, 0x1109A },
+    { 0x110BA, 0x1109C },
+    { 0x110BA, 0x110AB },
+    { 0x11127, 0x1112E },
+    { 0x11127, 0x1112F },
+    { 0x1133E, 0x1134B },
+    { 0x11357, 0x1134C },
+    { 0x114B0, 0x114BC },
+    { 0x114BA, 0x114BB },
+    { 0x114BD, 0x114BE },
+    { 0x115AF, 0x115BA },
+    { 0x115AF, 0x115BB },
+    { 0x11930, 0x11938 },
+};
+
+#define UCD_NORMALIZATION_BITS2 6
+#define UCD_NORMALIZATION_BITS3 4
+
+static const uint8_t UCD_NORMALIZATION_STAGE1[1088] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x11, 0x12,
+    0x13, 0x09, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x1A, 0x1B, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x1C,
+    0x09, 0x09, 0x09, 0x09, 0x1D, 0x09, 0x09, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x20, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+};
+
+static const uint16_t UCD_NORMALIZATION_STAGE2[2112] = {
+    0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0000, 0x0000, 0x0006, 0x0000,
+    0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012,
+    0x0000, 0x0000, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+    0x002A, 0x002B, 0x0000, 0x0000, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0000, 0x0032,
+    0x0033, 0x0000, 0x0000, 0x0000, 0x0034, 0x0035, 0x0036, 0x0037, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0038, 0x0039, 0x003A, 0x003B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x003C, 0x003D, 0x0000, 0x003E, 0x003F, 0x0000, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0041, 0x0042, 0x0043, 0x0000, 0x0000, 0x0044, 0x0000, 0x0045, 0x0046, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0047, 0x0048, 0x0000, 0x0049, 0x004A, 0x0000,
+    0x0000, 0x004B, 0x0000, 0x0000, 0x0000, 0x004C, 0x0000, 0x0000, 0x004D, 0x004E, 0x004F, 0x0050,
+    0x0000, 0x0000, 0x0051, 0x0052, 0x0053, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055,
+    0x0056, 0x0057, 0x0000, 0x0058, 0x0000, 0x0000, 0x0000, 0x0059, 0x0053, 0x005A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x005B, 0x0053, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055,
+    0x005C, 0x005D, 0x0000, 0x0000, 0x0000, 0x005E, 0x0000, 0x005F, 0x0060, 0x0061, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x005B, 0x0062, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064,
+    0x0065, 0x0066, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0068, 0x0061, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0069, 0x006A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006B,
+    0x006C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006D, 0x006E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x006F, 0x0000, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+    0x0079, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007A, 0x007B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x007C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x007D, 0x007E, 0x0000, 0x0000, 0x007F, 0x0080, 0x0081, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0083, 0x0000, 0x0084,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0085, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0086, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0088, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0089, 0x008A, 0x0000, 0x0000, 0x0000, 0x008B, 0x008C, 0x0000, 0x0000, 0x0000,
+    0x008D, 0x008E, 0x0000, 0x008F, 0x0090, 0x0000, 0x0091, 0x0092, 0x0000, 0x0000, 0x0093, 0x0000,
+    0x0000, 0x0000, 0x0094, 0x0095, 0x0000, 0x0000, 0x0000, 0x0096, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0097, 0x0098, 0x0099, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x009A, 0x009B, 0x009C, 0x009D,
+    0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9,
+    0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5,
+    0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00BF, 0x00C0, 0x00C1,
+    0x0000, 0x0000, 0x00C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C3, 0x00C4, 0x0000,
+    0x00C5, 0x00C6, 0x0000, 0x0000, 0x00C7, 0x0000, 0x00C8, 0x00C9, 0x00CA, 0x0000, 0x00CB, 0x00CC,
+    0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x0000, 0x0000, 0x00D1, 0x0000, 0x0000, 0x0000, 0x00D2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D4, 0x00D5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x009C, 0x009C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00D7, 0x0000, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x0000, 0x00DC, 0x00DD, 0x00DE,
+    0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D4, 0x00E3, 0x0000, 0x00E4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E5, 0x0000, 0x00E6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x009C, 0x00D5,
+    0x0000, 0x0000, 0x00E7, 0x0000, 0x0000, 0x00E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E9,
+    0x0089, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00EA, 0x00EB, 0x0000, 0x0000, 0x00E5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0053, 0x0000,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x00ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9,
+    0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105,
+    0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x0000, 0x0000, 0x0000, 0x010C, 0x010D, 0x010E,
+    0x010F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0110, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0111, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0112,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0113, 0x0000, 0x0000, 0x0114, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0115, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0116, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0117, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0118, 0x0111, 0x0000, 0x0000, 0x0119, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E5, 0x0000, 0x0000, 0x011A,
+    0x0000, 0x011B, 0x011C, 0x011D, 0x0000, 0x0000, 0x0000, 0x0000, 0x011E, 0x0000, 0x011F, 0x0120,
+    0x0000, 0x0000, 0x0000, 0x00E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0124, 0x0125, 0x0061, 0x0126, 0x0127,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0128, 0x0058, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0129, 0x012A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012B, 0x012C,
+    0x012D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x012E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0130, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x00E9, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0089, 0x0000, 0x0000, 0x0000, 0x0000, 0x0084,
+    0x0132, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00D6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0134, 0x0000, 0x0000, 0x0000, 0x0000, 0x0132, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0135, 0x0000, 0x0000, 0x0000, 0x0136,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0137, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0138, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0139, 0x013A, 0x013B, 0x013C, 0x0000, 0x013D, 0x013E,
+    0x013F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0141, 0x0142, 0x0143, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0136, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0058, 0x0000, 0x0000, 0x0000, 0x0144, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0147, 0x0148, 0x0149, 0x014A,
+    0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156,
+    0x0157, 0x0158, 0x0159, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162,
+    0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+static const uint16_t UCD_NORMALIZATION_STAGE3[5776] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0000, 0x0000, 0x0004, 0x0005, 0x0006,
+    0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012,
+    0x0013, 0x0000, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x0000, 0x002D, 0x002E,
+    0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0036, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E,
+    0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0000, 0x0047, 0x0048, 0x0049,
+    0x004A, 0x004B, 0x004C, 0x0000, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0000, 0x0000,
+    0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0000, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0000,
+    0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x0000, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+    0x0000, 0x0000, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089,
+    0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0000, 0x0000,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x0000, 0x0000, 0x0000,
+    0x009D, 0x009E, 0x009F, 0x00A0, 0x0000, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x0000, 0x0000, 0x0000,
+    0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x0000, 0x0000, 0x00B3, 0x00B4, 0x00B5, 0x00B6,
+    0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2,
+    0x00C3, 0x00C4, 0x0000, 0x0000, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC,
+    0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8,
+    0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00DF, 0x00E0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC,
+    0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x0000, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+    0x0000, 0x0000, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101,
+    0x0102, 0x0000, 0x0000, 0x0000, 0x0103, 0x0104, 0x0000, 0x0000, 0x0105, 0x0106, 0x0107, 0x0108,
+    0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114,
+    0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120,
+    0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0000, 0x0000, 0x0129, 0x012A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130,
+    0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0139, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013B, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A, 0x013A,
+    0x013A, 0x013B, 0x013B, 0x013A, 0x013B, 0x013A, 0x013B, 0x013A, 0x013A, 0x013C, 0x013D, 0x013D,
+    0x013D, 0x013D, 0x013C, 0x013E, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013F, 0x013F, 0x0140,
+    0x0140, 0x0140, 0x0140, 0x0141, 0x0141, 0x013D, 0x013D, 0x013D, 0x013D, 0x0140, 0x0140, 0x013D,
+    0x0140, 0x0140, 0x013D, 0x013D, 0x0142, 0x0142, 0x0142, 0x0142, 0x0143, 0x013D, 0x013D, 0x013D,
+    0x013D, 0x013B, 0x013B, 0x013B, 0x0144, 0x0145, 0x013A, 0x0146, 0x0147, 0x0148, 0x013B, 0x013D,
+    0x013D, 0x013D, 0x013B, 0x013B, 0x013B, 0x013D, 0x013D, 0x0000, 0x013B, 0x013B, 0x013B, 0x013D,
+    0x013D, 0x013D, 0x013D, 0x013B, 0x013C, 0x013D, 0x013D, 0x013B, 0x0149, 0x014A, 0x014A, 0x0149,
+    0x014A, 0x014A, 0x0149, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x014B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x014C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0000, 0x0153, 0x0000, 0x0154, 0x0155,
+    0x0156, 0x0157, 0x0000, 0x0000, 0x0000, 0x0158, 0x0000, 0x0159, 0x0000, 0x015A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x015B, 0x0000, 0x015C, 0x0000, 0x0000, 0x0000, 0x015D, 0x0000, 0x0000,
+    0x0000, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0000, 0x0000,
+    0x0000, 0x0167, 0x0000, 0x0168, 0x0000, 0x0169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016A,
+    0x0000, 0x016B, 0x0000, 0x0000, 0x0000, 0x016C, 0x0000, 0x0000, 0x0000, 0x016D, 0x016E, 0x016F,
+    0x0170, 0x0171, 0x0172, 0x0000, 0x0000, 0x0000, 0x0173, 0x0174, 0x0175, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0176, 0x0177, 0x0000, 0x0178,
+    0x0000, 0x0000, 0x0179, 0x017A, 0x0000, 0x0000, 0x0000, 0x0000, 0x017B, 0x017C, 0x017D, 0x0000,
+    0x017E, 0x0000, 0x0000, 0x017F, 0x0000, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0000,
+    0x0000, 0x0000, 0x0186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0187, 0x0000, 0x0000, 0x0000, 0x0188,
+    0x0000, 0x0000, 0x0000, 0x0189, 0x0000, 0x018A, 0x0000, 0x0000, 0x018B, 0x0000, 0x0000, 0x018C,
+    0x0000, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192, 0x0000, 0x0000, 0x0000, 0x0193, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0194, 0x0000, 0x0000, 0x0000, 0x0195, 0x0000, 0x0000, 0x0000, 0x0196,
+    0x0000, 0x0197, 0x0000, 0x0000, 0x0198, 0x0199, 0x0000, 0x019A, 0x0000, 0x0000, 0x019B, 0x019C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x019D, 0x019E, 0x019F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A4, 0x01A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A6, 0x01A7, 0x01A8, 0x01A9,
+    0x0000, 0x0000, 0x01AA, 0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B2, 0x01B3,
+    0x0000, 0x0000, 0x01B4, 0x01B5, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01BA, 0x01BB, 0x01BC, 0x01BD,
+    0x01BE, 0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C4, 0x01C5, 0x01C6, 0x01C7, 0x0000, 0x0000,
+    0x01C8, 0x01C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x01CA, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013B, 0x013B, 0x013D, 0x013B,
+    0x013B, 0x01CA, 0x01CB, 0x013B, 0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3,
+    0x01D4, 0x01D5, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x0000, 0x01D9, 0x0000, 0x01DA, 0x01DB, 0x0000,
+    0x013B, 0x013D, 0x0000, 0x01D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x01DC, 0x01DD, 0x01DE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01E5, 0x0000, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01DC, 0x01DD,
+    0x01DE, 0x01EA, 0x01EB, 0x013A, 0x013A, 0x0140, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013D, 0x013B, 0x013B, 0x013D, 0x01EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ED, 0x01EE, 0x01EF, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01F0, 0x01F1, 0x0000, 0x01F2, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013D, 0x013B, 0x0000, 0x0000, 0x013B,
+    0x013B, 0x0000, 0x013D, 0x013B, 0x013B, 0x013D, 0x0000, 0x0000, 0x0000, 0x01F3, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013D, 0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013B, 0x013D,
+    0x013D, 0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x013D, 0x013B, 0x013D, 0x013B, 0x013D, 0x013B,
+    0x013D, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x0000, 0x013B, 0x013B, 0x013B, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x013D, 0x013D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013D, 0x013D, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013D,
+    0x013D, 0x013D, 0x013D, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x013D, 0x013B, 0x013B, 0x013D, 0x013B,
+    0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x01E7, 0x01E8, 0x01E9, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x013D, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F4, 0x01F5, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01F6, 0x01F7, 0x0000, 0x01F8, 0x01F9, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x013B, 0x013D, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x01FC, 0x01FD, 0x01FE, 0x01FF,
+    0x0200, 0x0201, 0x0202, 0x0203, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0206, 0x0000, 0x0000, 0x0000, 0x0207, 0x0208, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0209, 0x020A, 0x0000, 0x020B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x020C,
+    0x0000, 0x0000, 0x020D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020E, 0x020F, 0x0210,
+    0x0000, 0x0000, 0x0211, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0212, 0x0213, 0x0000, 0x0000, 0x0214, 0x0215, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0216, 0x0217, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x0000, 0x0219, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021A, 0x021B, 0x0000, 0x0000, 0x021C, 0x021D,
+    0x021E, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x021F, 0x0000, 0x0220, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0221, 0x0222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0223, 0x0224, 0x0000, 0x0205, 0x0000,
+    0x0000, 0x0000, 0x0225, 0x0226, 0x0227, 0x0000, 0x0228, 0x0229, 0x0000, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01FB, 0x01FB, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x022A, 0x022B, 0x0000, 0x0000, 0x022C, 0x022D, 0x022E, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0230, 0x0231, 0x0000, 0x0232, 0x0233, 0x0234, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0235, 0x0235, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0236, 0x0236, 0x0236, 0x0236,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0237, 0x0237, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0238, 0x0238, 0x0238, 0x0238, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x013D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x0000, 0x013D,
+    0x0000, 0x0239, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x023A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x023B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x023C, 0x0000, 0x0000, 0x0000, 0x0000, 0x023D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x023E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x023F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0240, 0x0241, 0x0242,
+    0x0243, 0x0244, 0x0245, 0x0000, 0x0246, 0x0000, 0x0241, 0x0241, 0x0241, 0x0241, 0x0000, 0x0000,
+    0x0241, 0x0247, 0x013B, 0x013B, 0x01FB, 0x0000, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0248, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0249, 0x0000, 0x0000, 0x0000, 0x0000, 0x024A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x024C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x024E, 0x024F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x01FB, 0x01FB, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x0000, 0x0000, 0x0000, 0x0205, 0x0205, 0x0205,
+    0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205,
+    0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205,
+    0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205, 0x0205,
+    0x0205, 0x0205, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01FB, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01CA, 0x013B, 0x013D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B,
+    0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D,
+    0x013D, 0x013D, 0x013D, 0x013B, 0x013B, 0x013D, 0x0000, 0x013D, 0x013D, 0x013B, 0x013B, 0x013D,
+    0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256,
+    0x0257, 0x0258, 0x0259, 0x0000, 0x0000, 0x025A, 0x025B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0204, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260, 0x0261,
+    0x0262, 0x0263, 0x0264, 0x0265, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x01FB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x01FB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x0000, 0x0142, 0x013D, 0x013D, 0x013D,
+    0x013D, 0x013D, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013D, 0x013B, 0x0000, 0x0142, 0x0142,
+    0x0142, 0x0142, 0x0142, 0x0142, 0x0142, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013B, 0x013B, 0x014A, 0x0266, 0x013D, 0x013F, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013C, 0x01CB,
+    0x01CB, 0x013D, 0x0267, 0x013B, 0x0149, 0x013D, 0x013B, 0x013D, 0x0268, 0x0269, 0x026A, 0x026B,
+    0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277,
+    0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283,
+    0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F,
+    0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A, 0x029B,
+    0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7,
+    0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x02B1, 0x02B2, 0x02B3,
+    0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF,
+    0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB,
+    0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7,
+    0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x02E1, 0x02E2, 0x02E3,
+    0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF,
+    0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB,
+    0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300, 0x0301, 0x0000, 0x0302, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E,
+    0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A,
+    0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326,
+    0x0327, 0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331, 0x0332,
+    0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E,
+    0x033F, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348, 0x0349, 0x034A,
+    0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356,
+    0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x035C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368,
+    0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370, 0x0371, 0x0372, 0x0000, 0x0000,
+    0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x0000, 0x0000, 0x0379, 0x037A, 0x037B, 0x037C,
+    0x037D, 0x037E, 0x037F, 0x0380, 0x0381, 0x0382, 0x0383, 0x0384, 0x0385, 0x0386, 0x0387, 0x0388,
+    0x0389, 0x038A, 0x038B, 0x038C, 0x038D, 0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394,
+    0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x0000, 0x0000,
+    0x039F, 0x03A0, 0x03A1, 0x03A2, 0x03A3, 0x03A4, 0x0000, 0x0000, 0x03A5, 0x03A6, 0x03A7, 0x03A8,
+    0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x0000, 0x03AD, 0x0000, 0x03AE, 0x0000, 0x03AF, 0x0000, 0x03B0,
+    0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC,
+    0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
+    0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x0000, 0x0000, 0x03CF, 0x03D0, 0x03D1, 0x03D2,
+    0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7, 0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE,
+    0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E8, 0x03E9, 0x03EA,
+    0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6,
+    0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402,
+    0x0403, 0x0000, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x0000, 0x040B, 0x040C,
+    0x0000, 0x040D, 0x040E, 0x040F, 0x0410, 0x0000, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416,
+    0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x0000, 0x0000, 0x041F, 0x0420,
+    0x0421, 0x0422, 0x0423, 0x0424, 0x0000, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B,
+    0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0000, 0x0000, 0x0438, 0x0439, 0x043A, 0x0000, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440,
+    0x0441, 0x0442, 0x0443, 0x0000, 0x0444, 0x0445, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x0142, 0x0142,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x0142, 0x0142, 0x0142, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x013B, 0x0000, 0x0000, 0x0000, 0x0142, 0x0142, 0x013B, 0x013D, 0x013B, 0x0142, 0x0142,
+    0x013D, 0x013D, 0x013D, 0x013D, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0446, 0x0000, 0x0000, 0x0000, 0x0447, 0x0448, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0449, 0x0000, 0x044A, 0x0000, 0x044B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x044C, 0x044D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x044E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x044F, 0x0450, 0x0451,
+    0x0452, 0x0000, 0x0453, 0x0000, 0x0454, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0455, 0x0456, 0x0000, 0x0000, 0x0000,
+    0x0457, 0x0458, 0x0000, 0x0459, 0x045A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x045B,
+    0x045C, 0x045D, 0x045E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x045F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0460, 0x0000, 0x0461, 0x0462, 0x0463, 0x0000, 0x0464,
+    0x0465, 0x0466, 0x0000, 0x0000, 0x0000, 0x0467, 0x0000, 0x0000, 0x0468, 0x0469, 0x046A, 0x0000,
+    0x046B, 0x046C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x046D, 0x046E, 0x046F,
+    0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0x0478, 0x0479, 0x047A, 0x047B,
+    0x047C, 0x047D, 0x0000, 0x0000, 0x047E, 0x047F, 0x0480, 0x0481, 0x0482, 0x0483, 0x0484, 0x0485,
+    0x0486, 0x0487, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0488, 0x0489, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x048A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x048B, 0x048C, 0x0000, 0x048D,
+    0x048E, 0x048F, 0x0490, 0x0491, 0x0000, 0x0000, 0x0492, 0x0493, 0x0494, 0x0495, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0496, 0x0497, 0x0498, 0x0499,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x049A, 0x049B, 0x049C, 0x049D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x049E, 0x049F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x04A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B,
+    0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0267, 0x01CB, 0x013C, 0x01CA, 0x04A1, 0x04A1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x04A3,
+    0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF,
+    0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x0000,
+    0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF, 0x04C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C1,
+    0x04C2, 0x04C3, 0x04C4, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC, 0x04CD,
+    0x04CE, 0x04CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D0, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x04D1, 0x04D1, 0x0000, 0x0000, 0x04D2, 0x04D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x04D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D5, 0x04D6, 0x04D7, 0x04D8, 0x04D9,
+    0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE, 0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5,
+    0x04E6, 0x04E7, 0x04E8, 0x04E9, 0x04EA, 0x04EB, 0x04EC, 0x0000, 0x04ED, 0x04EE, 0x04EF, 0x04F0,
+    0x04F1, 0x04F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x04F7,
+    0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE, 0x04FF, 0x0500, 0x0501, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0502, 0x0503, 0x0504, 0x0505, 0x0000, 0x0506, 0x0000, 0x0000, 0x0507,
+    0x0508, 0x0509, 0x050A, 0x0000, 0x0000, 0x050B, 0x050C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D,
+    0x013D, 0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x0000, 0x013B, 0x013B, 0x013D, 0x0000, 0x0000, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x013B, 0x013B, 0x0000, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x050D, 0x050D, 0x050D, 0x050D,
+    0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D, 0x050D,
+    0x050D, 0x050D, 0x050D, 0x050D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515,
+    0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521,
+    0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D,
+    0x052E, 0x052F, 0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537, 0x0538, 0x0539,
+    0x053A, 0x053B, 0x053C, 0x053D, 0x053E, 0x053F, 0x0540, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545,
+    0x0546, 0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F, 0x0550, 0x0551,
+    0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D,
+    0x055E, 0x055F, 0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569,
+    0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575,
+    0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581,
+    0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D,
+    0x058E, 0x058F, 0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599,
+    0x059A, 0x059B, 0x059C, 0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5,
+    0x05A6, 0x05A7, 0x05A8, 0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1,
+    0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD,
+    0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7, 0x05C8, 0x05C9,
+    0x05CA, 0x05CB, 0x05CC, 0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5,
+    0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1,
+    0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED,
+    0x05EE, 0x05EF, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7, 0x05F8, 0x05F9,
+    0x05FA, 0x05FB, 0x05FC, 0x05FD, 0x05FE, 0x05FF, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605,
+    0x0606, 0x0607, 0x0608, 0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F, 0x0610, 0x0611,
+    0x0612, 0x0613, 0x0614, 0x0615, 0x0616, 0x0617, 0x0618, 0x0619, 0x061A, 0x061B, 0x0000, 0x0000,
+    0x061C, 0x0000, 0x061D, 0x0000, 0x0000, 0x061E, 0x061F, 0x0620, 0x0621, 0x0622, 0x0623, 0x0624,
+    0x0625, 0x0626, 0x0627, 0x0000, 0x0628, 0x0000, 0x0629, 0x0000, 0x0000, 0x062A, 0x062B, 0x0000,
+    0x0000, 0x0000, 0x062C, 0x062D, 0x062E, 0x062F, 0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635,
+    0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x063B, 0x063C, 0x063D, 0x063E, 0x063F, 0x0640, 0x0641,
+    0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D,
+    0x064E, 0x064F, 0x0650, 0x0651, 0x0652, 0x0653, 0x0654, 0x0655, 0x0656, 0x0657, 0x0658, 0x0659,
+    0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665,
+    0x0666, 0x0667, 0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0000, 0x0000,
+    0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0678, 0x0679, 0x067A, 0x067B,
+    0x067C, 0x067D, 0x067E, 0x067F, 0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687,
+    0x0688, 0x0689, 0x068A, 0x068B, 0x068C, 0x068D, 0x068E, 0x068F, 0x0690, 0x0691, 0x0692, 0x0693,
+    0x0694, 0x0695, 0x0696, 0x0697, 0x0698, 0x0699, 0x069A, 0x069B, 0x069C, 0x069D, 0x069E, 0x069F,
+    0x06A0, 0x06A1, 0x06A2, 0x06A3, 0x06A4, 0x06A5, 0x06A6, 0x06A7, 0x06A8, 0x06A9, 0x06AA, 0x06AB,
+    0x06AC, 0x06AD, 0x06AE, 0x06AF, 0x06B0, 0x06B1, 0x06B2, 0x06B3, 0x06B4, 0x06B5, 0x06B6, 0x06B7,
+    0x06B8, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x06BE, 0x06BF, 0x06C0, 0x06C1, 0x06C2, 0x06C3,
+    0x06C4, 0x06C5, 0x06C6, 0x06C7, 0x06C8, 0x06C9, 0x06CA, 0x06CB, 0x06CC, 0x06CD, 0x06CE, 0x06CF,
+    0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x06D6, 0x06D7, 0x06D8, 0x06D9, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06DA, 0x06DB, 0x06DC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06DD, 0x06DE, 0x06DF, 0x06E0, 0x06E1, 0x06E2,
+    0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8, 0x06E9, 0x0000, 0x06EA, 0x06EB, 0x06EC, 0x06ED,
+    0x06EE, 0x0000, 0x06EF, 0x0000, 0x06F0, 0x06F1, 0x0000, 0x06F2, 0x06F3, 0x0000, 0x06F4, 0x06F5,
+    0x06F6, 0x06F7, 0x06F8, 0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013B, 0x013B,
+    0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x0000, 0x013B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x0142, 0x013D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D, 0x013D,
+    0x013B, 0x013B, 0x013B, 0x013D, 0x013B, 0x013D, 0x013D, 0x013D, 0x0000, 0x0000, 0x013B, 0x013D,
+    0x013B, 0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x06FD, 0x06FE, 0x06FF, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0701, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0702, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x01FA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0703, 0x0704,
+    0x0000, 0x0705, 0x0706, 0x01FB, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01FB, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x01FB, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0204, 0x0204, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0707, 0x0000, 0x0000, 0x0000, 0x0708, 0x0709, 0x01FB, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000,
+    0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x070A, 0x0205, 0x070B,
+    0x070C, 0x0205, 0x070D, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x070E, 0x070F, 0x0710, 0x0711,
+    0x0000, 0x0000, 0x0000, 0x01FB, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01FB, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01FB, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0712, 0x0000, 0x0000, 0x0713, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x01FB, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000,
+    0x01FB, 0x01FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0142, 0x0142, 0x0142, 0x0142, 0x0142, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0714, 0x0714, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0142, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0715, 0x0716, 0x0717, 0x0718, 0x0719, 0x071A,
+    0x071B, 0x0239, 0x0239, 0x0142, 0x0142, 0x0142, 0x0000, 0x0000, 0x0000, 0x071C, 0x0239, 0x0239,
+    0x0239, 0x0239, 0x0239, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013D,
+    0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013D, 0x013D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x071D,
+    0x071E, 0x071F, 0x0720, 0x0721, 0x0722, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013B, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+    0x013B, 0x0000, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x013B,
+    0x013B, 0x0000, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0723, 0x0724, 0x0725, 0x0726, 0x0727, 0x0728, 0x0729, 0x072A, 0x072B, 0x072C, 0x072D, 0x072E,
+    0x072F, 0x0730, 0x0731, 0x0732, 0x0733, 0x0734, 0x0735, 0x0736, 0x0737, 0x0738, 0x0739, 0x073A,
+    0x073B, 0x073C, 0x073D, 0x073E, 0x073F, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746,
+    0x0747, 0x0748, 0x0749, 0x074A, 0x074B, 0x074C, 0x074D, 0x074E, 0x074F, 0x0750, 0x0751, 0x0752,
+    0x0753, 0x0754, 0x0755, 0x0756, 0x0757, 0x0758, 0x0759, 0x075A, 0x075B, 0x075C, 0x075D, 0x075E,
+    0x075F, 0x0760, 0x0761, 0x0762, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0769, 0x076A,
+    0x076B, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775, 0x0776,
+    0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781, 0x0782,
+    0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E,
+    0x078F, 0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799, 0x079A,
+    0x079B, 0x079C, 0x079D, 0x079E, 0x079F, 0x07A0, 0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5, 0x07A6,
+    0x07A7, 0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF, 0x07B0, 0x07B1, 0x07B2,
+    0x07B3, 0x07B4, 0x07B5, 0x07B6, 0x07B7, 0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD, 0x07BE,
+    0x07BF, 0x07C0, 0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7, 0x07C8, 0x07C9, 0x07CA,
+    0x07CB, 0x07CC, 0x07CD, 0x07CE, 0x07CF, 0x07D0, 0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5, 0x07D6,
+    0x07D7, 0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF, 0x07E0, 0x07E1, 0x07E2,
+    0x07E3, 0x07E4, 0x07E5, 0x07E6, 0x07E7, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE,
+    0x07EF, 0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7, 0x07F8, 0x07F9, 0x07FA,
+    0x07FB, 0x07FC, 0x07FD, 0x07FE, 0x07FF, 0x0800, 0x0801, 0x0802, 0x0803, 0x0804, 0x0805, 0x0806,
+    0x0807, 0x0808, 0x0809, 0x080A, 0x080B, 0x080C, 0x080D, 0x080E, 0x080F, 0x0810, 0x0811, 0x0812,
+    0x0813, 0x0814, 0x0815, 0x0816, 0x0817, 0x0818, 0x0819, 0x081A, 0x081B, 0x081C, 0x081D, 0x081E,
+    0x081F, 0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827, 0x0828, 0x0829, 0x082A,
+    0x082B, 0x082C, 0x082D, 0x082E, 0x082F, 0x0830, 0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836,
+    0x0837, 0x0838, 0x0839, 0x083A, 0x083B, 0x083C, 0x083D, 0x083E, 0x083F, 0x0840, 0x0841, 0x0842,
+    0x0843, 0x0844, 0x0845, 0x0846, 0x0847, 0x0848, 0x0849, 0x084A, 0x084B, 0x084C, 0x084D, 0x084E,
+    0x084F, 0x0850, 0x0851, 0x0852, 0x0853, 0x0854, 0x0855, 0x0856, 0x0857, 0x0858, 0x0859, 0x085A,
+    0x085B, 0x085C, 0x085D, 0x085E, 0x085F, 0x0860, 0x0861, 0x0862, 0x0863, 0x0864, 0x0865, 0x0866,
+    0x0867, 0x0868, 0x0869, 0x086A, 0x086B, 0x086C, 0x086D, 0x086E, 0x086F, 0x0870, 0x0871, 0x0872,
+    0x0873, 0x0874, 0x0875, 0x0876, 0x0877, 0x0878, 0x0879, 0x087A, 0x087B, 0x087C, 0x087D, 0x087E,
+    0x087F, 0x0880, 0x0881, 0x0882, 0x0883, 0x0884, 0x0885, 0x0886, 0x0887, 0x0888, 0x0889, 0x088A,
+    0x088B, 0x088C, 0x088D, 0x088E, 0x088F, 0x0890, 0x0891, 0x0892, 0x0893, 0x0894, 0x0895, 0x0896,
+    0x0897, 0x0898, 0x0899, 0x089A, 0x089B, 0x089C, 0x089D, 0x089E, 0x089F, 0x08A0, 0x08A1, 0x08A2,
+    0x08A3, 0x08A4, 0x08A5, 0x08A6, 0x08A7, 0x08A8, 0x08A9, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE,
+    0x08AF, 0x08B0, 0x08B1, 0x08B2, 0x08B3, 0x08B4, 0x08B5, 0x08B6, 0x08B7, 0x08B8, 0x08B9, 0x08BA,
+    0x08BB, 0x08BC, 0x08BD, 0x08BE, 0x08BF, 0x08C0, 0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C6,
+    0x08C7, 0x08C8, 0x08C9, 0x08CA, 0x08CB, 0x08CC, 0x08CD, 0x08CE, 0x08CF, 0x08D0, 0x08D1, 0x08D2,
+    0x08D3, 0x08D4, 0x08D5, 0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE,
+    0x08DF, 0x08E0, 0x08E1, 0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9, 0x08EA,
+    0x08EB, 0x08EC, 0x08ED, 0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 0x08F3, 0x08F4, 0x08F5, 0x08F6,
+    0x08F7, 0x08F8, 0x08F9, 0x08FA, 0x08FB, 0x08FC, 0x08FD, 0x08FE, 0x08FF, 0x0900, 0x0901, 0x0902,
+    0x0903, 0x0904, 0x0905, 0x0906, 0x0907, 0x0908, 0x0909, 0x090A, 0x090B, 0x090C, 0x090D, 0x090E,
+    0x090F, 0x0910, 0x0911, 0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918, 0x0919, 0x091A,
+    0x091B, 0x091C, 0x091D, 0x091E, 0x091F, 0x0920, 0x0921, 0x0922, 0x0923, 0x0924, 0x0925, 0x0926,
+    0x0927, 0x0928, 0x0929, 0x092A, 0x092B, 0x092C, 0x092D, 0x092E, 0x092F, 0x0930, 0x0931, 0x0932,
+    0x0933, 0x0934, 0x0935, 0x0936, 0x0937, 0x0938, 0x0939, 0x093A, 0x093B, 0x093C, 0x093D, 0x093E,
+    0x093F, 0x0940, 0x0000, 0x0000,
+};
+
+#define UCD_GRAPHEME_BITS2 6
+#define UCD_GRAPHEME_BITS3 3
+
+static const uint8_t UCD_GRAPHEME_STAGE1[2176] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0A,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x0A, 0x16, 0x17, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x23, 0x0A, 0x24,
+    0x25, 0x26, 0x0A, 0x0A, 0x0A, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x32, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x33, 0x0A, 0x34, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x35, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x36, 0x37, 0x38, 0x0A, 0x0A, 0x0A, 0x39, 0x0A, 0x0A,
+    0x3A, 0x3B, 0x0A, 0x0A, 0x3C, 0x0A, 0x0A, 0x0A, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+};
+
+static const uint8_t UCD_GRAPHEME_STAGE2[4544] = {
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x06, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x09, 0x0A, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x0B, 0x02, 0x05, 0x0C, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x05, 0x05, 0x02, 0x02, 0x0D, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E, 0x0F, 0x10, 0x11, 0x02, 0x02,
+    0x02, 0x12, 0x13, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x0E, 0x05, 0x0D, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x15, 0x16,
+    0x02, 0x02, 0x0E, 0x17, 0x18, 0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1A, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x1B, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1C, 0x05, 0x05, 0x1D, 0x05, 0x05, 0x05,
+    0x1E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1F, 0x20, 0x21, 0x08, 0x02, 0x22, 0x02, 0x02, 0x02,
+    0x23, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x24, 0x25, 0x26, 0x27, 0x02, 0x22, 0x02, 0x02, 0x28,
+    0x29, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x2A, 0x2B, 0x2C, 0x13, 0x02, 0x02, 0x02, 0x2D, 0x02,
+    0x29, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x2A, 0x2E, 0x2F, 0x02, 0x02, 0x22, 0x02, 0x02, 0x1C,
+    0x23, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x30, 0x25, 0x26, 0x31, 0x02, 0x22, 0x02, 0x02, 0x02,
+    0x32, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x33, 0x34, 0x35, 0x27, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x36, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x30, 0x37, 0x11, 0x38, 0x02, 0x22, 0x02, 0x02, 0x02,
+    0x23, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x39, 0x3A, 0x3B, 0x38, 0x02, 0x22, 0x02, 0x02, 0x02,
+    0x3C, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3D, 0x3E, 0x3F, 0x27, 0x02, 0x22, 0x02, 0x02, 0x02,
+    0x23, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x40, 0x41, 0x42, 0x02, 0x02, 0x43, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x44, 0x14, 0x27, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x44, 0x46, 0x02, 0x47, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x07, 0x02, 0x02, 0x48, 0x49, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x4A,
+    0x4B, 0x31, 0x05, 0x08, 0x05, 0x05, 0x05, 0x46, 0x28, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x31, 0x4C, 0x4D, 0x02, 0x02, 0x4E, 0x4F, 0x0D, 0x02, 0x50, 0x02,
+    0x51, 0x16, 0x02, 0x16, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x31, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x55, 0x02, 0x02, 0x02, 0x56, 0x02, 0x02, 0x02, 0x22, 0x02, 0x02, 0x02, 0x22, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x57, 0x58, 0x59, 0x20, 0x15, 0x16, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x5A, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x38, 0x02, 0x02, 0x02, 0x02, 0x13, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x5B, 0x5C, 0x5D, 0x5E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x27, 0x5F, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x60, 0x45, 0x61, 0x62, 0x63, 0x10,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x64, 0x02, 0x02, 0x02, 0x02, 0x02, 0x65, 0x66, 0x67, 0x02, 0x02, 0x02, 0x02, 0x06, 0x15, 0x02,
+    0x68, 0x02, 0x02, 0x02, 0x69, 0x6A, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x33, 0x6B, 0x3C, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x6C, 0x6D, 0x6E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6F, 0x05, 0x4C, 0x70, 0x71, 0x07,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x02, 0x72, 0x02, 0x02, 0x02, 0x73, 0x02, 0x74, 0x02, 0x75, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0D, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x76, 0x02, 0x02, 0x75, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x77, 0x78, 0x02, 0x79, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x7A, 0x02, 0x7B, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x7B, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7C, 0x02, 0x02, 0x02, 0x7D, 0x7E, 0x7F,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x76, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x7A, 0x80, 0x02, 0x7B, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81,
+    0x82, 0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x85, 0x02, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x85, 0x83, 0x86, 0x87, 0x75, 0x7B, 0x88, 0x02, 0x89, 0x8A, 0x8B, 0x02, 0x8C, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x8D, 0x02, 0x75, 0x02, 0x7B, 0x7C, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x8D, 0x02, 0x02, 0x88, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8F, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x07, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x1C, 0x7B, 0x87, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x90, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x7C, 0x75, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x6F, 0x47,
+    0x02, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x91, 0x92, 0x02, 0x02, 0x93, 0x94, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x95, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6C, 0x96, 0x97, 0x02, 0x02, 0x02, 0x05, 0x05, 0x07, 0x27,
+    0x02, 0x02, 0x02, 0x02, 0x0E, 0x47, 0x02, 0x02, 0x27, 0x05, 0x3C, 0x02, 0x52, 0x52, 0x52, 0x98,
+    0x1E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x99, 0x9A, 0x9B, 0x02, 0x02, 0x02, 0x16, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x9C, 0x9D, 0x02, 0x92, 0x9E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x94,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x9F, 0xA0, 0x13, 0x02, 0x02, 0x02, 0x02, 0xA1, 0xA2, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xA3, 0xA4, 0x02, 0x02,
+    0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7,
+    0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6,
+    0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5,
+    0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6,
+    0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6,
+    0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6,
+    0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7,
+    0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6,
+    0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5,
+    0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6,
+    0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6,
+    0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6,
+    0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7,
+    0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6,
+    0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5,
+    0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6,
+    0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6,
+    0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6,
+    0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7,
+    0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6,
+    0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5,
+    0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6,
+    0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6,
+    0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6,
+    0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+    0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7,
+    0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA7, 0xA6, 0xA6,
+    0xA6, 0xA5, 0xA6, 0xA6, 0xA8, 0x02, 0x53, 0x53, 0xA9, 0xAA, 0x54, 0x54, 0x54, 0x54, 0x54, 0xAB,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x28, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x05, 0x05, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xAC,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x16,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E, 0x14,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0xAD, 0x65, 0x02, 0x02, 0x02, 0x02, 0x02, 0xAE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x38, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x65, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0xAF, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E, 0x05, 0x0D, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0xB0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0xB1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0xB2, 0x27,
+    0x68, 0x02, 0x02, 0x02, 0x02, 0x02, 0xB3, 0xB4, 0x32, 0xB5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x14, 0x02, 0x02, 0x02, 0x27, 0xB6, 0x46, 0x02, 0xB7, 0x02, 0x02, 0x02, 0x02, 0x02, 0x92, 0x02,
+    0x68, 0x02, 0x02, 0x02, 0x02, 0x02, 0xB8, 0x4A, 0xB9, 0xBA, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0xBB, 0xBC, 0x28, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x63, 0x14, 0x02, 0x02,
+    0x3C, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3D, 0xBD, 0xBE, 0x27, 0x02, 0xBF, 0x46, 0x46, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xC0, 0x05, 0xC1, 0x02, 0x02, 0x28, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xC2, 0xC3, 0xC4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0xC5, 0xC6, 0x0D, 0x02, 0x02, 0xC7, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x63, 0xC8, 0x0D, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0xC9, 0xCA, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x31, 0xCB, 0x15, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0xBB, 0x05, 0xCC, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xCD, 0xCE, 0xCF, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xD0, 0xD1, 0xD2, 0x02, 0x02, 0x02,
+    0x08, 0x14, 0x02, 0x02, 0x02, 0x02, 0x06, 0xD3, 0x27, 0x02, 0x9C, 0x5E, 0x02, 0x02, 0x02, 0x02,
+    0xD4, 0xD5, 0x4A, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0xD6, 0x45, 0xCA, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x1C, 0x05, 0x05, 0xD7, 0xD8, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xD9, 0xDA, 0xDB, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0xDC, 0xDD, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xDE, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xDF, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x46, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0xE0, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x27, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x94, 0x02, 0x95, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x38, 0xAC, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x47, 0x05, 0x05, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xE1, 0xE2, 0xE3, 0xE4,
+    0xE5, 0x15, 0x02, 0x02, 0x02, 0xB0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xE6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x45, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x46, 0x16, 0x02,
+    0x94, 0x02, 0x02, 0x06, 0x08, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x45, 0x05, 0x05, 0xE7, 0xE8, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x28, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x65, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x45, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x65, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x02, 0x8D, 0x02, 0x02, 0x02, 0x7C, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x77, 0x78, 0xE9,
+    0x02, 0x80, 0x7D, 0x7F, 0x02, 0x8D, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xEA, 0xEB, 0xEB, 0xEB,
+    0x7D, 0x83, 0x02, 0x76, 0x02, 0x7C, 0xEC, 0x84, 0x02, 0x7D, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xED,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85, 0xE9, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x77, 0x83,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8D, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x02, 0x77, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x83, 0x02, 0xEC, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x83, 0x02, 0x02, 0x02, 0xE9, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x02, 0x77, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t UCD_GRAPHEME_STAGE3[1904] = {
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x01, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04, 0x00, 0x08, 0x08,
+    0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x08, 0x08,
+    0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x08,
+    0x08, 0x00, 0x00, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x08, 0x00, 0x08, 0x08, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
+    0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00,
+    0x04, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x04,
+    0x08, 0x08, 0x04, 0x08, 0x08, 0x00, 0x04, 0x08, 0x08, 0x00, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00,
+    0x04, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x08,
+    0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x04, 0x07, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04,
+    0x04, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x04, 0x04, 0x00,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04,
+    0x04, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x08, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x08, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08,
+    0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x08, 0x04, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x00,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
+    0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x0E,
+    0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x04, 0x04,
+    0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x08, 0x04, 0x04, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x08, 0x08,
+    0x04, 0x08, 0x08, 0x00, 0x08, 0x04, 0x00, 0x00, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x08, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08,
+    0x08, 0x04, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x04, 0x04, 0x08, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x04,
+    0x04, 0x04, 0x08, 0x08, 0x04, 0x08, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08,
+    0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x08, 0x04, 0x00,
+    0x04, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x08, 0x08, 0x04, 0x08, 0x04,
+    0x04, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x08, 0x08, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04, 0x08, 0x08,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04,
+    0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08,
+    0x08, 0x00, 0x00, 0x04, 0x04, 0x08, 0x04, 0x07, 0x08, 0x07, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x08, 0x07, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x08, 0x04, 0x04, 0x08, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x04, 0x00, 0x08, 0x08, 0x04, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04,
+};
+
+#define UCD_WORD_BITS2 5
+#define UCD_WORD_BITS3 4
+
+static const uint8_t UCD_WORD_STAGE1[2176] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1C, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x21, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x1C, 0x37, 0x38, 0x22, 0x22, 0x22, 0x22, 0x39, 0x1C, 0x1C, 0x3A, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x1C, 0x3B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1C, 0x3C, 0x22, 0x3D, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x3E, 0x1A, 0x1A, 0x3F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x41, 0x42, 0x22, 0x22, 0x22, 0x22, 0x43, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x45, 0x46, 0x47, 0x48, 0x22, 0x49, 0x22, 0x4A,
+    0x4B, 0x4C, 0x22, 0x4D, 0x4E, 0x22, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x59, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x5A, 0x5B, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x5C, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x5D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1A, 0x5E, 0x22, 0x22,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x5F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x60, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+};
+
+static const uint16_t UCD_WORD_STAGE2[3104] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0004, 0x0006, 0x0007, 0x0001, 0x0008, 0x0009,
+    0x000A, 0x000B, 0x000A, 0x000B, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000C, 0x000A, 0x000A,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000E, 0x000F, 0x000A, 0x0010, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x0011, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x0012, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0004,
+    0x000A, 0x0013, 0x000A, 0x000A, 0x0014, 0x0015, 0x000D, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A,
+    0x001B, 0x001C, 0x000A, 0x000A, 0x001D, 0x000D, 0x001E, 0x001F, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x000A, 0x000D, 0x0025, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x0026, 0x0027, 0x0028, 0x000A, 0x001D, 0x0029, 0x000A, 0x002A, 0x002B, 0x0001,
+    0x000A, 0x002C, 0x0006, 0x000A, 0x002D, 0x002E, 0x000A, 0x000A, 0x002F, 0x000D, 0x0030, 0x000D,
+    0x0031, 0x000A, 0x000A, 0x0032, 0x000D, 0x0033, 0x0034, 0x0004, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x003A, 0x0034, 0x003B, 0x003C, 0x0036, 0x0037, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0010, 0x0037, 0x0043, 0x0044, 0x0045, 0x0034, 0x0046, 0x0047, 0x0036, 0x0037, 0x0043,
+    0x0048, 0x0049, 0x0034, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0040, 0x0051,
+    0x0052, 0x0053, 0x0037, 0x0054, 0x0055, 0x0056, 0x0034, 0x0057, 0x0058, 0x0053, 0x0037, 0x0059,
+    0x0055, 0x005A, 0x0034, 0x005B, 0x005C, 0x0053, 0x000A, 0x005D, 0x005E, 0x005F, 0x0034, 0x0060,
+    0x0061, 0x0062, 0x000A, 0x0063, 0x0064, 0x0065, 0x0040, 0x0066, 0x0067, 0x0068, 0x0068, 0x0069,
+    0x006A, 0x006B, 0x0001, 0x0001, 0x006C, 0x0068, 0x006D, 0x006E, 0x006F, 0x0070, 0x0001, 0x0001,
+    0x0045, 0x0071, 0x0072, 0x0073, 0x0074, 0x000A, 0x0075, 0x0015, 0x0076, 0x0077, 0x000D, 0x0078,
+    0x0079, 0x0001, 0x0001, 0x0001, 0x0068, 0x0068, 0x007A, 0x007B, 0x006B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x000A, 0x000A, 0x0081, 0x000A, 0x000A, 0x0082, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x0083, 0x0084, 0x000A, 0x000A, 0x0083, 0x000A, 0x000A, 0x0085,
+    0x0086, 0x000B, 0x000A, 0x000A, 0x000A, 0x0086, 0x000A, 0x000A, 0x000A, 0x0087, 0x0088, 0x0089,
+    0x000A, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x008A, 0x0004, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x008B, 0x000A,
+    0x008C, 0x0006, 0x000A, 0x000A, 0x000A, 0x000A, 0x008D, 0x008E, 0x000A, 0x008F, 0x000A, 0x0090,
+    0x000A, 0x0091, 0x0092, 0x0093, 0x0068, 0x0068, 0x0068, 0x0094, 0x000D, 0x0095, 0x006B, 0x0096,
+    0x0097, 0x006B, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x008E, 0x0098, 0x000A, 0x0099, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x009A, 0x000A, 0x009B, 0x009C, 0x009C, 0x0040, 0x0068, 0x009D, 0x009E,
+    0x0068, 0x0068, 0x009F, 0x0068, 0x0096, 0x00A0, 0x0001, 0x0001, 0x000A, 0x00A1, 0x0068, 0x0068,
+    0x0068, 0x00A2, 0x000D, 0x00A3, 0x006B, 0x006B, 0x00A4, 0x000D, 0x00A5, 0x0001, 0x0001, 0x0001,
+    0x00A6, 0x000A, 0x000A, 0x00A7, 0x00A8, 0x006B, 0x00A9, 0x00AA, 0x00AB, 0x000A, 0x00AC, 0x0028,
+    0x000A, 0x000A, 0x0026, 0x00AA, 0x000A, 0x000A, 0x00A7, 0x00AD, 0x00AE, 0x0028, 0x000A, 0x00AF,
+    0x008E, 0x000A, 0x000A, 0x00B0, 0x0001, 0x00B1, 0x00B2, 0x00B3, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x008A, 0x000A, 0x000A, 0x008A, 0x00B4, 0x000A, 0x00AF,
+    0x000A, 0x000A, 0x000A, 0x00B5, 0x00B6, 0x00B7, 0x0075, 0x00B6, 0x00B8, 0x00B9, 0x00BA, 0x00BB,
+    0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x0096, 0x0075, 0x0001, 0x0001, 0x0001, 0x000D, 0x000D, 0x00C0,
+    0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x0068, 0x000A, 0x000A, 0x00C6, 0x00C7, 0x00C8, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00C9, 0x00CA, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x00CA, 0x0001, 0x0001, 0x0001, 0x00CB, 0x0001, 0x00CC, 0x00CD,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x0068, 0x0068, 0x009F, 0x0001, 0x00CE,
+    0x00CF, 0x000A, 0x00D0, 0x0068, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x00C9, 0x00D1, 0x00D2, 0x0001, 0x0001, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D7, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x0068, 0x00E0, 0x00E1, 0x00E2,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00E3,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x00E4, 0x00E5, 0x0001, 0x0001, 0x0001, 0x00E6, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x00E7, 0x00E8,
+    0x000A, 0x000A, 0x0081, 0x000A, 0x000A, 0x000A, 0x00E9, 0x00EA, 0x000A, 0x00EB, 0x00EC, 0x00EC,
+    0x00EC, 0x00EC, 0x000D, 0x000D, 0x0001, 0x0001, 0x00ED, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x00EE, 0x0001, 0x00EF, 0x00F0, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x00F1, 0x00F2, 0x00F2,
+    0x00F2, 0x00F2, 0x00F2, 0x00F3, 0x00F4, 0x000A, 0x000A, 0x0004, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x009B, 0x00F5, 0x000A, 0x000A, 0x0001, 0x0001, 0x0001, 0x00F2, 0x0001, 0x0001, 0x0096, 0x0001,
+    0x00F6, 0x0067, 0x0001, 0x0001, 0x0096, 0x00F7, 0x0001, 0x0067, 0x0001, 0x00F2, 0x00F2, 0x00F8,
+    0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F9, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x0075, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x00AF, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x0075, 0x000A, 0x00FA, 0x0001, 0x000A, 0x000A, 0x00FB, 0x00FC, 0x000A, 0x00FD, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x00FE, 0x00FF, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x0006, 0x0100, 0x0001, 0x0101, 0x0102, 0x000A, 0x0103, 0x0104,
+    0x000A, 0x000A, 0x000A, 0x0105, 0x0106, 0x000A, 0x000A, 0x00A7, 0x0107, 0x006B, 0x000D, 0x0108,
+    0x0028, 0x000A, 0x0109, 0x000A, 0x010A, 0x00AA, 0x000A, 0x0075, 0x0031, 0x000A, 0x000A, 0x010B,
+    0x010C, 0x006B, 0x010D, 0x010E, 0x000A, 0x000A, 0x010F, 0x0110, 0x0111, 0x006B, 0x0068, 0x0112,
+    0x0068, 0x0068, 0x0068, 0x0113, 0x0114, 0x0115, 0x001D, 0x0116, 0x0117, 0x0118, 0x00EC, 0x000A,
+    0x000A, 0x000A, 0x0119, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x011A, 0x006B,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x0105, 0x000A, 0x011B, 0x000A, 0x000A, 0x011C, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x009D, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0096, 0x0001, 0x0001, 0x00EB, 0x011D, 0x011E, 0x011F, 0x0120, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x0121, 0x0001, 0x0122, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x00AF, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x0101, 0x000A, 0x000A,
+    0x0123, 0x0001, 0x0001, 0x011C, 0x000D, 0x0124, 0x000D, 0x0125, 0x0126, 0x0127, 0x0001, 0x0128,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0129, 0x012A, 0x0003, 0x0004, 0x0005,
+    0x0004, 0x0006, 0x012B, 0x00F2, 0x00F2, 0x012C, 0x000A, 0x009B, 0x012D, 0x012E, 0x0001, 0x012F,
+    0x0130, 0x000A, 0x000B, 0x0131, 0x00AF, 0x00AF, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x0006, 0x0132, 0x0068, 0x0068, 0x0133, 0x000A, 0x000A, 0x000A, 0x0134,
+    0x0135, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0136, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x0075, 0x000A, 0x000A, 0x000A, 0x0045, 0x0137, 0x009F,
+    0x000A, 0x000A, 0x0138, 0x000A, 0x0006, 0x000A, 0x000A, 0x0139, 0x000A, 0x00AF, 0x000A, 0x000A,
+    0x013A, 0x013B, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x00AF, 0x006B, 0x000A, 0x000A, 0x013A, 0x000A, 0x011C, 0x000A, 0x000A, 0x0123, 0x000A,
+    0x000A, 0x000A, 0x0105, 0x0082, 0x0082, 0x013C, 0x0010, 0x013D, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x00EB, 0x000A, 0x009A, 0x0123, 0x0001,
+    0x0011, 0x000A, 0x000A, 0x013E, 0x0001, 0x0001, 0x0001, 0x0001, 0x013F, 0x000A, 0x000A, 0x0140,
+    0x000A, 0x0141, 0x000A, 0x0142, 0x000A, 0x009B, 0x0132, 0x0001, 0x0001, 0x0001, 0x000A, 0x0143,
+    0x000A, 0x0144, 0x000A, 0x0119, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x0145,
+    0x0068, 0x0146, 0x0068, 0x0068, 0x0147, 0x0148, 0x000A, 0x0149, 0x014A, 0x0001, 0x000A, 0x014B,
+    0x000A, 0x014C, 0x0001, 0x0001, 0x0074, 0x000A, 0x014D, 0x0001, 0x000A, 0x000A, 0x000A, 0x009A,
+    0x000A, 0x0141, 0x000A, 0x014E, 0x000A, 0x0121, 0x0088, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x008E, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x014F,
+    0x000A, 0x000A, 0x000A, 0x0150, 0x000A, 0x000A, 0x0151, 0x006B, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0068, 0x0152, 0x000A, 0x000A, 0x0153, 0x0121, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x014C, 0x0154, 0x000A, 0x0026, 0x0155, 0x0001, 0x000A, 0x0156, 0x0001, 0x0001, 0x000A,
+    0x0157, 0x0001, 0x000A, 0x00EB, 0x00AB, 0x000A, 0x000A, 0x0158, 0x0110, 0x0146, 0x0159, 0x015A,
+    0x00AB, 0x000A, 0x000A, 0x015B, 0x015C, 0x000A, 0x008E, 0x006B, 0x00AB, 0x000A, 0x010A, 0x015D,
+    0x015E, 0x000A, 0x000A, 0x015F, 0x00AB, 0x000A, 0x000A, 0x010B, 0x0160, 0x0161, 0x0067, 0x009E,
+    0x000A, 0x0010, 0x0162, 0x0163, 0x0001, 0x0001, 0x0001, 0x0001, 0x0164, 0x0165, 0x008E, 0x000A,
+    0x000A, 0x00FB, 0x0166, 0x006B, 0x0167, 0x0036, 0x0037, 0x0168, 0x0048, 0x0169, 0x016A, 0x016B,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x016C,
+    0x016D, 0x016E, 0x0121, 0x0001, 0x000A, 0x000A, 0x000A, 0x000D, 0x016F, 0x006B, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x00FB, 0x0170,
+    0x00C0, 0x0171, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000D, 0x0172, 0x006B, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x001D, 0x0173, 0x006B, 0x0001, 0x0001, 0x0001, 0x0068, 0x0174, 0x009C, 0x0175,
+    0x0176, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x0162, 0x0166, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x0072, 0x0177, 0x0178, 0x0179, 0x000A, 0x017A, 0x017B, 0x006B, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x017C, 0x000A, 0x000A, 0x017D, 0x017E, 0x0001, 0x017F, 0x000A, 0x000A, 0x0180,
+    0x0181, 0x0182, 0x000A, 0x000A, 0x002F, 0x0183, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x008E,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0037, 0x000A, 0x00FB, 0x0184, 0x0045, 0x0072, 0x0089, 0x0101,
+    0x000A, 0x0185, 0x0077, 0x0110, 0x0001, 0x0001, 0x0001, 0x0001, 0x0186, 0x000A, 0x000A, 0x0187,
+    0x0188, 0x006B, 0x0189, 0x000A, 0x018A, 0x018B, 0x006B, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x000A, 0x018C, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0045, 0x0068, 0x009E, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0119, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x009B, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x0105, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0045, 0x000A, 0x000A, 0x009B, 0x018D,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x00EB, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x008E, 0x000A, 0x009B, 0x006B, 0x000A, 0x000A, 0x000A, 0x000A, 0x009B,
+    0x006B, 0x000A, 0x00AF, 0x016B, 0x000A, 0x000A, 0x000A, 0x0110, 0x0105, 0x018E, 0x018F, 0x0190,
+    0x000A, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x0068, 0x0176, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x0191, 0x0192, 0x000D, 0x000D, 0x0193, 0x00AB, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0194, 0x00FE, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0195,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0104, 0x0001, 0x0001, 0x014A, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0196, 0x0197, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0198, 0x0001,
+    0x0001, 0x0051, 0x0199, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x009F, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x0006, 0x0075, 0x008E, 0x019A, 0x019B, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000D, 0x000D, 0x019C, 0x000D,
+    0x0110, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x019D, 0x019E,
+    0x019F, 0x0001, 0x01A0, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x01A1, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x0133,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x014A, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x0128, 0x000A, 0x000A,
+    0x000A, 0x0092, 0x01A2, 0x01A3, 0x01A4, 0x000A, 0x000A, 0x000A, 0x01A5, 0x01A6, 0x000A, 0x01A7,
+    0x01A8, 0x0053, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x01A9, 0x000A,
+    0x0053, 0x0082, 0x000A, 0x0082, 0x000A, 0x0128, 0x000A, 0x0128, 0x009B, 0x000A, 0x009B, 0x000A,
+    0x0037, 0x000A, 0x0037, 0x000A, 0x01AA, 0x01AB, 0x01AB, 0x01AB, 0x000D, 0x000D, 0x000D, 0x01AC,
+    0x000D, 0x000D, 0x0078, 0x01AD, 0x01AE, 0x00A9, 0x0015, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x009B, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0184, 0x01AF, 0x01B0, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x000A, 0x0075, 0x01B1, 0x01B2, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000A, 0x01B3, 0x0001, 0x000A, 0x000A, 0x0162, 0x006B,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x01B4, 0x009B,
+    0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A, 0x000A,
+    0x01B5, 0x0110, 0x0001, 0x0001, 0x000A, 0x000A, 0x000A, 0x000A, 0x01B6, 0x006B, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0067, 0x0068, 0x0068, 0x01B7, 0x01B8, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0067, 0x0068, 0x01B9, 0x009D, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x01A4, 0x000A, 0x01BA, 0x01BB, 0x01BC, 0x01BD, 0x01BE, 0x01BF,
+    0x01C0, 0x011C, 0x01C1, 0x011C, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x01C2, 0x0001, 0x00CB, 0x000A, 0x0119, 0x000A, 0x01C3, 0x01C4,
+    0x01C5, 0x01C6, 0x01C7, 0x00D6, 0x00D6, 0x00D6, 0x01C8, 0x01C9, 0x01CA, 0x01CB, 0x00CB, 0x01CC,
+    0x00CC, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x01CD, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x01CE,
+    0x01CF, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x0001, 0x0001, 0x0001, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x01D0,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x01D1, 0x00D6, 0x00D6, 0x01D2, 0x0001, 0x0001, 0x0001,
+    0x01D3, 0x01D4, 0x0001, 0x0001, 0x01D3, 0x0001, 0x01D5, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x01D2, 0x00D6, 0x00D6, 0x01D6, 0x00D4, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x006B,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6, 0x00D6,
+    0x00D6, 0x00D6, 0x00D6, 0x01CE, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0001, 0x0001, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x014A, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x009D, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x01D7, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x01D8, 0x0001, 0x0068, 0x009D, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+    0x01D9, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x01DA, 0x0001, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x0001,
+};
+
+static const uint8_t UCD_WORD_STAGE3[7600] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0D, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x07, 0x20, 0x00,
+    0x00, 0x00, 0x13, 0x13, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x13, 0x0A, 0x00, 0x13, 0x13, 0x13, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0E, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0E,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0F, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x09, 0x09, 0x09, 0x0A, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x0F, 0x00, 0x0A, 0x0A,
+    0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x0A, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x00, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x0A, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A,
+    0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x0A, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x0A,
+    0x0A, 0x0A, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x0A, 0x00, 0x04, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A,
+    0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x0A, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x0A,
+    0x00, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A,
+    0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A,
+    0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x0A, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00,
+    0x0A, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x0A, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00,
+    0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x0A, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x04, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0A,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x04, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x13, 0x00, 0x13, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x00, 0x13, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x04, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x13, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x13, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04,
+    0x04, 0x13, 0x04, 0x04, 0x04, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x13, 0x13,
+    0x13, 0x04, 0x04, 0x04, 0x04, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x13, 0x04,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A,
+    0x12, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x0A, 0x0A, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x07, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00,
+    0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x00, 0x12, 0x12, 0x12, 0x00, 0x04, 0x05, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0E, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x11,
+    0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x13, 0x0A, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x2A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x2A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x04,
+    0x04, 0x04, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x20, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x13, 0x13, 0x13, 0x0A, 0x0A, 0x20, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x13, 0x13, 0x13,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04,
+    0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x04, 0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x13, 0x04, 0x04, 0x04, 0x13, 0x13,
+    0x04, 0x13, 0x04, 0x04, 0x04, 0x13, 0x13, 0x04, 0x04, 0x13, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04,
+    0x13, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x09, 0x00,
+    0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+    0x0F, 0x00, 0x0D, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04,
+    0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x04, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x0A, 0x0A,
+    0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x04, 0x0A, 0x0A, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x04, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A,
+    0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x04, 0x04, 0x0A, 0x04, 0x04,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0A,
+    0x04, 0x0A, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x0A, 0x00, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x0A, 0x0A, 0x00, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
+    0x08, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x13, 0x13, 0x13,
+    0x00, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x13,
+    0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0A, 0x0A,
+    0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
+    0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x20, 0x20, 0x20,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x2A, 0x2A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x2A, 0x2A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#define UCD_LINE_BITS2 5
+#define UCD_LINE_BITS3 4
+
+static const uint8_t UCD_LINE_STAGE1[2176] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x12, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x1B, 0x19, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x28, 0x29, 0x2A, 0x2B,
+    0x2C, 0x2D, 0x2E, 0x12, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+    0x12, 0x12, 0x3B, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x3C, 0x3D, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x3E, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x3F, 0x12, 0x40, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x41, 0x19, 0x42, 0x43, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x44, 0x45, 0x12, 0x12, 0x12, 0x12, 0x46, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x47, 0x48, 0x49, 0x12, 0x4A, 0x12, 0x4B, 0x12, 0x12,
+    0x4C, 0x4D, 0x12, 0x12, 0x4E, 0x12, 0x4F, 0x12, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x58,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x58,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x59, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+};
+
+static const uint16_t UCD_LINE_STAGE2[2880] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0004, 0x0006, 0x0007, 0x0001, 0x0008, 0x0009,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x000A, 0x000B, 0x0004, 0x0004,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x000C, 0x000D, 0x000E, 0x000F, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0010, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0011, 0x0012, 0x0001, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x0004, 0x0004, 0x001A, 0x0001, 0x001B, 0x001C, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x001D, 0x001E, 0x001F, 0x0004, 0x0020, 0x0004, 0x0001, 0x0021, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0022, 0x001C, 0x001F, 0x0004, 0x001A, 0x0023, 0x0004, 0x0024, 0x0025, 0x0004,
+    0x0004, 0x0026, 0x0004, 0x0004, 0x0004, 0x0027, 0x0004, 0x0004, 0x0028, 0x0001, 0x0029, 0x0001,
+    0x002A, 0x0004, 0x0004, 0x002B, 0x0001, 0x002C, 0x002D, 0x0004, 0x002E, 0x0004, 0x0004, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x002E, 0x0004, 0x0004, 0x002F, 0x0034, 0x0020, 0x0035, 0x0036,
+    0x002E, 0x0004, 0x0004, 0x002F, 0x0037, 0x0004, 0x0032, 0x0038, 0x002E, 0x0004, 0x0004, 0x002F,
+    0x0030, 0x0039, 0x0032, 0x0004, 0x003A, 0x0004, 0x0004, 0x003B, 0x003C, 0x0031, 0x0035, 0x003D,
+    0x003E, 0x0004, 0x0004, 0x002F, 0x003F, 0x0040, 0x0032, 0x0041, 0x0042, 0x0004, 0x0004, 0x002F,
+    0x003F, 0x0040, 0x0032, 0x0004, 0x002A, 0x0004, 0x0004, 0x0043, 0x003F, 0x0031, 0x0032, 0x0044,
+    0x002E, 0x0004, 0x0004, 0x0004, 0x0045, 0x0046, 0x0035, 0x0047, 0x0004, 0x0004, 0x0004, 0x0048,
+    0x0049, 0x004A, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x004B, 0x004C, 0x001F, 0x0004, 0x0004,
+    0x004D, 0x004E, 0x001F, 0x004F, 0x0004, 0x0004, 0x0004, 0x0050, 0x0051, 0x0052, 0x0001, 0x0053,
+    0x0054, 0x0055, 0x0004, 0x0004, 0x0004, 0x0004, 0x001A, 0x0056, 0x004A, 0x0057, 0x0058, 0x0059,
+    0x005A, 0x005B, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x005C, 0x005C, 0x005C, 0x005C,
+    0x005C, 0x005C, 0x005D, 0x005D, 0x005D, 0x005D, 0x005E, 0x005F, 0x005F, 0x005F, 0x005F, 0x005F,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0060, 0x0061, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0062, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0062, 0x0063, 0x0004, 0x0004, 0x0004, 0x0004, 0x0064, 0x0004, 0x0004, 0x0065, 0x0004, 0x0066,
+    0x0004, 0x0047, 0x0004, 0x0047, 0x0004, 0x0004, 0x0004, 0x0067, 0x0001, 0x0068, 0x001F, 0x0004,
+    0x0069, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0040, 0x0004, 0x006A, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x006B, 0x006B, 0x006C, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x001F, 0x0004, 0x0004, 0x0004, 0x006D, 0x0004, 0x0004,
+    0x0004, 0x006E, 0x0001, 0x006F, 0x001F, 0x001F, 0x0004, 0x0001, 0x0056, 0x0004, 0x0004, 0x0004,
+    0x003E, 0x0004, 0x0004, 0x0067, 0x003E, 0x0070, 0x0071, 0x0072, 0x0073, 0x0004, 0x0074, 0x001F,
+    0x0004, 0x0004, 0x0022, 0x002A, 0x0004, 0x0004, 0x0067, 0x0075, 0x001F, 0x001F, 0x0004, 0x0076,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0077, 0x0078, 0x0079, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0082, 0x0004, 0x0083, 0x0084, 0x0085, 0x0001, 0x0001, 0x001C,
+    0x0086, 0x0087, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0088, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0089, 0x0004, 0x008A, 0x008B, 0x008C, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x008D,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x008D, 0x008E, 0x0004, 0x008F,
+    0x0004, 0x0004, 0x0090, 0x0091, 0x0004, 0x0004, 0x0004, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096,
+    0x0097, 0x0004, 0x0004, 0x0004, 0x0004, 0x0098, 0x0099, 0x009A, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x009B, 0x0004, 0x009C, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x009D, 0x009E, 0x0004, 0x0004, 0x0004, 0x008A, 0x0004, 0x009F,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x00A0, 0x00A1, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00A2,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0001, 0x0001, 0x00A3, 0x00A4, 0x00A5, 0x00A6,
+    0x00A7, 0x00A8, 0x0004, 0x0004, 0x00A9, 0x00AA, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x008D,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00AB, 0x0004, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00A9, 0x00B2, 0x00A9,
+    0x00B3, 0x00B4, 0x00B5, 0x00A9, 0x00B2, 0x00A9, 0x00B3, 0x00B6, 0x00B7, 0x00A9, 0x00A9, 0x00B8,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00B9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x008D, 0x00BA,
+    0x00A9, 0x00B9, 0x00A9, 0x00A9, 0x00BB, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x00A9, 0x00BC, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00BD, 0x00A9, 0x00A9, 0x00A9, 0x00BE, 0x0004, 0x0004, 0x0076,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x00BF, 0x0004, 0x001F, 0x0004, 0x0004, 0x0004, 0x00A0, 0x00C0,
+    0x0004, 0x003B, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00C1, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x00C2, 0x0004, 0x00C3, 0x00C4, 0x0004, 0x0004, 0x0004, 0x00C5, 0x00C6, 0x0004, 0x0004, 0x0067,
+    0x00C7, 0x001F, 0x0001, 0x00C8, 0x001F, 0x0004, 0x00C9, 0x0004, 0x00CA, 0x002A, 0x005C, 0x00CB,
+    0x002A, 0x0004, 0x0004, 0x00CC, 0x00CD, 0x001F, 0x00CE, 0x001F, 0x0004, 0x0004, 0x00CF, 0x00D0,
+    0x00D1, 0x00D2, 0x0004, 0x00D3, 0x0004, 0x0004, 0x0004, 0x00D4, 0x0020, 0x0004, 0x001A, 0x00D5,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x00D6, 0x001F, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB,
+    0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA,
+    0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8,
+    0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9,
+    0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9,
+    0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9,
+    0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB,
+    0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA,
+    0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8,
+    0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9,
+    0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9,
+    0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9,
+    0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB,
+    0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA,
+    0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8,
+    0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9,
+    0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9,
+    0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00D9, 0x00DB, 0x00D9, 0x00D7, 0x00D8, 0x00D9,
+    0x00DA, 0x00D9, 0x00DC, 0x005D, 0x00DD, 0x005F, 0x005F, 0x00DE, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0004, 0x00DF, 0x00E0, 0x00E1,
+    0x00E2, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00E3, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00E4, 0x0001, 0x00E5, 0x0001, 0x00E6,
+    0x00E7, 0x00E8, 0x00E9, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00EA,
+    0x00EB, 0x00EC, 0x00A9, 0x00ED, 0x00A9, 0x00EE, 0x00EF, 0x00F0, 0x00A9, 0x00F1, 0x00A9, 0x00B9,
+    0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00F6, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00F7,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x001C, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00F8,
+    0x0004, 0x00F9, 0x0004, 0x0004, 0x0004, 0x0062, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00FA, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00F9, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x00FB, 0x0004, 0x0004, 0x00FC, 0x0004, 0x00FD, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0040, 0x00FE, 0x0004, 0x0004, 0x0004, 0x00FF, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0100, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0101, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0022, 0x001C, 0x0004, 0x0004, 0x0065, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0073, 0x0004, 0x0004, 0x0027, 0x0102, 0x0004, 0x0035, 0x0103, 0x0073, 0x0004, 0x0004, 0x0104,
+    0x0105, 0x0004, 0x0004, 0x001F, 0x0073, 0x0004, 0x00CA, 0x0106, 0x0107, 0x0004, 0x0004, 0x0108,
+    0x0073, 0x0004, 0x0004, 0x00CC, 0x0109, 0x010A, 0x0004, 0x0004, 0x0004, 0x0004, 0x010B, 0x010C,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x010D, 0x0004, 0x0004, 0x00A0, 0x0021, 0x001F,
+    0x002A, 0x0004, 0x0004, 0x0043, 0x0030, 0x0031, 0x010E, 0x003E, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x010F, 0x0110, 0x0111, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0001, 0x002A, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00A0, 0x0112, 0x0113, 0x0114, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0001, 0x0115, 0x001F, 0x0116, 0x0004, 0x0004, 0x0004, 0x001A, 0x0117,
+    0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0060, 0x006B, 0x0118, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x010B, 0x0021,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x001F, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0119, 0x011A, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x011B, 0x011C, 0x0004, 0x011D, 0x0004, 0x0004, 0x011E, 0x011F, 0x0120, 0x0004, 0x0004,
+    0x0028, 0x0121, 0x0122, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x00A0, 0x0123, 0x0124, 0x001F, 0x0004, 0x0125, 0x0004, 0x0126, 0x0052, 0x00D0,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0127, 0x0128, 0x001F, 0x0004, 0x0004,
+    0x0129, 0x012A, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x012B,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x012C, 0x012D, 0x00F9, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x012E,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x012F, 0x0004, 0x0004, 0x0130, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0131,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0132,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0133, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0134, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x001F, 0x0004, 0x0004, 0x0135, 0x0004, 0x0004, 0x0004, 0x0136, 0x0137, 0x001F, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0138, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x00A0, 0x0012, 0x0001, 0x0001, 0x0139, 0x0073, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x013A, 0x00C6, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00BB,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x013B, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x013C, 0x0004,
+    0x0004, 0x013D, 0x013E, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00AC, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x013F, 0x002A, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0001, 0x0001, 0x0140, 0x0001,
+    0x00D0, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0141, 0x0001,
+    0x0142, 0x0004, 0x0143, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0144, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0145, 0x0146, 0x0146, 0x0146,
+    0x0001, 0x0001, 0x0001, 0x0147, 0x0001, 0x0001, 0x0148, 0x00CE, 0x0149, 0x001A, 0x0012, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0123, 0x014A, 0x014B, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x00D0, 0x001F, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x014C, 0x0004, 0x0004, 0x0004, 0x010B, 0x014D, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x00D0, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x014E, 0x014F, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00E4, 0x012D, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x00A9, 0x00A9, 0x0150, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x0151, 0x0152, 0x0153, 0x0153, 0x0153, 0x00A9, 0x0154, 0x0092, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0092, 0x0004, 0x0004, 0x0004, 0x0155, 0x0156, 0x0156, 0x0156, 0x0157, 0x0158,
+    0x0159, 0x00A9, 0x00A9, 0x0150, 0x015A, 0x015B, 0x0154, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x015C, 0x015D, 0x00A9, 0x015E, 0x015F, 0x00A9, 0x00A9, 0x0160, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x0169, 0x00BE, 0x00B7, 0x016A, 0x016B, 0x00A9, 0x00A9, 0x016C, 0x00A9, 0x016D, 0x00A9, 0x00A9,
+    0x00A9, 0x016E, 0x00A9, 0x016F, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x0170, 0x0004, 0x0004, 0x0171,
+    0x00A9, 0x00A9, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0176, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0177, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0178, 0x0150, 0x0179,
+    0x017A, 0x0004, 0x0004, 0x0004, 0x017B, 0x017C, 0x0004, 0x0004, 0x017B, 0x0004, 0x017D, 0x015B,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x017E, 0x017F, 0x0180, 0x0181, 0x00A9, 0x00A9, 0x00A9, 0x0182,
+    0x00A9, 0x00A9, 0x00A9, 0x0183, 0x0184, 0x0185, 0x00A9, 0x00A9, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0177, 0x0186, 0x0187, 0x0188, 0x00A9, 0x0176, 0x0189, 0x018A, 0x018B, 0x018C, 0x018D,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x001F, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x018E, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9, 0x00A9,
+    0x00A9, 0x00A9, 0x00A9, 0x018F, 0x0020, 0x0004, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004,
+};
+
+static const uint8_t UCD_LINE_STAGE3[6400] = {
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x03, 0x01, 0x01, 0x02, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x05, 0x12, 0x16, 0x00, 0x1B, 0x1C, 0x00, 0x16, 0x15, 0x11, 0x00, 0x1B, 0x13, 0x0C, 0x13, 0x14,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x13, 0x13, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1B, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x10, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x0A, 0x15, 0x1C, 0x1B, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x0B, 0x00, 0x00,
+    0x1C, 0x1B, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x1B,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x08,
+    0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x13, 0x13, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x12, 0x08, 0x12, 0x12, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1C, 0x1A, 0x1A, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x13, 0x12, 0x00, 0x00, 0x00, 0x08, 0x1B, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x0B, 0x0B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0x00, 0x00, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x0D, 0x0D, 0x0D, 0x0D, 0x00, 0x0D, 0x0D, 0x0A, 0x0D, 0x0D, 0x0B, 0x0A, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x0A, 0x00, 0x12, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x08, 0x00, 0x08, 0x00, 0x08, 0x15, 0x10, 0x15, 0x10, 0x08, 0x08,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0x0D, 0x0B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08,
+    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x17, 0x00, 0x0B, 0x00, 0x0B, 0x1B, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x12, 0x0B, 0x0B, 0x0D, 0x00, 0x12, 0x12, 0x00, 0x08, 0x08, 0x08, 0x0A, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x0B, 0x0B, 0x00, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x00,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B,
+    0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x0B, 0x0B, 0x0B, 0x06, 0x08, 0x07, 0x08, 0x08,
+    0x0B, 0x0A, 0x0B, 0x0B, 0x0E, 0x00, 0x00, 0x00, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16, 0x15, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x0B, 0x01, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x16, 0x16, 0x00, 0x17, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x15, 0x10, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x0B, 0x0B, 0x0B,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x00,
+    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1B, 0x1B, 0x1C, 0x1B,
+    0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1D,
+    0x1D, 0x1D, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D,
+    0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1D, 0x1D, 0x1E, 0x1D, 0x00, 0x00, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x00, 0x12, 0x12, 0x1D, 0x00, 0x00, 0x00, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+    0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+    0x00, 0x00, 0x00, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15,
+    0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0B, 0x0B, 0x0B, 0x00, 0x12, 0x0B,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x0B, 0x15, 0x0B, 0x00, 0x00, 0x16, 0x16, 0x00, 0x00,
+    0x16, 0x16, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x00,
+    0x0B, 0x0B, 0x00, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0B, 0x0B, 0x0B, 0x00,
+    0x0B, 0x0B, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x12, 0x12, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x0B, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x10, 0x10, 0x1D, 0x1D, 0x17, 0x1D, 0x1D, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10,
+    0x55, 0x10, 0x1D, 0x1D, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x17, 0x55, 0x10, 0x10,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17, 0x1D, 0x1D, 0x1D,
+    0x00, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17, 0x00, 0x00, 0x08, 0x08, 0x17, 0x17, 0x17, 0x17, 0x1D,
+    0x17, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17, 0x17, 0x17, 0x1D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x12, 0x0B,
+    0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
+    0x0B, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x08, 0x08, 0x00, 0x00,
+    0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x08, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0x19, 0x00,
+    0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x13, 0x10, 0x10, 0x13, 0x13, 0x12, 0x12, 0x55, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x55,
+    0x10, 0x55, 0x10, 0x55, 0x10, 0x1D, 0x1D, 0x55, 0x10, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x10, 0x1D, 0x10, 0x00, 0x17, 0x17, 0x12, 0x12, 0x1D, 0x55, 0x10, 0x55, 0x10, 0x55, 0x10, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1D, 0x1B, 0x1C, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x12, 0x1D, 0x1D, 0x1B, 0x1C, 0x1D, 0x1D, 0x55, 0x10, 0x1D, 0x1D, 0x10, 0x1D, 0x10, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17, 0x1D, 0x1D, 0x1D, 0x12,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x55, 0x1D, 0x10, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x55, 0x1D, 0x10, 0x1D, 0x55,
+    0x10, 0x10, 0x55, 0x10, 0x10, 0x17, 0x1D, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+    0x17, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0x17,
+    0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00,
+    0x1C, 0x1B, 0x1D, 0x1D, 0x1D, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0F, 0x00, 0x00, 0x00,
+    0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0B, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x00, 0x0B, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x0D, 0x00, 0x0B, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x00, 0x0B, 0x0B, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x0B, 0x0B, 0x00, 0x00, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x0D, 0x0B, 0x0B, 0x12, 0x12, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x0D,
+    0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x00, 0x0D, 0x0D,
+    0x0D, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x10, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x17, 0x17, 0x17, 0x17, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0B,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x1A,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D,
+    0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1D, 0x1D, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E,
+    0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x00, 0x1D, 0x00, 0x1D, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x00,
+    0x1D, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1D, 0x1D, 0x1E,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1D, 0x1E, 0x1E, 0x1D, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E,
+    0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x00, 0x00,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x00, 0x00,
+};
+
+#define UCD_WIDTH_BITS2 6
+#define UCD_WIDTH_BITS3 4
+
+static const uint8_t UCD_WIDTH_STAGE1[1088] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0F, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x14,
+    0x15, 0x12, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1C, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1D, 0x1E, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x1F, 0x0D, 0x20, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x21, 0x22, 0x12, 0x12, 0x23,
+    0x12, 0x12, 0x12, 0x24, 0x25, 0x12, 0x26, 0x12, 0x27, 0x12, 0x28, 0x12, 0x29, 0x2A, 0x2B, 0x12,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x2C,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x2C,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x2D, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+};
+
+static const uint8_t UCD_WIDTH_STAGE2[2944] = {
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x05, 0x06, 0x01, 0x01, 0x01,
+    0x07, 0x08, 0x01, 0x01, 0x09, 0x00, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01,
+    0x02, 0x0D, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0A, 0x01, 0x01, 0x09, 0x10,
+    0x01, 0x11, 0x12, 0x01, 0x01, 0x13, 0x01, 0x01, 0x01, 0x14, 0x01, 0x01, 0x15, 0x00, 0x00, 0x00,
+    0x16, 0x01, 0x01, 0x17, 0x18, 0x19, 0x1A, 0x01, 0x0D, 0x01, 0x01, 0x1B, 0x1C, 0x01, 0x1A, 0x1D,
+    0x1E, 0x01, 0x01, 0x1B, 0x1F, 0x0D, 0x01, 0x20, 0x1E, 0x01, 0x01, 0x1B, 0x21, 0x01, 0x1A, 0x15,
+    0x0D, 0x01, 0x01, 0x22, 0x1C, 0x23, 0x1A, 0x01, 0x24, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01,
+    0x26, 0x01, 0x01, 0x27, 0x28, 0x23, 0x1A, 0x01, 0x0D, 0x01, 0x01, 0x22, 0x29, 0x01, 0x1A, 0x01,
+    0x2A, 0x01, 0x01, 0x2B, 0x1C, 0x01, 0x1A, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x2C, 0x2D, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x2E, 0x2F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x31, 0x01, 0x01, 0x01,
+    0x01, 0x32, 0x01, 0x33, 0x01, 0x01, 0x01, 0x34, 0x35, 0x36, 0x00, 0x37, 0x38, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x39, 0x3A, 0x01, 0x3B, 0x0A, 0x3C, 0x3D, 0x3E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x40, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x01, 0x01, 0x41, 0x42, 0x10, 0x01, 0x01,
+    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x01, 0x43, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x44, 0x45, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x46, 0x01, 0x01, 0x01, 0x47, 0x48, 0x49, 0x01, 0x01, 0x01, 0x00, 0x4A, 0x01, 0x01, 0x01,
+    0x4B, 0x01, 0x01, 0x4C, 0x24, 0x01, 0x09, 0x4B, 0x2A, 0x01, 0x4D, 0x01, 0x01, 0x01, 0x4E, 0x2A,
+    0x01, 0x01, 0x4F, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x52, 0x53,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x09, 0x01, 0x54, 0x01, 0x01, 0x01, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x0A,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x56, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x59,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5A,
+    0x01, 0x5B, 0x01, 0x01, 0x5C, 0x5D, 0x01, 0x5E, 0x01, 0x5F, 0x60, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x01, 0x66, 0x01, 0x67, 0x68, 0x01, 0x01, 0x01, 0x69, 0x01, 0x6A, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x6B, 0x01, 0x01, 0x01, 0x6C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x2A,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x6D, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x5D,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x6E, 0x01, 0x6F,
+    0x3F, 0x3F, 0x70, 0x71, 0x72, 0x3F, 0x3F, 0x3F, 0x3F, 0x73, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x74, 0x3F, 0x3F, 0x72, 0x3F, 0x3F, 0x3F, 0x3F, 0x71, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x5D, 0x3F,
+    0x3F, 0x71, 0x3F, 0x3F, 0x75, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x76, 0x3F, 0x3F, 0x3F, 0x77, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x78, 0x01, 0x79, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2A,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x7A, 0x01, 0x7B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7C, 0x01, 0x00, 0x7D,
+    0x01, 0x01, 0x7E, 0x01, 0x7F, 0x2A, 0x3F, 0x76, 0x16, 0x01, 0x01, 0x80, 0x01, 0x01, 0x81, 0x01,
+    0x01, 0x01, 0x82, 0x83, 0x84, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x01, 0x85, 0x0D, 0x01, 0x86, 0x38,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x87, 0x01,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x01, 0x1D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x88, 0x00, 0x3F, 0x3F, 0x89, 0x8A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x72, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x8B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x77, 0x13,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3E,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x8D, 0x01, 0x01, 0x8E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x8F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2B, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0F, 0x0A, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0D, 0x01, 0x01, 0x91, 0x92, 0x01, 0x01, 0x93, 0x2A, 0x01, 0x01, 0x94, 0x95, 0x01, 0x01, 0x01,
+    0x16, 0x01, 0x96, 0x97, 0x01, 0x01, 0x01, 0x98, 0x2A, 0x01, 0x01, 0x99, 0x9A, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x9B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x9C, 0x01,
+    0x2A, 0x01, 0x01, 0x2B, 0x0A, 0x01, 0x9D, 0x97, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x91, 0x2D, 0x1D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x9F, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA0, 0x0A, 0x86, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xA1, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA2, 0xA3, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x39, 0xA4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0xA5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xA6, 0x98, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA7, 0x0A, 0x01,
+    0xA8, 0x01, 0x01, 0xA9, 0xAA, 0xAB, 0x01, 0x01, 0x15, 0xAC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xAD, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAE, 0xAF, 0xB0, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xB1, 0xA3, 0x01, 0x01, 0x01, 0x01, 0xB2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB3,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xB4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x97,
+    0x01, 0x01, 0x01, 0x92, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x16, 0x01, 0x01, 0x01, 0x01, 0xB5, 0xB6,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x75,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x6E, 0x01, 0x01,
+    0xB7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB8,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0xB9, 0x01, 0x01, 0xB9, 0xBA, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x6F,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xBB, 0x4B, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0xBC, 0x00, 0x92, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xBD, 0xBE, 0xBF, 0x01, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x40, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x37, 0x81, 0xC2, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xC3, 0xC4, 0xC5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x92, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1D, 0x01, 0x01, 0x01, 0x4F, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x92, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0xC6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x62, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5E, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC7, 0xC8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xB9, 0x3F, 0x3F, 0x6F, 0xB7, 0xB6, 0x6E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3F, 0x3F, 0xC9, 0xCA, 0x3F, 0x3F, 0x3F, 0xCB, 0x3F, 0x5D, 0x3F, 0x3F, 0xCC, 0x5D, 0x3F, 0xCD,
+    0x3F, 0x3F, 0x3F, 0x71, 0xCE, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0xCF,
+    0x3F, 0x3F, 0x3F, 0xD0, 0xD1, 0x3F, 0x75, 0x63, 0x01, 0xD2, 0x62, 0x01, 0x01, 0x01, 0x01, 0xD3,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x3F, 0x3F, 0x3F, 0x3F, 0xD4, 0xD5, 0x6B, 0xD6,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6F, 0x8B,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xD7, 0x3F, 0x3F, 0xD8, 0xCA, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xD9, 0x77, 0x3F, 0x76, 0xDA, 0x6E, 0x88, 0x75, 0x77,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0xD0,
+    0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static const uint8_t UCD_WIDTH_STAGE3[3504] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
@@ -3,6 +3,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <errno.h>
+#include <limits.h>
 
 #define TEST_X_TO_Y(str, X, Y, path)                                                                                                      \
     do {                                                                                                                            \
@@ -76,6 +78,790 @@ void test_utf8(utf8_char_t *str, const char *path_16, const char *path_32)
     TEST_X_TO_Y(str, 8, 32, path_32);
 }
 
+void test_optimistic(utf8_char_t *str)
+{
+    size_t length = strlen_utf8(str);
+    utf16_char_t *buffer = calloc(length + 1, sizeof(utf16_char_t));
+    utf16_char_t *reference = calloc(length + 1, sizeof(utf16_char_t));
+
+    if (!buffer || !reference)
+    {
+        perror("calloc");
+        free(buffer);
+        free(reference);
+        return;
+    }
+
+    size_t converted_length = length;
+    int status;
+
+    size_t converted = enc_utf8_to_utf16_optimistic(buffer, &converted_length, str, length, &status, false);
+
+    printf("Optimistic conversion, length: %zu, converted: %zu, consumed: %zu, status: %d\n", length, converted, converted_length, status);
+
+    // Everything before the first error should convert the same as the regular conversion, which
+    //   also reports the first error the same way validation does.
+    size_t reference_length = length;
+    size_t reference_converted = enc_utf8_to_utf16(reference, &reference_length, str, converted, false);
+
+    bool matches = (reference_converted == converted && reference_length == converted_length &&
+        !memcmp(buffer, reference, converted_length * sizeof(utf16_char_t)));
+
+    printf("Matches enc_utf8_to_utf16? %s, validation status: %d\n\n", (matches ? "yes" : "no"), utf8_validate(str, false));
+
+    free(buffer);
+    free(reference);
+}
+
+void test_replace(utf8_char_t *str)
+{
+    size_t length = strlen_utf8(str);
+
+    // Each bad char could become a 3 char replacement.
+    utf8_char_t *buffer = calloc(length * 3 + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = length * 3;
+    enc_utf8_to_utf8_repl(buffer, &converted_length, str, length, 0xFFFD, false, false);
+
+    printf("Replaced: '%s' (%zu chars)\n", buffer, converted_length);
+
+    // Collapsing should write one replacement for the whole bad run.
+    memset(buffer, 0, length * 3 + 1);
+    converted_length = length * 3;
+    enc_utf8_to_utf8_repl(buffer, &converted_length, str, length, 0xFFFD, true, false);
+
+    printf("Collapsed: '%s' (%zu chars)\n", buffer, converted_length);
+
+    // Replacements which can't be encoded fall back to U+FFFD.
+    memset(buffer, 0, length * 3 + 1);
+    converted_length = length * 3;
+    enc_utf8_to_utf8_repl(buffer, &converted_length, str, length, 0xD800, true, false);
+
+    printf("Surrogate replacement: '%s' (valid? %s)\n", buffer, (utf8_validate(buffer, false) ? "no" : "yes"));
+
+    memset(buffer, 0, length * 3 + 1);
+    converted_length = length * 3;
+    enc_utf8_to_utf8_repl(buffer, &converted_length, str, length, 0x110000, true, false);
+
+    printf("Out of range replacement: '%s' (valid? %s)\n\n", buffer, (utf8_validate(buffer, false) ? "no" : "yes"));
+
+    free(buffer);
+}
+
+void test_copy(utf8_char_t *str)
+{
+    size_t length = strlen_utf8(str);
+    utf8_char_t *buffer = calloc(length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    int result = utf8_validate_copy(buffer, str, length);
+
+    printf("Copy valid? %s (%d), equal? %s\n\n", (result ? "no" : "yes"), result, (memcmp(buffer, str, length) ? "no" : "yes"));
+
+    free(buffer);
+}
+
+void test_lines(utf8_char_t *str)
+{
+    utf8_line_error_t *errors;
+    size_t error_count;
+
+    if (!utf8_validate_lines(str, strlen_utf8(str), 2, &errors, &error_count))
+    {
+        perror("utf8_validate_lines");
+        return;
+    }
+
+    printf("Invalid lines: %zu\n", error_count);
+
+    for (size_t i = 0; i < error_count; i++)
+        printf("Line %zu (offset %zu, length %zu): %d\n", errors[i].line, errors[i].offset, errors[i].length, errors[i].status);
+
+    printf("\n");
+    free(errors);
+}
+
+void test_partition(utf8_char_t *str, size_t clean_capacity)
+{
+    utf8_line_error_t *errors;
+    size_t error_count;
+    size_t length = strlen_utf8(str);
+
+    if (!utf8_validate_lines(str, length, 2, &errors, &error_count))
+    {
+        perror("utf8_validate_lines");
+        return;
+    }
+
+    utf8_char_t clean[64];
+    utf8_char_t quarantine[64];
+    size_t clean_size = clean_capacity;
+    size_t quarantine_size = sizeof(quarantine);
+
+    size_t partitioned = utf8_partition_lines(clean, &clean_size, quarantine, &quarantine_size, str, length, errors, error_count);
+
+    printf("Partitioned: %zu of %zu, clean buffer: %zu\n", partitioned, length, clean_capacity);
+    printf("Clean (%zu): '%.*s'\n", clean_size, (int)clean_size, (char *)clean);
+    printf("Quarantine (%zu): '%.*s'\n\n", quarantine_size, (int)quarantine_size, (char *)quarantine);
+
+    free(errors);
+}
+
+void test_index(utf8_char_t *str)
+{
+    size_t length = strlen_utf8(str);
+
+    // Make a copy we can edit.
+    utf8_char_t *buffer = calloc(length + 2, sizeof(utf8_char_t));
+    utf8_index_t index;
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    if (!utf8_index_build(&index, str, length))
+    {
+        perror("utf8_index_build");
+        free(buffer);
+        return;
+    }
+
+    memcpy(buffer, str, length);
+
+    printf("Index codepoints: %zu, UTF-16 length: %zu, valid? %s\n", index.codepoints, index.utf16_length, (utf8_index_validate(&index) ? "no" : "yes"));
+
+    // Insert a stray trailing char at the start of the buffer.
+    memmove(buffer + 1, buffer, length);
+    buffer[0] = 0x80;
+
+    utf8_index_update(&index, buffer, length + 1, 0, 0, 1);
+    printf("After inserting 0x80, codepoints: %zu, valid? %s\n", index.codepoints, (utf8_index_validate(&index) ? "no" : "yes"));
+
+    // And take it back out again.
+    memmove(buffer, buffer + 1, length);
+
+    utf8_index_update(&index, buffer, length, 0, 1, 0);
+    printf("After removing it, codepoints: %zu, valid? %s\n\n", index.codepoints, (utf8_index_validate(&index) ? "no" : "yes"));
+
+    utf8_index_free(&index);
+    free(buffer);
+}
+
+// Check an updated index has the same totals as one built over the whole buffer.
+void test_index_matches(const char *edit, utf8_index_t *index, utf8_char_t *buffer, size_t length)
+{
+    utf8_index_t rebuilt;
+
+    if (!utf8_index_build(&rebuilt, buffer, length))
+    {
+        perror("utf8_index_build");
+        return;
+    }
+
+    bool matches = (index->length == rebuilt.length && index->codepoints == rebuilt.codepoints &&
+        index->utf16_length == rebuilt.utf16_length && utf8_index_validate(index) == utf8_index_validate(&rebuilt));
+
+    printf("%s: %zu blocks, codepoints: %zu, valid? %s, matches rebuild? %s\n", edit, index->block_count, index->codepoints,
+        (utf8_index_validate(index) ? "no" : "yes"), (matches ? "yes" : "no"));
+
+    utf8_index_free(&rebuilt);
+}
+
+void test_index_blocks(utf8_char_t *str, size_t copies)
+{
+    size_t str_length = strlen_utf8(str);
+    size_t length = str_length * copies;
+
+    // Leave room for the inserted chars.
+    utf8_char_t *buffer = calloc(length + str_length + 1, sizeof(utf8_char_t));
+    utf8_index_t index;
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    for (size_t i = 0; i < copies; i++)
+        memcpy(buffer + i * str_length, str, str_length);
+
+    if (!utf8_index_build(&index, buffer, length))
+    {
+        perror("utf8_index_build");
+        free(buffer);
+        return;
+    }
+
+    test_index_matches("Built", &index, buffer, length);
+
+    // Replace a stretch spanning several blocks with a copy of the string, starting in the middle of a sequence.
+    size_t offset = length / 4 + 2;
+    size_t removed = length / 2;
+
+    memmove(buffer + offset + str_length, buffer + offset + removed, length - offset - removed);
+    memcpy(buffer + offset, str, str_length);
+    length = length - removed + str_length;
+
+    utf8_index_update(&index, buffer, length, offset, removed, str_length);
+    test_index_matches("After replacing across blocks", &index, buffer, length);
+
+    // Remove the first char, before the gap.
+    memmove(buffer, buffer + 1, length - 1);
+    length--;
+
+    utf8_index_update(&index, buffer, length, 0, 1, 0);
+    test_index_matches("After removing the first char", &index, buffer, length);
+
+    // And append it at the very end, after the gap.
+    buffer[length] = str[0];
+    length++;
+
+    utf8_index_update(&index, buffer, length, length - 1, 0, 1);
+    test_index_matches("After appending a char", &index, buffer, length);
+    printf("\n");
+
+    utf8_index_free(&index);
+    free(buffer);
+}
+
+void test_mbstowcs(utf8_char_t *str)
+{
+    // Count first, like with the C library functions.
+    size_t length = uniconv_mbstowcs(NULL, (const char *)str, 0);
+
+    if (length == (size_t)-1)
+    {
+        printf("Conversion failed: %s\n\n", strerror(errno));
+        return;
+    }
+
+    wchar_t *buffer = calloc(length + 1, sizeof(wchar_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    uniconv_mbstowcs(buffer, (const char *)str, length + 1);
+
+    // Round trip back to UTF-8.
+    size_t mb_length = uniconv_wcstombs(NULL, buffer, 0);
+    char *mb_buffer = calloc(mb_length + 1, sizeof(char));
+
+    if (!mb_buffer)
+    {
+        perror("calloc");
+        free(buffer);
+
+        return;
+    }
+
+    uniconv_wcstombs(mb_buffer, buffer, mb_length + 1);
+
+    printf("Wide length: %zu, multibyte length: %zu, round trip: '%s'\n\n", length, mb_length, mb_buffer);
+
+    free(mb_buffer);
+    free(buffer);
+}
+
+void test_mbrtowc(const char *str)
+{
+    // Copy the string into a buffer of exactly its size, so reading past the NULL char is caught.
+    size_t length = strlen(str) + 1;
+    char *buffer = malloc(length);
+
+    if (!buffer)
+    {
+        perror("malloc");
+        return;
+    }
+
+    memcpy(buffer, str, length);
+
+    uniconv_mbstate_t state = { 0 };
+    const char *s = buffer;
+    size_t wide_count = 0;
+    size_t count;
+    wchar_t wc;
+
+    // Always allow a whole sequence, like callers passing MB_LEN_MAX do.
+    while ((count = uniconv_mbrtowc(&wc, s, MB_LEN_MAX, &state)) != 0)
+    {
+        if (count == (size_t)-1 || count == (size_t)-2)
+            break;
+
+        s += count;
+        wide_count++;
+    }
+
+    const char *result = ((count == (size_t)-1) ? "invalid" : ((count == (size_t)-2) ? "incomplete" : "end"));
+
+    printf("Wide chars: %zu, result: %s, stopped at char: %zu of %zu\n", wide_count, result, (size_t)(s - buffer), length);
+
+    free(buffer);
+}
+
+void test_iconv(utf8_char_t *str, const char *tocode)
+{
+    uniconv_iconv_t cd = uniconv_iconv_open(tocode, "UTF-8");
+
+    if (cd == (uniconv_iconv_t)-1)
+    {
+        perror("uniconv_iconv_open");
+        return;
+    }
+
+    // Deliberately small, to show how a full buffer is reported.
+    char buffer[16];
+
+    char *in = (char *)str;
+    char *out = buffer;
+    size_t in_size = strlen_utf8(str);
+    size_t out_size = sizeof(buffer);
+
+    size_t result = uniconv_iconv(cd, &in, &in_size, &out, &out_size);
+
+    printf("To %s, result: %zd (%s), read: %td, written: %td\n\n", tocode, result, ((result == (size_t)-1) ? strerror(errno) : "ok"),
+           in - (char *)str, out - buffer);
+
+    uniconv_iconv_close(cd);
+}
+
+void test_mutf8(utf8_char_t *str, size_t length)
+{
+    // Every UTF-8 char becomes at most 2 Modified UTF-8 chars (NULL chars and 4 char sequences).
+    utf8_char_t *buffer = calloc(2 * length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = 2 * length;
+    int status;
+
+    size_t converted = enc_utf8_to_mutf8(buffer, &converted_length, str, length, &status, false);
+
+    printf("Modified UTF-8, length: %zu, converted: %zu, encoded length: %zu, status: %d\n", length, converted, converted_length, status);
+
+    // Convert back to make sure nothing changed.
+    utf8_char_t *round_trip = calloc(length + 1, sizeof(utf8_char_t));
+
+    if (!round_trip)
+    {
+        perror("calloc");
+        free(buffer);
+
+        return;
+    }
+
+    size_t round_trip_length = length;
+    enc_mutf8_to_utf8(round_trip, &round_trip_length, buffer, converted_length, &status, false);
+
+    printf("Round trip matches? %s\n\n", ((round_trip_length == length && !memcmp(round_trip, str, length)) ? "yes" : "no"));
+
+    free(round_trip);
+    free(buffer);
+}
+
+void test_wtf8(utf16_char_t *str, size_t length)
+{
+    // Every UTF-16 char becomes at most 3 WTF-8 chars.
+    utf8_char_t *buffer = calloc(3 * length + 1, sizeof(utf8_char_t));
+    utf16_char_t *round_trip = calloc(length + 1, sizeof(utf16_char_t));
+
+    if (!buffer || !round_trip)
+    {
+        perror("calloc");
+
+        free(round_trip);
+        free(buffer);
+
+        return;
+    }
+
+    size_t converted_length = 3 * length;
+    enc_utf16_to_wtf8(buffer, &converted_length, str, length, false);
+
+    size_t round_trip_length = length;
+    int status;
+
+    enc_wtf8_to_utf16(round_trip, &round_trip_length, buffer, converted_length, &status, false);
+
+    printf("WTF-8 length: %zu, round trip matches? %s\n", converted_length,
+           ((round_trip_length == length && !memcmp(round_trip, str, length * sizeof(utf16_char_t))) ? "yes" : "no"));
+
+    size_t replaced = utf16_fix_lone_surrogates(round_trip, round_trip_length, false);
+    printf("Lone surrogates replaced: %zu, valid now? %s\n\n", replaced, (utf16_validate(round_trip, false) ? "no" : "yes"));
+
+    free(round_trip);
+    free(buffer);
+}
+
+void test_codepage(uint8_t *str, size_t length, const char *name)
+{
+    const uniconv_codepage_t *codepage = uniconv_codepage(name);
+
+    if (!codepage)
+    {
+        printf("Unknown codepage '%s'\n\n", name);
+        return;
+    }
+
+    // Every codepage char is a BMP codepoint, so it takes at most 3 UTF-8 chars.
+    utf8_char_t *buffer = calloc(3 * length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = 3 * length;
+    int status;
+
+    size_t converted = enc_codepage_to_utf8(buffer, &converted_length, str, length, codepage, &status, false);
+
+    printf("From %s, converted: %zu, status: %d, result: '%s'\n\n", uniconv_codepage_name(codepage), converted, status, buffer);
+
+    free(buffer);
+}
+
+void test_cjk(uint8_t *str, size_t length, const char *name)
+{
+    const uniconv_cjk_t *encoding = uniconv_cjk(name);
+
+    if (!encoding)
+    {
+        printf("Unknown encoding '%s'\n\n", name);
+        return;
+    }
+
+    // A char takes at most 4 UTF-8 chars, and never fewer source chars than that.
+    utf8_char_t *buffer = calloc(4 * length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    // Feed the string one char at a time, to show lead chars being held between calls.
+    uniconv_cjk_state_t state = {0};
+    size_t total_length = 0;
+    size_t converted = 0;
+    int status = 0;
+
+    while (converted < length && !status)
+    {
+        size_t converted_length = 4 * length - total_length;
+
+        converted += enc_cjk_to_utf8(buffer + total_length, &converted_length, str + converted, 1, encoding, &state, &status, false);
+        total_length += converted_length;
+    }
+
+    printf("From %s, converted: %zu, status: %d, pending: %u, result: '%s'\n\n", uniconv_cjk_name(encoding), converted, status, state.pending_count, buffer);
+
+    free(buffer);
+}
+
+void test_json(utf8_char_t *str, size_t length)
+{
+    // A control char becomes a 6 char \u escape, which is as long as escapes get.
+    utf8_char_t *buffer = calloc(6 * length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = 6 * length;
+    int status;
+
+    size_t converted = enc_utf8_to_json(buffer, &converted_length, str, length, &status, false);
+
+    printf("JSON escaped, converted: %zu, status: %d, result: \"%s\"\n", converted, status, buffer);
+
+    // Unescape it again, which always takes fewer chars.
+    utf8_char_t *round_trip = calloc(converted_length + 1, sizeof(utf8_char_t));
+
+    if (!round_trip)
+    {
+        perror("calloc");
+        free(buffer);
+
+        return;
+    }
+
+    size_t round_trip_length = converted_length;
+    enc_json_to_utf8(round_trip, &round_trip_length, buffer, converted_length, &status, false);
+
+    printf("Round trip, status: %d, matches: %s\n\n", status, (round_trip_length == length && !memcmp(round_trip, str, length)) ? "yes" : "no");
+
+    free(round_trip);
+    free(buffer);
+}
+
+void test_url(const char *url)
+{
+    size_t length = strlen(url);
+
+    // Decoding never makes anything longer.
+    utf8_char_t *buffer = calloc(length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = length;
+    int status;
+
+    size_t converted = enc_url_to_utf8(buffer, &converted_length, (utf8_char_t *)url, length, &status, false);
+
+    printf("URL '%s', converted: %zu, status: %d, result: '%s'\n\n", url, converted, status, buffer);
+
+    free(buffer);
+}
+
+void test_log(utf8_char_t *str, size_t length)
+{
+    // An invalid char becomes a 4 char escape, and a C1 control char (2 chars) a 6 char escape.
+    utf8_char_t *buffer = calloc(4 * length + 1, sizeof(utf8_char_t));
+
+    if (!buffer)
+    {
+        perror("calloc");
+        return;
+    }
+
+    size_t converted_length = 4 * length;
+    size_t converted = enc_utf8_to_log(buffer, &converted_length, str, length, false);
+
+    printf("Log safe, converted: %zu, result: '%s'\n\n", converted, buffer);
+
+    free(buffer);
+}
+
+void test_idna(const char *host)
+{
+    utf8_char_t ascii[256] = {0};
+    utf8_char_t round_trip[256] = {0};
+    size_t length = strlen(host);
+    size_t ascii_length = sizeof(ascii) - 1;
+    size_t round_trip_length = sizeof(round_trip) - 1;
+    int status;
+
+    size_t converted = enc_utf8_to_idna(ascii, &ascii_length, (utf8_char_t *)host, length, &status, false);
+
+    printf("IDNA '%s', converted: %zu, status: %d, result: '%s'\n", host, converted, status, ascii);
+
+    enc_idna_to_utf8(round_trip, &round_trip_length, ascii, ascii_length, &status, false);
+
+    printf("Round trip, status: %d, result: '%s'\n\n", status, round_trip);
+}
+
+void test_properties(utf8_char_t *str)
+{
+    static const char *CATEGORY_NAMES[] = {
+        "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps",
+        "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+    };
+
+    unicode_properties_t properties[64];
+    size_t property_count = 64;
+    int status;
+
+    size_t converted = utf8_properties(properties, &property_count, str, strlen((char *)str), &status, false);
+
+    printf("Properties, converted: %zu, status: %d\n", converted, status);
+
+    for (size_t i = 0; i < property_count; i++)
+        printf("  %s %-8s %02X\n", CATEGORY_NAMES[properties[i].category], unicode_script_name(properties[i].script), properties[i].properties);
+
+    printf("\n");
+}
+
+void test_casefold(utf8_char_t *str, utf8_char_t *other)
+{
+    utf8_char_t folded[64] = {0};
+    size_t folded_length = 63;
+    int status;
+
+    size_t converted = utf8_casefold(folded, &folded_length, str, strlen((char *)str), true, &status, false);
+
+    printf("Case folding, converted: %zu, length: %zu, status: %d, result: '%s'\n", converted, folded_length, status, folded);
+
+    int order = utf8_casecmp(str, strlen((char *)str), other, strlen((char *)other), false);
+
+    printf("Compared to '%s': %d\n\n", other, order);
+}
+
+void test_normalize(utf8_char_t *str, int form, const char *name)
+{
+    utf8_char_t normalized[64] = {0};
+    size_t normalized_length = 63;
+    int status;
+
+    size_t length = strlen((char *)str);
+    size_t prefix = utf8_normalized_prefix(str, length, form, &status, false);
+    size_t converted = utf8_normalize(normalized, &normalized_length, str, length, form, &status, false);
+
+    printf("%s, normalized prefix: %zu of %zu, converted: %zu, length: %zu, status: %d, result: '%s'\n\n",
+           name, prefix, length, converted, normalized_length, status, normalized);
+}
+
+void test_graphemes(utf8_char_t *str)
+{
+    size_t length = strlen((char *)str);
+    size_t count = SIZE_MAX;
+
+    utf8_grapheme_advance(str, length, &count, false);
+
+    printf("Grapheme clusters: %zu, chars: %zu\n", count, length);
+
+    for (size_t i = 0, cluster_length; i < length; i += cluster_length)
+    {
+        cluster_length = utf8_grapheme_next(str + i, length - i, false);
+        printf("  '%.*s' (%zu chars)\n", (int)cluster_length, (char *)(str + i), cluster_length);
+    }
+
+    printf("\n");
+}
+
+void test_words(utf8_char_t *str)
+{
+    unicode_span_t spans[16];
+    size_t span_count = 16;
+
+    size_t length = strlen((char *)str);
+    size_t converted = utf8_words(spans, &span_count, str, length, true, false);
+
+    printf("Words: %zu, converted: %zu of %zu\n", span_count, converted, length);
+
+    for (size_t i = 0; i < span_count; i++)
+        printf("  %zu+%zu '%.*s'\n", spans[i].offset, spans[i].length, (int)spans[i].length, (char *)(str + spans[i].offset));
+
+    printf("\n");
+}
+
+void test_line_breaks(utf8_char_t *str)
+{
+    uint8_t breaks[16];
+    uint8_t mandatory[16];
+
+    size_t length = strlen((char *)str);
+    size_t count = utf8_line_breaks(breaks, mandatory, str, length, false);
+
+    printf("Line break opportunities: %zu\n", count);
+
+    // Print each piece of text between two opportunities, marking the mandatory breaks.
+    for (size_t i = 0, start = 0; i <= length; i++)
+    {
+        if (i > start && (breaks[i / 8] & (1 << (i % 8))))
+        {
+            printf("  '%.*s'%s\n", (int)(i - start), (char *)(str + start), ((mandatory[i / 8] & (1 << (i % 8))) ? " !" : ""));
+            start = i;
+        }
+    }
+
+    printf("\n");
+}
+
+void test_display_width(utf8_char_t *str, size_t max_width)
+{
+    size_t length = strlen((char *)str);
+    size_t width = utf8_display_width(str, length, false);
+
+    size_t truncated_width;
+    size_t truncated = utf8_truncate_to_width(str, length, max_width, &truncated_width, false);
+
+    printf("Display width: %zu, truncated to %zu columns: '%.*s' (%zu columns)\n", width, max_width, (int)truncated, (char *)str, truncated_width);
+}
+
+void test_binary(utf8_char_t *str, size_t length)
+{
+    utf16_char_t buffer[16];
+    size_t converted_length = 16;
+
+    // Only the binary-safe conversion should convert past the NULL char.
+    size_t converted = enc_utf8_to_utf16_bin(buffer, &converted_length, str, length, false);
+
+    printf("Binary conversion, length: %zu, converted: %zu, consumed: %zu\n", length, converted, converted_length);
+
+    converted_length = 16;
+    converted = enc_utf8_to_utf16(buffer, &converted_length, str, length, false);
+
+    printf("Regular conversion, length: %zu, converted: %zu, consumed: %zu\n\n", length, converted, converted_length);
+}
+
+void test_binary_small(void)
+{
+    // The emoji takes 2 UTF-16 chars and the euro sign takes 3 UTF-8 chars, which don't fit after the 'a'.
+    utf8_char_t utf8_src[6] = {0x61, 0xF0, 0x9F, 0x98, 0x80, 0x7A};
+    utf16_char_t utf16_src[3] = {0x61, 0x20AC, 0x7A};
+    utf32_char_t utf32_src[3] = {0x61, 0x1F600, 0x7A};
+
+    utf16_char_t utf16_buffer[2] = {0};
+    utf8_char_t utf8_buffer[2] = {0};
+
+    size_t converted_length = 2;
+    size_t converted = enc_utf8_to_utf16_bin(utf16_buffer, &converted_length, utf8_src, 6, false);
+
+    printf("UTF-8 to UTF-16 into 2 chars, converted: %zu, consumed: %zu, dest: %04X %04X\n", converted, converted_length, utf16_buffer[0], utf16_buffer[1]);
+
+    converted_length = 2;
+    converted = enc_utf16_to_utf8_bin(utf8_buffer, &converted_length, utf16_src, 3, false);
+
+    printf("UTF-16 to UTF-8 into 2 chars, converted: %zu, consumed: %zu, dest: %02X %02X\n", converted, converted_length, utf8_buffer[0], utf8_buffer[1]);
+
+    converted_length = 2;
+    converted = enc_utf32_to_utf16_bin(utf16_buffer, &converted_length, utf32_src, 3, false);
+
+    printf("UTF-32 to UTF-16 into 2 chars, converted: %zu, consumed: %zu\n", converted, converted_length);
+
+    converted_length = 2;
+    converted = enc_utf32_to_utf8_bin(utf8_buffer, &converted_length, utf32_src, 3, false);
+
+    printf("UTF-32 to UTF-8 into 2 chars, converted: %zu, consumed: %zu\n\n", converted, converted_length);
+}
+
+void test_profile(utf8_char_t *str, const char *name, unsigned profile)
+{
+    int result = utf8_validate_profile(str, profile, false);
+
+    printf("Valid under %s profile? %s (%d)\n", name, (result ? "no" : "yes"), result);
+}
+
+void test_strip(utf8_char_t *str, unsigned profile)
+{
+    utf8_char_t buffer[64];
+    size_t converted_length = 64;
+    int status;
+
+    size_t length = strlen((char *)str);
+    size_t converted = utf8_strip_profile(buffer, &converted_length, str, length, profile, &status, false);
+
+    printf("Stripped: '%.*s', length: %zu of %zu, converted: %zu, status: %d\n", (int)converted_length, (char *)buffer, converted_length, length, converted, status);
+}
+
 int main(int argc, const char *const *argv)
 {
     utf8_char_t *good_string_1 = (utf8_char_t *)"H¢llo, 試看看這個嘛, 😁。😁";
@@ -105,5 +891,207 @@ int main(int argc, const char *const *argv)
     printf("--> Bad string 3: '%s'\n", bad_string_3);
     test_utf8(bad_string_3, "bad.3.16", "bad.3.32");
 
+    // This has a NULL char in the middle of it.
+    utf8_char_t binary_string[6] = {0x61, 0x00, 0xC2, 0xA2, 0x62, 0x00};
+
+    printf("--> Binary string: 'a\\0¢b'\n");
+    test_binary(binary_string, 5);
+
+    printf("--> Binary conversion into a small buffer\n");
+    test_binary_small();
+
+    // This has a right-to-left override in it.
+    utf8_char_t bidi_string[7] = {0x61, 0xE2, 0x80, 0xAE, 0x62, 0x0A, 0x00};
+
+    printf("--> Profiles for 'a<RLO>b\\n'\n");
+    test_profile(bidi_string, "empty", 0);
+    test_profile(bidi_string, "XML 1.0", UNICODE_PROFILE_XML10);
+    test_profile(bidi_string, "controls", UNICODE_PROFILE_CONTROLS);
+    test_profile(bidi_string, "bidi", UNICODE_PROFILE_BIDI);
+    printf("\n");
+
+    // This has a zero width space in it.
+    utf8_char_t invisible_string[7] = {0x61, 0xE2, 0x80, 0x8B, 0x62, 0x0A, 0x00};
+
+    printf("--> Profiles for 'a<ZWSP>b\\n'\n");
+    test_profile(invisible_string, "bidi", UNICODE_PROFILE_BIDI);
+    test_profile(invisible_string, "invisible", UNICODE_PROFILE_INVISIBLE);
+    printf("\n");
+
+    // One char from each profile class. Each should only be rejected by the profiles covering it.
+    struct {
+        const char *codepoint;
+        const char *name;
+        utf8_char_t *str;
+        unsigned profile;
+    } profile_classes[] = {
+        { "U+FDD0", "noncharacters", (utf8_char_t *)"a\xEF\xB7\x90" "b", UNICODE_PROFILE_NONCHARACTERS },
+        { "U+0085", "controls", (utf8_char_t *)"a\xC2\x85" "b", UNICODE_PROFILE_CONTROLS },
+        { "U+E000", "private use", (utf8_char_t *)"a\xEE\x80\x80" "b", UNICODE_PROFILE_PRIVATE_USE },
+        { "U+FFFE", "XML 1.0 and noncharacters", (utf8_char_t *)"a\xEF\xBF\xBE" "b", UNICODE_PROFILE_XML10 | UNICODE_PROFILE_NONCHARACTERS },
+        { "U+200E", "invisible", (utf8_char_t *)"a\xE2\x80\x8E" "b", UNICODE_PROFILE_INVISIBLE },
+    };
+    unsigned all_profiles = UNICODE_PROFILE_NONCHARACTERS | UNICODE_PROFILE_CONTROLS | UNICODE_PROFILE_PRIVATE_USE |
+        UNICODE_PROFILE_BIDI | UNICODE_PROFILE_XML10 | UNICODE_PROFILE_INVISIBLE;
+
+    for (size_t i = 0; i < sizeof(profile_classes) / sizeof(profile_classes[0]); i++)
+    {
+        printf("--> Profiles for 'a<%s>b'\n", profile_classes[i].codepoint);
+        test_profile(profile_classes[i].str, profile_classes[i].name, profile_classes[i].profile);
+        test_profile(profile_classes[i].str, "every other", all_profiles & ~profile_classes[i].profile);
+        printf("\n");
+    }
+
+    printf("--> Stripping bidi and invisible chars from 'if (a<RLO><LRI>) x<ZWSP>y<ZWJ>'\n");
+    test_strip((utf8_char_t *)"if (a\xE2\x80\xAE\xE2\x81\xA6) x\xE2\x80\x8By\xE2\x80\x8D", UNICODE_PROFILE_BIDI | UNICODE_PROFILE_INVISIBLE);
+    printf("\n");
+
+    printf("--> Optimistic conversion of good string 1\n");
+    test_optimistic(good_string_1);
+
+    printf("--> Optimistic conversion of bad string 3\n");
+    test_optimistic(bad_string_3);
+
+    // Long enough to go through the block by block conversion, which works on 64 char blocks.
+    // Good string 1 is 39 chars long.
+    utf8_char_t long_string[4 * 39 + 1] = { 0 };
+
+    for (size_t i = 0; i < 4; i++)
+        memcpy(long_string + i * 39, good_string_1, 39);
+
+    printf("--> Optimistic conversion of 4 copies of good string 1\n");
+    test_optimistic(long_string);
+
+    // Turn the ',' at 84 (in the middle of the second block) into an overlong lead char.
+    long_string[84] = 0xC0;
+
+    printf("--> Optimistic conversion of 4 copies of good string 1 with an error in the second block\n");
+    test_optimistic(long_string);
+
+    printf("--> Replacing bad string 1\n");
+    test_replace(bad_string_1);
+
+    printf("--> Replacing bad string 3\n");
+    test_replace(bad_string_3);
+
+    printf("--> Validating copy of good string 1\n");
+    test_copy(good_string_1);
+
+    printf("--> Validating copy of bad string 2\n");
+    test_copy(bad_string_2);
+
+    // Only the second line here is bad.
+    utf8_char_t *lines_string = (utf8_char_t *)"good line\nbad \xC0\xAE line\nanother good line\n";
+
+    printf("--> Validating lines\n");
+    test_lines(lines_string);
+
+    // The two good lines before the bad one take 22 chars.
+    utf8_char_t *partition_string = (utf8_char_t *)"good line\nsecond line\nbad \xC0\xAE line\nlast line";
+
+    printf("--> Partitioning lines\n");
+    test_partition(partition_string, 64);
+    test_partition(partition_string, 20);
+    test_partition(partition_string, 5);
+
+    printf("--> Incremental index: '%s'\n", good_string_1);
+    test_index(good_string_1);
+
+    printf("--> Incremental index over 1000 copies of good string 1\n");
+    test_index_blocks(good_string_1, 1000);
+
+    printf("--> C library style conversion of good string 1\n");
+    test_mbstowcs(good_string_1);
+
+    printf("--> C library style conversion of bad string 1\n");
+    test_mbstowcs(bad_string_1);
+
+    printf("--> Restartable conversion with MB_LEN_MAX of 'a', good string 1 and a truncated sequence\n");
+    test_mbrtowc("a");
+    test_mbrtowc((const char *)good_string_1);
+    test_mbrtowc("a\xE8\xA9");
+    printf("\n");
+
+    printf("--> iconv conversion of good string 1\n");
+    test_iconv(good_string_1, "UTF-16LE");
+    test_iconv(good_string_1, "ISO-8859-1");
+
+    printf("--> iconv conversion of good string 2\n");
+    test_iconv(good_string_2, "UTF-16");
+
+    printf("--> Modified UTF-8 conversion of good string 1\n");
+    test_mutf8(good_string_1, strlen_utf8(good_string_1));
+
+    printf("--> Modified UTF-8 conversion of binary string\n");
+    test_mutf8(binary_string, 5);
+
+    // A lone high surrogate, then a proper pair.
+    utf16_char_t lone_surrogate_string[6] = {0x0061, 0xD83D, 0x0062, 0xD83D, 0xDE01, 0x0000};
+
+    printf("--> WTF-8 round trip of 'a<D83D>b😁'\n");
+    test_wtf8(lone_surrogate_string, 5);
+
+    // "café €5" in two very different codepages.
+    uint8_t windows_1252_string[7] = {0x63, 0x61, 0x66, 0xE9, 0x20, 0x80, 0x35};
+    uint8_t ibm1140_string[7] = {0x83, 0x81, 0x86, 0x51, 0x40, 0x9F, 0xF5};
+
+    printf("--> Codepage conversions\n");
+    test_codepage(windows_1252_string, 7, "Windows-1252");
+    test_codepage(ibm1140_string, 7, "ibm1140");
+
+    // "日本語" and "中文😁" in their legacy encodings.
+    uint8_t shift_jis_string[6] = {0x93, 0xFA, 0x96, 0x7B, 0x8C, 0xEA};
+    uint8_t gb18030_string[8] = {0xD6, 0xD0, 0xCE, 0xC4, 0x94, 0x39, 0xFC, 0x37};
+
+    printf("--> CJK conversions, one char at a time\n");
+    test_cjk(shift_jis_string, 6, "Shift_JIS");
+    test_cjk(gb18030_string, 8, "GB18030");
+
+    utf8_char_t json_string[] = "say \"hi\"\\\t\x01 😁";
+
+    printf("--> JSON string escaping\n");
+    test_json(json_string, sizeof(json_string) - 1);
+
+    // Percent encoded dots decode like any other char, but bad string 3 is still overlong when percent encoded.
+    printf("--> URL decoding\n");
+    test_url("/caf%C3%A9/%2E%2E/");
+    test_url("/%C0%AE./");
+
+    printf("--> Log safe escaping of bad string 3 and a forged log line\n");
+    test_log(bad_string_3, 5);
+    test_log((utf8_char_t *)"user\r\nINFO admin\\ok", 19);
+
+    printf("--> IDNA host names\n");
+    test_idna("www.example.com");
+    test_idna("bücher.example");
+    test_idna("😁.試看看.tw");
+
+    printf("--> Character properties\n");
+    test_properties((utf8_char_t *)"Aé 試1😁");
+
+    printf("--> Case folding\n");
+    test_casefold((utf8_char_t *)"Straße ÀÉÎ", (utf8_char_t *)"STRASSE àéî");
+    test_casefold((utf8_char_t *)"ΣΊΣΥΦΟΣ", (utf8_char_t *)"σίσυφος");
+
+    printf("--> Normalization\n");
+    test_normalize((utf8_char_t *)"Crème brûlée", UNICODE_NORMALIZATION_NFC, "NFC");
+    test_normalize((utf8_char_t *)"Cre\xCC\x80" "me bru\xCC\x82" "le\xCC\x81" "e", UNICODE_NORMALIZATION_NFC, "NFC");
+    test_normalize((utf8_char_t *)"Crème brûlée", UNICODE_NORMALIZATION_NFD, "NFD");
+    test_normalize((utf8_char_t *)"한국어", UNICODE_NORMALIZATION_NFD, "NFD");
+
+    printf("--> Grapheme clusters\n");
+    test_graphemes((utf8_char_t *)"Cafe\xCC\x81\r\n🇹🇼👩‍👩‍👧 한");
+
+    printf("--> Words\n");
+    test_words((utf8_char_t *)"Can't stop: 3.14, e.g. ドーナツ and 中文!");
+
+    printf("--> Line breaks\n");
+    test_line_breaks((utf8_char_t *)"A well-known fact (costs $3.50) 日本語です。\nNext line");
+
+    printf("--> Display width\n");
+    test_display_width((utf8_char_t *)"Plain ASCII", 5);
+    test_display_width((utf8_char_t *)"日本語 text", 5);
+    test_display_width((utf8_char_t *)"Cafe\xCC\x81 \xF0\x9F\x98\x80!", 4);
+
     return 0;
 }
@@ -4,12 +4,38 @@
 /* Tyler Besselman (C) January 2023, licensed under GPLv2     */
 /* ********************************************************** */
 
+// The iconv shim finds the C library's iconv with RTLD_NEXT, which is a GNU extension.
+// This has to come before any system header is included.
+#ifdef UNICONV_ICONV_SHIM
+    #define _GNU_SOURCE 1
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
 // For unicode function definitions
 #include "unicode.h"
 
 // For bzero. This could be replaced with memset if more portability is desired.
 #include <strings.h>
 
+// For memcpy, memmove
+#include <string.h>
+
+// For realloc, free
+#include <stdlib.h>
+
+// For line validation threads
+#include <pthread.h>
+
+// For errno, EILSEQ
+#include <errno.h>
+
+// For wcslen
+#include <wchar.h>
+
+// For dlsym in the iconv shim
+#ifdef UNICONV_ICONV_SHIM
+    #include <dlfcn.h>
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
 // Do note that everything in this file can be made faster with CPU-specific optimizations.
 // On modern systems, for instance, we have 64-bit native registers. Doing math in them or
 //   accessing memory on 64-bit boundaries would be faster. I leave this up to the compiler/cpu
@@ -24,6 +50,26 @@
 #define __byte_swap_16(i)   ({ uint16_t x = (i); (((x >> 8) & 0x00FF) | ((x << 8) & 0xFF00)); })
 #define __byte_swap_32(i)   (__builtin_bswap32((i)))
 
+// Store a 64-bit word without pulling its cache line in. This is only worth it for large copies.
+// These fall back to regular stores on anything but x86-64 (which always has SSE2).
+#if defined(__x86_64__) && defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define __store_64_stream(p, w) (_mm_stream_si64((long long *)(p), (long long)(w)))
+    #define __store_fence()         (_mm_sfence())
+#else /* !defined(__x86_64__) || !defined(__SSE2__) */
+    #define __store_64_stream(p, w) ({ uint64_t x = (w); memcpy((p), &x, sizeof(x)); })
+    #define __store_fence()         ((void)0)
+#endif /* defined(__x86_64__) && defined(__SSE2__) */
+
+// Whether this machine is big endian. Byte orders named by encodings are relative to this.
+#define __host_big_endian       (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+// Byte swap a UTF-X char only if requested. UTF-8 chars are never swapped.
+#define __utf8_swap(c, swap)    (c)
+#define __utf16_swap(c, swap)   ((swap) ? __byte_swap_16(c) : (c))
+#define __utf32_swap(c, swap)   ((swap) ? __byte_swap_32(c) : (c))
+
 /* ************************** */
 /* -*- helpful constants -*- */
 /* ************************** */
@@ -58,6 +104,30 @@ static const size_t UTF8_SEQ_MAX_CHARS          = 4;
 // Unicode replacement character. This is used to replace invalid sequences.
 static const unipoint_t UNICODE_REPL_CHAR       = 0xFFFD;
 
+// Every char in a 64-bit word with its high bit set. A word of UTF-8 chars is pure ASCII
+//   exactly when none of these bits are set.
+static const uint64_t WORD_HIGH_BITS            = 0x8080808080808080ULL;
+
+// Every char in a 64-bit word set to 1. Subtracting this finds zero chars in a word.
+static const uint64_t WORD_LOW_BITS             = 0x0101010101010101ULL;
+
+// Number of clean chars a replacing conversion must see after an error before it goes back
+//   to looking for ASCII a word at a time.
+static const size_t UTF8_RESYNC_CHARS           = 16;
+
+// The smallest part of a buffer worth giving its own line validation thread.
+static const size_t UTF8_LINES_THREAD_MIN       = 1 << 20;
+
+// Number of UTF-8 chars converted between checks for errors in optimistic conversions.
+static const size_t UTF8_OPTIMISTIC_BLOCK       = 64;
+
+// Target size of a block in an incremental UTF-8 index.
+// Blocks are kept between this and twice this size, except in very small buffers.
+static const size_t UTF8_INDEX_BLOCK_SIZE       = 4096;
+
+// Marks undefined bytes and unmapped codepoints in single byte codepage tables.
+static const uint16_t CODEPAGE_UNMAPPED         = 0xFFFF;
+
 // Number of bytes used to encode a single codepoint in UTF-8 indexed by the first byte.
 // That is, the first byte of a UTF-8 encoded codepoint can be used as the index to this
 //   table, and the resulting value is the number of following bytes needed to decode
@@ -110,6 +180,20 @@ static const utf8_char_t UTF8_INITIAL_MASK[5] = {
 // Validate the provided codepoint, returning 0 on success.
 static inline int __codepoint_is_valid(unipoint_t codepoint);
 
+// Strictly validate a single UTF-8 sequence, returning 0 on success. Return the number of chars in the
+//   sequence (or in the invalid prefix of the sequence) in the `consumed` argument.
+static inline int __utf8_sequence_check(utf8_char_t *src, size_t src_size, size_t *consumed);
+static inline int __utf16_sequence_check(utf16_char_t *src, size_t src_size, size_t *consumed, bool swap);
+
+// Find the number of leading ASCII chars in a UTF-X buffer, checking a word at a time.
+static inline size_t __utf8_ascii_prefix(utf8_char_t *src, size_t src_size, bool);
+static inline size_t __utf16_ascii_prefix(utf16_char_t *src, size_t src_size, bool swap);
+static inline size_t __utf32_ascii_prefix(utf32_char_t *src, size_t src_size, bool swap);
+
+// Find the number of leading UTF-8 chars which can never start a valid sequence.
+// These are stray trailing chars, 0xC0, 0xC1 and everything past 0xF4.
+static inline size_t __utf8_invalid_prefix(utf8_char_t *src, size_t src_size);
+
 
 // Calculate the number of characters needed to encode the provided codepoint.
 static inline size_t __utf8_chars_for_codepoint(unipoint_t codepoint);
@@ -140,9 +224,9 @@ static inline unipoint_t __codepoint_from_utf16(utf16_char_t *src, size_t src_si
 // Read a codepoint from the provided UTF-32 buffer, byte swapping if necessary.
 static inline unipoint_t __codepoint_from_utf32(utf32_char_t *src, size_t src_size, size_t *consumed, bool swap);
 
-/* ********************************************** */
-/* -*- static helper for codepoint validation -*- */
-/* ********************************************** */
+/* ************************************************************ */
+/* -*- static helpers for codepoint and sequence validation -*- */
+/* ************************************************************ */
 
 static inline int __codepoint_is_valid(unipoint_t codepoint)
 {
@@ -162,6 +246,156 @@ static inline int __codepoint_is_valid(unipoint_t codepoint)
     return 0;
 }
 
+static inline int __utf8_sequence_check(utf8_char_t *src, size_t src_size, size_t *consumed)
+{
+    // We always have at least one char available here.
+    utf8_char_t leading_char = (*src);
+
+    // Single chars are always fine.
+    (*consumed) = 1;
+
+    if (leading_char < UTF8_ONE_CHAR_LIMIT)
+        return 0;
+
+    // Use the leading char to determine how many chars should follow.
+    size_t char_count = UTF8_TRAILING_COUNT[leading_char] + 1;
+
+    // Stray trailing chars and 5 or 6 char sequences can never start a valid sequence.
+    if (char_count == 1 || char_count > UTF8_SEQ_MAX_CHARS)
+        return 6;
+
+    // Some leading chars restrict the range of the first trailing char.
+    // This is how overlong encodings, surrogates and out of range codepoints are caught
+    //   without decoding the sequence. (See table 3-7 of the unicode standard)
+    utf8_char_t range_low = 0x80;
+    utf8_char_t range_high = 0xBF;
+    int range_result = 0;
+
+    if (leading_char < 0xC2) {
+        // 0xC0 and 0xC1 can only start overlong sequences.
+        range_high = 0x00;
+        range_result = 6;
+    } else if (leading_char > 0xF4) {
+        // These always encode codepoints past the end of unicode.
+        range_high = 0x00;
+        range_result = 3;
+    } else {
+        switch (leading_char)
+        {
+            case 0xE0: range_low  = 0xA0; range_result = 6; break; // Overlong 3 char sequence
+            case 0xED: range_high = 0x9F; range_result = 2; break; // UTF-16 surrogate
+            case 0xF0: range_low  = 0x90; range_result = 6; break; // Overlong 4 char sequence
+            case 0xF4: range_high = 0x8F; range_result = 3; break; // Past the final codepoint
+        }
+    }
+
+    // When the first trailing char is out of range, only the leading char is consumed.
+    bool in_range = (src_size < 2 || (range_low <= src[1] && src[1] <= range_high));
+
+    for (size_t j = 1; j < char_count; j++)
+    {
+        // Either the buffer ended early or this isn't a trailing char.
+        if (j >= src_size || (src[j] & 0xC0) != 0x80)
+        {
+            (*consumed) = (in_range ? j : 1);
+            return 4;
+        }
+    }
+
+    // This sequence is well formed, but doesn't encode a valid codepoint in its shortest form.
+    if (!in_range)
+        return range_result;
+
+    // Everything checks out.
+    (*consumed) = char_count;
+    return 0;
+}
+
+static inline size_t __utf8_ascii_prefix(utf8_char_t *src, size_t src_size, bool)
+{
+    size_t i = 0;
+
+    // Check a word at a time. memcpy allows unaligned loads and compiles to a single instruction.
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & WORD_HIGH_BITS)
+            break;
+    }
+
+    // Finish up char by char.
+    while (i < src_size && src[i] < UTF8_ONE_CHAR_LIMIT)
+        i++;
+
+    return i;
+}
+
+static inline size_t __utf8_invalid_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    // Runs of trailing chars are by far the most common kind of garbage, so skip those a word at a time.
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        // Every trailing char has the form 0b10xxxxxx.
+        if ((word & (WORD_HIGH_BITS | (WORD_HIGH_BITS >> 1))) != WORD_HIGH_BITS)
+            break;
+    }
+
+    // Finish up char by char.
+    while (i < src_size && src[i] >= UTF8_ONE_CHAR_LIMIT && (src[i] < 0xC2 || src[i] > 0xF4))
+        i++;
+
+    return i;
+}
+
+static inline size_t __utf16_ascii_prefix(utf16_char_t *src, size_t src_size, bool swap)
+{
+    // Bits that must be clear in each of the 4 chars of a word, before swapping.
+    uint64_t mask = ((swap) ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL);
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & mask)
+            break;
+    }
+
+    while (i < src_size && __utf16_swap(src[i], swap) < UTF8_ONE_CHAR_LIMIT)
+        i++;
+
+    return i;
+}
+
+static inline size_t __utf32_ascii_prefix(utf32_char_t *src, size_t src_size, bool swap)
+{
+    // Bits that must be clear in each of the 2 chars of a word, before swapping.
+    uint64_t mask = ((swap) ? 0x80FFFFFF80FFFFFFULL : 0xFFFFFF80FFFFFF80ULL);
+    size_t i = 0;
+
+    for ( ; i + 2 <= src_size; i += 2)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & mask)
+            break;
+    }
+
+    while (i < src_size && __utf32_swap(src[i], swap) < UTF8_ONE_CHAR_LIMIT)
+        i++;
+
+    return i;
+}
+
 /* ************************************************************************ */
 /* -*- static helpers for conversion between code points and UTF8/16/32 -*- */
 /* ************************************************************************ */
@@ -381,7 +615,7 @@ static inline unipoint_t __codepoint_from_utf16(utf16_char_t *src, size_t src_si
         utf16_char_t trailing_char = ((swap) ? __byte_swap_16(*src) : (*src));
 
         // Check if the trailing char is outside the low surrogate range
-        if (trailing_char <= SURROGATE_LOW_START || SURROGATE_LOW_END <= trailing_char)
+        if (trailing_char < SURROGATE_LOW_START || SURROGATE_LOW_END < trailing_char)
         {
             // This high surrogate has no corresponding low surrogate.
             if (consumed)
@@ -443,6 +677,10 @@ static inline unipoint_t __codepoint_from_utf32(utf32_char_t *src, size_t src_si
 /* -*- encoding conversion functions -*- */
 /* ************************************* */
 
+#define UTFCONV_CHARS_8(c)      (__utf8_chars_for_codepoint(c))
+#define UTFCONV_CHARS_16(c)     (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+#define UTFCONV_CHARS_32(c)     (1)
+
 // Do UTF-X to UTF-Y conversion. These functions are all the same with bit widths changed.
 #define UTFCONV(X, Y)                                                                                       \
     do {                                                                                                    \
@@ -463,13 +701,20 @@ static inline unipoint_t __codepoint_from_utf32(utf32_char_t *src, size_t src_si
             /* Read out the next codepoint from the src buffer. */                                          \
             unipoint_t codepoint = __codepoint_from_utf ## X(src, (src_end - src), &consumed, swap);        \
                                                                                                             \
-            /* Write out the UTF-Y version of the read codepoint. */                                        \
-            size_t dest_consumed = __utf ## Y ## _from_codepoint(codepoint, dest, (dest_end - dest), swap); \
-                                                                                                            \
             /* The '0' codepoint is NULL and represents the end of a string. */                             \
             if (!codepoint)                                                                                 \
+            {                                                                                               \
+                __utf ## Y ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);                    \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            /* Stop before splitting a codepoint over the end of the dest buffer, without consuming it. */  \
+            if (UTFCONV_CHARS_ ## Y(codepoint) > (size_t)(dest_end - dest))                                 \
                 break;                                                                                      \
                                                                                                             \
+            /* Write out the UTF-Y version of the read codepoint. */                                        \
+            size_t dest_consumed = __utf ## Y ## _from_codepoint(codepoint, dest, (dest_end - dest), swap); \
+                                                                                                            \
             /* We don't count the null terminator as being converted. */                                    \
             /* Increment these after the above check. */                                                    \
             dest += dest_consumed;                                                                          \
@@ -501,8 +746,405 @@ size_t enc_utf32_to_utf16(utf16_char_t *dest, size_t *dest_size, utf32_char_t *s
 size_t enc_utf32_to_utf8(utf8_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size,  bool swap)
 { UTFCONV(32, 8); }
 
+// Do length-driven UTF-X to UTF-Y conversion. Unlike UTFCONV, a '0' codepoint is just data here.
+// Without having to look for a null terminator, ASCII runs can be copied straight across.
+#define UTFCONV_BIN(X, Y)                                                                                   \
+    do {                                                                                                    \
+        /* These are useful for calculating the number of chars consumed in each buffer */                  \
+        utf ## Y ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *src_ptr = src;                                                                 \
+                                                                                                            \
+        /* For range checking */                                                                            \
+        utf ## Y ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf ## X ## _char_t *src_end = src + src_size;                                                      \
+                                                                                                            \
+        /* Loop until one of the two buffers is exhausted. */                                               \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            /* Find the ASCII run at the start of the src buffer which fits in the dest buffer. */          \
+            size_t ascii_limit = (src_end - src);                                                           \
+                                                                                                            \
+            if ((size_t)(dest_end - dest) < ascii_limit)                                                    \
+                ascii_limit = (dest_end - dest);                                                            \
+                                                                                                            \
+            size_t ascii_count = __utf ## X ## _ascii_prefix(src, ascii_limit, swap);                       \
+                                                                                                            \
+            /* ASCII chars have the same value in every encoding. */                                        \
+            for (size_t i = 0; i < ascii_count; i++)                                                        \
+                dest[i] = __utf ## Y ## _swap(__utf ## X ## _swap(src[i], swap), swap);                     \
+                                                                                                            \
+            dest += ascii_count;                                                                            \
+            src += ascii_count;                                                                             \
+                                                                                                            \
+            if ((dest == dest_end) || (src == src_end))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            /* How many chars were consumed in this loop? */                                                \
+            size_t consumed;                                                                                \
+                                                                                                            \
+            /* Read out the next codepoint from the src buffer. */                                          \
+            unipoint_t codepoint = __codepoint_from_utf ## X(src, (src_end - src), &consumed, swap);        \
+                                                                                                            \
+            /* Stop before splitting a codepoint over the end of the dest buffer, without consuming it. */  \
+            if (UTFCONV_CHARS_ ## Y(codepoint) > (size_t)(dest_end - dest))                                 \
+                break;                                                                                      \
+                                                                                                            \
+            /* Write out the UTF-Y version of the read codepoint. */                                        \
+            dest += __utf ## Y ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);                \
+            src += consumed;                                                                                \
+        }                                                                                                   \
+                                                                                                            \
+        /* We consumed the difference in the current dest pointer from the original value. */               \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        /* Similarly for the src buffer. */                                                                 \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_utf8_to_utf16_bin(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(8, 16); }
+
+size_t enc_utf8_to_utf32_bin(utf32_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(8, 32); }
+
+size_t enc_utf16_to_utf8_bin(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(16, 8); }
+
+size_t enc_utf16_to_utf32_bin(utf32_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(16, 32); }
+
+size_t enc_utf32_to_utf16_bin(utf16_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(32, 16); }
+
+size_t enc_utf32_to_utf8_bin(utf8_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap)
+{ UTFCONV_BIN(32, 8); }
+
+// Do length-driven UTF-8 to UTF-Y conversion with a chosen replacement for malformed sequences.
+// Valid sequences are strictly checked, and malformed ones never go through the regular decoding path.
+#define UTFCONV_REPL(Y)                                                                                     \
+    do {                                                                                                    \
+        /* These are useful for calculating the number of chars consumed in each buffer */                  \
+        utf ## Y ## _char_t *dest_ptr = dest;                                                               \
+        utf8_char_t *src_ptr = src;                                                                         \
+                                                                                                            \
+        /* For range checking */                                                                            \
+        utf ## Y ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf8_char_t *src_end = src + src_size;                                                              \
+                                                                                                            \
+        /* Encode the replacement once up front. Surrogates and values past the final codepoint */          \
+        /*   can't be encoded, so they fall back to the replacement char. */                                \
+        if ((SURROGATE_HIGH_START <= replacement && replacement <= SURROGATE_LOW_END) ||                    \
+            replacement > UNICODE_FINAL_POINT)                                                              \
+            replacement = UNICODE_REPL_CHAR;                                                                \
+                                                                                                            \
+        utf ## Y ## _char_t repl[UTF8_SEQ_MAX_CHARS];                                                       \
+        size_t repl_size = __utf ## Y ## _from_codepoint(replacement, repl, UTF8_SEQ_MAX_CHARS, swap);      \
+                                                                                                            \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            /* Copy ASCII runs straight across. */                                                          \
+            size_t ascii_limit = (src_end - src);                                                           \
+                                                                                                            \
+            if ((size_t)(dest_end - dest) < ascii_limit)                                                    \
+                ascii_limit = (dest_end - dest);                                                            \
+                                                                                                            \
+            size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, swap);                               \
+                                                                                                            \
+            for (size_t i = 0; i < ascii_count; i++)                                                        \
+                dest[i] = __utf ## Y ## _swap(src[i], swap);                                                \
+                                                                                                            \
+            dest += ascii_count;                                                                            \
+            src += ascii_count;                                                                             \
+                                                                                                            \
+            if ((dest == dest_end) || (src == src_end))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            /* Check the next sequence. */                                                                  \
+            size_t consumed;                                                                                \
+            int result = __utf8_sequence_check(src, (src_end - src), &consumed);                            \
+                                                                                                            \
+            if (!result)                                                                                    \
+            {                                                                                               \
+                /* Only 4 char sequences need more than one UTF-16 char, and UTF-8 maps to itself. */       \
+                size_t needed = ((Y == 8) ? consumed : ((Y == 16 && consumed == 4) ? 2 : 1));               \
+                                                                                                            \
+                /* Stop before splitting a codepoint over the end of the dest buffer. */                    \
+                if ((size_t)(dest_end - dest) < needed)                                                     \
+                    break;                                                                                  \
+                                                                                                            \
+                unipoint_t codepoint = __utf8_decode(src, consumed);                                        \
+                                                                                                            \
+                dest += __utf ## Y ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);            \
+                src += consumed;                                                                            \
+                                                                                                            \
+                continue;                                                                                   \
+            }                                                                                               \
+                                                                                                            \
+            /* Each char which can never start a sequence is its own error. Skip them all at once. */       \
+            size_t error_count = __utf8_invalid_prefix(src, (src_end - src));                               \
+                                                                                                            \
+            /* Otherwise the error is the invalid part of a single sequence. */                             \
+            if (error_count)                                                                                \
+                consumed = error_count;                                                                     \
+            else                                                                                            \
+                error_count = 1;                                                                            \
+                                                                                                            \
+            /* When collapsing, keep going until the next valid sequence. */                                \
+            while (collapse && (src + consumed < src_end) && (src[consumed] >= UTF8_ONE_CHAR_LIMIT))        \
+            {                                                                                               \
+                size_t remaining = (src_end - src) - consumed;                                              \
+                size_t sequence_size = __utf8_invalid_prefix(src + consumed, remaining);                    \
+                                                                                                            \
+                /* Stop at the first sequence that checks out. */                                           \
+                if (!sequence_size && !__utf8_sequence_check(src + consumed, remaining, &sequence_size))    \
+                    break;                                                                                  \
+                                                                                                            \
+                consumed += sequence_size;                                                                  \
+            }                                                                                               \
+                                                                                                            \
+            if (collapse)                                                                                   \
+                error_count = 1;                                                                            \
+                                                                                                            \
+            /* Write as many replacements as will fit. Each error here is one char of garbage. */           \
+            size_t room = (dest_end - dest) / repl_size;                                                    \
+                                                                                                            \
+            if (!room)                                                                                      \
+                break;                                                                                      \
+                                                                                                            \
+            if (error_count > room)                                                                         \
+            {                                                                                               \
+                error_count = room;                                                                         \
+                consumed = room;                                                                            \
+            }                                                                                               \
+                                                                                                            \
+            for (size_t i = 0; i < error_count; i++)                                                        \
+            {                                                                                               \
+                for (size_t j = 0; j < repl_size; j++)                                                      \
+                    (*dest++) = repl[j];                                                                    \
+            }                                                                                               \
+                                                                                                            \
+            src += consumed;                                                                                \
+                                                                                                            \
+            /* Garbage tends to come in bulk, and then looking for ASCII words doesn't pay off. */          \
+            /* Go a char at a time until enough clean chars go by, or a valid sequence turns up. */         \
+            /* There is always room for a replacement in this loop. */                                      \
+            size_t clean_count = 0;                                                                         \
+                                                                                                            \
+            while ((clean_count < UTF8_RESYNC_CHARS) && (src < src_end))                                    \
+            {                                                                                               \
+                if ((size_t)(dest_end - dest) < UTF8_SEQ_MAX_CHARS)                                         \
+                    break;                                                                                  \
+                                                                                                            \
+                if (*src < UTF8_ONE_CHAR_LIMIT)                                                             \
+                {                                                                                           \
+                    (*dest++) = __utf ## Y ## _swap(*src++, swap);                                          \
+                                                                                                            \
+                    clean_count++;                                                                          \
+                    continue;                                                                               \
+                }                                                                                           \
+                                                                                                            \
+                /* Only possible leading chars are worth a full check. */                                   \
+                consumed = 1;                                                                               \
+                                                                                                            \
+                bool may_lead = ((0xC2 <= *src) && (*src <= 0xF4));                                         \
+                                                                                                            \
+                if (may_lead && !__utf8_sequence_check(src, (src_end - src), &consumed))                    \
+                    break;                                                                                  \
+                                                                                                            \
+                /* Back to back errors are part of the same run. */                                         \
+                if (!collapse || clean_count)                                                               \
+                {                                                                                           \
+                    for (size_t j = 0; j < repl_size; j++)                                                  \
+                        (*dest++) = repl[j];                                                                \
+                }                                                                                           \
+                                                                                                            \
+                src += consumed;                                                                            \
+                clean_count = 0;                                                                            \
+            }                                                                                               \
+        }                                                                                                   \
+                                                                                                            \
+        /* We consumed the difference in the current dest pointer from the original value. */               \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        /* Similarly for the src buffer. */                                                                 \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_utf8_to_utf8_repl(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap)
+{ UTFCONV_REPL(8); }
+
+size_t enc_utf8_to_utf16_repl(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap)
+{ UTFCONV_REPL(16); }
+
+size_t enc_utf8_to_utf32_repl(utf32_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap)
+{ UTFCONV_REPL(32); }
+
+#undef UTFCONV_REPL
+#undef UTFCONV_BIN
+#undef UTFCONV_CHARS_32
+#undef UTFCONV_CHARS_16
+#undef UTFCONV_CHARS_8
 #undef UTFCONV
 
+// Convert UTF-8 to UTF-16 one strictly checked sequence at a time, stopping at the first malformed sequence.
+// Store the number of dest chars used in dest_size and the result of the check in `status`.
+// Return the number of chars of the src buffer that were converted.
+static size_t __utf8_to_utf16_checked(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{
+    utf16_char_t *dest_ptr = dest;
+    utf16_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        // Don't split a surrogate pair over the end of the buffer.
+        if (consumed == 4 && (dest_end - dest) < 2)
+            break;
+
+        dest += __utf16_from_codepoint(__utf8_decode(src, consumed), dest, (dest_end - dest), swap);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+// Convert as many whole blocks of UTF-8 to UTF-16 as possible, assuming they are valid.
+// Store the number of dest chars used in dest_size and whether the last block converted had an error in `error`.
+// Return the number of chars of the src buffer converted before the first block with an error.
+// This is always inlined with a constant `swap` so the compiler can drop the byte swapping branches.
+static inline size_t __utf8_to_utf16_blocks(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool *error, bool swap)
+{
+    utf16_char_t *dest_ptr = dest;
+    utf16_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    // Smallest codepoint which needs a given number of trailing chars, to catch overlong sequences.
+    static const unipoint_t minimum_codepoint[4] = { 0, UTF8_ONE_CHAR_LIMIT, UTF8_TWO_CHAR_LIMIT, UTF8_THREE_CHAR_LIMIT };
+
+    (*error) = false;
+
+    // A block never writes more UTF-16 chars than it reads UTF-8 chars, and reads at most
+    //   a word or a sequence past its end, so there's no need for bounds checks inside of one.
+    while ((size_t)(src_end - src) >= UTF8_OPTIMISTIC_BLOCK + sizeof(uint64_t) &&
+           (size_t)(dest_end - dest) >= UTF8_OPTIMISTIC_BLOCK + sizeof(uint64_t))
+    {
+        utf8_char_t *block_end = src + UTF8_OPTIMISTIC_BLOCK;
+
+        // Every check in the block is or'd into this, and only looked at once the block is done.
+        uint32_t block_error = 0;
+
+        while (src < block_end)
+        {
+            utf8_char_t leading_char = (*src);
+
+            // Widen whole words of ASCII. Non-ASCII text rarely has any, so don't bother looking there.
+            if (leading_char < UTF8_ONE_CHAR_LIMIT)
+            {
+                uint64_t word;
+                memcpy(&word, src, sizeof(word));
+
+                if (!(word & WORD_HIGH_BITS))
+                {
+                    for (size_t i = 0; i < sizeof(uint64_t); i++)
+                        dest[i] = __utf16_swap((utf16_char_t)src[i], swap);
+
+                    src += sizeof(uint64_t);
+                    dest += sizeof(uint64_t);
+
+                    continue;
+                }
+            }
+
+            size_t trailing_count = UTF8_TRAILING_COUNT[leading_char];
+
+            // Stray trailing chars and 5 or 6 char sequences are decoded as single chars and flagged.
+            block_error |= ((leading_char & 0xC0) == 0x80) | (trailing_count > 3);
+            trailing_count = ((trailing_count > 3) ? 0 : trailing_count);
+
+            // Decode assuming every trailing char has the form 0b10xxxxxx, and flag any that don't.
+            unipoint_t codepoint = leading_char & ~UTF8_INITIAL_MASK[trailing_count + 1];
+
+            // Nice cascading switch statement, like the one in __utf8_decode.
+            switch (trailing_count)
+            {
+                case 3: codepoint = (codepoint << 6) | (src[trailing_count - 2] & 0x3F);
+                        block_error |= (src[trailing_count - 2] & 0xC0) ^ 0x80;
+                        [[fallthrough]];
+                case 2: codepoint = (codepoint << 6) | (src[trailing_count - 1] & 0x3F);
+                        block_error |= (src[trailing_count - 1] & 0xC0) ^ 0x80;
+                        [[fallthrough]];
+                case 1: codepoint = (codepoint << 6) | (src[trailing_count - 0] & 0x3F);
+                        block_error |= (src[trailing_count - 0] & 0xC0) ^ 0x80;
+            }
+
+            // Overlong sequences, surrogates and codepoints past the end of unicode.
+            block_error |= (codepoint < minimum_codepoint[trailing_count]);
+            block_error |= ((codepoint & 0xFFFFF800) == SURROGATE_HIGH_START);
+            block_error |= (codepoint > UNICODE_FINAL_POINT);
+
+            if (codepoint < UTF16_ONE_CHAR_LIMIT) {
+                (*dest++) = __utf16_swap((utf16_char_t)codepoint, swap);
+            } else {
+                codepoint -= UTF16_ONE_CHAR_LIMIT;
+
+                (*dest++) = __utf16_swap((utf16_char_t)(((codepoint >> 10) & 0x3FF) | SURROGATE_HIGH_START), swap);
+                (*dest++) = __utf16_swap((utf16_char_t)(((codepoint >>  0) & 0x3FF) | SURROGATE_LOW_START), swap);
+            }
+
+            src += trailing_count + 1;
+        }
+
+        // The block was fine. This is (hopefully) the only branch on validity.
+        if (block_error)
+        {
+            (*error) = true;
+            break;
+        }
+
+        // Only count the block once it's known to be good.
+        src_ptr = src;
+        dest_ptr = dest;
+    }
+
+    // Report what was converted up to the end of the last good block.
+    (*dest_size) = (*dest_size) - (dest_end - dest_ptr);
+
+    return src_size - (src_end - src_ptr);
+}
+
+size_t enc_utf8_to_utf16_optimistic(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{
+    bool error;
+    size_t block_dest_size = (*dest_size);
+
+    // Pick a version of the block converter with the byte swapping resolved up front.
+    size_t converted = ((swap) ? __utf8_to_utf16_blocks(dest, &block_dest_size, src, src_size, &error, true)
+                               : __utf8_to_utf16_blocks(dest, &block_dest_size, src, src_size, &error, false));
+
+    // Whether or not the last block had an error, the rest is done carefully, stopping at the exact error.
+    size_t rest_dest_size = (*dest_size) - block_dest_size;
+    converted += __utf8_to_utf16_checked(dest + block_dest_size, &rest_dest_size, src + converted, src_size - converted, status, swap);
+
+    (*dest_size) = block_dest_size + rest_dest_size;
+
+    return converted;
+}
+
 /* ******************************* */
 /* -*- buffer sizing functions -*- */
 /* ******************************* */
@@ -656,66 +1298,130 @@ size_t utf32_in_utf16_len(utf32_char_t *str, bool swap)
 /* -*- string validation functions -*- */
 /* *********************************** */
 
-int utf8_validate(utf8_char_t *str, bool swap)
+// Build a bitmap of the ASCII chars rejected by a validation profile.
+static inline void __profile_ascii_rejects(unsigned profile, uint64_t rejects[2])
 {
-    // Loop through the string until we encounter a null-terminator.
-    // `c` is the leading bit of each UTF-8 codepoint sequence.
-    for (utf8_char_t c = (*str); c; c = (*str))
-    {
-        // Lookup how many chars trail this one, skip to the next leading char.
-        size_t char_count = UTF8_TRAILING_COUNT[c] + 1;
+    // C0 controls, except for tab, LF and CR.
+    uint64_t c0_controls = 0xFFFFFFFFULL & ~((1ULL << '\t') | (1ULL << '\n') | (1ULL << '\r'));
 
-        // UTF-8 does not support sequences of more than 4 chars.
-        if (char_count > UTF8_SEQ_MAX_CHARS)
-            return 6;
+    rejects[0] = 0;
+    rejects[1] = 0;
 
-        // Ensure all trailing characters have a valid mark.
-        // That is, they all start with a 1 bit followed by a 0 bit.
-        for (size_t j = 1; j < char_count; j++)
-        {
-            // We either have an early null-terminator or a bad char.
-            if (!str[j] || !(str[j] >> 7) || ((str[j] >> 6) & 1))
-                return 4;
-        }
+    // XML 1.0 rejects the same C0 controls, but allows DEL.
+    if (profile & (UNICODE_PROFILE_CONTROLS | UNICODE_PROFILE_XML10))
+        rejects[0] |= c0_controls;
 
-        // Decode the next codepoint
-        unipoint_t codepoint = __utf8_decode(str, char_count);
+    if (profile & UNICODE_PROFILE_CONTROLS)
+        rejects[1] |= (1ULL << (0x7F - 64));
+}
 
-        // Check if the decoded codepoint is valid.
-        int validity_result = __codepoint_is_valid(codepoint);
+// Check if a valid codepoint is rejected by a validation profile.
+// Each class is a range test or two. Every class is tested, and the ones `profile` selects are or-ed together.
+static inline bool __profile_rejects(unipoint_t codepoint, unsigned profile)
+{
+    bool noncharacter = ((codepoint & 0xFFFE) == 0xFFFE) || ((codepoint - 0xFDD0) < 0x20);
+    bool c1_control   = ((codepoint - 0x80) < 0x20);
+    bool private_use  = ((codepoint - 0xE000) < 0x1900) || (codepoint >= 0xF0000);
+    bool bidi         = ((codepoint - 0x202A) < 5) || ((codepoint - 0x2066) < 4);
+    bool invisible    = ((codepoint - 0x200B) < 5) || ((codepoint - 0x2060) < 5) || (codepoint == 0x061C) ||
+                        (codepoint == 0xFEFF);
+
+    // Outside of ASCII, only U+FFFE and U+FFFF aren't XML 1.0 Chars. (Surrogates are never valid.)
+    bool xml_invalid  = ((codepoint - 0xFFFE) < 2);
+
+    return (((profile & UNICODE_PROFILE_NONCHARACTERS) && noncharacter) |
+            ((profile & UNICODE_PROFILE_CONTROLS)      && c1_control)   |
+            ((profile & UNICODE_PROFILE_PRIVATE_USE)   && private_use)  |
+            ((profile & UNICODE_PROFILE_BIDI)          && bidi)         |
+            ((profile & UNICODE_PROFILE_XML10)         && xml_invalid)  |
+            ((profile & UNICODE_PROFILE_INVISIBLE)     && invisible));
+}
 
-        // If validity_result is set, this codepoint was not valid.
+// Check if a valid UTF-8 sequence starting with `lead` needs decoding for a validation profile.
+// Everything the bidi and invisible profiles reject starts with D8 (U+061C), E2 (U+200B-U+2069) or
+//   EF (U+FEFF), so the rest of non-ASCII text is only validated for them.
+static inline bool __utf8_profile_checks(utf8_char_t lead, unsigned profile)
+{
+    if (profile & ~(UNICODE_PROFILE_BIDI | UNICODE_PROFILE_INVISIBLE))
+        return true;
+
+    return (profile && (lead == 0xD8 || lead == 0xE2 || lead == 0xEF));
+}
+
+int utf8_validate(utf8_char_t *str, bool swap)
+{ return utf8_validate_profile(str, 0, swap); }
+
+int utf16_validate(utf16_char_t *str, bool swap)
+{ return utf16_validate_profile(str, 0, swap); }
+
+int utf32_validate(utf32_char_t *str, bool swap)
+{ return utf32_validate_profile(str, 0, swap); }
+
+int utf8_validate_profile(utf8_char_t *str, unsigned profile, bool)
+{
+    uint64_t ascii_rejects[2];
+    __profile_ascii_rejects(profile, ascii_rejects);
+
+    // Loop through the string until we encounter a null-terminator.
+    // `c` is the leading bit of each UTF-8 codepoint sequence.
+    for (utf8_char_t c = (*str); c; c = (*str))
+    {
+        // ASCII only needs a lookup in the profile bitmap.
+        if (c < UTF8_ONE_CHAR_LIMIT)
+        {
+            if ((ascii_rejects[c >> 6] >> (c & 63)) & 1)
+                return 7;
+
+            str++;
+            continue;
+        }
+
+        // Check the full sequence. The null-terminator stops this like any other bad trailing char.
+        size_t char_count;
+        int validity_result = __utf8_sequence_check(str, SIZE_MAX, &char_count);
+
+        // If validity_result is set, this sequence was not valid.
         if (validity_result)
             return validity_result;
 
-        // Codepoints must be encoded by their minimal sequence.
-        if (char_count != __utf8_chars_for_codepoint(codepoint))
-            return 6;
+        // Only decode the codepoint if a profile needs to see it.
+        if (__utf8_profile_checks(c, profile) && __profile_rejects(__utf8_decode(str, char_count), profile))
+            return 7;
 
         // Skip past the last sequence
         str += char_count;
     }
 
+    // This is a valid string
     return 0;
 }
 
-int utf16_validate(utf16_char_t *str, bool swap)
+int utf16_validate_profile(utf16_char_t *str, unsigned profile, bool swap)
 {
+    uint64_t ascii_rejects[2];
+    __profile_ascii_rejects(profile, ascii_rejects);
+
     // Loop through the string until we encounter a null-terminator.
-    // `c` is the leading bit of each UTF-16 sequence.
-    for (utf16_char_t c = (*str); c; c = (*str++))
+    while (*str)
     {
         // Byte swap if requested
-        if (swap)
-            c = __byte_swap_16(c);
+        utf16_char_t c = __utf16_swap(*str++, swap);
+        unipoint_t codepoint = (unipoint_t)c;
 
-        // Codepoints which take 2 chars in UTF-16 will start with a high surrogate.
-        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_HIGH_END) {
-            utf16_char_t next_char = (*str++);
+        // ASCII only needs a lookup in the profile bitmap.
+        if (c < UTF8_ONE_CHAR_LIMIT)
+        {
+            if ((ascii_rejects[c >> 6] >> (c & 63)) & 1)
+                return 7;
+
+            continue;
+        }
 
-            // Check we're not at the end of the string.
-            if (!next_char)
-                return 1; // This string is missing a low surrogate.
+        // Codepoints which take 2 chars in UTF-16 will start with a high surrogate.
+        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_HIGH_END)
+        {
+            // This will be the null-terminator at the end of the string.
+            utf16_char_t next_char = __utf16_swap(*str, swap);
 
             if (next_char < SURROGATE_LOW_START || SURROGATE_LOW_END < next_char)
             {
@@ -724,56 +1430,214 @@ int utf16_validate(utf16_char_t *str, bool swap)
             }
 
             // Decode this codepoint
-            unipoint_t codepoint = __utf16_decode(c, next_char);
-
-            // Check if the decoded codepoint is valid.
-            int validity_result = __codepoint_is_valid(codepoint);
-
-            // If validity_result is set, this codepoint was not valid.
-            if (validity_result)
-                return validity_result;
-
-            // This was a valid sequence.
-        } else {
-            // This codepoint is only a single char.
-            unipoint_t codepoint = (unipoint_t)c;
+            codepoint = __utf16_decode(c, next_char);
+            str++;
+        }
 
-            // Check if the decoded codepoint is valid.
-            int validity_result = __codepoint_is_valid(codepoint);
+        // Check if the decoded codepoint is valid. This catches low surrogates on their own.
+        int validity_result = __codepoint_is_valid(codepoint);
 
-            // If validity_result is set, this codepoint was not valid.
-            if (validity_result)
-                return validity_result;
+        // If validity_result is set, this codepoint was not valid.
+        if (validity_result)
+            return validity_result;
 
-            // This was a valid sequence.
-        }
+        if (profile && __profile_rejects(codepoint, profile))
+            return 7;
     }
 
     // This is a valid string
     return 0;
 }
 
-int utf32_validate(utf32_char_t *str, bool swap)
+int utf32_validate_profile(utf32_char_t *str, unsigned profile, bool swap)
 {
+    uint64_t ascii_rejects[2];
+    __profile_ascii_rejects(profile, ascii_rejects);
+
     // Loop through the string until we encounter a null-terminator.
-    for (utf32_char_t c = (*str); c; c = (*str++))
+    for ( ; (*str); str++)
     {
         // Byte swap if requested
-        if (swap)
-            c = __byte_swap_32(c);
+        unipoint_t codepoint = (unipoint_t)__utf32_swap(*str, swap);
+
+        // ASCII only needs a lookup in the profile bitmap.
+        if (codepoint < UTF8_ONE_CHAR_LIMIT)
+        {
+            if ((ascii_rejects[codepoint >> 6] >> (codepoint & 63)) & 1)
+                return 7;
+
+            continue;
+        }
 
         // Simply cast to codepoint and check if the underlying point is valid.
-        int validity_result = __codepoint_is_valid((unipoint_t)c);
+        int validity_result = __codepoint_is_valid(codepoint);
 
         // If validity_result is set, this codepoint was not valid.
         if (validity_result)
             return validity_result;
+
+        if (profile && __profile_rejects(codepoint, profile))
+            return 7;
     }
 
     // This is a valid string
     return 0;
 }
 
+size_t utf8_strip_profile(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unsigned profile, int *status, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+
+    uint64_t ascii_rejects[2];
+    __profile_ascii_rejects(profile, ascii_rejects);
+
+    bool ascii_allowed = !(ascii_rejects[0] | ascii_rejects[1]);
+    size_t i = 0;
+
+    (*status) = 0;
+
+    while (i < src_size)
+    {
+        // Copy ASCII a word at a time, when none of it is rejected.
+        if (ascii_allowed)
+        {
+            for ( ; i + sizeof(uint64_t) <= src_size && (size_t)(dest_end - dest) >= sizeof(uint64_t); i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                memcpy(&word, src + i, sizeof(word));
+
+                if (word & WORD_HIGH_BITS)
+                    break;
+
+                memcpy(dest, &word, sizeof(word));
+                dest += sizeof(uint64_t);
+            }
+
+            if (i == src_size)
+                break;
+        }
+
+        utf8_char_t c = src[i];
+        size_t consumed = 1;
+
+        if (c < UTF8_ONE_CHAR_LIMIT)
+        {
+            if ((ascii_rejects[c >> 6] >> (c & 63)) & 1)
+            {
+                i++;
+                continue;
+            }
+        }
+        else
+        {
+            int result = __utf8_sequence_check(src + i, src_size - i, &consumed);
+
+            if (result)
+            {
+                (*status) = result;
+                break;
+            }
+
+            // Rejected codepoints are left out.
+            if (__utf8_profile_checks(c, profile) && __profile_rejects(__utf8_decode(src + i, consumed), profile))
+            {
+                i += consumed;
+                continue;
+            }
+        }
+
+        if ((size_t)(dest_end - dest) < consumed)
+            break;
+
+        memcpy(dest, src + i, consumed);
+        dest += consumed;
+        i += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return i;
+}
+
+size_t utf16_strip_profile(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, unsigned profile, int *status, bool swap)
+{
+    utf16_char_t *dest_ptr = dest;
+    utf16_char_t *dest_end = dest + (*dest_size);
+
+    uint64_t ascii_rejects[2];
+    __profile_ascii_rejects(profile, ascii_rejects);
+
+    // Bits that must be clear in each of the 4 chars of an ASCII word, before swapping.
+    uint64_t mask = ((swap) ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL);
+    bool ascii_allowed = !(ascii_rejects[0] | ascii_rejects[1]);
+    size_t i = 0;
+
+    (*status) = 0;
+
+    while (i < src_size)
+    {
+        // Copy ASCII 4 chars at a time, when none of it is rejected.
+        if (ascii_allowed)
+        {
+            for ( ; i + 4 <= src_size && (dest_end - dest) >= 4; i += 4)
+            {
+                uint64_t word;
+                memcpy(&word, src + i, sizeof(word));
+
+                if (word & mask)
+                    break;
+
+                memcpy(dest, &word, sizeof(word));
+                dest += 4;
+            }
+
+            if (i == src_size)
+                break;
+        }
+
+        utf16_char_t c = __utf16_swap(src[i], swap);
+        size_t consumed = 1;
+
+        if (c < UTF8_ONE_CHAR_LIMIT)
+        {
+            if ((ascii_rejects[c >> 6] >> (c & 63)) & 1)
+            {
+                i++;
+                continue;
+            }
+        }
+        else
+        {
+            int result = __utf16_sequence_check(src + i, src_size - i, &consumed, swap);
+
+            if (result)
+            {
+                (*status) = result;
+                break;
+            }
+
+            // Rejected codepoints are left out.
+            if (profile && __profile_rejects(__codepoint_from_utf16(src + i, consumed, NULL, swap), profile))
+            {
+                i += consumed;
+                continue;
+            }
+        }
+
+        if ((size_t)(dest_end - dest) < consumed)
+            break;
+
+        memcpy(dest, src + i, consumed * sizeof(utf16_char_t));
+        dest += consumed;
+        i += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return i;
+}
+
 /* ******************************* */
 /* -*- string length functions -*- */
 /* ******************************* */
@@ -800,3 +1664,5926 @@ size_t strlen_utf32(utf32_char_t *str)
 { STRLEN(32); }
 
 #undef STRLEN
+
+/* ************************************ */
+/* -*- fused validate/copy functions -*- */
+/* ************************************ */
+
+// Copy src_size chars from src to dest a word at a time, validating the copied chars as they go by.
+// The copy is always completed. Return the status of the first invalid sequence, or 0 if src is valid.
+static inline int __utf8_validate_copy(utf8_char_t *dest, utf8_char_t *src, size_t src_size, bool stream)
+{
+    int status = 0;
+    size_t i = 0;
+
+    // The next char which hasn't been validated yet. Sequences may run past the word being copied.
+    size_t checked = 0;
+
+    // Streaming stores want an aligned destination, so copy up to the first aligned word normally.
+    if (stream)
+    {
+        while (i < src_size && ((uintptr_t)(dest + i) % sizeof(uint64_t)))
+        {
+            dest[i] = src[i];
+            i++;
+        }
+    }
+
+    for ( ; ; i += sizeof(uint64_t))
+    {
+        // The end of the word being copied. The last word may be partial.
+        size_t end = i + sizeof(uint64_t);
+
+        if (end <= src_size) {
+            uint64_t word;
+            memcpy(&word, src + i, sizeof(word));
+
+            if (stream)
+                __store_64_stream(dest + i, word);
+            else
+                memcpy(dest + i, &word, sizeof(word));
+
+            // The common case. Nothing more to do for all ASCII words, once everything before them is checked.
+            if (!(word & WORD_HIGH_BITS) && checked == i)
+            {
+                checked = end;
+                continue;
+            }
+        } else {
+            memcpy(dest + i, src + i, src_size - i);
+            end = src_size;
+        }
+
+        // Validate every sequence starting in this word.
+        while (checked < end)
+        {
+            size_t consumed;
+            int result = __utf8_sequence_check(src + checked, src_size - checked, &consumed);
+
+            // Only the first error is reported.
+            if (result && !status)
+                status = result;
+
+            checked += consumed;
+        }
+
+        if (end == src_size)
+            break;
+    }
+
+    // Make sure the streaming stores are visible before returning.
+    if (stream)
+        __store_fence();
+
+    return status;
+}
+
+int utf8_validate_copy(utf8_char_t *dest, utf8_char_t *src, size_t src_size)
+{ return __utf8_validate_copy(dest, src, src_size, false); }
+
+int utf8_validate_copy_stream(utf8_char_t *dest, utf8_char_t *src, size_t src_size)
+{ return __utf8_validate_copy(dest, src, src_size, true); }
+
+/* ********************************* */
+/* -*- line validation functions -*- */
+/* ********************************* */
+
+// The part of a buffer given to one line validation thread, and the invalid lines it found.
+typedef struct {
+    utf8_char_t *src;
+    size_t start;
+    size_t end;
+
+    size_t line_count;
+    utf8_line_error_t *errors;
+    size_t error_count;
+    size_t error_capacity;
+
+    bool failed;
+} __utf8_line_chunk_t;
+
+// Return the status of the first invalid sequence in a length-bounded span, or 0 if the span is valid.
+static int __utf8_span_status(utf8_char_t *src, size_t src_size)
+{
+    utf8_char_t *src_end = src + src_size;
+
+    while (src < src_end)
+    {
+        src += __utf8_ascii_prefix(src, (src_end - src), false);
+
+        if (src == src_end)
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+            return result;
+
+        src += consumed;
+    }
+
+    return 0;
+}
+
+// Validate every line in a chunk. '\n' never appears inside a UTF-8 sequence, so each line can be
+//   checked on its own without changing where errors are found.
+static void *__utf8_validate_line_chunk(void *arg)
+{
+    __utf8_line_chunk_t *chunk = arg;
+    size_t offset = chunk->start;
+
+    while (offset < chunk->end)
+    {
+        // memchr is usually the fastest way there is to find the end of the line.
+        utf8_char_t *newline = memchr(chunk->src + offset, '\n', chunk->end - offset);
+        size_t length = ((newline) ? (size_t)(newline - (chunk->src + offset)) : (chunk->end - offset));
+
+        int status = __utf8_span_status(chunk->src + offset, length);
+
+        if (status)
+        {
+            if (chunk->error_count == chunk->error_capacity)
+            {
+                size_t capacity = ((chunk->error_capacity) ? (chunk->error_capacity * 2) : 16);
+                utf8_line_error_t *errors = realloc(chunk->errors, capacity * sizeof(utf8_line_error_t));
+
+                if (!errors)
+                {
+                    chunk->failed = true;
+                    return NULL;
+                }
+
+                chunk->errors = errors;
+                chunk->error_capacity = capacity;
+            }
+
+            // Line numbers are local to the chunk for now.
+            chunk->errors[chunk->error_count++] = (utf8_line_error_t){
+                .line = chunk->line_count,
+                .offset = offset,
+                .length = length,
+                .status = status
+            };
+        }
+
+        chunk->line_count++;
+        offset += length + 1;
+    }
+
+    return NULL;
+}
+
+bool utf8_validate_lines(utf8_char_t *src, size_t src_size, unsigned thread_count, utf8_line_error_t **errors, size_t *error_count)
+{
+    (*errors) = NULL;
+    (*error_count) = 0;
+
+    // There's no point in having threads with nothing to do.
+    if (!thread_count)
+        thread_count = 1;
+
+    if (thread_count > src_size / UTF8_LINES_THREAD_MIN + 1)
+        thread_count = src_size / UTF8_LINES_THREAD_MIN + 1;
+
+    __utf8_line_chunk_t *chunks = calloc(thread_count, sizeof(__utf8_line_chunk_t));
+    pthread_t *threads = calloc(thread_count, sizeof(pthread_t));
+    bool *started = calloc(thread_count, sizeof(bool));
+
+    bool success = (chunks && threads && started);
+
+    if (success)
+    {
+        size_t start = 0;
+
+        // Split the buffer evenly, moving each split just past the next newline.
+        for (unsigned i = 0; i < thread_count; i++)
+        {
+            size_t end = ((i == thread_count - 1) ? src_size : (src_size / thread_count) * (i + 1));
+
+            if (end < start)
+                end = start;
+
+            if (end < src_size)
+            {
+                utf8_char_t *newline = memchr(src + end, '\n', src_size - end);
+                end = ((newline) ? (size_t)(newline - src) + 1 : src_size);
+            }
+
+            chunks[i].src = src;
+            chunks[i].start = start;
+            chunks[i].end = end;
+
+            start = end;
+        }
+
+        // The calling thread takes the first chunk. If a thread can't be started, its chunk is done here too.
+        for (unsigned i = 1; i < thread_count; i++)
+            started[i] = !pthread_create(&threads[i], NULL, __utf8_validate_line_chunk, &chunks[i]);
+
+        for (unsigned i = 0; i < thread_count; i++)
+        {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                __utf8_validate_line_chunk(&chunks[i]);
+
+            success &= !chunks[i].failed;
+            (*error_count) += chunks[i].error_count;
+        }
+    }
+
+    // Gather the invalid lines in order, fixing up their line numbers.
+    if (success && (*error_count))
+    {
+        (*errors) = malloc((*error_count) * sizeof(utf8_line_error_t));
+        success = ((*errors) != NULL);
+    }
+
+    if (success)
+    {
+        size_t line = 0;
+        size_t index = 0;
+
+        for (unsigned i = 0; i < thread_count; i++)
+        {
+            for (size_t j = 0; j < chunks[i].error_count; j++)
+            {
+                (*errors)[index] = chunks[i].errors[j];
+                (*errors)[index++].line += line;
+            }
+
+            line += chunks[i].line_count;
+        }
+    } else {
+        (*error_count) = 0;
+    }
+
+    for (unsigned i = 0; chunks && i < thread_count; i++)
+        free(chunks[i].errors);
+
+    free(chunks);
+    free(threads);
+    free(started);
+
+    return success;
+}
+
+size_t utf8_partition_lines(utf8_char_t *clean, size_t *clean_size, utf8_char_t *quarantine, size_t *quarantine_size,
+                            utf8_char_t *src, size_t src_size, utf8_line_error_t *errors, size_t error_count)
+{
+    size_t clean_used = 0;
+    size_t quarantine_used = 0;
+    size_t offset = 0;
+
+    // Alternate between the clean lines before each invalid line, and the invalid line itself.
+    for (size_t i = 0; i <= error_count; i++)
+    {
+        size_t clean_end = ((i < error_count) ? errors[i].offset : src_size);
+        size_t room = (*clean_size) - clean_used;
+        bool full = false;
+
+        // Lines are never split, so only take the whole lines which fit when the next piece doesn't.
+        if (clean_end - offset > room)
+        {
+            clean_end = offset;
+
+            for (size_t j = offset + room; j > offset; j--)
+            {
+                if (src[j - 1] == '\n')
+                {
+                    clean_end = j;
+                    break;
+                }
+            }
+
+            full = true;
+        }
+
+        memcpy(clean + clean_used, src + offset, clean_end - offset);
+        clean_used += clean_end - offset;
+        offset = clean_end;
+
+        if (full || i == error_count)
+            break;
+
+        // Take the newline along with the line, if there is one.
+        size_t length = errors[i].length + (clean_end + errors[i].length < src_size);
+
+        if (length > (*quarantine_size) - quarantine_used)
+            break;
+
+        memcpy(quarantine + quarantine_used, src + offset, length);
+        quarantine_used += length;
+        offset += length;
+    }
+
+    (*clean_size) = clean_used;
+    (*quarantine_size) = quarantine_used;
+
+    return offset;
+}
+
+/* **************************************** */
+/* -*- incremental validation functions -*- */
+/* **************************************** */
+
+// Validate a length-bounded span of UTF-8, counting the codepoints and UTF-16 chars it decodes to.
+// Invalid sequences are counted as the single replacement char they would be converted to.
+// Return the status of the first invalid sequence, or 0 if the span is valid.
+static int __utf8_validate_span(utf8_char_t *src, size_t src_size, size_t *codepoints, size_t *utf16_length)
+{
+    utf8_char_t *src_end = src + src_size;
+    size_t point_count = 0;
+    size_t char_count = 0;
+    int status = 0;
+
+    while (src < src_end)
+    {
+        // ASCII runs are one codepoint and one UTF-16 char per char.
+        size_t ascii_count = __utf8_ascii_prefix(src, (src_end - src), false);
+
+        point_count += ascii_count;
+        char_count += ascii_count;
+        src += ascii_count;
+
+        if (src == src_end)
+            break;
+
+        // Check the non-ASCII sequence.
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        // Only the first error is reported.
+        if (result && !status)
+            status = result;
+
+        // Only valid 4 char sequences need a surrogate pair in UTF-16.
+        point_count++;
+        char_count += ((!result && consumed == 4) ? 2 : 1);
+        src += consumed;
+    }
+
+    (*codepoints) = point_count;
+    (*utf16_length) = char_count;
+
+    return status;
+}
+
+// Split `str` into blocks of roughly UTF8_INDEX_BLOCK_SIZE chars, writing their summaries to `blocks`.
+// Blocks only ever end right before a leading char, so no valid sequence is split between blocks.
+// Return the number of blocks written. `blocks` must have room for str_size / UTF8_INDEX_BLOCK_SIZE + 1 entries.
+static size_t __utf8_index_chunk(utf8_block_t *blocks, utf8_char_t *str, size_t str_size)
+{
+    // Spread the chars evenly so every block is between one and two target sizes.
+    size_t block_count = str_size / UTF8_INDEX_BLOCK_SIZE;
+
+    if (!block_count)
+        block_count = 1;
+
+    size_t block_size = str_size / block_count;
+    size_t offset = 0;
+
+    for (size_t i = 0; i < block_count; i++)
+    {
+        size_t end = ((i == block_count - 1) ? str_size : (offset + block_size));
+
+        // Move past (at most a sequence worth of) trailing chars so the next block starts on a leading char.
+        for (size_t j = 1; j < UTF8_SEQ_MAX_CHARS && end < str_size && (str[end] & 0xC0) == 0x80; j++)
+            end++;
+
+        blocks[i].length = end - offset;
+        blocks[i].status = __utf8_validate_span(str + offset, blocks[i].length, &blocks[i].codepoints, &blocks[i].utf16_length);
+
+        offset = end;
+    }
+
+    return block_count;
+}
+
+// Add block summaries to (or remove them from) the index totals.
+static void __utf8_index_account(utf8_index_t *index, utf8_block_t *blocks, size_t block_count, bool remove)
+{
+    for (size_t i = 0; i < block_count; i++)
+    {
+        if (remove) {
+            index->length         -= blocks[i].length;
+            index->codepoints     -= blocks[i].codepoints;
+            index->utf16_length   -= blocks[i].utf16_length;
+            index->invalid_blocks -= (blocks[i].status != 0);
+        } else {
+            index->length         += blocks[i].length;
+            index->codepoints     += blocks[i].codepoints;
+            index->utf16_length   += blocks[i].utf16_length;
+            index->invalid_blocks += (blocks[i].status != 0);
+        }
+    }
+}
+
+// Return the block at position `i` of the index, skipping over the gap.
+static inline utf8_block_t *__utf8_index_block(utf8_index_t *index, size_t i)
+{
+    return index->blocks + ((i < index->gap) ? i : (i + index->block_capacity - index->block_count));
+}
+
+// Move the gap one block towards the start (or end) of the buffer.
+static inline void __utf8_index_shift_gap(utf8_index_t *index, bool forward)
+{
+    size_t after_start = index->block_capacity - (index->block_count - index->gap);
+
+    if (forward) {
+        index->blocks[index->gap] = index->blocks[after_start];
+        index->gap_offset += index->blocks[index->gap].length;
+        index->gap++;
+    } else {
+        index->gap--;
+        index->blocks[after_start - 1] = index->blocks[index->gap];
+        index->gap_offset -= index->blocks[index->gap].length;
+    }
+}
+
+// Ensure the gap has room for at least `block_count` blocks.
+static bool __utf8_index_reserve(utf8_index_t *index, size_t block_count)
+{
+    if (index->block_count + block_count <= index->block_capacity)
+        return true;
+
+    // Grow geometrically so repeated edits don't reallocate every time.
+    size_t capacity = index->block_capacity * 2;
+
+    if (capacity < index->block_count + block_count)
+        capacity = index->block_count + block_count;
+
+    utf8_block_t *blocks = realloc(index->blocks, capacity * sizeof(utf8_block_t));
+
+    if (!blocks)
+        return false;
+
+    // Keep the blocks after the gap at the end of the array.
+    size_t after_count = index->block_count - index->gap;
+
+    memmove(blocks + capacity - after_count, blocks + index->block_capacity - after_count, after_count * sizeof(utf8_block_t));
+
+    index->blocks = blocks;
+    index->block_capacity = capacity;
+
+    return true;
+}
+
+bool utf8_index_build(utf8_index_t *index, utf8_char_t *str, size_t str_size)
+{
+    // Start from an empty index.
+    bzero(index, sizeof(utf8_index_t));
+
+    if (!str_size)
+        return true;
+
+    if (!__utf8_index_reserve(index, str_size / UTF8_INDEX_BLOCK_SIZE + 1))
+        return false;
+
+    // Every block starts out before the gap.
+    index->block_count = __utf8_index_chunk(index->blocks, str, str_size);
+    index->gap = index->block_count;
+    index->gap_offset = str_size;
+
+    __utf8_index_account(index, index->blocks, index->block_count, false);
+
+    return true;
+}
+
+bool utf8_index_update(utf8_index_t *index, utf8_char_t *str, size_t str_size, size_t edit_offset, size_t removed, size_t inserted)
+{
+    // Without any blocks there's nothing to reuse.
+    if (!index->block_count)
+    {
+        utf8_index_free(index);
+
+        return utf8_index_build(index, str, str_size);
+    }
+
+    // Move the gap so the block holding the first removed char (in the old buffer) comes right after it.
+    while (index->gap && index->gap_offset > edit_offset)
+        __utf8_index_shift_gap(index, false);
+
+    while (index->gap < index->block_count && index->gap_offset + __utf8_index_block(index, index->gap)->length <= edit_offset)
+        __utf8_index_shift_gap(index, true);
+
+    // An insertion at the very end of the buffer belongs to the last block.
+    if (index->gap == index->block_count)
+        __utf8_index_shift_gap(index, false);
+
+    // Also take in the neighboring blocks. An edit at the edge of a block can complete or break
+    //   a sequence that starts in the block before it, and blocks must still end before leading chars.
+    if (index->gap)
+        __utf8_index_shift_gap(index, false);
+
+    // Take the affected blocks out from after the gap, up to the one holding the last removed char
+    //   and its neighbor. The blocks before the gap stay where they are.
+    size_t edit_end = edit_offset + (removed ? (removed - 1) : 0);
+    size_t span_size = 0;
+    bool neighbor = false;
+
+    while (index->gap < index->block_count && !neighbor)
+    {
+        utf8_block_t *block = __utf8_index_block(index, index->gap);
+
+        neighbor = (index->gap_offset + span_size > edit_end);
+        span_size += block->length;
+
+        __utf8_index_account(index, block, 1, true);
+        index->block_count--;
+    }
+
+    // Work out where the affected span now lives in the edited buffer.
+    span_size = span_size + inserted - removed;
+
+    // Rechunking may produce more blocks than it replaces, so make sure there's room.
+    if (!__utf8_index_reserve(index, span_size / UTF8_INDEX_BLOCK_SIZE + 1))
+        return false;
+
+    // Only the affected span is ever revalidated. The new blocks fill the start of the gap.
+    size_t new_count = (span_size ? __utf8_index_chunk(index->blocks + index->gap, str + index->gap_offset, span_size) : 0);
+    __utf8_index_account(index, index->blocks + index->gap, new_count, false);
+
+    index->block_count += new_count;
+    index->gap += new_count;
+    index->gap_offset += span_size;
+
+    return true;
+}
+
+int utf8_index_validate(utf8_index_t *index)
+{
+    // Valid buffers don't need to look at any blocks.
+    if (!index->invalid_blocks)
+        return 0;
+
+    // Report the first problem in the buffer.
+    for (size_t i = 0; i < index->block_count; i++)
+    {
+        utf8_block_t *block = __utf8_index_block(index, i);
+
+        if (block->status)
+            return block->status;
+    }
+
+    return 0;
+}
+
+void utf8_index_free(utf8_index_t *index)
+{
+    free(index->blocks);
+
+    bzero(index, sizeof(utf8_index_t));
+}
+
+/* ************************************* */
+/* -*- C library multibyte functions -*- */
+/* ************************************* */
+
+// Convert UTF-8 to UTF-32 one strictly checked sequence at a time, stopping at the first malformed sequence.
+// ASCII runs are widened without being checked one char at a time.
+// Store the number of dest chars used in dest_size and the result of the check in `status`.
+// Return the number of chars of the src buffer that were converted.
+static size_t __utf8_to_utf32_checked(utf32_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{
+    utf32_char_t *dest_ptr = dest;
+    utf32_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (size_t)(src_end - src);
+
+        if ((size_t)(dest_end - dest) < ascii_limit)
+            ascii_limit = (dest_end - dest);
+
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        for (size_t i = 0; i < ascii_count; i++)
+            dest[i] = __utf32_swap((utf32_char_t)src[i], swap);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        (*dest++) = __utf32_swap(__utf8_decode(src, consumed), swap);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+#if WCHAR_MAX >= 0x10FFFF
+
+// wchar_t strings are handed straight to the UTF-32 helpers.
+_Static_assert(sizeof(wchar_t) == sizeof(utf32_char_t), "wchar_t must hold UTF-32");
+
+int uniconv_mbsinit(uniconv_mbstate_t *state)
+{
+    return (!state || !state->pending_count);
+}
+
+size_t uniconv_mbrtowc(wchar_t *pwc, const char *s, size_t n, uniconv_mbstate_t *state)
+{
+    // Like the C library, keep a state of our own for callers which don't pass one.
+    static uniconv_mbstate_t internal_state;
+
+    if (!state)
+        state = &internal_state;
+
+    // A NULL string just resets the state. This is the same as converting "".
+    if (!s)
+    {
+        pwc = NULL;
+        s = "";
+        n = 1;
+    }
+
+    if (!n)
+        return (size_t)-2;
+
+    // Put the chars held over from the last call in front of the new ones.
+    utf8_char_t sequence[UTF8_SEQ_MAX_CHARS];
+    size_t held = state->pending_count;
+    size_t available = held;
+
+    memcpy(sequence, state->pending, held);
+
+    // `n` is only an upper bound, so never read past the char which ends (or breaks) the sequence.
+    // Take the leading char first to find out how many trailing chars to look for.
+    if (!available)
+        sequence[available++] = (utf8_char_t)s[0];
+
+    size_t needed = UTF8_TRAILING_COUNT[sequence[0]] + 1;
+
+    if (needed > UTF8_SEQ_MAX_CHARS)
+        needed = UTF8_SEQ_MAX_CHARS;
+
+    while (available < needed && available - held < n)
+    {
+        // Stop early after a char which isn't a trailing char, since the string may end right after it.
+        if (available > 1 && (sequence[available - 1] & 0xC0) != 0x80)
+            break;
+
+        sequence[available] = (utf8_char_t)s[available - held];
+        available++;
+    }
+
+    size_t consumed;
+    int result = __utf8_sequence_check(sequence, available, &consumed);
+
+    // Every char so far could still start a valid sequence. Hold on to them and wait for more.
+    // 0xC0, 0xC1 and anything past 0xF4 can't, no matter what follows them.
+    if (result == 4 && consumed == available && 0xC2 <= sequence[0] && sequence[0] <= 0xF4)
+    {
+        memcpy(state->pending, sequence, available);
+        state->pending_count = available;
+
+        return (size_t)-2;
+    }
+
+    state->pending_count = 0;
+
+    if (result)
+    {
+        errno = EILSEQ;
+        return (size_t)-1;
+    }
+
+    unipoint_t codepoint = __utf8_decode(sequence, consumed);
+
+    if (pwc)
+        (*pwc) = (wchar_t)codepoint;
+
+    // Only the chars from this call count towards the result.
+    return ((codepoint) ? (consumed - held) : 0);
+}
+
+size_t uniconv_wcrtomb(char *s, wchar_t wc, uniconv_mbstate_t *state)
+{
+    // A NULL string just resets the state. This is the same as converting L'\0' into a buffer of our own.
+    if (!s)
+    {
+        if (state)
+            state->pending_count = 0;
+
+        return 1;
+    }
+
+    if (__codepoint_is_valid((unipoint_t)wc))
+    {
+        errno = EILSEQ;
+        return (size_t)-1;
+    }
+
+    return __utf8_from_codepoint((unipoint_t)wc, (utf8_char_t *)s, UTF8_SEQ_MAX_CHARS, false);
+}
+
+size_t uniconv_mbsrtowcs(wchar_t *dest, const char **src, size_t len, uniconv_mbstate_t *state)
+{
+    static uniconv_mbstate_t internal_state;
+
+    if (!state)
+        state = &internal_state;
+
+    const char *s = (*src);
+    size_t written = 0;
+
+    // Finish off a sequence left incomplete by uniconv_mbrtowc first.
+    // It stops at the NULL char at the latest, so it never reads past the end of the string.
+    if (state->pending_count && (!dest || len))
+    {
+        wchar_t wc;
+        size_t count = uniconv_mbrtowc(&wc, s, UTF8_SEQ_MAX_CHARS, state);
+
+        if (count == (size_t)-1)
+        {
+            if (dest)
+                (*src) = s;
+
+            return (size_t)-1;
+        }
+
+        if (dest)
+            dest[written] = wc;
+
+        if (!wc)
+        {
+            if (dest)
+                (*src) = NULL;
+
+            return 0;
+        }
+
+        written++;
+        s += count;
+    }
+
+    utf8_char_t *str = (utf8_char_t *)s;
+    size_t str_size = strlen(s);
+
+    // Without a dest buffer, this just counts codepoints. Anything invalid fails the whole string.
+    if (!dest)
+    {
+        size_t codepoints;
+        size_t utf16_length;
+
+        if (__utf8_validate_span(str, str_size, &codepoints, &utf16_length))
+        {
+            errno = EILSEQ;
+            return (size_t)-1;
+        }
+
+        return written + codepoints;
+    }
+
+    int status;
+    size_t dest_size = len - written;
+    size_t converted = __utf8_to_utf32_checked((utf32_char_t *)dest + written, &dest_size, str, str_size, &status, false);
+
+    written += dest_size;
+
+    // The whole string fit, so the NULL char is stored if there's room for it.
+    if (converted == str_size && written < len)
+    {
+        dest[written] = L'\0';
+        (*src) = NULL;
+
+        return written;
+    }
+
+    (*src) = s + converted;
+
+    // Otherwise the dest buffer filled up, or there's a malformed sequence right at `src`.
+    if (written == len)
+        return written;
+
+    errno = EILSEQ;
+    return (size_t)-1;
+}
+
+size_t uniconv_wcsrtombs(char *dest, const wchar_t **src, size_t len, uniconv_mbstate_t *state)
+{
+    // There's never any pending state when encoding UTF-8, but accept one for symmetry.
+    (void)state;
+
+    // The NULL char is converted along with everything else, so it's included here.
+    utf32_char_t *str = (utf32_char_t *)(*src);
+    size_t str_size = wcslen(*src) + 1;
+    size_t written = 0;
+    size_t i = 0;
+
+    while (i < str_size)
+    {
+        // ASCII runs are narrowed a word at a time.
+        size_t ascii_count = __utf32_ascii_prefix(str + i, str_size - i, false);
+
+        if (dest)
+        {
+            if (ascii_count > len - written)
+                ascii_count = len - written;
+
+            for (size_t j = 0; j < ascii_count; j++)
+                dest[written + j] = (char)str[i + j];
+        }
+
+        written += ascii_count;
+        i += ascii_count;
+
+        if ((i == str_size) || (dest && written == len))
+            break;
+
+        unipoint_t codepoint = str[i];
+
+        if (__codepoint_is_valid(codepoint))
+        {
+            if (dest)
+                (*src) = (const wchar_t *)(str + i);
+
+            errno = EILSEQ;
+            return (size_t)-1;
+        }
+
+        // Codepoints are never split over the end of the dest buffer.
+        size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+        if (dest)
+        {
+            if (char_count > len - written)
+                break;
+
+            __utf8_from_codepoint(codepoint, (utf8_char_t *)dest + written, char_count, false);
+        }
+
+        written += char_count;
+        i++;
+    }
+
+    // The NULL char made it, but isn't counted.
+    if (i == str_size)
+    {
+        if (dest)
+            (*src) = NULL;
+
+        return written - 1;
+    }
+
+    (*src) = (const wchar_t *)(str + i);
+
+    return written;
+}
+
+size_t uniconv_mbstowcs(wchar_t *dest, const char *src, size_t n)
+{
+    uniconv_mbstate_t state = {0};
+
+    return uniconv_mbsrtowcs(dest, &src, n, &state);
+}
+
+size_t uniconv_wcstombs(char *dest, const wchar_t *src, size_t n)
+{
+    uniconv_mbstate_t state = {0};
+
+    return uniconv_wcsrtombs(dest, &src, n, &state);
+}
+
+#endif /* WCHAR_MAX >= 0x10FFFF */
+
+/* ************************************** */
+/* -*- single byte codepage functions -*- */
+/* ************************************** */
+
+// A single byte codepage. Every byte maps to at most one BMP codepoint.
+struct uniconv_codepage {
+    const char *name;
+    const uint16_t *to_unicode;     // Codepoint for every byte, or CODEPAGE_UNMAPPED
+    const uint16_t *from_low;       // Byte for every codepoint below U+0100, or CODEPAGE_UNMAPPED
+    const uint32_t *from_high;      // (codepoint << 8) | byte for every codepoint past U+00FF, sorted
+    size_t from_high_count;
+    bool ascii_compatible;          // Bytes below 0x80 are ASCII
+};
+
+// Generated by tables/gen_codepages.py. Run `make tables` to regenerate it.
+#include "tables/codepages.h"
+
+// Normalize an encoding name for lookup, by making it upper case and dropping '-' and '_'.
+// iconv's "//" suffixes are only accepted when there's nothing after them.
+// Return false if the name is too long or has a suffix.
+static bool __encoding_name_normalize(const char *name, char *normal_name, size_t normal_size)
+{
+    size_t length = 0;
+
+    for ( ; (*name); name++)
+    {
+        char c = (*name);
+
+        if (c == '-' || c == '_')
+            continue;
+
+        if (c == '/')
+        {
+            while ((*name) == '/')
+                name++;
+
+            if (*name)
+                return false;
+
+            break;
+        }
+
+        if (length + 1 >= normal_size)
+            return false;
+
+        normal_name[length++] = (('a' <= c && c <= 'z') ? (c - 'a' + 'A') : c);
+    }
+
+    normal_name[length] = 0;
+
+    return true;
+}
+
+// Look up the byte for a codepoint. Return -1 if there isn't one.
+static inline int __codepage_byte(const uniconv_codepage_t *codepage, unipoint_t codepoint)
+{
+    if (codepoint < 0x100)
+        return ((codepage->from_low[codepoint] == CODEPAGE_UNMAPPED) ? -1 : codepage->from_low[codepoint]);
+
+    // Binary search the rest. There are at most 128 of these.
+    size_t low = 0;
+    size_t high = codepage->from_high_count;
+
+    while (low < high)
+    {
+        size_t middle = (low + high) / 2;
+        unipoint_t entry = (codepage->from_high[middle] >> 8);
+
+        if (entry == codepoint)
+            return (codepage->from_high[middle] & 0xFF);
+
+        if (entry < codepoint) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return -1;
+}
+
+const uniconv_codepage_t *uniconv_codepage(const char *name)
+{
+    char normal_name[24];
+
+    if (!__encoding_name_normalize(name, normal_name, sizeof(normal_name)))
+        return NULL;
+
+    // The names are sorted, so do a binary search here too.
+    size_t low = 0;
+    size_t high = sizeof(CODEPAGE_NAMES) / sizeof(CODEPAGE_NAMES[0]);
+
+    while (low < high)
+    {
+        size_t middle = (low + high) / 2;
+        int order = strcmp(normal_name, CODEPAGE_NAMES[middle].name);
+
+        if (!order)
+            return &CODEPAGES[CODEPAGE_NAMES[middle].index];
+
+        if (order > 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return NULL;
+}
+
+const char *uniconv_codepage_name(const uniconv_codepage_t *codepage)
+{ return codepage->name; }
+
+size_t enc_codepage_to_utf8(utf8_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    uint8_t *src_ptr = src;
+    uint8_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        // ASCII passes straight through, a word at a time.
+        if (codepage->ascii_compatible)
+        {
+            size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+            size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+            memcpy(dest, src, ascii_count);
+
+            dest += ascii_count;
+            src += ascii_count;
+
+            if ((dest == dest_end) || (src == src_end))
+                break;
+        }
+
+        uint16_t codepoint = codepage->to_unicode[*src];
+
+        if (codepoint == CODEPAGE_UNMAPPED)
+        {
+            (*status) = 8;
+            break;
+        }
+
+        size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+        if (char_count > (size_t)(dest_end - dest))
+            break;
+
+        dest += __utf8_from_codepoint(codepoint, dest, char_count, false);
+        src++;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+#define CODEPAGE_TO_UTFX(X)                                                                                 \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        uint8_t *src_ptr = src;                                                                             \
+        uint8_t *src_end = src + src_size;                                                                  \
+        const uint16_t *table = codepage->to_unicode;                                                       \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        /* Every byte is a single BMP codepoint, so this is a straight table lookup. */                     \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            uint16_t codepoint = table[*src];                                                               \
+                                                                                                            \
+            if (codepoint == CODEPAGE_UNMAPPED)                                                             \
+            {                                                                                               \
+                (*status) = 8;                                                                              \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            (*dest++) = __utf ## X ## _swap((utf ## X ## _char_t)codepoint, swap);                          \
+            src++;                                                                                          \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_codepage_to_utf16(utf16_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap)
+{ CODEPAGE_TO_UTFX(16); }
+
+size_t enc_codepage_to_utf32(utf32_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap)
+{ CODEPAGE_TO_UTFX(32); }
+
+#undef CODEPAGE_TO_UTFX
+
+size_t enc_utf8_to_codepage(uint8_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool)
+{
+    uint8_t *dest_ptr = dest;
+    uint8_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        if (codepage->ascii_compatible)
+        {
+            size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+            size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+            memcpy(dest, src, ascii_count);
+
+            dest += ascii_count;
+            src += ascii_count;
+
+            if ((dest == dest_end) || (src == src_end))
+                break;
+        }
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        int byte = __codepage_byte(codepage, __utf8_decode(src, consumed));
+
+        if (byte < 0)
+        {
+            (*status) = 8;
+            break;
+        }
+
+        (*dest++) = (uint8_t)byte;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t enc_utf16_to_codepage(uint8_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap)
+{
+    uint8_t *dest_ptr = dest;
+    uint8_t *dest_end = dest + (*dest_size);
+    utf16_char_t *src_ptr = src;
+    utf16_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        utf16_char_t c = __utf16_swap(*src, swap);
+
+        // No codepage has anything past the BMP, so any surrogate is an error of some kind.
+        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_LOW_END)
+        {
+            utf16_char_t trailing_char = ((src + 1 < src_end) ? __utf16_swap(src[1], swap) : 0);
+
+            if (c > SURROGATE_HIGH_END) {
+                (*status) = 2;
+            } else if (trailing_char < SURROGATE_LOW_START || trailing_char > SURROGATE_LOW_END) {
+                (*status) = 1;
+            } else {
+                (*status) = 8;
+            }
+
+            break;
+        }
+
+        int byte = __codepage_byte(codepage, c);
+
+        if (byte < 0)
+        {
+            (*status) = 8;
+            break;
+        }
+
+        (*dest++) = (uint8_t)byte;
+        src++;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t enc_utf32_to_codepage(uint8_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap)
+{
+    uint8_t *dest_ptr = dest;
+    uint8_t *dest_end = dest + (*dest_size);
+    utf32_char_t *src_ptr = src;
+    utf32_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        unipoint_t codepoint = __utf32_swap(*src, swap);
+        int result = __codepoint_is_valid(codepoint);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        int byte = __codepage_byte(codepage, codepoint);
+
+        if (byte < 0)
+        {
+            (*status) = 8;
+            break;
+        }
+
+        (*dest++) = (uint8_t)byte;
+        src++;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+/* ****************************** */
+/* -*- CJK decoding functions -*- */
+/* ****************************** */
+
+// Kinds of CJK encodings, which differ in how they get from bytes to a table entry.
+#define CJK_KIND_DOUBLE         0   // Lead and trail bytes index the table directly (CP932, GBK, Big5)
+#define CJK_KIND_SJIS           1   // Shift_JIS bytes are shifted to JIS X 0208 rows and columns first
+#define CJK_KIND_EUCJP          2   // Adds 2 char half width katakana and 3 char JIS X 0212 sequences
+#define CJK_KIND_GB18030        3   // Adds 4 char sequences, decoded algorithmically
+
+// Marks lead bytes in the single byte tables. Unmapped chars use CODEPAGE_UNMAPPED, like codepages.
+#define CJK_LEAD                0xFFFE
+
+// A two level mapping table. Each lead byte has a row of codepoints indexed by trail byte.
+typedef struct {
+    const uint8_t *lead_rows;       // Row number + 1 for every lead byte with a row, 0 otherwise
+    const uint16_t *rows;           // trail_count codepoints per row, or CODEPAGE_UNMAPPED
+    uint8_t trail_min;
+    uint8_t trail_count;
+} __cjk_table_t;
+
+// Generated by tables/gen_cjk.py. Run `make tables` to regenerate it.
+#include "tables/cjk.h"
+
+struct uniconv_cjk {
+    const char *name;
+    uint8_t kind;
+    const uint16_t *single;         // Codepoints for chars 0x80-0xFF, CJK_LEAD or CODEPAGE_UNMAPPED
+    const __cjk_table_t *table;
+    const __cjk_table_t *extra;     // JIS X 0212 for EUC-JP
+};
+
+static const struct uniconv_cjk CJK_ENCODINGS[] = {
+    { "SHIFTJIS",   CJK_KIND_SJIS,      CJK_SJIS_SINGLE,    &CJK_JIS0208,   NULL            },
+    { "CP932",      CJK_KIND_DOUBLE,    CJK_CP932_SINGLE,   &CJK_CP932,     NULL            },
+    { "EUCJP",      CJK_KIND_EUCJP,     CJK_EUCJP_SINGLE,   &CJK_JIS0208,   &CJK_JIS0212    },
+    { "GBK",        CJK_KIND_DOUBLE,    CJK_GB18030_SINGLE, &CJK_GB18030,   NULL            },
+    { "GB18030",    CJK_KIND_GB18030,   CJK_GB18030_SINGLE, &CJK_GB18030,   NULL            },
+    { "BIG5",       CJK_KIND_DOUBLE,    CJK_BIG5_SINGLE,    &CJK_BIG5,      NULL            },
+};
+
+// Other names for the above, by index.
+static const struct { const char *name; size_t index; } CJK_ALIASES[] = {
+    { "SJIS",       0 },
+    { "MSKANJI",    0 },
+    { "WINDOWS31J", 1 },
+    { "MS932",      1 },
+    { "CP936",      3 },
+    { "BIG5TW",     5 },
+};
+
+// Number of UTF-X chars needed for a codepoint.
+#define CJK_CHARS_8(c)          (__utf8_chars_for_codepoint(c))
+#define CJK_CHARS_16(c)         (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+#define CJK_CHARS_32(c)         (1)
+
+// Decode a single char, storing the number of chars it uses in `consumed`.
+// Return the utf8_validate style result for the char, or -1 if src ends partway through it.
+static inline int __cjk_decode(const uniconv_cjk_t *encoding, uint8_t *src, size_t src_size, size_t *consumed, unipoint_t *codepoint)
+{
+    const __cjk_table_t *table = encoding->table;
+    uint8_t leading_char = src[0];
+
+    (*consumed) = 1;
+
+    if (leading_char < UTF8_ONE_CHAR_LIMIT)
+    {
+        (*codepoint) = leading_char;
+        return 0;
+    }
+
+    uint16_t single = encoding->single[leading_char - 0x80];
+
+    if (single == CODEPAGE_UNMAPPED)
+        return 6;
+
+    if (single != CJK_LEAD)
+    {
+        (*codepoint) = single;
+        return 0;
+    }
+
+    if (src_size < 2)
+        return -1;
+
+    uint8_t lead = leading_char;
+    uint8_t trail = src[1];
+    size_t char_count = 2;
+
+    switch (encoding->kind)
+    {
+        case CJK_KIND_SJIS: {
+            if (trail < 0x40 || trail == 0x7F || trail > 0xFC)
+                return 4;
+
+            // Each Shift_JIS lead byte covers two JIS rows. Work out the row and column as EUC-JP bytes.
+            unsigned row = 2 * ((lead < 0xA0) ? (lead - 0x70) : (lead - 0xB0));
+
+            if (trail < 0x9F) {
+                row--;
+                trail = trail - 0x1F - ((trail >= 0x80) ? 1 : 0);
+            } else {
+                trail = trail - 0x7E;
+            }
+
+            // Leads past 0xEF are user defined rows, which have no mapping.
+            if (row + 0x80 > 0xFE)
+                return 8;
+
+            lead = row + 0x80;
+            trail += 0x80;
+
+            break;
+        }
+        case CJK_KIND_EUCJP: {
+            if (trail < 0xA1 || trail == 0xFF)
+                return 4;
+
+            // Half width katakana.
+            if (lead == 0x8E)
+            {
+                if (trail > 0xDF)
+                    return 8;
+
+                (*codepoint) = 0xFF61 + (trail - 0xA1);
+                (*consumed) = 2;
+
+                return 0;
+            }
+
+            // JIS X 0212 takes another char.
+            if (lead == 0x8F)
+            {
+                if (src_size < 3)
+                    return -1;
+
+                table = encoding->extra;
+                lead = trail;
+                trail = src[2];
+                char_count = 3;
+
+                if (trail < 0xA1 || trail == 0xFF)
+                    return 4;
+            }
+
+            break;
+        }
+        case CJK_KIND_GB18030: {
+            if (trail < 0x30 || trail > 0x39)
+                break;
+
+            // 4 char sequences alternate between bytes like lead bytes and digits.
+            if (src_size < 3)
+                return -1;
+
+            if (src[2] < 0x81 || src[2] > 0xFE)
+                return 4;
+
+            if (src_size < 4)
+                return -1;
+
+            if (src[3] < 0x30 || src[3] > 0x39)
+                return 4;
+
+            uint32_t linear = (((lead - 0x81) * 10 + (trail - 0x30)) * 126 + (src[2] - 0x81)) * 10 + (src[3] - 0x30);
+
+            (*consumed) = 4;
+
+            // Supplementary codepoints are in order starting from 90 30 81 30.
+            if (linear >= 189000 && linear - 189000 <= UNICODE_FINAL_POINT - UTF16_ONE_CHAR_LIMIT)
+            {
+                (*codepoint) = UTF16_ONE_CHAR_LIMIT + (linear - 189000);
+                return 0;
+            }
+
+            if (linear >= CJK_GB18030_BMP_END)
+                return 8;
+
+            // The rest of the BMP is in runs. Find the last one starting at or before this index.
+            size_t low = 0;
+            size_t high = sizeof(CJK_GB18030_RANGES) / sizeof(CJK_GB18030_RANGES[0]);
+
+            while (high - low > 1)
+            {
+                size_t middle = (low + high) / 2;
+
+                if (CJK_GB18030_RANGES[middle][0] <= linear) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+
+            (*codepoint) = CJK_GB18030_RANGES[low][1] + (linear - CJK_GB18030_RANGES[low][0]);
+
+            return 0;
+        }
+    }
+
+    // ASCII and control chars can't be trail bytes, and aren't consumed with the lead byte.
+    if (trail < table->trail_min || trail == 0x7F || trail == 0xFF)
+        return 4;
+
+    size_t row = table->lead_rows[lead];
+    size_t column = trail - table->trail_min;
+
+    if (!row || column >= table->trail_count)
+        return 8;
+
+    uint16_t mapped = table->rows[(row - 1) * table->trail_count + column];
+
+    if (mapped == CODEPAGE_UNMAPPED)
+        return 8;
+
+    (*codepoint) = mapped;
+    (*consumed) = char_count;
+
+    return 0;
+}
+
+const uniconv_cjk_t *uniconv_cjk(const char *name)
+{
+    char normal_name[24];
+
+    if (!__encoding_name_normalize(name, normal_name, sizeof(normal_name)))
+        return NULL;
+
+    for (size_t i = 0; i < sizeof(CJK_ENCODINGS) / sizeof(CJK_ENCODINGS[0]); i++)
+    {
+        if (!strcmp(normal_name, CJK_ENCODINGS[i].name))
+            return &CJK_ENCODINGS[i];
+    }
+
+    for (size_t i = 0; i < sizeof(CJK_ALIASES) / sizeof(CJK_ALIASES[0]); i++)
+    {
+        if (!strcmp(normal_name, CJK_ALIASES[i].name))
+            return &CJK_ENCODINGS[CJK_ALIASES[i].index];
+    }
+
+    return NULL;
+}
+
+const char *uniconv_cjk_name(const uniconv_cjk_t *encoding)
+{ return encoding->name; }
+
+#define CJK_TO_UTFX(X)                                                                                      \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        uint8_t *src_ptr = src;                                                                             \
+        uint8_t *src_end = src + src_size;                                                                  \
+                                                                                                            \
+        size_t consumed;                                                                                    \
+        unipoint_t codepoint;                                                                               \
+        int result;                                                                                         \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        /* Finish the char split over the end of the last buffer first. */                                  \
+        if (state && state->pending_count)                                                                  \
+        {                                                                                                   \
+            uint8_t sequence[4];                                                                            \
+            size_t held = state->pending_count;                                                             \
+            size_t available = held + ((src_size < 4 - held) ? src_size : (4 - held));                      \
+                                                                                                            \
+            memcpy(sequence, state->pending, held);                                                         \
+            memcpy(sequence + held, src, available - held);                                                 \
+                                                                                                            \
+            result = __cjk_decode(encoding, sequence, available, &consumed, &codepoint);                    \
+                                                                                                            \
+            /* Still not enough chars. Hold on to all of them. */                                           \
+            if (result < 0)                                                                                 \
+            {                                                                                               \
+                memcpy(state->pending, sequence, available);                                                \
+                state->pending_count = available;                                                           \
+                                                                                                            \
+                (*dest_size) = 0;                                                                           \
+                return src_size;                                                                            \
+            }                                                                                               \
+                                                                                                            \
+            /* The held chars were already counted as converted, so they're dropped. */                     \
+            if (result)                                                                                     \
+            {                                                                                               \
+                state->pending_count = 0;                                                                   \
+                                                                                                            \
+                (*status) = result;                                                                         \
+                (*dest_size) = 0;                                                                           \
+                                                                                                            \
+                return 0;                                                                                   \
+            }                                                                                               \
+                                                                                                            \
+            if (CJK_CHARS_ ## X(codepoint) > (size_t)(dest_end - dest))                                     \
+            {                                                                                               \
+                (*dest_size) = 0;                                                                           \
+                return 0;                                                                                   \
+            }                                                                                               \
+                                                                                                            \
+            dest += __utf ## X ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);                \
+            src += consumed - held;                                                                         \
+                                                                                                            \
+            state->pending_count = 0;                                                                       \
+        }                                                                                                   \
+                                                                                                            \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            /* Every one of these encodings is ASCII compatible. */                                         \
+            size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ?                   \
+                                  (size_t)(src_end - src) : (size_t)(dest_end - dest));                     \
+            size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);                              \
+                                                                                                            \
+            for (size_t i = 0; i < ascii_count; i++)                                                        \
+                dest[i] = __utf ## X ## _swap((utf ## X ## _char_t)src[i], swap);                           \
+                                                                                                            \
+            dest += ascii_count;                                                                            \
+            src += ascii_count;                                                                             \
+                                                                                                            \
+            if ((dest == dest_end) || (src == src_end))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            result = __cjk_decode(encoding, src, (src_end - src), &consumed, &codepoint);                   \
+                                                                                                            \
+            /* The buffer ends partway through a char. Keep the rest for next time if we can. */            \
+            if (result < 0)                                                                                 \
+            {                                                                                               \
+                if (state) {                                                                                \
+                    state->pending_count = (src_end - src);                                                 \
+                    memcpy(state->pending, src, state->pending_count);                                      \
+                                                                                                            \
+                    src = src_end;                                                                          \
+                } else {                                                                                    \
+                    (*status) = 4;                                                                          \
+                }                                                                                           \
+                                                                                                            \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                (*status) = result;                                                                         \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            /* Codepoints are never split over the end of the dest buffer. */                               \
+            if (CJK_CHARS_ ## X(codepoint) > (size_t)(dest_end - dest))                                     \
+                break;                                                                                      \
+                                                                                                            \
+            dest += __utf ## X ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);                \
+            src += consumed;                                                                                \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_cjk_to_utf8(utf8_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap)
+{ CJK_TO_UTFX(8); }
+
+size_t enc_cjk_to_utf16(utf16_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap)
+{ CJK_TO_UTFX(16); }
+
+size_t enc_cjk_to_utf32(utf32_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap)
+{ CJK_TO_UTFX(32); }
+
+#undef CJK_TO_UTFX
+#undef CJK_CHARS_32
+#undef CJK_CHARS_16
+#undef CJK_CHARS_8
+
+/* ********************************** */
+/* -*- iconv compatible functions -*- */
+/* ********************************** */
+
+// Byte orders of the UTF-16 and UTF-32 iconv encodings.
+#define ICONV_ORDER_BOM         0   // Host order unless a BOM says otherwise. A BOM is written on output.
+#define ICONV_ORDER_LITTLE      1
+#define ICONV_ORDER_BIG         2
+
+// An encoding known to the iconv functions.
+typedef struct {
+    const char *name;       // Upper case name with '-' and '_' removed
+    uint8_t unit_size;      // 1 for UTF-8 and single byte encodings, 2 for UTF-16, 4 for UTF-32
+    uint8_t byte_order;     // One of the ICONV_ORDER values above
+    unipoint_t limit;       // Final codepoint of single byte encodings, 0 for everything else
+} __iconv_encoding_t;
+
+static const __iconv_encoding_t ICONV_ENCODINGS[] = {
+    { "UTF8",           1, ICONV_ORDER_BOM,     0x00 },
+    { "UTF16",          2, ICONV_ORDER_BOM,     0x00 },
+    { "UTF16LE",        2, ICONV_ORDER_LITTLE,  0x00 },
+    { "UTF16BE",        2, ICONV_ORDER_BIG,     0x00 },
+    { "UTF32",          4, ICONV_ORDER_BOM,     0x00 },
+    { "UTF32LE",        4, ICONV_ORDER_LITTLE,  0x00 },
+    { "UTF32BE",        4, ICONV_ORDER_BIG,     0x00 },
+    { "ISO88591",       1, ICONV_ORDER_BOM,     0xFF },
+    { "LATIN1",         1, ICONV_ORDER_BOM,     0xFF },
+    { "ASCII",          1, ICONV_ORDER_BOM,     0x7F },
+    { "USASCII",        1, ICONV_ORDER_BOM,     0x7F },
+    { "ANSIX3.41968",   1, ICONV_ORDER_BOM,     0x7F }, // What the C locale calls ASCII
+};
+
+// Stands in for any of the single byte codepages, which have their own tables.
+static const __iconv_encoding_t ICONV_CODEPAGE_ENCODING = { "", 1, ICONV_ORDER_BOM, 0xFF };
+
+// Tags descriptors from uniconv_iconv_open, so the shim can tell them apart from the C library's own.
+static const uint32_t ICONV_MAGIC = 0x756E6963; // "unic"
+
+struct uniconv_iconv {
+    uint32_t magic;         // ICONV_MAGIC while the descriptor is open. Always the first field.
+
+    const __iconv_encoding_t *from;
+    const __iconv_encoding_t *to;
+
+    const uniconv_codepage_t *from_codepage;    // Only set for single byte codepages
+    const uniconv_codepage_t *to_codepage;
+
+    bool from_swap;         // Input is in the opposite byte order to the host
+    bool to_swap;           // Output is in the opposite byte order to the host
+    bool read_bom;          // Input may still start with a BOM
+    bool write_bom;         // Output still needs to start with a BOM
+
+    void *fallback;         // C library descriptor, for encodings only the shim passes on
+};
+
+#ifdef UNICONV_ICONV_SHIM
+
+// The C library's iconv functions, found past our own.
+static void *(*__libc_iconv_open)(const char *tocode, const char *fromcode);
+static size_t (*__libc_iconv)(void *cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+static int (*__libc_iconv_close)(void *cd);
+
+static pthread_once_t __libc_iconv_once = PTHREAD_ONCE_INIT;
+
+static void __libc_iconv_load(void)
+{
+    __libc_iconv_open = (void *(*)(const char *, const char *))dlsym(RTLD_NEXT, "iconv_open");
+    __libc_iconv = (size_t (*)(void *, char **, size_t *, char **, size_t *))dlsym(RTLD_NEXT, "iconv");
+    __libc_iconv_close = (int (*)(void *))dlsym(RTLD_NEXT, "iconv_close");
+}
+
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+// Find an encoding by name, ignoring case, '-' and '_'. Single byte codepages are stored in `codepage`.
+// Return NULL for encodings which aren't supported, including any with iconv's "//" suffixes.
+static const __iconv_encoding_t *__iconv_encoding(const char *name, const uniconv_codepage_t **codepage)
+{
+    char normal_name[24];
+
+    (*codepage) = NULL;
+
+    if (!__encoding_name_normalize(name, normal_name, sizeof(normal_name)))
+        return NULL;
+
+    for (size_t i = 0; i < sizeof(ICONV_ENCODINGS) / sizeof(ICONV_ENCODINGS[0]); i++)
+    {
+        if (!strcmp(normal_name, ICONV_ENCODINGS[i].name))
+            return &ICONV_ENCODINGS[i];
+    }
+
+    (*codepage) = uniconv_codepage(name);
+
+    return ((*codepage) ? &ICONV_CODEPAGE_ENCODING : NULL);
+}
+
+// Decode a single codepoint from the in_size bytes of `in`, storing the number of bytes used in `consumed`.
+// Return 0, EINVAL if the input ends partway through a sequence, or EILSEQ if it's malformed.
+static int __iconv_decode(uniconv_iconv_t cd, utf8_char_t *in, size_t in_size, unipoint_t *codepoint, size_t *consumed)
+{
+    switch (cd->from->unit_size)
+    {
+        case 1: {
+            if (cd->from_codepage)
+            {
+                (*codepoint) = cd->from_codepage->to_unicode[in[0]];
+                (*consumed) = 1;
+
+                return (((*codepoint) == CODEPAGE_UNMAPPED) ? EILSEQ : 0);
+            }
+
+            // Other single byte encodings map straight to codepoints.
+            if (cd->from->limit)
+            {
+                (*codepoint) = in[0];
+                (*consumed) = 1;
+
+                return (((*codepoint) > cd->from->limit) ? EILSEQ : 0);
+            }
+
+            int result = __utf8_sequence_check(in, in_size, consumed);
+
+            // The sequence is only incomplete if it could still turn out to be valid.
+            if (result == 4 && (*consumed) == in_size && 0xC2 <= in[0] && in[0] <= 0xF4)
+                return EINVAL;
+
+            if (result)
+                return EILSEQ;
+
+            (*codepoint) = __utf8_decode(in, (*consumed));
+
+            return 0;
+        }
+        case 2: {
+            utf16_char_t leading_char;
+            utf16_char_t trailing_char;
+
+            if (in_size < sizeof(utf16_char_t))
+                return EINVAL;
+
+            // The input isn't necessarily aligned.
+            memcpy(&leading_char, in, sizeof(utf16_char_t));
+            leading_char = __utf16_swap(leading_char, cd->from_swap);
+
+            (*codepoint) = leading_char;
+            (*consumed) = sizeof(utf16_char_t);
+
+            if (SURROGATE_LOW_START <= leading_char && leading_char <= SURROGATE_LOW_END)
+                return EILSEQ;
+
+            if (leading_char < SURROGATE_HIGH_START || leading_char > SURROGATE_HIGH_END)
+                return 0;
+
+            if (in_size < 2 * sizeof(utf16_char_t))
+                return EINVAL;
+
+            memcpy(&trailing_char, in + sizeof(utf16_char_t), sizeof(utf16_char_t));
+            trailing_char = __utf16_swap(trailing_char, cd->from_swap);
+
+            if (trailing_char < SURROGATE_LOW_START || trailing_char > SURROGATE_LOW_END)
+                return EILSEQ;
+
+            (*codepoint) = __utf16_decode(leading_char, trailing_char);
+            (*consumed) = 2 * sizeof(utf16_char_t);
+
+            return 0;
+        }
+        default: {
+            utf32_char_t c;
+
+            if (in_size < sizeof(utf32_char_t))
+                return EINVAL;
+
+            memcpy(&c, in, sizeof(utf32_char_t));
+
+            (*codepoint) = __utf32_swap(c, cd->from_swap);
+            (*consumed) = sizeof(utf32_char_t);
+
+            return ((__codepoint_is_valid(*codepoint)) ? EILSEQ : 0);
+        }
+    }
+}
+
+// Encode a single codepoint to `out`, which has room for out_size bytes.
+// Return the number of bytes used, 0 if there isn't enough room, or (size_t)-1 if the codepoint can't be encoded.
+static size_t __iconv_encode(uniconv_iconv_t cd, unipoint_t codepoint, utf8_char_t *out, size_t out_size)
+{
+    switch (cd->to->unit_size)
+    {
+        case 1: {
+            if (cd->to_codepage)
+            {
+                if (!out_size)
+                    return 0;
+
+                int byte = __codepage_byte(cd->to_codepage, codepoint);
+
+                if (byte < 0)
+                    return (size_t)-1;
+
+                (*out) = (uint8_t)byte;
+
+                return 1;
+            }
+
+            if (cd->to->limit)
+            {
+                // A full buffer is reported before an unencodable codepoint, like the C library does.
+                if (!out_size)
+                    return 0;
+
+                if (codepoint > cd->to->limit)
+                    return (size_t)-1;
+
+                (*out) = (utf8_char_t)codepoint;
+
+                return 1;
+            }
+
+            size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+            if (char_count > out_size)
+                return 0;
+
+            return __utf8_from_codepoint(codepoint, out, char_count, false);
+        }
+        case 2: {
+            utf16_char_t chars[2];
+            size_t char_count = ((codepoint < UTF16_ONE_CHAR_LIMIT) ? 1 : 2);
+
+            if (char_count * sizeof(utf16_char_t) > out_size)
+                return 0;
+
+            __utf16_from_codepoint(codepoint, chars, char_count, cd->to_swap);
+            memcpy(out, chars, char_count * sizeof(utf16_char_t));
+
+            return char_count * sizeof(utf16_char_t);
+        }
+        default: {
+            utf32_char_t c = __utf32_swap(codepoint, cd->to_swap);
+
+            if (out_size < sizeof(utf32_char_t))
+                return 0;
+
+            memcpy(out, &c, sizeof(utf32_char_t));
+
+            return sizeof(utf32_char_t);
+        }
+    }
+}
+
+// Convert as much of `in` as a bulk kernel can handle for this pair of encodings.
+// Every kernel here stops right before anything it can't convert, which is then left to the
+//   single codepoint path. Store the number of bytes read and written in in_used and out_used.
+static void __iconv_bulk(uniconv_iconv_t cd, utf8_char_t *in, size_t in_size, utf8_char_t *out, size_t out_size, size_t *in_used, size_t *out_used)
+{
+    const __iconv_encoding_t *from = cd->from;
+    const __iconv_encoding_t *to = cd->to;
+
+    (*in_used) = 0;
+    (*out_used) = 0;
+
+    // Codepages have their own kernels to and from UTF-8, and can't share the ASCII paths below.
+    if (cd->from_codepage || cd->to_codepage)
+    {
+        int status;
+        size_t dest_size = out_size;
+
+        if (cd->from_codepage && to->unit_size == 1 && !to->limit) {
+            (*in_used) = enc_codepage_to_utf8(out, &dest_size, in, in_size, cd->from_codepage, &status, false);
+            (*out_used) = dest_size;
+        } else if (cd->to_codepage && from->unit_size == 1 && !from->limit) {
+            (*in_used) = enc_utf8_to_codepage(out, &dest_size, in, in_size, cd->to_codepage, &status, false);
+            (*out_used) = dest_size;
+        }
+
+        return;
+    }
+
+    if (from->unit_size == 1 && !from->limit)
+    {
+        // UTF-8 to UTF-16 and UTF-32 have their own kernels, as long as the output is aligned.
+        if (to->unit_size == 2 && !((uintptr_t)out % sizeof(utf16_char_t)))
+        {
+            int status;
+            size_t dest_size = out_size / sizeof(utf16_char_t);
+
+            (*in_used) = enc_utf8_to_utf16_optimistic((utf16_char_t *)out, &dest_size, in, in_size, &status, cd->to_swap);
+            (*out_used) = dest_size * sizeof(utf16_char_t);
+        } else if (to->unit_size == 4 && !((uintptr_t)out % sizeof(utf32_char_t))) {
+            int status;
+            size_t dest_size = out_size / sizeof(utf32_char_t);
+
+            (*in_used) = __utf8_to_utf32_checked((utf32_char_t *)out, &dest_size, in, in_size, &status, cd->to_swap);
+            (*out_used) = dest_size * sizeof(utf32_char_t);
+        } else if (to->unit_size == 1) {
+            // ASCII is the same in UTF-8 and every single byte encoding.
+            size_t ascii_count = __utf8_ascii_prefix(in, ((in_size < out_size) ? in_size : out_size), false);
+
+            memcpy(out, in, ascii_count);
+
+            (*in_used) = ascii_count;
+            (*out_used) = ascii_count;
+        }
+    } else if (to->unit_size == 1 && !to->limit) {
+        // ASCII runs narrow straight into UTF-8.
+        size_t limit = ((in_size / from->unit_size < out_size) ? in_size / from->unit_size : out_size);
+        size_t ascii_count = 0;
+
+        if (from->unit_size == 1) {
+            ascii_count = __utf8_ascii_prefix(in, limit, false);
+
+            memcpy(out, in, ascii_count);
+        } else if (from->unit_size == 2 && !((uintptr_t)in % sizeof(utf16_char_t))) {
+            ascii_count = __utf16_ascii_prefix((utf16_char_t *)in, limit, cd->from_swap);
+
+            for (size_t i = 0; i < ascii_count; i++)
+                out[i] = (utf8_char_t)__utf16_swap(((utf16_char_t *)in)[i], cd->from_swap);
+        } else if (from->unit_size == 4 && !((uintptr_t)in % sizeof(utf32_char_t))) {
+            ascii_count = __utf32_ascii_prefix((utf32_char_t *)in, limit, cd->from_swap);
+
+            for (size_t i = 0; i < ascii_count; i++)
+                out[i] = (utf8_char_t)__utf32_swap(((utf32_char_t *)in)[i], cd->from_swap);
+        }
+
+        (*in_used) = ascii_count * from->unit_size;
+        (*out_used) = ascii_count;
+    }
+}
+
+uniconv_iconv_t uniconv_iconv_open(const char *tocode, const char *fromcode)
+{
+    const uniconv_codepage_t *to_codepage;
+    const uniconv_codepage_t *from_codepage;
+    const __iconv_encoding_t *to = __iconv_encoding(tocode, &to_codepage);
+    const __iconv_encoding_t *from = __iconv_encoding(fromcode, &from_codepage);
+    void *fallback = NULL;
+
+    if (!to || !from)
+    {
+#ifdef UNICONV_ICONV_SHIM
+        // Pass anything we don't handle on to the C library.
+        pthread_once(&__libc_iconv_once, __libc_iconv_load);
+
+        if (__libc_iconv_open)
+            fallback = __libc_iconv_open(tocode, fromcode);
+
+        if (fallback == (void *)-1)
+            return (uniconv_iconv_t)-1;
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+        if (!fallback)
+        {
+            errno = EINVAL;
+            return (uniconv_iconv_t)-1;
+        }
+    }
+
+    uniconv_iconv_t cd = calloc(1, sizeof(struct uniconv_iconv));
+
+    if (!cd)
+    {
+#ifdef UNICONV_ICONV_SHIM
+        if (fallback)
+            __libc_iconv_close(fallback);
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+        errno = ENOMEM;
+        return (uniconv_iconv_t)-1;
+    }
+
+    cd->magic = ICONV_MAGIC;
+    cd->from = from;
+    cd->to = to;
+    cd->from_codepage = from_codepage;
+    cd->to_codepage = to_codepage;
+    cd->fallback = fallback;
+
+    if (fallback)
+        return cd;
+
+    // Named byte orders are relative to the host. A BOM, if any, decides the input byte order later.
+    cd->from_swap = (from->byte_order == (__host_big_endian ? ICONV_ORDER_LITTLE : ICONV_ORDER_BIG));
+    cd->to_swap = (to->byte_order == (__host_big_endian ? ICONV_ORDER_LITTLE : ICONV_ORDER_BIG));
+
+    cd->read_bom = (from->unit_size > 1 && from->byte_order == ICONV_ORDER_BOM);
+    cd->write_bom = (to->unit_size > 1 && to->byte_order == ICONV_ORDER_BOM);
+
+    return cd;
+}
+
+size_t uniconv_iconv(uniconv_iconv_t cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft)
+{
+#ifdef UNICONV_ICONV_SHIM
+    if (cd->fallback)
+        return __libc_iconv(cd->fallback, inbuf, inbytesleft, outbuf, outbytesleft);
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+    // There are no shift states to reset, so there's nothing to write here.
+    if (!inbuf || !(*inbuf))
+        return 0;
+
+    utf8_char_t *in = (utf8_char_t *)(*inbuf);
+    utf8_char_t *out = (utf8_char_t *)(*outbuf);
+    size_t in_size = (*inbytesleft);
+    size_t out_size = (*outbytesleft);
+    int error = 0;
+
+    // Use the input BOM to pick the byte order, and drop it.
+    if (cd->read_bom && in_size >= cd->from->unit_size)
+    {
+        utf32_char_t bom;
+        utf32_char_t swapped_bom;
+
+        if (cd->from->unit_size == 2) {
+            utf16_char_t c;
+            memcpy(&c, in, sizeof(c));
+
+            bom = c;
+            swapped_bom = __byte_swap_16(0xFEFF);
+        } else {
+            memcpy(&bom, in, sizeof(bom));
+
+            swapped_bom = __byte_swap_32(0xFEFF);
+        }
+
+        if (bom == 0xFEFF || bom == swapped_bom)
+        {
+            cd->from_swap = (bom == swapped_bom);
+            in += cd->from->unit_size;
+            in_size -= cd->from->unit_size;
+        }
+
+        cd->read_bom = false;
+    }
+
+    while (in_size)
+    {
+        // The output BOM goes out along with the first codepoint, so hold off on the bulk kernels until then.
+        if (!cd->write_bom)
+        {
+            size_t in_used;
+            size_t out_used;
+
+            __iconv_bulk(cd, in, in_size, out, out_size, &in_used, &out_used);
+
+            in += in_used;
+            in_size -= in_used;
+            out += out_used;
+            out_size -= out_used;
+
+            if (!in_size)
+                break;
+        }
+
+        // Whatever stopped the bulk kernel is handled one codepoint at a time.
+        unipoint_t codepoint;
+        size_t consumed;
+
+        error = __iconv_decode(cd, in, in_size, &codepoint, &consumed);
+
+        if (error)
+            break;
+
+        // Start the output with a BOM in host order.
+        if (cd->write_bom)
+        {
+            size_t bom_size = __iconv_encode(cd, 0xFEFF, out, out_size);
+
+            if (!bom_size)
+            {
+                error = E2BIG;
+                break;
+            }
+
+            out += bom_size;
+            out_size -= bom_size;
+            cd->write_bom = false;
+        }
+
+        size_t written = __iconv_encode(cd, codepoint, out, out_size);
+
+        if (written == (size_t)-1 || !written)
+        {
+            error = ((written) ? EILSEQ : E2BIG);
+            break;
+        }
+
+        in += consumed;
+        in_size -= consumed;
+        out += written;
+        out_size -= written;
+    }
+
+    // The pointers always end up right after the last codepoint converted.
+    (*inbuf) = (char *)in;
+    (*inbytesleft) = in_size;
+    (*outbuf) = (char *)out;
+    (*outbytesleft) = out_size;
+
+    if (error)
+    {
+        errno = error;
+        return (size_t)-1;
+    }
+
+    // Nothing is ever converted irreversibly.
+    return 0;
+}
+
+int uniconv_iconv_close(uniconv_iconv_t cd)
+{
+#ifdef UNICONV_ICONV_SHIM
+    if (cd->fallback)
+        __libc_iconv_close(cd->fallback);
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+    // Don't let a stale descriptor pass for one of ours.
+    cd->magic = 0;
+    free(cd);
+
+    return 0;
+}
+
+#ifdef UNICONV_ICONV_SHIM
+
+// Check if a descriptor passed to the shim came from uniconv_iconv_open. Programs can also get
+//   descriptors from the C library without going through iconv_open (glibc's iconv program uses
+//   __gconv_open), and those have to go back to the C library untouched.
+// Every C library descriptor is an allocation at least as large as the tag, so reading it is safe.
+static bool __iconv_is_ours(void *cd)
+{
+    return (cd && cd != (void *)-1 && ((struct uniconv_iconv *)cd)->magic == ICONV_MAGIC);
+}
+
+// The shim exports the iconv functions themselves, so linking against this (or preloading it)
+//   speeds up existing callers without any changes to them.
+void *iconv_open(const char *tocode, const char *fromcode)
+{
+    return uniconv_iconv_open(tocode, fromcode);
+}
+
+size_t iconv(void *cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft)
+{
+    if (__iconv_is_ours(cd))
+        return uniconv_iconv(cd, inbuf, inbytesleft, outbuf, outbytesleft);
+
+    pthread_once(&__libc_iconv_once, __libc_iconv_load);
+
+    if (!__libc_iconv)
+    {
+        errno = EBADF;
+        return (size_t)-1;
+    }
+
+    return __libc_iconv(cd, inbuf, inbytesleft, outbuf, outbytesleft);
+}
+
+int iconv_close(void *cd)
+{
+    if (__iconv_is_ours(cd))
+        return uniconv_iconv_close(cd);
+
+    pthread_once(&__libc_iconv_once, __libc_iconv_load);
+
+    if (!__libc_iconv_close)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    return __libc_iconv_close(cd);
+}
+
+#endif /* defined(UNICONV_ICONV_SHIM) */
+
+/* ****************************************************** */
+/* -*- Modified UTF-8 and CESU-8 conversion functions -*- */
+/* ****************************************************** */
+
+// CESU-8 is UTF-8 applied to UTF-16 chars. Supplementary codepoints are a surrogate pair of 3 char sequences.
+// Modified UTF-8 (as used by Java and JNI) is the same, except that U+0000 is encoded as C0 80.
+
+// Check and decode a single CESU-8 (or Modified UTF-8) sequence, storing the number of chars it uses in `consumed`.
+// Return the utf8_validate style result for the sequence.
+static inline int __cesu8_sequence_check(utf8_char_t *src, size_t src_size, size_t *consumed, unipoint_t *codepoint, bool modified)
+{
+    utf8_char_t leading_char = (*src);
+
+    // Modified UTF-8 has a 2 char encoding of U+0000. Everywhere else, this is overlong.
+    if (modified && leading_char == 0xC0 && src_size >= 2 && src[1] == 0x80)
+    {
+        (*codepoint) = 0;
+        (*consumed) = 2;
+
+        return 0;
+    }
+
+    // There are no 4 char sequences.
+    if (leading_char >= 0xF0)
+    {
+        (*consumed) = 1;
+        return 6;
+    }
+
+    // Anything but a surrogate is checked like regular UTF-8.
+    if (leading_char != 0xED || src_size < 3 || src[1] < 0xA0 || src[1] > 0xBF || (src[2] & 0xC0) != 0x80)
+    {
+        int result = __utf8_sequence_check(src, src_size, consumed);
+
+        if (!result)
+            (*codepoint) = __utf8_decode(src, (*consumed));
+
+        return result;
+    }
+
+    utf16_char_t leading_surrogate = (utf16_char_t)__utf8_decode(src, 3);
+
+    (*consumed) = 3;
+
+    if (leading_surrogate > SURROGATE_HIGH_END)
+        return 2;
+
+    // A high surrogate has to be followed by an encoded low surrogate.
+    if (src_size < 6 || src[3] != 0xED || src[4] < 0xB0 || src[4] > 0xBF || (src[5] & 0xC0) != 0x80)
+        return 1;
+
+    (*codepoint) = __utf16_decode(leading_surrogate, (utf16_char_t)__utf8_decode(src + 3, 3));
+    (*consumed) = 6;
+
+    return 0;
+}
+
+// Encode a single codepoint as CESU-8 (or Modified UTF-8) in the provided buffer.
+// Return the number of chars used, or 0 if there isn't enough room.
+static inline size_t __cesu8_from_codepoint(unipoint_t codepoint, utf8_char_t *dest, size_t dest_size, bool modified)
+{
+    if (modified && !codepoint)
+    {
+        if (dest_size < 2)
+            return 0;
+
+        dest[0] = 0xC0;
+        dest[1] = 0x80;
+
+        return 2;
+    }
+
+    if (codepoint < UTF16_ONE_CHAR_LIMIT)
+    {
+        size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+        if (char_count > dest_size)
+            return 0;
+
+        return __utf8_from_codepoint(codepoint, dest, char_count, false);
+    }
+
+    if (dest_size < 6)
+        return 0;
+
+    // Surrogates encode to 3 chars just like any other codepoint in their range.
+    codepoint -= UTF16_ONE_CHAR_LIMIT;
+
+    __utf8_from_codepoint(((codepoint >> 10) & 0x3FF) | SURROGATE_HIGH_START, dest + 0, 3, false);
+    __utf8_from_codepoint(((codepoint >>  0) & 0x3FF) | SURROGATE_LOW_START,  dest + 3, 3, false);
+
+    return 6;
+}
+
+// Conversions between CESU-8 (or Modified UTF-8 if `modified` is set) and UTF-8/16.
+// All of these stop right before the first malformed sequence, storing its utf8_validate style result in `status`.
+// ASCII runs are copied a word at a time, except that Modified UTF-8 stops at NULL chars to encode them.
+static size_t __utf8_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool modified)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        if (modified)
+        {
+            utf8_char_t *null_char = memchr(src, 0, ascii_count);
+
+            if (null_char)
+                ascii_count = (null_char - src);
+        }
+
+        memcpy(dest, src, ascii_count);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        size_t written = __cesu8_from_codepoint(__utf8_decode(src, consumed), dest, (dest_end - dest), modified);
+
+        if (!written)
+            break;
+
+        dest += written;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+static size_t __cesu8_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool modified)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        memcpy(dest, src, ascii_count);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        unipoint_t codepoint;
+        int result = __cesu8_sequence_check(src, (src_end - src), &consumed, &codepoint, modified);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+        if (char_count > (size_t)(dest_end - dest))
+            break;
+
+        dest += __utf8_from_codepoint(codepoint, dest, char_count, false);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+static size_t __utf16_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool modified, bool swap)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf16_char_t *src_ptr = src;
+    utf16_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf16_ascii_prefix(src, ascii_limit, swap);
+
+        for (size_t i = 0; i < ascii_count; i++)
+        {
+            // Modified UTF-8 never has NULL chars.
+            if (modified && !src[i])
+            {
+                ascii_count = i;
+                break;
+            }
+
+            dest[i] = (utf8_char_t)__utf16_swap(src[i], swap);
+        }
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        utf16_char_t c = __utf16_swap(*src, swap);
+
+        // Only proper surrogate pairs are allowed, even though they're encoded separately.
+        if (SURROGATE_LOW_START <= c && c <= SURROGATE_LOW_END)
+        {
+            (*status) = 2;
+            break;
+        }
+
+        size_t consumed = 1;
+        unipoint_t codepoint = c;
+
+        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_HIGH_END)
+        {
+            utf16_char_t trailing_char = ((src + 1 < src_end) ? __utf16_swap(src[1], swap) : 0);
+
+            if (trailing_char < SURROGATE_LOW_START || trailing_char > SURROGATE_LOW_END)
+            {
+                (*status) = 1;
+                break;
+            }
+
+            codepoint = __utf16_decode(c, trailing_char);
+            consumed = 2;
+        }
+
+        size_t written = __cesu8_from_codepoint(codepoint, dest, (dest_end - dest), modified);
+
+        if (!written)
+            break;
+
+        dest += written;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+static size_t __cesu8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool modified, bool swap)
+{
+    utf16_char_t *dest_ptr = dest;
+    utf16_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        for (size_t i = 0; i < ascii_count; i++)
+            dest[i] = __utf16_swap((utf16_char_t)src[i], swap);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        unipoint_t codepoint;
+        int result = __cesu8_sequence_check(src, (src_end - src), &consumed, &codepoint, modified);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        // Don't split a surrogate pair over the end of the buffer.
+        if (codepoint >= UTF16_ONE_CHAR_LIMIT && (dest_end - dest) < 2)
+            break;
+
+        dest += __utf16_from_codepoint(codepoint, dest, (dest_end - dest), swap);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t enc_utf8_to_mutf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{ return __utf8_to_cesu8(dest, dest_size, src, src_size, status, true); }
+
+size_t enc_utf8_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{ return __utf8_to_cesu8(dest, dest_size, src, src_size, status, false); }
+
+size_t enc_mutf8_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{ return __cesu8_to_utf8(dest, dest_size, src, src_size, status, true); }
+
+size_t enc_cesu8_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{ return __cesu8_to_utf8(dest, dest_size, src, src_size, status, false); }
+
+size_t enc_utf16_to_mutf8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap)
+{ return __utf16_to_cesu8(dest, dest_size, src, src_size, status, true, swap); }
+
+size_t enc_utf16_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap)
+{ return __utf16_to_cesu8(dest, dest_size, src, src_size, status, false, swap); }
+
+size_t enc_mutf8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ return __cesu8_to_utf16(dest, dest_size, src, src_size, status, true, swap); }
+
+size_t enc_cesu8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ return __cesu8_to_utf16(dest, dest_size, src, src_size, status, false, swap); }
+
+/* ********************************** */
+/* -*- WTF-8 conversion functions -*- */
+/* ********************************** */
+
+// WTF-8 is UTF-8 which may also contain surrogates, each encoded as a 3 char sequence.
+// Only unpaired surrogates are encoded that way. Pairs are always encoded as a single 4 char sequence.
+
+// Check and decode a single WTF-8 sequence, storing the number of chars it uses in `consumed`.
+// Return the utf8_validate style result for the sequence.
+static inline int __wtf8_sequence_check(utf8_char_t *src, size_t src_size, size_t *consumed, unipoint_t *codepoint)
+{
+    // Anything but a surrogate is checked like regular UTF-8.
+    if (src[0] != 0xED || src_size < 3 || src[1] < 0xA0 || (src[1] & 0xC0) != 0x80 || (src[2] & 0xC0) != 0x80)
+    {
+        int result = __utf8_sequence_check(src, src_size, consumed);
+
+        if (!result)
+            (*codepoint) = __utf8_decode(src, (*consumed));
+
+        return result;
+    }
+
+    (*codepoint) = __utf8_decode(src, 3);
+    (*consumed) = 3;
+
+    // A high surrogate followed by a low surrogate should have been encoded as a single codepoint.
+    if ((*codepoint) <= SURROGATE_HIGH_END && src_size >= 6 && src[3] == 0xED && 0xB0 <= src[4] && src[4] <= 0xBF && (src[5] & 0xC0) == 0x80)
+        return 2;
+
+    return 0;
+}
+
+// Get the length of the prefix of src without any surrogates, checking 4 chars at a time.
+static inline size_t __utf16_surrogate_free_prefix(utf16_char_t *src, size_t src_size, bool swap)
+{
+    // A char is a surrogate if its top 5 bits are 0b11011. The masks are the same for both byte orders,
+    //   just swapped. Lanes which are zero after masking and flipping are surrogates.
+    uint64_t mask = ((swap) ? 0x00F800F800F800F8ULL : 0xF800F800F800F800ULL);
+    uint64_t surrogate = ((swap) ? 0x00D800D800D800D8ULL : 0xD800D800D800D800ULL);
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        word = (word & mask) ^ surrogate;
+
+        // Classic zero lane check.
+        if ((word - 0x0001000100010001ULL) & ~word & 0x8000800080008000ULL)
+            break;
+    }
+
+    while (i < src_size && (__utf16_swap(src[i], swap) & 0xF800) != SURROGATE_HIGH_START)
+        i++;
+
+    return i;
+}
+
+size_t enc_utf16_to_wtf8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf16_char_t *src_ptr = src;
+    utf16_char_t *src_end = src + src_size;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf16_ascii_prefix(src, ascii_limit, swap);
+
+        for (size_t i = 0; i < ascii_count; i++)
+            dest[i] = (utf8_char_t)__utf16_swap(src[i], swap);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        utf16_char_t c = __utf16_swap(*src, swap);
+        unipoint_t codepoint = c;
+        size_t consumed = 1;
+
+        // Surrogate pairs are joined. Anything else, including lone surrogates, is encoded as it is.
+        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_HIGH_END && src + 1 < src_end)
+        {
+            utf16_char_t trailing_char = __utf16_swap(src[1], swap);
+
+            if (SURROGATE_LOW_START <= trailing_char && trailing_char <= SURROGATE_LOW_END)
+            {
+                codepoint = __utf16_decode(c, trailing_char);
+                consumed = 2;
+            }
+        }
+
+        size_t char_count = __utf8_chars_for_codepoint(codepoint);
+
+        if (char_count > (size_t)(dest_end - dest))
+            break;
+
+        dest += __utf8_from_codepoint(codepoint, dest, char_count, false);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t enc_wtf8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{
+    utf16_char_t *dest_ptr = dest;
+    utf16_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        for (size_t i = 0; i < ascii_count; i++)
+            dest[i] = __utf16_swap((utf16_char_t)src[i], swap);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        unipoint_t codepoint;
+        int result = __wtf8_sequence_check(src, (src_end - src), &consumed, &codepoint);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        // Don't split a surrogate pair over the end of the buffer.
+        if (codepoint >= UTF16_ONE_CHAR_LIMIT && (dest_end - dest) < 2)
+            break;
+
+        dest += __utf16_from_codepoint(codepoint, dest, (dest_end - dest), swap);
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t utf16_fix_lone_surrogates(utf16_char_t *str, size_t str_size, bool swap)
+{
+    utf16_char_t replacement = __utf16_swap((utf16_char_t)UNICODE_REPL_CHAR, swap);
+    size_t replaced = 0;
+    size_t i = 0;
+
+    while (i < str_size)
+    {
+        // Most strings have no surrogates at all, so skip those a word at a time.
+        i += __utf16_surrogate_free_prefix(str + i, str_size - i, swap);
+
+        if (i == str_size)
+            break;
+
+        utf16_char_t c = __utf16_swap(str[i], swap);
+
+        // Leave proper pairs alone.
+        if (c <= SURROGATE_HIGH_END && i + 1 < str_size)
+        {
+            utf16_char_t trailing_char = __utf16_swap(str[i + 1], swap);
+
+            if (SURROGATE_LOW_START <= trailing_char && trailing_char <= SURROGATE_LOW_END)
+            {
+                i += 2;
+                continue;
+            }
+        }
+
+        str[i++] = replacement;
+        replaced++;
+    }
+
+    return replaced;
+}
+
+/* ***************************** */
+/* -*- JSON string functions -*- */
+/* ***************************** */
+
+// Short escapes for control chars, or 0 for those which need a \u escape.
+static const char JSON_SHORT_ESCAPES[0x20] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   'b', 't', 'n', 0,   'f', 'r', 0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+// Get the length of the prefix of src which can be copied into or out of a JSON string as it is.
+// That's every ASCII char except controls, quotes and backslashes.
+static inline size_t __json_plain_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        // Lanes which are zero after flipping are quotes or backslashes.
+        uint64_t quotes = word ^ 0x2222222222222222ULL;
+        uint64_t backslashes = word ^ 0x5C5C5C5C5C5C5C5CULL;
+
+        // Any lane below 0x20 borrows into its high bit, and non-ASCII lanes already have it set.
+        uint64_t special = (word | (word - 0x2020202020202020ULL) |
+                            ((quotes - WORD_LOW_BITS) & ~quotes) |
+                            ((backslashes - WORD_LOW_BITS) & ~backslashes));
+
+        if (special & WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && src[i] >= 0x20 && src[i] < UTF8_ONE_CHAR_LIMIT && src[i] != '"' && src[i] != '\\')
+        i++;
+
+    return i;
+}
+
+// Parse the 4 hex digits of a \u escape. Return false if any of them isn't a hex digit.
+static inline bool __json_hex4(utf8_char_t *src, unipoint_t *value)
+{
+    (*value) = 0;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        utf8_char_t c = src[i];
+        unipoint_t digit;
+
+        if ('0' <= c && c <= '9') {
+            digit = c - '0';
+        } else if ('a' <= (c | 0x20) && (c | 0x20) <= 'f') {
+            digit = (c | 0x20) - 'a' + 10;
+        } else {
+            return false;
+        }
+
+        (*value) = ((*value) << 4) | digit;
+    }
+
+    return true;
+}
+
+// Check and decode a single escape or UTF-8 sequence of a JSON string, storing the number of chars
+//   it uses in `consumed`. Return the utf8_validate style result for the sequence.
+static inline int __json_unescape(utf8_char_t *src, size_t src_size, size_t *consumed, unipoint_t *codepoint)
+{
+    if (src[0] >= UTF8_ONE_CHAR_LIMIT)
+    {
+        int result = __utf8_sequence_check(src, src_size, consumed);
+
+        if (!result)
+            (*codepoint) = __utf8_decode(src, (*consumed));
+
+        return result;
+    }
+
+    // Quotes and control chars must be escaped.
+    if (src[0] != '\\' || src_size < 2)
+        return 9;
+
+    (*consumed) = 2;
+
+    switch (src[1])
+    {
+        case '"':  (*codepoint) = '"';  return 0;
+        case '\\': (*codepoint) = '\\'; return 0;
+        case '/':  (*codepoint) = '/';  return 0;
+        case 'b':  (*codepoint) = '\b'; return 0;
+        case 'f':  (*codepoint) = '\f'; return 0;
+        case 'n':  (*codepoint) = '\n'; return 0;
+        case 'r':  (*codepoint) = '\r'; return 0;
+        case 't':  (*codepoint) = '\t'; return 0;
+        case 'u':  break;
+        default:   return 9;
+    }
+
+    if (src_size < 6 || !__json_hex4(src + 2, codepoint))
+        return 9;
+
+    (*consumed) = 6;
+
+    if ((*codepoint) < SURROGATE_HIGH_START || (*codepoint) > SURROGATE_LOW_END)
+        return 0;
+
+    if ((*codepoint) >= SURROGATE_LOW_START)
+        return 2;
+
+    // Supplementary codepoints are escaped as a surrogate pair.
+    unipoint_t trailing_char;
+
+    if (src_size < 12 || src[6] != '\\' || src[7] != 'u' || !__json_hex4(src + 8, &trailing_char) ||
+        trailing_char < SURROGATE_LOW_START || trailing_char > SURROGATE_LOW_END)
+        return 1;
+
+    (*codepoint) = __utf16_decode((*codepoint), trailing_char);
+    (*consumed) = 12;
+
+    return 0;
+}
+
+size_t enc_utf8_to_json(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t plain_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t plain_count = __json_plain_prefix(src, plain_limit);
+
+        memcpy(dest, src, plain_count);
+
+        dest += plain_count;
+        src += plain_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        utf8_char_t c = *src;
+
+        // Valid sequences are copied as they are.
+        if (c >= UTF8_ONE_CHAR_LIMIT)
+        {
+            size_t consumed;
+            int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+            if (result)
+            {
+                (*status) = result;
+                break;
+            }
+
+            if (consumed > (size_t)(dest_end - dest))
+                break;
+
+            memcpy(dest, src, consumed);
+
+            dest += consumed;
+            src += consumed;
+
+            continue;
+        }
+
+        // Escapes are never split over the end of the dest buffer.
+        if (c == '"' || c == '\\' || JSON_SHORT_ESCAPES[c])
+        {
+            if ((dest_end - dest) < 2)
+                break;
+
+            dest[0] = '\\';
+            dest[1] = ((c < 0x20) ? JSON_SHORT_ESCAPES[c] : c);
+            dest += 2;
+        } else {
+            if ((dest_end - dest) < 6)
+                break;
+
+            memcpy(dest, "\\u00", 4);
+            dest[4] = "0123456789abcdef"[c >> 4];
+            dest[5] = "0123456789abcdef"[c & 0xF];
+            dest += 6;
+        }
+
+        src++;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+// Number of UTF-X chars needed for a codepoint.
+#define JSON_CHARS_8(c)         (__utf8_chars_for_codepoint(c))
+#define JSON_CHARS_16(c)        (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+
+#define JSON_TO_UTFX(X)                                                                                     \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf8_char_t *src_ptr = src;                                                                         \
+        utf8_char_t *src_end = src + src_size;                                                              \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            size_t plain_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ?                   \
+                                  (size_t)(src_end - src) : (size_t)(dest_end - dest));                     \
+            size_t plain_count = __json_plain_prefix(src, plain_limit);                                     \
+                                                                                                            \
+            for (size_t i = 0; i < plain_count; i++)                                                        \
+                dest[i] = __utf ## X ## _swap((utf ## X ## _char_t)src[i], swap);                           \
+                                                                                                            \
+            dest += plain_count;                                                                            \
+            src += plain_count;                                                                             \
+                                                                                                            \
+            if ((dest == dest_end) || (src == src_end))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            size_t consumed;                                                                                \
+            unipoint_t codepoint;                                                                           \
+            int result = __json_unescape(src, (src_end - src), &consumed, &codepoint);                      \
+                                                                                                            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                (*status) = result;                                                                         \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            /* Codepoints are never split over the end of the dest buffer. */                               \
+            if (JSON_CHARS_ ## X(codepoint) > (size_t)(dest_end - dest))                                    \
+                break;                                                                                      \
+                                                                                                            \
+            dest += __utf ## X ## _from_codepoint(codepoint, dest, (dest_end - dest), swap);                \
+            src += consumed;                                                                                \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_json_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ JSON_TO_UTFX(8); }
+
+size_t enc_json_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ JSON_TO_UTFX(16); }
+
+#undef JSON_TO_UTFX
+#undef JSON_CHARS_16
+#undef JSON_CHARS_8
+
+/* ****************************** */
+/* -*- URL decoding functions -*- */
+/* ****************************** */
+
+// Get the length of the prefix of src which decodes to itself. That's every ASCII char but '%'.
+static inline size_t __url_plain_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        // Lanes which are zero after flipping are percent signs.
+        uint64_t percents = word ^ 0x2525252525252525ULL;
+
+        if ((word | ((percents - WORD_LOW_BITS) & ~percents)) & WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && src[i] < UTF8_ONE_CHAR_LIMIT && src[i] != '%')
+        i++;
+
+    return i;
+}
+
+// Decode a single char, which may be percent encoded, storing the number of chars it uses in `consumed`.
+// Return false for a malformed percent encoding.
+static inline bool __url_byte(utf8_char_t *src, size_t src_size, size_t *consumed, utf8_char_t *byte)
+{
+    (*consumed) = 1;
+    (*byte) = src[0];
+
+    if (src[0] != '%')
+        return true;
+
+    if (src_size < 3)
+        return false;
+
+    unipoint_t value = 0;
+
+    for (size_t i = 1; i < 3; i++)
+    {
+        utf8_char_t c = src[i];
+
+        if ('0' <= c && c <= '9') {
+            value = (value << 4) | (c - '0');
+        } else if ('a' <= (c | 0x20) && (c | 0x20) <= 'f') {
+            value = (value << 4) | ((c | 0x20) - 'a' + 10);
+        } else {
+            return false;
+        }
+    }
+
+    (*consumed) = 3;
+    (*byte) = value;
+
+    return true;
+}
+
+size_t enc_url_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t plain_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t plain_count = __url_plain_prefix(src, plain_limit);
+
+        // dest may be src, for decoding in place.
+        memmove(dest, src, plain_count);
+
+        dest += plain_count;
+        src += plain_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        // Gather the chars of a whole UTF-8 sequence, decoding them as we go.
+        // offsets[i] is the number of src chars used by the first i decoded chars.
+        utf8_char_t sequence[4];
+        size_t offsets[5] = {0};
+        size_t sequence_size = 0;
+        bool malformed = false;
+
+        while (sequence_size < UTF8_SEQ_MAX_CHARS && src + offsets[sequence_size] < src_end)
+        {
+            size_t consumed;
+
+            if (!__url_byte(src + offsets[sequence_size], (src_end - src) - offsets[sequence_size], &consumed, &sequence[sequence_size]))
+            {
+                malformed = true;
+                break;
+            }
+
+            offsets[sequence_size + 1] = offsets[sequence_size] + consumed;
+            sequence_size++;
+
+            // Only gather as many chars as the leading char asks for.
+            if (sequence_size == (size_t)UTF8_TRAILING_COUNT[sequence[0]] + 1)
+                break;
+        }
+
+        if (!sequence_size)
+        {
+            (*status) = 9;
+            break;
+        }
+
+        size_t consumed;
+        int result = __utf8_sequence_check(sequence, sequence_size, &consumed);
+
+        // A sequence cut short by a malformed percent encoding is reported as the latter.
+        if (result == 4 && malformed && consumed == sequence_size)
+            result = 9;
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        if (consumed > (size_t)(dest_end - dest))
+            break;
+
+        memcpy(dest, sequence, consumed);
+
+        dest += consumed;
+        src += offsets[consumed];
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+/* *********************************** */
+/* -*- log-safe escaping functions -*- */
+/* *********************************** */
+
+// Get the length of the prefix of src which is copied to a log as it is.
+// That's every ASCII char except control chars and backslashes.
+static inline size_t __log_plain_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        // Lanes which are zero after flipping are backslashes or DEL.
+        uint64_t backslashes = word ^ 0x5C5C5C5C5C5C5C5CULL;
+        uint64_t deletes = word ^ 0x7F7F7F7F7F7F7F7FULL;
+
+        // Any lane below 0x20 borrows into its high bit, and non-ASCII lanes already have it set.
+        uint64_t special = (word | (word - 0x2020202020202020ULL) |
+                            ((backslashes - WORD_LOW_BITS) & ~backslashes) |
+                            ((deletes - WORD_LOW_BITS) & ~deletes));
+
+        if (special & WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && src[i] >= 0x20 && src[i] < 0x7F && src[i] != '\\')
+        i++;
+
+    return i;
+}
+
+// Check if a codepoint is copied to a log as it is. Only C0 and C1 control chars, DEL and backslashes aren't.
+static inline bool __log_is_plain(unipoint_t codepoint)
+{ return (codepoint >= 0x20 && codepoint != '\\' && (codepoint < 0x7F || codepoint > 0x9F)); }
+
+// Write the escape for a char that isn't plain. Invalid chars (`raw`) and ASCII are written as \xNN,
+//   and other codepoints as \uNNNN. Return the number of chars written, or 0 if there isn't room.
+static inline size_t __log_escape(utf8_char_t *dest, size_t dest_size, unipoint_t value, bool raw)
+{
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    size_t length = 4;
+
+    if (raw || value < UTF8_ONE_CHAR_LIMIT)
+    {
+        char short_escape = 0;
+
+        switch (raw ? 0 : value)
+        {
+            case '\\': short_escape = '\\'; break;
+            case '\n': short_escape = 'n';  break;
+            case '\r': short_escape = 'r';  break;
+            case '\t': short_escape = 't';  break;
+        }
+
+        if (short_escape)
+        {
+            if (dest_size < 2)
+                return 0;
+
+            dest[0] = '\\';
+            dest[1] = short_escape;
+
+            return 2;
+        }
+
+        if (dest_size < length)
+            return 0;
+
+        dest[0] = '\\';
+        dest[1] = 'x';
+    } else {
+        length = 6;
+
+        if (dest_size < length)
+            return 0;
+
+        dest[0] = '\\';
+        dest[1] = 'u';
+        dest[2] = HEX_DIGITS[(value >> 12) & 0xF];
+        dest[3] = HEX_DIGITS[(value >> 8) & 0xF];
+    }
+
+    dest[length - 2] = HEX_DIGITS[(value >> 4) & 0xF];
+    dest[length - 1] = HEX_DIGITS[value & 0xF];
+
+    return length;
+}
+
+size_t enc_utf8_to_log(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t plain_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t plain_count = __log_plain_prefix(src, plain_limit);
+
+        memcpy(dest, src, plain_count);
+
+        dest += plain_count;
+        src += plain_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+        size_t written;
+
+        if (result) {
+            // Every char of an invalid sequence is escaped on its own.
+            written = __log_escape(dest, (dest_end - dest), *src, true);
+            consumed = 1;
+        } else {
+            unipoint_t codepoint = __utf8_decode(src, consumed);
+
+            if (__log_is_plain(codepoint)) {
+                written = ((consumed <= (size_t)(dest_end - dest)) ? consumed : 0);
+                memcpy(dest, src, written);
+            } else {
+                written = __log_escape(dest, (dest_end - dest), codepoint, false);
+            }
+        }
+
+        // Escapes and codepoints are never split over the end of the dest buffer.
+        if (!written)
+            break;
+
+        dest += written;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+size_t enc_utf16_to_log(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf16_char_t *src_ptr = src;
+    utf16_char_t *src_end = src + src_size;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf16_ascii_prefix(src, ascii_limit, swap);
+        size_t plain_count = 0;
+
+        // Narrow the ASCII run, stopping at the first char that needs escaping.
+        for ( ; plain_count < ascii_count; plain_count++)
+        {
+            utf16_char_t c = __utf16_swap(src[plain_count], swap);
+
+            if (!__log_is_plain(c))
+                break;
+
+            dest[plain_count] = (utf8_char_t)c;
+        }
+
+        dest += plain_count;
+        src += plain_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        utf16_char_t c = __utf16_swap(*src, swap);
+        unipoint_t codepoint = c;
+        size_t consumed = 1;
+        bool valid = (c < SURROGATE_HIGH_START || c > SURROGATE_LOW_END);
+
+        if (SURROGATE_HIGH_START <= c && c <= SURROGATE_HIGH_END && src + 1 < src_end)
+        {
+            utf16_char_t trailing_char = __utf16_swap(src[1], swap);
+
+            if (SURROGATE_LOW_START <= trailing_char && trailing_char <= SURROGATE_LOW_END)
+            {
+                codepoint = __utf16_decode(c, trailing_char);
+                consumed = 2;
+                valid = true;
+            }
+        }
+
+        size_t written;
+
+        // Lone surrogates are escaped as \uNNNN, like control chars.
+        if (valid && __log_is_plain(codepoint)) {
+            written = __utf8_chars_for_codepoint(codepoint);
+            written = ((written <= (size_t)(dest_end - dest)) ? __utf8_from_codepoint(codepoint, dest, written, false) : 0);
+        } else {
+            written = __log_escape(dest, (dest_end - dest), codepoint, false);
+        }
+
+        // Escapes and codepoints are never split over the end of the dest buffer.
+        if (!written)
+            break;
+
+        dest += written;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+/* *********************************** */
+/* -*- Punycode and IDNA functions -*- */
+/* *********************************** */
+
+// Punycode parameters for IDNA. (See section 5 of RFC 3492)
+#define PUNYCODE_BASE           36
+#define PUNYCODE_TMIN           1
+#define PUNYCODE_TMAX           26
+#define PUNYCODE_SKEW           38
+#define PUNYCODE_DAMP           700
+#define PUNYCODE_INITIAL_BIAS   72
+#define PUNYCODE_INITIAL_N      0x80
+
+// Adapt the bias after each encoded codepoint. (See section 6.1 of RFC 3492)
+static inline uint32_t __punycode_adapt(uint32_t delta, size_t count, bool first)
+{
+    uint32_t k = 0;
+
+    delta = ((first) ? delta / PUNYCODE_DAMP : delta / 2);
+    delta += delta / count;
+
+    while (delta > ((PUNYCODE_BASE - PUNYCODE_TMIN) * PUNYCODE_TMAX) / 2)
+    {
+        delta /= PUNYCODE_BASE - PUNYCODE_TMIN;
+        k += PUNYCODE_BASE;
+    }
+
+    return k + (PUNYCODE_BASE - PUNYCODE_TMIN + 1) * delta / (delta + PUNYCODE_SKEW);
+}
+
+// Get the threshold for the digit of a variable length integer at position k.
+static inline uint32_t __punycode_threshold(uint32_t k, uint32_t bias)
+{
+    if (k <= bias)
+        return PUNYCODE_TMIN;
+
+    if (k >= bias + PUNYCODE_TMAX)
+        return PUNYCODE_TMAX;
+
+    return k - bias;
+}
+
+// Digits are a-z for 0-25 then 0-9 for 26-35. Letters may be in either case when decoding.
+static inline utf8_char_t __punycode_digit(uint32_t value)
+{ return ((value < 26) ? 'a' + value : '0' + (value - 26)); }
+
+static inline int __punycode_digit_value(utf8_char_t c)
+{
+    if ('a' <= (c | 0x20) && (c | 0x20) <= 'z')
+        return (c | 0x20) - 'a';
+
+    if ('0' <= c && c <= '9')
+        return c - '0' + 26;
+
+    return -1;
+}
+
+// Check a single UTF-16 sequence in the same way as __utf8_sequence_check.
+static inline int __utf16_sequence_check(utf16_char_t *src, size_t src_size, size_t *consumed, bool swap)
+{
+    utf16_char_t c = __utf16_swap(*src, swap);
+
+    (*consumed) = 1;
+
+    if (c < SURROGATE_HIGH_START || c > SURROGATE_LOW_END)
+        return 0;
+
+    if (c >= SURROGATE_LOW_START)
+        return 2;
+
+    if (src_size < 2 || (__utf16_swap(src[1], swap) & 0xFC00) != SURROGATE_LOW_START)
+        return 1;
+
+    (*consumed) = 2;
+    return 0;
+}
+
+// Copy UTF-8 one strictly checked sequence at a time, in the same way as __utf8_to_utf16_checked.
+static size_t __utf8_to_utf8_checked(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{
+    utf8_char_t *dest_ptr = dest;
+    utf8_char_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        memcpy(dest, src, ascii_count);
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        if (consumed > (size_t)(dest_end - dest))
+            break;
+
+        memcpy(dest, src, consumed);
+
+        dest += consumed;
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+// Check a UTF-X label, which may be pure ASCII.
+#define PUNYCODE_CHECK_8(s, n, c)   (__utf8_sequence_check((s), (n), (c)))
+#define PUNYCODE_CHECK_16(s, n, c)  (__utf16_sequence_check((s), (n), (c), swap))
+
+// Encode a single label, adding the ACE prefix unless it's pure ASCII. Store the number of dest chars used in `written`.
+// Return the utf8_validate style result for the label, or -1 if it doesn't fit in dest.
+#define UTFX_TO_PUNYCODE(X)                                                                                 \
+    do {                                                                                                    \
+        size_t basic_count = 0;                                                                             \
+        size_t total_count = 0;                                                                             \
+        size_t out = 0;                                                                                     \
+                                                                                                            \
+        /* Check the whole label first, so the passes below can decode it without checking. */              \
+        for (size_t i = 0; i < src_size; )                                                                  \
+        {                                                                                                   \
+            size_t consumed;                                                                                \
+            int result = PUNYCODE_CHECK_ ## X(src + i, src_size - i, &consumed);                            \
+                                                                                                            \
+            if (result)                                                                                     \
+                return result;                                                                              \
+                                                                                                            \
+            if (__utf ## X ## _swap(src[i], swap) < UTF8_ONE_CHAR_LIMIT)                                    \
+                basic_count++;                                                                              \
+                                                                                                            \
+            total_count++;                                                                                  \
+            i += consumed;                                                                                  \
+        }                                                                                                   \
+                                                                                                            \
+        /* Pure ASCII labels are copied as they are. */                                                     \
+        if (basic_count == total_count)                                                                     \
+        {                                                                                                   \
+            if (src_size > dest_size)                                                                       \
+                return -1;                                                                                  \
+                                                                                                            \
+            for (size_t i = 0; i < src_size; i++)                                                           \
+                dest[i] = (utf8_char_t)__utf ## X ## _swap(src[i], swap);                                   \
+                                                                                                            \
+            (*written) = src_size;                                                                          \
+            return 0;                                                                                       \
+        }                                                                                                   \
+                                                                                                            \
+        /* Otherwise the basic codepoints come first, after the ACE prefix and before a delimiter. */       \
+        if (dest_size < 4 + basic_count + (basic_count ? 1 : 0))                                            \
+            return -1;                                                                                      \
+                                                                                                            \
+        memcpy(dest, "xn--", 4);                                                                            \
+        out = 4;                                                                                            \
+                                                                                                            \
+        for (size_t i = 0; i < src_size; i++)                                                               \
+        {                                                                                                   \
+            unipoint_t c = __utf ## X ## _swap(src[i], swap);                                               \
+                                                                                                            \
+            if (c < UTF8_ONE_CHAR_LIMIT)                                                                    \
+                dest[out++] = (utf8_char_t)c;                                                               \
+        }                                                                                                   \
+                                                                                                            \
+        if (basic_count)                                                                                    \
+            dest[out++] = '-';                                                                              \
+                                                                                                            \
+        uint32_t n = PUNYCODE_INITIAL_N;                                                                    \
+        uint32_t delta = 0;                                                                                 \
+        uint32_t bias = PUNYCODE_INITIAL_BIAS;                                                              \
+        size_t handled = basic_count;                                                                       \
+                                                                                                            \
+        while (handled < total_count)                                                                       \
+        {                                                                                                   \
+            /* Find the smallest codepoint which hasn't been handled yet. */                                \
+            unipoint_t next = UNICODE_FINAL_POINT;                                                          \
+            size_t consumed;                                                                                \
+                                                                                                            \
+            for (size_t i = 0; i < src_size; i += consumed)                                                 \
+            {                                                                                               \
+                unipoint_t c = __codepoint_from_utf ## X(src + i, src_size - i, &consumed, swap);           \
+                                                                                                            \
+                if (c >= n && c < next)                                                                     \
+                    next = c;                                                                               \
+            }                                                                                               \
+                                                                                                            \
+            if ((next - n) > (UINT32_MAX - delta) / (handled + 1))                                          \
+                return 9;                                                                                   \
+                                                                                                            \
+            delta += (next - n) * (handled + 1);                                                            \
+            n = next;                                                                                       \
+                                                                                                            \
+            /* Encode the position of every occurrence of it as a variable length integer. */               \
+            for (size_t i = 0; i < src_size; i += consumed)                                                 \
+            {                                                                                               \
+                unipoint_t c = __codepoint_from_utf ## X(src + i, src_size - i, &consumed, swap);           \
+                                                                                                            \
+                if (c < n && ++delta == 0)                                                                  \
+                    return 9;                                                                               \
+                                                                                                            \
+                if (c != n)                                                                                 \
+                    continue;                                                                               \
+                                                                                                            \
+                uint32_t q = delta;                                                                         \
+                                                                                                            \
+                for (uint32_t k = PUNYCODE_BASE; ; k += PUNYCODE_BASE)                                      \
+                {                                                                                           \
+                    uint32_t t = __punycode_threshold(k, bias);                                             \
+                                                                                                            \
+                    if (q < t)                                                                              \
+                        break;                                                                              \
+                                                                                                            \
+                    if (out == dest_size)                                                                   \
+                        return -1;                                                                          \
+                                                                                                            \
+                    dest[out++] = __punycode_digit(t + (q - t) % (PUNYCODE_BASE - t));                      \
+                    q = (q - t) / (PUNYCODE_BASE - t);                                                      \
+                }                                                                                           \
+                                                                                                            \
+                if (out == dest_size)                                                                       \
+                    return -1;                                                                              \
+                                                                                                            \
+                dest[out++] = __punycode_digit(q);                                                          \
+                                                                                                            \
+                bias = __punycode_adapt(delta, handled + 1, handled == basic_count);                        \
+                delta = 0;                                                                                  \
+                handled++;                                                                                  \
+            }                                                                                               \
+                                                                                                            \
+            delta++;                                                                                        \
+            n++;                                                                                            \
+        }                                                                                                   \
+                                                                                                            \
+        (*written) = out;                                                                                   \
+        return 0;                                                                                           \
+    } while (0)
+
+static int __utf8_to_punycode(utf8_char_t *dest, size_t dest_size, utf8_char_t *src, size_t src_size, size_t *written, bool swap)
+{ UTFX_TO_PUNYCODE(8); }
+
+static int __utf16_to_punycode(utf8_char_t *dest, size_t dest_size, utf16_char_t *src, size_t src_size, size_t *written, bool swap)
+{ UTFX_TO_PUNYCODE(16); }
+
+// Number of UTF-X chars needed for a codepoint, and used by the codepoint starting with char c.
+#define PUNYCODE_CHARS_8(c)     (__utf8_chars_for_codepoint(c))
+#define PUNYCODE_CHARS_16(c)    (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+#define PUNYCODE_LENGTH_8(c)    ((size_t)UTF8_TRAILING_COUNT[(c)] + 1)
+#define PUNYCODE_LENGTH_16(c)   (((__utf16_swap((c), swap) & 0xFC00) == SURROGATE_HIGH_START) ? 2 : 1)
+
+// Decode the punycode of a single label, without its ACE prefix. Store the number of dest chars used in `written`.
+// Codepoints are inserted into dest as they're decoded, so no other buffer is needed.
+// Return the utf8_validate style result for the label, or -1 if it doesn't fit in dest.
+#define PUNYCODE_TO_UTFX(X)                                                                                 \
+    do {                                                                                                    \
+        /* The basic codepoints come before the last delimiter, if there is one. */                         \
+        size_t basic_size = src_size;                                                                       \
+                                                                                                            \
+        while (basic_size && src[basic_size - 1] != '-')                                                    \
+            basic_size--;                                                                                   \
+                                                                                                            \
+        size_t start = basic_size;                                                                          \
+                                                                                                            \
+        if (basic_size)                                                                                     \
+            basic_size--;                                                                                   \
+                                                                                                            \
+        if (basic_size > dest_size)                                                                         \
+            return -1;                                                                                      \
+                                                                                                            \
+        for (size_t i = 0; i < basic_size; i++)                                                             \
+        {                                                                                                   \
+            if (src[i] >= UTF8_ONE_CHAR_LIMIT)                                                              \
+                return 9;                                                                                   \
+                                                                                                            \
+            dest[i] = __utf ## X ## _swap((utf ## X ## _char_t)src[i], swap);                               \
+        }                                                                                                   \
+                                                                                                            \
+        size_t out = basic_size;                                                                            \
+        size_t count = basic_size;                                                                          \
+        uint32_t n = PUNYCODE_INITIAL_N;                                                                    \
+        uint32_t i = 0;                                                                                     \
+        uint32_t bias = PUNYCODE_INITIAL_BIAS;                                                              \
+                                                                                                            \
+        for (size_t pos = start; pos < src_size; )                                                          \
+        {                                                                                                   \
+            /* Decode a variable length integer, which is where the next codepoint goes. */                 \
+            uint32_t old_i = i;                                                                             \
+            uint32_t w = 1;                                                                                 \
+                                                                                                            \
+            for (uint32_t k = PUNYCODE_BASE; ; k += PUNYCODE_BASE)                                          \
+            {                                                                                               \
+                if (pos == src_size)                                                                        \
+                    return 9;                                                                               \
+                                                                                                            \
+                int digit = __punycode_digit_value(src[pos++]);                                             \
+                                                                                                            \
+                if (digit < 0 || (uint32_t)digit > (UINT32_MAX - i) / w)                                    \
+                    return 9;                                                                               \
+                                                                                                            \
+                i += digit * w;                                                                             \
+                                                                                                            \
+                uint32_t t = __punycode_threshold(k, bias);                                                 \
+                                                                                                            \
+                if ((uint32_t)digit < t)                                                                    \
+                    break;                                                                                  \
+                                                                                                            \
+                if (w > UINT32_MAX / (PUNYCODE_BASE - t))                                                   \
+                    return 9;                                                                               \
+                                                                                                            \
+                w *= PUNYCODE_BASE - t;                                                                     \
+            }                                                                                               \
+                                                                                                            \
+            bias = __punycode_adapt(i - old_i, count + 1, old_i == 0);                                      \
+                                                                                                            \
+            if (i / (count + 1) > UINT32_MAX - n)                                                           \
+                return 9;                                                                                   \
+                                                                                                            \
+            n += i / (count + 1);                                                                           \
+            i %= count + 1;                                                                                 \
+                                                                                                            \
+            /* Basic codepoints should never be encoded. */                                                 \
+            if (n < PUNYCODE_INITIAL_N)                                                                     \
+                return 9;                                                                                   \
+                                                                                                            \
+            if (n > UNICODE_FINAL_POINT)                                                                    \
+                return 3;                                                                                   \
+                                                                                                            \
+            if (SURROGATE_HIGH_START <= n && n <= SURROGATE_LOW_END)                                        \
+                return 2;                                                                                   \
+                                                                                                            \
+            size_t char_count = PUNYCODE_CHARS_ ## X(n);                                                    \
+                                                                                                            \
+            if (char_count > dest_size - out)                                                               \
+                return -1;                                                                                  \
+                                                                                                            \
+            /* Find where the i-th codepoint starts, and move everything after it up to make room. */       \
+            size_t offset = 0;                                                                              \
+                                                                                                            \
+            for (uint32_t j = 0; j < i; j++)                                                                \
+                offset += PUNYCODE_LENGTH_ ## X(dest[offset]);                                              \
+                                                                                                            \
+            memmove(dest + offset + char_count, dest + offset, (out - offset) * sizeof(dest[0]));           \
+            __utf ## X ## _from_codepoint(n, dest + offset, char_count, swap);                              \
+                                                                                                            \
+            out += char_count;                                                                              \
+            count++;                                                                                        \
+            i++;                                                                                            \
+        }                                                                                                   \
+                                                                                                            \
+        (*written) = out;                                                                                   \
+        return 0;                                                                                           \
+    } while (0)
+
+static int __punycode_to_utf8(utf8_char_t *dest, size_t dest_size, utf8_char_t *src, size_t src_size, size_t *written, bool swap)
+{ PUNYCODE_TO_UTFX(8); }
+
+static int __punycode_to_utf16(utf16_char_t *dest, size_t dest_size, utf8_char_t *src, size_t src_size, size_t *written, bool swap)
+{ PUNYCODE_TO_UTFX(16); }
+
+#define UTFX_TO_IDNA(X)                                                                                     \
+    do {                                                                                                    \
+        utf8_char_t *dest_ptr = dest;                                                                       \
+        utf8_char_t *dest_end = dest + (*dest_size);                                                        \
+        utf ## X ## _char_t *src_ptr = src;                                                                 \
+        utf ## X ## _char_t *src_end = src + src_size;                                                      \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        while (src < src_end)                                                                               \
+        {                                                                                                   \
+            /* Nearly every label is ASCII. Copy all the whole ASCII labels a word at a time. */            \
+            size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ?                   \
+                                  (size_t)(src_end - src) : (size_t)(dest_end - dest));                     \
+            size_t ascii_count = __utf ## X ## _ascii_prefix(src, ascii_limit, swap);                       \
+                                                                                                            \
+            if (ascii_count < (size_t)(src_end - src))                                                      \
+            {                                                                                               \
+                while (ascii_count && __utf ## X ## _swap(src[ascii_count - 1], swap) != '.')               \
+                    ascii_count--;                                                                          \
+            }                                                                                               \
+                                                                                                            \
+            for (size_t i = 0; i < ascii_count; i++)                                                        \
+                dest[i] = (utf8_char_t)__utf ## X ## _swap(src[i], swap);                                   \
+                                                                                                            \
+            dest += ascii_count;                                                                            \
+            src += ascii_count;                                                                             \
+                                                                                                            \
+            if (src == src_end)                                                                             \
+                break;                                                                                      \
+                                                                                                            \
+            size_t label_size = 0;                                                                          \
+                                                                                                            \
+            while (src + label_size < src_end && __utf ## X ## _swap(src[label_size], swap) != '.')         \
+                label_size++;                                                                               \
+                                                                                                            \
+            /* Labels are never split over the end of the dest buffer. */                                   \
+            size_t written;                                                                                 \
+            int result = __utf ## X ## _to_punycode(dest, (dest_end - dest), src, label_size, &written,     \
+                                                    swap);                                                  \
+                                                                                                            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                if (result > 0)                                                                             \
+                    (*status) = result;                                                                     \
+                                                                                                            \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            dest += written;                                                                                \
+            src += label_size;                                                                              \
+                                                                                                            \
+            /* Keep the dot with its label if there's room for it. */                                       \
+            if (src < src_end)                                                                              \
+            {                                                                                               \
+                if (dest == dest_end)                                                                       \
+                    break;                                                                                  \
+                                                                                                            \
+                (*dest++) = '.';                                                                            \
+                src++;                                                                                      \
+            }                                                                                               \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_utf8_to_idna(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ UTFX_TO_IDNA(8); }
+
+size_t enc_utf16_to_idna(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap)
+{ UTFX_TO_IDNA(16); }
+
+#define IDNA_TO_UTFX(X)                                                                                     \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf8_char_t *src_ptr = src;                                                                         \
+        utf8_char_t *src_end = src + src_size;                                                              \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        while (src < src_end)                                                                               \
+        {                                                                                                   \
+            utf8_char_t *dot = memchr(src, '.', (src_end - src));                                           \
+            size_t label_size = ((dot) ? (size_t)(dot - src) : (size_t)(src_end - src));                    \
+                                                                                                            \
+            /* Labels are never split over the end of the dest buffer. */                                   \
+            size_t written = (dest_end - dest);                                                             \
+            int result;                                                                                     \
+                                                                                                            \
+            bool encoded = (label_size >= 4 && (src[0] | 0x20) == 'x' && (src[1] | 0x20) == 'n' &&          \
+                            src[2] == '-' && src[3] == '-');                                                \
+                                                                                                            \
+            if (encoded) {                                                                                  \
+                result = __punycode_to_utf ## X(dest, written, src + 4, label_size - 4, &written, swap);    \
+            } else if (__utf8_to_utf ## X ## _checked(dest, &written, src, label_size, &result, swap) <     \
+                       label_size && !result) {                                                             \
+                result = -1;                                                                                \
+            }                                                                                               \
+                                                                                                            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                if (result > 0)                                                                             \
+                    (*status) = result;                                                                     \
+                                                                                                            \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            dest += written;                                                                                \
+            src += label_size;                                                                              \
+                                                                                                            \
+            /* Keep the dot with its label if there's room for it. */                                       \
+            if (src < src_end)                                                                              \
+            {                                                                                               \
+                if (dest == dest_end)                                                                       \
+                    break;                                                                                  \
+                                                                                                            \
+                (*dest++) = __utf ## X ## _swap((utf ## X ## _char_t)'.', swap);                            \
+                src++;                                                                                      \
+            }                                                                                               \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t enc_idna_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ IDNA_TO_UTFX(8); }
+
+size_t enc_idna_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap)
+{ IDNA_TO_UTFX(16); }
+
+#undef IDNA_TO_UTFX
+#undef UTFX_TO_IDNA
+#undef PUNYCODE_TO_UTFX
+#undef PUNYCODE_LENGTH_16
+#undef PUNYCODE_LENGTH_8
+#undef PUNYCODE_CHARS_16
+#undef PUNYCODE_CHARS_8
+#undef UTFX_TO_PUNYCODE
+#undef PUNYCODE_CHECK_16
+#undef PUNYCODE_CHECK_8
+
+/* ************************************ */
+/* -*- character property functions -*- */
+/* ************************************ */
+
+// Generated by tables/gen_ucd.py. Run `make tables` to regenerate it.
+#include "tables/ucd.h"
+
+// Look up a codepoint (which must not be past the end of unicode) in a three stage table generated
+//   by tables/gen_ucd.py. The first stage picks a block of the second, which picks a block of the third.
+#define __ucd_lookup(name, codepoint)                                                                       \
+    (name ## _STAGE3[(name ## _STAGE2[(name ## _STAGE1[(codepoint) >> (name ## _BITS2 + name ## _BITS3)]    \
+                                       << name ## _BITS2) + (((codepoint) >> name ## _BITS3) &              \
+                                                             ((1 << name ## _BITS2) - 1))]                  \
+                      << name ## _BITS3) + ((codepoint) & ((1 << name ## _BITS3) - 1))])
+
+static inline unicode_properties_t __unicode_properties(unipoint_t codepoint)
+{
+    if (codepoint < UTF8_ONE_CHAR_LIMIT)
+        return UCD_PROPERTY_RECORDS[UCD_PROPERTY_ASCII[codepoint]];
+
+    // The first record is for unassigned codepoints.
+    if (codepoint > UNICODE_FINAL_POINT)
+        return UCD_PROPERTY_RECORDS[0];
+
+    return UCD_PROPERTY_RECORDS[__ucd_lookup(UCD_PROPERTY, codepoint)];
+}
+
+unicode_properties_t unicode_properties(unipoint_t codepoint)
+{ return __unicode_properties(codepoint); }
+
+const char *unicode_script_name(uint8_t script)
+{
+    if (script >= sizeof(UCD_SCRIPT_NAMES) / sizeof(UCD_SCRIPT_NAMES[0]))
+        return NULL;
+
+    return UCD_SCRIPT_NAMES[script];
+}
+
+int unicode_script_code(const char *name)
+{
+    for (size_t i = 0; i < sizeof(UCD_SCRIPT_NAMES) / sizeof(UCD_SCRIPT_NAMES[0]); i++)
+    {
+        if (!strcmp(name, UCD_SCRIPT_NAMES[i]))
+            return i;
+    }
+
+    return -1;
+}
+
+size_t utf8_properties(unicode_properties_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool)
+{
+    unicode_properties_t *dest_ptr = dest;
+    unicode_properties_t *dest_end = dest + (*dest_size);
+    utf8_char_t *src_ptr = src;
+    utf8_char_t *src_end = src + src_size;
+
+    (*status) = 0;
+
+    while ((dest < dest_end) && (src < src_end))
+    {
+        size_t ascii_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ? (size_t)(src_end - src) : (size_t)(dest_end - dest));
+        size_t ascii_count = __utf8_ascii_prefix(src, ascii_limit, false);
+
+        for (size_t i = 0; i < ascii_count; i++)
+            dest[i] = UCD_PROPERTY_RECORDS[UCD_PROPERTY_ASCII[src[i]]];
+
+        dest += ascii_count;
+        src += ascii_count;
+
+        if ((dest == dest_end) || (src == src_end))
+            break;
+
+        size_t consumed;
+        int result = __utf8_sequence_check(src, (src_end - src), &consumed);
+
+        if (result)
+        {
+            (*status) = result;
+            break;
+        }
+
+        (*dest++) = UCD_PROPERTY_RECORDS[__ucd_lookup(UCD_PROPERTY, __utf8_decode(src, consumed))];
+        src += consumed;
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return (src - src_ptr);
+}
+
+/* ****************************** */
+/* -*- case folding functions -*- */
+/* ****************************** */
+
+// Fold a single valid codepoint, storing its folding (up to 3 codepoints) in `folded`.
+// Return the number of codepoints stored.
+static inline size_t __casefold(unipoint_t codepoint, unipoint_t folded[3], bool full)
+{
+    if (codepoint < UTF8_ONE_CHAR_LIMIT)
+    {
+        folded[0] = codepoint | ((('A' <= codepoint) && (codepoint <= 'Z')) ? 0x20 : 0);
+        return 1;
+    }
+
+    __typeof__(UCD_CASEFOLD_RECORDS[0]) record = UCD_CASEFOLD_RECORDS[__ucd_lookup(UCD_CASEFOLD, codepoint)];
+
+    if (full && record.full)
+    {
+        const unipoint_t *expansion = UCD_CASEFOLD_FULL[record.full - 1];
+
+        folded[0] = expansion[0];
+        folded[1] = expansion[1];
+        folded[2] = expansion[2];
+
+        return (expansion[2] ? 3 : 2);
+    }
+
+    folded[0] = codepoint + record.delta;
+    return 1;
+}
+
+// Set the high bit of each char of a word of ASCII chars which is between `low` and `high`, inclusive.
+static inline uint64_t __ascii_word_range(uint64_t word, utf8_char_t low, utf8_char_t high)
+{
+    // Adding to each char sets its high bit from `low` onwards in the first sum, and past `high` in the second.
+    // No char carries into the next, since they're all ASCII.
+    uint64_t from_low = word + (0x80 - low) * WORD_LOW_BITS;
+    uint64_t past_high = word + (0x7F - high) * WORD_LOW_BITS;
+
+    return (from_low & ~past_high) & WORD_HIGH_BITS;
+}
+
+// Fold the upper case ASCII letters in a word of ASCII chars.
+static inline uint64_t __ascii_word_fold(uint64_t word)
+{
+    // 0x80 >> 2 is the 0x20 which makes a letter lower case.
+    return word | (__ascii_word_range(word, 'A', 'Z') >> 2);
+}
+
+// Fold the Latin-1 prefix of src into dest, a word at a time for ASCII. Stop at the first char which
+//   changes size when folded (like ß in full folding) or isn't Latin-1, so the caller can handle it.
+// Return the number of chars folded.
+static inline size_t __utf8_latin_fold(utf8_char_t *dest, utf8_char_t *src, size_t src_size, bool full, bool)
+{
+    size_t i = 0;
+
+    while (i < src_size)
+    {
+        for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, src + i, sizeof(word));
+
+            if (word & WORD_HIGH_BITS)
+                break;
+
+            word = __ascii_word_fold(word);
+            memcpy(dest + i, &word, sizeof(word));
+        }
+
+        if (i == src_size)
+            break;
+
+        utf8_char_t c = src[i];
+
+        if (c < UTF8_ONE_CHAR_LIMIT)
+        {
+            dest[i++] = c | ((('A' <= c) && (c <= 'Z')) ? 0x20 : 0);
+            continue;
+        }
+
+        // Only whole two char sequences for U+0080-U+00FF. Micro sign folds to Greek mu.
+        if ((c != 0xC2 && c != 0xC3) || i + 1 >= src_size || (src[i + 1] & 0xC0) != 0x80 || (c == 0xC2 && src[i + 1] == 0xB5))
+            break;
+
+        utf8_char_t trailing_char = src[i + 1];
+
+        if (c == 0xC3 && trailing_char <= 0x9F)
+        {
+            if (trailing_char == 0x9F && full)
+                break;
+
+            // Latin-1 upper case letters are 0x20 below lower case ones, but × isn't a letter.
+            if (trailing_char != 0x97 && trailing_char != 0x9F)
+                trailing_char |= 0x20;
+        }
+
+        dest[i] = c;
+        dest[i + 1] = trailing_char;
+        i += 2;
+    }
+
+    return i;
+}
+
+static inline size_t __utf16_latin_fold(utf16_char_t *dest, utf16_char_t *src, size_t src_size, bool full, bool swap)
+{
+    size_t i = 0;
+
+    for ( ; i < src_size; i++)
+    {
+        utf16_char_t c = __utf16_swap(src[i], swap);
+
+        if (c > 0xFF || c == 0xB5 || (c == 0xDF && full))
+            break;
+
+        if (('A' <= c && c <= 'Z') || (0xC0 <= c && c <= 0xDE && c != 0xD7))
+            c |= 0x20;
+
+        dest[i] = __utf16_swap(c, swap);
+    }
+
+    return i;
+}
+
+// Check a single sequence of UTF-X.
+#define CASEFOLD_CHECK_8(s, n, c)   (__utf8_sequence_check((s), (n), (c)))
+#define CASEFOLD_CHECK_16(s, n, c)  (__utf16_sequence_check((s), (n), (c), swap))
+
+// Number of UTF-X chars needed for a codepoint.
+#define CASEFOLD_CHARS_8(c)         (__utf8_chars_for_codepoint(c))
+#define CASEFOLD_CHARS_16(c)        (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+
+#define CASEFOLD_UTFX(X)                                                                                    \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf ## X ## _char_t *src_ptr = src;                                                                 \
+        utf ## X ## _char_t *src_end = src + src_size;                                                      \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        while ((dest < dest_end) && (src < src_end))                                                        \
+        {                                                                                                   \
+            size_t latin_limit = (((size_t)(src_end - src) < (size_t)(dest_end - dest)) ?                   \
+                                  (size_t)(src_end - src) : (size_t)(dest_end - dest));                     \
+            size_t latin_count = __utf ## X ## _latin_fold(dest, src, latin_limit, full, swap);             \
+                                                                                                            \
+            dest += latin_count;                                                                            \
+            src += latin_count;                                                                             \
+                                                                                                            \
+            if ((dest == dest_end) || (src == src_end))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            size_t consumed;                                                                                \
+            int result = CASEFOLD_CHECK_ ## X(src, (src_end - src), &consumed);                             \
+                                                                                                            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                (*status) = result;                                                                         \
+                break;                                                                                      \
+            }                                                                                               \
+                                                                                                            \
+            unipoint_t folded[3];                                                                           \
+            unipoint_t codepoint = __codepoint_from_utf ## X(src, consumed, NULL, swap);                    \
+            size_t folded_count = __casefold(codepoint, folded, full);                                      \
+            size_t char_count = 0;                                                                          \
+                                                                                                            \
+            for (size_t i = 0; i < folded_count; i++)                                                       \
+                char_count += CASEFOLD_CHARS_ ## X(folded[i]);                                              \
+                                                                                                            \
+            /* The folding of a codepoint is never split over the end of the dest buffer. */                \
+            if (char_count > (size_t)(dest_end - dest))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            for (size_t i = 0; i < folded_count; i++)                                                       \
+                dest += __utf ## X ## _from_codepoint(folded[i], dest, (dest_end - dest), swap);            \
+                                                                                                            \
+            src += consumed;                                                                                \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t utf8_casefold(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool full, int *status, bool swap)
+{ CASEFOLD_UTFX(8); }
+
+size_t utf16_casefold(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool full, int *status, bool swap)
+{ CASEFOLD_UTFX(16); }
+
+// Fold the next sequence of UTF-X for comparison, storing the number of chars it uses in `consumed`.
+// Each char of an invalid sequence is its own "codepoint", past the end of unicode so it sorts after everything.
+// Return the number of codepoints stored.
+static inline size_t __casefold_next_8(utf8_char_t *src, size_t src_size, size_t *consumed, unipoint_t folded[3], bool)
+{
+    if (__utf8_sequence_check(src, src_size, consumed))
+    {
+        folded[0] = UNICODE_FINAL_POINT + 1 + src[0];
+        (*consumed) = 1;
+
+        return 1;
+    }
+
+    return __casefold(__utf8_decode(src, (*consumed)), folded, true);
+}
+
+static inline size_t __casefold_next_16(utf16_char_t *src, size_t src_size, size_t *consumed, unipoint_t folded[3], bool swap)
+{
+    if (__utf16_sequence_check(src, src_size, consumed, swap))
+    {
+        folded[0] = UNICODE_FINAL_POINT + 1 + __utf16_swap(src[0], swap);
+        return 1;
+    }
+
+    return __casefold(__codepoint_from_utf16(src, (*consumed), NULL, swap), folded, true);
+}
+
+// Get the length of the common prefix of two strings which is ASCII and the same once folded.
+static inline size_t __utf8_ascii_casecmp_prefix(utf8_char_t *a, size_t a_size, utf8_char_t *b, size_t b_size, bool)
+{
+    size_t size = ((a_size < b_size) ? a_size : b_size);
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t a_word;
+        uint64_t b_word;
+        memcpy(&a_word, a + i, sizeof(a_word));
+        memcpy(&b_word, b + i, sizeof(b_word));
+
+        if (((a_word | b_word) & WORD_HIGH_BITS) || __ascii_word_fold(a_word) != __ascii_word_fold(b_word))
+            break;
+    }
+
+    for ( ; i < size && a[i] < UTF8_ONE_CHAR_LIMIT && b[i] < UTF8_ONE_CHAR_LIMIT; i++)
+    {
+        if ((a[i] | ((('A' <= a[i]) && (a[i] <= 'Z')) ? 0x20 : 0)) != (b[i] | ((('A' <= b[i]) && (b[i] <= 'Z')) ? 0x20 : 0)))
+            break;
+    }
+
+    return i;
+}
+
+static inline size_t __utf16_ascii_casecmp_prefix(utf16_char_t *a, size_t a_size, utf16_char_t *b, size_t b_size, bool swap)
+{
+    size_t size = ((a_size < b_size) ? a_size : b_size);
+    size_t i = 0;
+
+    for ( ; i < size; i++)
+    {
+        utf16_char_t a_char = __utf16_swap(a[i], swap);
+        utf16_char_t b_char = __utf16_swap(b[i], swap);
+
+        if (a_char >= UTF8_ONE_CHAR_LIMIT || b_char >= UTF8_ONE_CHAR_LIMIT)
+            break;
+
+        if ((a_char | ((('A' <= a_char) && (a_char <= 'Z')) ? 0x20 : 0)) != (b_char | ((('A' <= b_char) && (b_char <= 'Z')) ? 0x20 : 0)))
+            break;
+    }
+
+    return i;
+}
+
+#define CASECMP_UTFX(X)                                                                                     \
+    do {                                                                                                    \
+        unipoint_t a_folded[3];                                                                             \
+        unipoint_t b_folded[3];                                                                             \
+        size_t a_count = 0;                                                                                 \
+        size_t b_count = 0;                                                                                 \
+        size_t a_next = 0;                                                                                  \
+        size_t b_next = 0;                                                                                  \
+                                                                                                            \
+        while (true)                                                                                        \
+        {                                                                                                   \
+            /* Skip over runs of ASCII which are the same once folded, when there's nothing pending. */     \
+            if (a_next == a_count && b_next == b_count)                                                     \
+            {                                                                                               \
+                size_t same = __utf ## X ## _ascii_casecmp_prefix(a, a_size, b, b_size, swap);              \
+                                                                                                            \
+                a += same;                                                                                  \
+                a_size -= same;                                                                             \
+                b += same;                                                                                  \
+                b_size -= same;                                                                             \
+            }                                                                                               \
+                                                                                                            \
+            if (a_next == a_count && a_size)                                                                \
+            {                                                                                               \
+                size_t consumed;                                                                            \
+                                                                                                            \
+                a_count = __casefold_next_ ## X(a, a_size, &consumed, a_folded, swap);                      \
+                a_next = 0;                                                                                 \
+                a += consumed;                                                                              \
+                a_size -= consumed;                                                                         \
+            }                                                                                               \
+                                                                                                            \
+            if (b_next == b_count && b_size)                                                                \
+            {                                                                                               \
+                size_t consumed;                                                                            \
+                                                                                                            \
+                b_count = __casefold_next_ ## X(b, b_size, &consumed, b_folded, swap);                      \
+                b_next = 0;                                                                                 \
+                b += consumed;                                                                              \
+                b_size -= consumed;                                                                         \
+            }                                                                                               \
+                                                                                                            \
+            /* A string which runs out first sorts first. */                                                \
+            bool a_done = (a_next == a_count);                                                              \
+            bool b_done = (b_next == b_count);                                                              \
+                                                                                                            \
+            if (a_done || b_done)                                                                           \
+                return (int)b_done - (int)a_done;                                                           \
+                                                                                                            \
+            unipoint_t a_codepoint = a_folded[a_next++];                                                    \
+            unipoint_t b_codepoint = b_folded[b_next++];                                                    \
+                                                                                                            \
+            if (a_codepoint != b_codepoint)                                                                 \
+                return ((a_codepoint < b_codepoint) ? -1 : 1);                                              \
+        }                                                                                                   \
+    } while (0)
+
+int utf8_casecmp(utf8_char_t *a, size_t a_size, utf8_char_t *b, size_t b_size, bool swap)
+{ CASECMP_UTFX(8); }
+
+int utf16_casecmp(utf16_char_t *a, size_t a_size, utf16_char_t *b, size_t b_size, bool swap)
+{ CASECMP_UTFX(16); }
+
+#undef CASECMP_UTFX
+#undef CASEFOLD_UTFX
+#undef CASEFOLD_CHARS_16
+#undef CASEFOLD_CHARS_8
+#undef CASEFOLD_CHECK_16
+#undef CASEFOLD_CHECK_8
+
+/* ******************************* */
+/* -*- normalization functions -*- */
+/* ******************************* */
+
+// Flags of the normalization records. Codepoints which join the previous one may be reordered or
+//   composed with it, so normalization can't restart at them.
+#define NORMALIZATION_NFD_NO            (1 << 0)
+#define NORMALIZATION_NFC_NO            (1 << 1)
+#define NORMALIZATION_NFC_MAYBE         (1 << 2)
+#define NORMALIZATION_JOINS_PREVIOUS    (1 << 3)
+
+// The most codepoints a segment can decompose to. That's 60 combining marks or so, far more than
+//   the 30 of the Stream-Safe Text Format.
+#define NORMALIZATION_SEGMENT_MAX       64
+
+// Hangul syllables are decomposed and composed arithmetically, from leading consonant, vowel and
+//   optional trailing consonant jamo.
+static const unipoint_t HANGUL_SYLLABLE_BASE    = 0xAC00;
+static const unipoint_t HANGUL_LEADING_BASE     = 0x1100;
+static const unipoint_t HANGUL_VOWEL_BASE       = 0x1161;
+static const unipoint_t HANGUL_TRAILING_BASE    = 0x11A7;
+static const unipoint_t HANGUL_LEADING_COUNT    = 19;
+static const unipoint_t HANGUL_VOWEL_COUNT      = 21;
+static const unipoint_t HANGUL_TRAILING_COUNT   = 28;
+static const unipoint_t HANGUL_SYLLABLE_COUNT   = 11172;
+
+#define __normalization_record(codepoint) (UCD_NORMALIZATION_RECORDS[__ucd_lookup(UCD_NORMALIZATION, codepoint)])
+
+// Codepoints below the limit are unchanged by normalization and don't interact with their neighbours.
+static inline unipoint_t __normalization_limit(int form)
+{
+    return ((form == UNICODE_NORMALIZATION_NFD) ? 0xC0 : 0x300);
+}
+
+// Check whether normalization can restart at a codepoint.
+static inline bool __normalization_boundary(unipoint_t codepoint)
+{
+    return (codepoint < 0x300 || !(__normalization_record(codepoint).flags & NORMALIZATION_JOINS_PREVIOUS));
+}
+
+// Quick check a codepoint, following one with a combining class of `last_class`, storing its flags in `flags`.
+// Return false if the text might not be normalized.
+static inline bool __normalization_quick_check(unipoint_t codepoint, int form, uint8_t *last_class, uint8_t *flags)
+{
+    if (codepoint < __normalization_limit(form))
+    {
+        (*last_class) = 0;
+        (*flags) = 0;
+
+        return true;
+    }
+
+    __typeof__(UCD_NORMALIZATION_RECORDS[0]) record = __normalization_record(codepoint);
+    uint8_t rejected = ((form == UNICODE_NORMALIZATION_NFD) ? NORMALIZATION_NFD_NO :
+                                                              (NORMALIZATION_NFC_NO | NORMALIZATION_NFC_MAYBE));
+
+    // Combining marks must be in order.
+    if ((record.flags & rejected) || (record.combining_class && record.combining_class < (*last_class)))
+        return false;
+
+    (*last_class) = record.combining_class;
+    (*flags) = record.flags;
+
+    return true;
+}
+
+// Get the length of the prefix of UTF-8 made of whole, valid chars for codepoints below `limit`, a word at a time.
+// The limit is at most U+0800, so every char is a single char or a leading char followed by a trailing one.
+static inline size_t __utf8_below_prefix(utf8_char_t *src, size_t src_size, unipoint_t limit, bool)
+{
+    // Adding this to a char without its high bit sets it for leading chars at or past the limit.
+    uint64_t limit_bits = (0x80 - ((0xC0 | (limit >> 6)) & 0x7F)) * WORD_LOW_BITS;
+
+    // The high bits of the first and last char of a word, in memory order.
+    uint64_t first_char = (__host_big_endian ? (0x80ULL << 56) : 0x80ULL);
+    uint64_t last_char = (__host_big_endian ? 0x80ULL : (0x80ULL << 56));
+
+    // Set to first_char when a leading char at the end of the previous word needs a trailing char.
+    uint64_t pending = 0;
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        uint64_t high = word & WORD_HIGH_BITS;
+        uint64_t leading = high & (word << 1);
+        uint64_t trailing = high & ~leading;
+
+        // Leading chars which are past the limit, or 0xC0 and 0xC1 which are always overlong.
+        uint64_t past_limit = ((word & ~WORD_HIGH_BITS) + limit_bits) & high;
+        uint64_t overlong = ~((word & 0x3E3E3E3E3E3E3E3EULL) + ~WORD_HIGH_BITS) & leading;
+
+        // Every leading char must be followed by a trailing char, and nothing else may be.
+        uint64_t expected = (__host_big_endian ? (leading >> 8) : (leading << 8)) | pending;
+
+        if (past_limit | overlong | (trailing ^ expected))
+            break;
+
+        pending = ((leading & last_char) ? first_char : 0);
+    }
+
+    // Don't stop right after a leading char.
+    return (pending ? i - 1 : i);
+}
+
+// Same as above, for UTF-16. There are no surrogates below the limit.
+static inline size_t __utf16_below_prefix(utf16_char_t *src, size_t src_size, unipoint_t limit, bool swap)
+{
+    // Adding this to a char without its high bit sets it for chars at or past the limit.
+    uint64_t limit_bits = (0x8000 - limit) * 0x0001000100010001ULL;
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (swap)
+            word = ((word & 0x00FF00FF00FF00FFULL) << 8) | ((word >> 8) & 0x00FF00FF00FF00FFULL);
+
+        if ((((word & 0x7FFF7FFF7FFF7FFFULL) + limit_bits) | word) & 0x8000800080008000ULL)
+            break;
+    }
+
+    while (i < src_size && __utf16_swap(src[i], swap) < limit)
+        i++;
+
+    return i;
+}
+
+// Add the full decomposition of a codepoint to a segment, with the combining class of each codepoint.
+// Return false if it doesn't fit.
+static inline bool __normalization_decompose(unipoint_t codepoint, unipoint_t *segment, uint8_t *classes, size_t *segment_size)
+{
+    unipoint_t decomposition[3] = { codepoint };
+    const unipoint_t *decomposed = decomposition;
+    size_t count = 1;
+
+    if (codepoint - HANGUL_SYLLABLE_BASE < HANGUL_SYLLABLE_COUNT)
+    {
+        unipoint_t index = codepoint - HANGUL_SYLLABLE_BASE;
+
+        decomposition[0] = HANGUL_LEADING_BASE + index / (HANGUL_VOWEL_COUNT * HANGUL_TRAILING_COUNT);
+        decomposition[1] = HANGUL_VOWEL_BASE + (index / HANGUL_TRAILING_COUNT) % HANGUL_VOWEL_COUNT;
+        decomposition[2] = HANGUL_TRAILING_BASE + index % HANGUL_TRAILING_COUNT;
+        count = ((index % HANGUL_TRAILING_COUNT) ? 3 : 2);
+    }
+    else if (codepoint >= 0xC0)
+    {
+        __typeof__(UCD_NORMALIZATION_RECORDS[0]) record = __normalization_record(codepoint);
+
+        if (record.decomposition_length)
+        {
+            decomposed = UCD_DECOMPOSITIONS + record.decomposition;
+            count = record.decomposition_length;
+        }
+    }
+
+    if ((*segment_size) + count > NORMALIZATION_SEGMENT_MAX)
+        return false;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        segment[*segment_size] = decomposed[i];
+        classes[*segment_size] = ((decomposed[i] < 0x300) ? 0 : __normalization_record(decomposed[i]).combining_class);
+        (*segment_size)++;
+    }
+
+    return true;
+}
+
+// Put the combining marks of a decomposed segment in canonical order, keeping marks of the same class in order.
+static inline void __normalization_reorder(unipoint_t *segment, uint8_t *classes, size_t segment_size)
+{
+    for (size_t i = 1; i < segment_size; i++)
+    {
+        unipoint_t codepoint = segment[i];
+        uint8_t combining_class = classes[i];
+        size_t j = i;
+
+        // Marks never move past a starter.
+        for ( ; j > 0 && combining_class && classes[j - 1] > combining_class; j--)
+        {
+            segment[j] = segment[j - 1];
+            classes[j] = classes[j - 1];
+        }
+
+        segment[j] = codepoint;
+        classes[j] = combining_class;
+    }
+}
+
+// Get the primary composite of two codepoints, or 0 if there's none.
+static inline unipoint_t __normalization_composite(unipoint_t first, unipoint_t second)
+{
+    if (first - HANGUL_LEADING_BASE < HANGUL_LEADING_COUNT && second - HANGUL_VOWEL_BASE < HANGUL_VOWEL_COUNT)
+    {
+        return HANGUL_SYLLABLE_BASE + ((first - HANGUL_LEADING_BASE) * HANGUL_VOWEL_COUNT +
+                                       (second - HANGUL_VOWEL_BASE)) * HANGUL_TRAILING_COUNT;
+    }
+
+    if (first - HANGUL_SYLLABLE_BASE < HANGUL_SYLLABLE_COUNT && !((first - HANGUL_SYLLABLE_BASE) % HANGUL_TRAILING_COUNT) &&
+        second - HANGUL_TRAILING_BASE - 1 < HANGUL_TRAILING_COUNT - 1)
+    {
+        return first + (second - HANGUL_TRAILING_BASE);
+    }
+
+    __typeof__(UCD_NORMALIZATION_RECORDS[0]) record = __normalization_record(first);
+
+    for (size_t i = record.composition; i < (size_t)record.composition + record.composition_count; i++)
+    {
+        if (UCD_COMPOSITIONS[i][0] == second)
+            return UCD_COMPOSITIONS[i][1];
+    }
+
+    return 0;
+}
+
+// Compose a decomposed and reordered segment in place.
+// Return the number of codepoints left.
+static inline size_t __normalization_compose(unipoint_t *segment, uint8_t *classes, size_t segment_size)
+{
+    // There's nothing to compose with until the first starter.
+    size_t starter = ((segment_size && !classes[0]) ? 0 : SIZE_MAX);
+    uint8_t last_class = 0;
+    size_t kept = 1;
+
+    for (size_t i = 1; i < segment_size; i++)
+    {
+        unipoint_t codepoint = segment[i];
+        uint8_t combining_class = classes[i];
+
+        // A codepoint composes with the last starter unless a mark in between has the same or a higher class.
+        if (starter != SIZE_MAX && (kept == starter + 1 || last_class < combining_class))
+        {
+            unipoint_t composite = __normalization_composite(segment[starter], codepoint);
+
+            if (composite)
+            {
+                segment[starter] = composite;
+                continue;
+            }
+        }
+
+        if (!combining_class)
+            starter = kept;
+
+        last_class = combining_class;
+        segment[kept] = codepoint;
+        classes[kept] = combining_class;
+        kept++;
+    }
+
+    return ((segment_size) ? kept : 0);
+}
+
+// Check and decode a single sequence of UTF-X.
+#define NORMALIZE_CHECK_8(s, n, c)      (__utf8_sequence_check((s), (n), (c)))
+#define NORMALIZE_CHECK_16(s, n, c)     (__utf16_sequence_check((s), (n), (c), swap))
+#define NORMALIZE_DECODE_8(s, n)        (__utf8_decode((s), (n)))
+#define NORMALIZE_DECODE_16(s, n)       (__codepoint_from_utf16((s), (n), NULL, swap))
+
+// Number of UTF-X chars needed for a codepoint.
+#define NORMALIZE_CHARS_8(c)            (__utf8_chars_for_codepoint(c))
+#define NORMALIZE_CHARS_16(c)           (((c) < UTF16_ONE_CHAR_LIMIT) ? 1 : 2)
+
+// Start of the last char of a run below the limit, which is at most 2 UTF-8 chars long.
+#define NORMALIZE_LAST_CHAR_8(s, i)     ((((s)[(i) - 1] & 0xC0) == 0x80) ? (i) - 2 : (i) - 1)
+#define NORMALIZE_LAST_CHAR_16(s, i)    ((i) - 1)
+
+// Start of the valid codepoint containing the char at `i`.
+#define NORMALIZE_CHAR_START_8(s, i)    (__utf8_char_start((s), (i)))
+#define NORMALIZE_CHAR_START_16(s, i)   (((i) && (__utf16_swap((s)[i], swap) & 0xFC00) == 0xDC00) ? (i) - 1 : (i))
+
+static inline size_t __utf8_char_start(utf8_char_t *src, size_t i)
+{
+    while (i && (src[i] & 0xC0) == 0x80)
+        i--;
+
+    return i;
+}
+
+#define NORMALIZED_PREFIX_UTFX(X)                                                                           \
+    do {                                                                                                    \
+        unipoint_t limit = __normalization_limit(form);                                                     \
+        size_t boundary = 0;                                                                                \
+        uint8_t last_class = 0;                                                                             \
+        size_t i = 0;                                                                                       \
+                                                                                                            \
+        (*status) = 0;                                                                                      \
+                                                                                                            \
+        while (i < src_size)                                                                                \
+        {                                                                                                   \
+            /* Every codepoint below the limit is normalized and a boundary. */                             \
+            size_t below = __utf ## X ## _below_prefix(src + i, src_size - i, limit, swap);                 \
+                                                                                                            \
+            if (below)                                                                                      \
+            {                                                                                               \
+                i += below;                                                                                 \
+                boundary = NORMALIZE_LAST_CHAR_ ## X(src, i);                                               \
+                last_class = 0;                                                                             \
+                                                                                                            \
+                if (i == src_size)                                                                          \
+                    break;                                                                                  \
+            }                                                                                               \
+                                                                                                            \
+            size_t consumed;                                                                                \
+            int result = NORMALIZE_CHECK_ ## X(src + i, src_size - i, &consumed);                           \
+                                                                                                            \
+            /* Everything before an invalid sequence is checked as if the string ended there. */            \
+            if (result)                                                                                     \
+            {                                                                                               \
+                (*status) = result;                                                                         \
+                return i;                                                                                   \
+            }                                                                                               \
+                                                                                                            \
+            uint8_t flags;                                                                                  \
+                                                                                                            \
+            unipoint_t codepoint = NORMALIZE_DECODE_ ## X(src + i, consumed);                               \
+                                                                                                            \
+            if (!__normalization_quick_check(codepoint, form, &last_class, &flags))                         \
+                return boundary;                                                                            \
+                                                                                                            \
+            if (!(flags & NORMALIZATION_JOINS_PREVIOUS))                                                    \
+                boundary = i;                                                                               \
+                                                                                                            \
+            i += consumed;                                                                                  \
+        }                                                                                                   \
+                                                                                                            \
+        return i;                                                                                           \
+    } while (0)
+
+static inline size_t __utf8_normalized_prefix(utf8_char_t *src, size_t src_size, int form, int *status, bool swap)
+{ NORMALIZED_PREFIX_UTFX(8); }
+
+static inline size_t __utf16_normalized_prefix(utf16_char_t *src, size_t src_size, int form, int *status, bool swap)
+{ NORMALIZED_PREFIX_UTFX(16); }
+
+size_t utf8_normalized_prefix(utf8_char_t *src, size_t src_size, int form, int *status, bool swap)
+{
+    return __utf8_normalized_prefix(src, src_size, form, status, swap);
+}
+
+size_t utf16_normalized_prefix(utf16_char_t *src, size_t src_size, int form, int *status, bool swap)
+{
+    return __utf16_normalized_prefix(src, src_size, form, status, swap);
+}
+
+#define NORMALIZE_UTFX(X)                                                                                   \
+    do {                                                                                                    \
+        utf ## X ## _char_t *dest_ptr = dest;                                                               \
+        utf ## X ## _char_t *dest_end = dest + (*dest_size);                                                \
+        utf ## X ## _char_t *src_ptr = src;                                                                 \
+        utf ## X ## _char_t *src_end = src + src_size;                                                      \
+                                                                                                            \
+        while (src < src_end)                                                                               \
+        {                                                                                                   \
+            /* Copy the part which is already normalized as it is, without splitting a codepoint. */        \
+            size_t prefix = __utf ## X ## _normalized_prefix(src, (src_end - src), form, status, swap);     \
+            size_t copied = prefix;                                                                         \
+                                                                                                            \
+            if (copied > (size_t)(dest_end - dest))                                                         \
+            {                                                                                               \
+                copied = NORMALIZE_CHAR_START_ ## X(src, (size_t)(dest_end - dest));                        \
+                (*status) = 0;                                                                              \
+            }                                                                                               \
+                                                                                                            \
+            memcpy(dest, src, copied * sizeof(*src));                                                       \
+            dest += copied;                                                                                 \
+            src += copied;                                                                                  \
+                                                                                                            \
+            if (copied < prefix || (*status) || src == src_end)                                             \
+                break;                                                                                      \
+                                                                                                            \
+            /* Decompose the rest of the segment, up to the next codepoint normalization can restart at. */ \
+            unipoint_t segment[NORMALIZATION_SEGMENT_MAX];                                                  \
+            uint8_t classes[NORMALIZATION_SEGMENT_MAX];                                                     \
+            size_t segment_size = 0;                                                                        \
+            size_t consumed = 0;                                                                            \
+                                                                                                            \
+            while (src + consumed < src_end)                                                                \
+            {                                                                                               \
+                size_t char_count;                                                                          \
+                                                                                                            \
+                if (NORMALIZE_CHECK_ ## X(src + consumed, (src_end - src) - consumed, &char_count))         \
+                    break;                                                                                  \
+                                                                                                            \
+                unipoint_t codepoint = NORMALIZE_DECODE_ ## X(src + consumed, char_count);                  \
+                                                                                                            \
+                if (consumed && __normalization_boundary(codepoint))                                        \
+                    break;                                                                                  \
+                                                                                                            \
+                if (!__normalization_decompose(codepoint, segment, classes, &segment_size))                 \
+                {                                                                                           \
+                    (*status) = 10;                                                                         \
+                    break;                                                                                  \
+                }                                                                                           \
+                                                                                                            \
+                consumed += char_count;                                                                     \
+            }                                                                                               \
+                                                                                                            \
+            if (*status)                                                                                    \
+                break;                                                                                      \
+                                                                                                            \
+            __normalization_reorder(segment, classes, segment_size);                                        \
+                                                                                                            \
+            if (form == UNICODE_NORMALIZATION_NFC)                                                          \
+                segment_size = __normalization_compose(segment, classes, segment_size);                     \
+                                                                                                            \
+            /* The segment is never split over the end of the dest buffer. */                               \
+            size_t char_count = 0;                                                                          \
+                                                                                                            \
+            for (size_t i = 0; i < segment_size; i++)                                                       \
+                char_count += NORMALIZE_CHARS_ ## X(segment[i]);                                            \
+                                                                                                            \
+            if (char_count > (size_t)(dest_end - dest))                                                     \
+                break;                                                                                      \
+                                                                                                            \
+            for (size_t i = 0; i < segment_size; i++)                                                       \
+                dest += __utf ## X ## _from_codepoint(segment[i], dest, (dest_end - dest), swap);           \
+                                                                                                            \
+            src += consumed;                                                                                \
+        }                                                                                                   \
+                                                                                                            \
+        (*dest_size) = (dest - dest_ptr);                                                                   \
+                                                                                                            \
+        return (src - src_ptr);                                                                             \
+    } while (0)
+
+size_t utf8_normalize(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int form, int *status, bool swap)
+{ NORMALIZE_UTFX(8); }
+
+size_t utf16_normalize(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int form, int *status, bool swap)
+{ NORMALIZE_UTFX(16); }
+
+#undef NORMALIZE_UTFX
+#undef NORMALIZED_PREFIX_UTFX
+#undef NORMALIZE_CHAR_START_16
+#undef NORMALIZE_CHAR_START_8
+#undef NORMALIZE_LAST_CHAR_16
+#undef NORMALIZE_LAST_CHAR_8
+#undef NORMALIZE_CHARS_16
+#undef NORMALIZE_CHARS_8
+#undef NORMALIZE_DECODE_16
+#undef NORMALIZE_DECODE_8
+#undef NORMALIZE_CHECK_16
+#undef NORMALIZE_CHECK_8
+
+/* ********************************** */
+/* -*- grapheme cluster functions -*- */
+/* ********************************** */
+
+// Grapheme cluster break classes, as in tables/gen_ucd.py.
+#define GRAPHEME_OTHER                  0
+#define GRAPHEME_CR                     1
+#define GRAPHEME_LF                     2
+#define GRAPHEME_CONTROL                3
+#define GRAPHEME_EXTEND                 4
+#define GRAPHEME_ZWJ                    5
+#define GRAPHEME_REGIONAL_INDICATOR     6
+#define GRAPHEME_PREPEND                7
+#define GRAPHEME_SPACING_MARK           8
+#define GRAPHEME_L                      9
+#define GRAPHEME_V                      10
+#define GRAPHEME_T                      11
+#define GRAPHEME_LV                     12
+#define GRAPHEME_LVT                    13
+#define GRAPHEME_EXTENDED_PICTOGRAPHIC  14
+
+// What's known about a grapheme cluster so far.
+typedef struct {
+    uint8_t last;           // Class of the last codepoint
+    uint8_t emoji;          // 1 after Extended_Pictographic Extend*, 2 if a ZWJ follows that
+    bool odd_regional;      // Whether the cluster ends with an odd number of regional indicators
+} __grapheme_state_t;
+
+static inline uint8_t __grapheme_class(unipoint_t codepoint)
+{
+    if (codepoint < UTF8_ONE_CHAR_LIMIT)
+    {
+        if (codepoint == '\r')
+            return GRAPHEME_CR;
+
+        if (codepoint == '\n')
+            return GRAPHEME_LF;
+
+        return ((codepoint < 0x20 || codepoint == 0x7F) ? GRAPHEME_CONTROL : GRAPHEME_OTHER);
+    }
+
+    return __ucd_lookup(UCD_GRAPHEME, codepoint);
+}
+
+// Add a codepoint of class `next` to the state of a cluster.
+static inline void __grapheme_add(__grapheme_state_t *state, uint8_t next)
+{
+    if (next == GRAPHEME_EXTENDED_PICTOGRAPHIC)
+        state->emoji = 1;
+    else if (next == GRAPHEME_ZWJ && state->emoji == 1)
+        state->emoji = 2;
+    else if (next != GRAPHEME_EXTEND || state->emoji != 1)
+        state->emoji = 0;
+
+    state->odd_regional = (next == GRAPHEME_REGIONAL_INDICATOR && !state->odd_regional);
+    state->last = next;
+}
+
+// Check whether there's a grapheme cluster boundary before a codepoint of class `next`, following the
+//   rules of UAX #29, and add it to the state of the cluster if not.
+static inline bool __grapheme_break(__grapheme_state_t *state, uint8_t next)
+{
+    uint8_t last = state->last;
+    bool joined;
+
+    if (last == GRAPHEME_CR || last == GRAPHEME_LF || last == GRAPHEME_CONTROL)
+        joined = (last == GRAPHEME_CR && next == GRAPHEME_LF);                                  // GB3, GB4
+    else if (next == GRAPHEME_CR || next == GRAPHEME_LF || next == GRAPHEME_CONTROL)
+        joined = false;                                                                         // GB5
+    else if (last == GRAPHEME_L && (next == GRAPHEME_L || next == GRAPHEME_V || next == GRAPHEME_LV || next == GRAPHEME_LVT))
+        joined = true;                                                                          // GB6
+    else if ((last == GRAPHEME_LV || last == GRAPHEME_V) && (next == GRAPHEME_V || next == GRAPHEME_T))
+        joined = true;                                                                          // GB7
+    else if ((last == GRAPHEME_LVT || last == GRAPHEME_T) && next == GRAPHEME_T)
+        joined = true;                                                                          // GB8
+    else
+    {
+        joined = (next == GRAPHEME_EXTEND || next == GRAPHEME_ZWJ || next == GRAPHEME_SPACING_MARK ||  // GB9, GB9a
+                  last == GRAPHEME_PREPEND ||                                                   // GB9b
+                  (next == GRAPHEME_EXTENDED_PICTOGRAPHIC && state->emoji == 2) ||              // GB11
+                  (next == GRAPHEME_REGIONAL_INDICATOR && state->odd_regional));                // GB12, GB13
+    }
+
+    if (joined)
+        __grapheme_add(state, next);
+
+    return !joined;
+}
+
+// Get the length of the prefix of UTFX which is ASCII other than CR, a word at a time.
+static inline size_t __utf8_grapheme_run(utf8_char_t *src, size_t src_size, bool)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & WORD_HIGH_BITS)
+            break;
+
+        // Every char of the word is ASCII, so adding 0x7F sets the high bit of every char which isn't CR.
+        uint64_t carriage_returns = ~((word ^ ('\r' * WORD_LOW_BITS)) + ~WORD_HIGH_BITS) & WORD_HIGH_BITS;
+
+        if (carriage_returns)
+            break;
+    }
+
+    while (i < src_size && src[i] < UTF8_ONE_CHAR_LIMIT && src[i] != '\r')
+        i++;
+
+    return i;
+}
+
+static inline size_t __utf16_grapheme_run(utf16_char_t *src, size_t src_size, bool swap)
+{
+    // Bits that must be clear in each of the 4 chars of a word, and CR, before swapping.
+    uint64_t mask = ((swap) ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL);
+    uint64_t carriage_return = __utf16_swap((utf16_char_t)'\r', swap) * 0x0001000100010001ULL;
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & mask)
+            break;
+
+        if (~((word ^ carriage_return) + 0x7FFF7FFF7FFF7FFFULL) & 0x8000800080008000ULL)
+            break;
+    }
+
+    while (i < src_size && __utf16_swap(src[i], swap) < UTF8_ONE_CHAR_LIMIT && __utf16_swap(src[i], swap) != '\r')
+        i++;
+
+    return i;
+}
+
+// Get the grapheme cluster break class of the codepoint at the start of UTF-X, storing its length in `consumed`.
+// Each char of an invalid sequence is a control on its own.
+static inline uint8_t __utf8_grapheme_class(utf8_char_t *src, size_t src_size, size_t *consumed)
+{
+    if (src[0] < UTF8_ONE_CHAR_LIMIT)
+    {
+        (*consumed) = 1;
+        return __grapheme_class(src[0]);
+    }
+
+    if (__utf8_sequence_check(src, src_size, consumed))
+    {
+        (*consumed) = 1;
+        return GRAPHEME_CONTROL;
+    }
+
+    return __grapheme_class(__utf8_decode(src, (*consumed)));
+}
+
+static inline uint8_t __utf16_grapheme_class(utf16_char_t *src, size_t src_size, size_t *consumed, bool swap)
+{
+    if (__utf16_sequence_check(src, src_size, consumed, swap))
+    {
+        (*consumed) = 1;
+        return GRAPHEME_CONTROL;
+    }
+
+    return __grapheme_class(__codepoint_from_utf16(src, (*consumed), NULL, swap));
+}
+
+#define GRAPHEME_CLASS_8(s, n, c)       (__utf8_grapheme_class((s), (n), (c)))
+#define GRAPHEME_CLASS_16(s, n, c)      (__utf16_grapheme_class((s), (n), (c), swap))
+
+// Get the length of the grapheme cluster at the start of a non-empty UTFX string.
+#define GRAPHEME_CLUSTER_UTFX(X)                                                                            \
+    do {                                                                                                    \
+        size_t consumed;                                                                                    \
+        __grapheme_state_t state = {0};                                                                     \
+                                                                                                            \
+        __grapheme_add(&state, GRAPHEME_CLASS_ ## X(src, src_size, &consumed));                             \
+                                                                                                            \
+        size_t i = consumed;                                                                                \
+                                                                                                            \
+        for ( ; i < src_size; i += consumed)                                                                \
+        {                                                                                                   \
+            if (__grapheme_break(&state, GRAPHEME_CLASS_ ## X(src + i, src_size - i, &consumed)))           \
+                break;                                                                                      \
+        }                                                                                                   \
+                                                                                                            \
+        return i;                                                                                           \
+    } while (0)
+
+static inline size_t __utf8_grapheme_cluster(utf8_char_t *src, size_t src_size, bool)
+{ GRAPHEME_CLUSTER_UTFX(8); }
+
+static inline size_t __utf16_grapheme_cluster(utf16_char_t *src, size_t src_size, bool swap)
+{ GRAPHEME_CLUSTER_UTFX(16); }
+
+size_t utf8_grapheme_next(utf8_char_t *src, size_t src_size, bool swap)
+{
+    return ((src_size) ? __utf8_grapheme_cluster(src, src_size, swap) : 0);
+}
+
+size_t utf16_grapheme_next(utf16_char_t *src, size_t src_size, bool swap)
+{
+    return ((src_size) ? __utf16_grapheme_cluster(src, src_size, swap) : 0);
+}
+
+#define GRAPHEME_ADVANCE_UTFX(X)                                                                            \
+    do {                                                                                                    \
+        size_t wanted = (*count);                                                                           \
+        size_t clusters = 0;                                                                                \
+        size_t i = 0;                                                                                       \
+                                                                                                            \
+        while (clusters < wanted && i < src_size)                                                           \
+        {                                                                                                   \
+            /* Each char of a run of ASCII without CR is a cluster, but the last may be extended. */        \
+            size_t run = __utf ## X ## _grapheme_run(src + i, src_size - i, swap);                          \
+                                                                                                            \
+            if (run > 1)                                                                                    \
+            {                                                                                               \
+                size_t skipped = (((run - 1) < (wanted - clusters)) ? (run - 1) : (wanted - clusters));     \
+                                                                                                            \
+                i += skipped;                                                                               \
+                clusters += skipped;                                                                        \
+                                                                                                            \
+                if (clusters == wanted)                                                                     \
+                    break;                                                                                  \
+            }                                                                                               \
+                                                                                                            \
+            i += __utf ## X ## _grapheme_cluster(src + i, src_size - i, swap);                              \
+            clusters++;                                                                                     \
+        }                                                                                                   \
+                                                                                                            \
+        (*count) = clusters;                                                                                \
+                                                                                                            \
+        return i;                                                                                           \
+    } while (0)
+
+size_t utf8_grapheme_advance(utf8_char_t *src, size_t src_size, size_t *count, bool swap)
+{ GRAPHEME_ADVANCE_UTFX(8); }
+
+size_t utf16_grapheme_advance(utf16_char_t *src, size_t src_size, size_t *count, bool swap)
+{ GRAPHEME_ADVANCE_UTFX(16); }
+
+#undef GRAPHEME_ADVANCE_UTFX
+#undef GRAPHEME_CLUSTER_UTFX
+#undef GRAPHEME_CLASS_16
+#undef GRAPHEME_CLASS_8
+
+/* *********************************** */
+/* -*- word segmentation functions -*- */
+/* *********************************** */
+
+// Word break classes, as in tables/gen_ucd.py. Extended_Pictographic is a flag on top of them.
+#define WORD_OTHER                      0
+#define WORD_CR                         1
+#define WORD_LF                         2
+#define WORD_NEWLINE                    3
+#define WORD_EXTEND                     4
+#define WORD_ZWJ                        5
+#define WORD_REGIONAL_INDICATOR         6
+#define WORD_FORMAT                     7
+#define WORD_KATAKANA                   8
+#define WORD_HEBREW_LETTER              9
+#define WORD_ALETTER                    10
+#define WORD_SINGLE_QUOTE               11
+#define WORD_DOUBLE_QUOTE               12
+#define WORD_MID_NUM_LET                13
+#define WORD_MID_LETTER                 14
+#define WORD_MID_NUM                    15
+#define WORD_NUMERIC                    16
+#define WORD_EXTEND_NUM_LET             17
+#define WORD_WSEG_SPACE                 18
+#define WORD_OTHER_LETTER               19
+#define WORD_EXTENDED_PICTOGRAPHIC      0x20
+
+// Class of nothing, before the start of the text or past its end.
+#define WORD_NONE                       0xFF
+
+// What's known about the text before a possible word boundary.
+typedef struct {
+    uint8_t raw_last;       // Class of the last codepoint
+    uint8_t last;           // Class of the last codepoint that isn't ignored (Extend, Format or ZWJ)
+    uint8_t before_last;    // Class of the one before that
+    bool odd_regional;      // Whether the text ends with an odd number of regional indicators
+} __word_state_t;
+
+static inline bool __word_ah_letter(uint8_t word_class)
+{
+    return (word_class == WORD_ALETTER || word_class == WORD_HEBREW_LETTER);
+}
+
+// MidLetter and MidNum, including MidNumLet and Single_Quote.
+static inline bool __word_mid_letter(uint8_t word_class)
+{
+    return (word_class == WORD_MID_LETTER || word_class == WORD_MID_NUM_LET || word_class == WORD_SINGLE_QUOTE);
+}
+
+static inline bool __word_mid_num(uint8_t word_class)
+{
+    return (word_class == WORD_MID_NUM || word_class == WORD_MID_NUM_LET || word_class == WORD_SINGLE_QUOTE);
+}
+
+static inline bool __word_ignored(uint8_t word_class)
+{
+    return (word_class == WORD_EXTEND || word_class == WORD_FORMAT || word_class == WORD_ZWJ);
+}
+
+static inline bool __word_newline(uint8_t word_class)
+{
+    return (word_class == WORD_CR || word_class == WORD_LF || word_class == WORD_NEWLINE);
+}
+
+// Classes joined by ExtendNumLet, like the underscore.
+static inline bool __word_joins_underscore(uint8_t word_class)
+{
+    return (__word_ah_letter(word_class) || word_class == WORD_NUMERIC || word_class == WORD_KATAKANA);
+}
+
+// Letters and numbers, which make a segment a word.
+static inline bool __word_letter(uint8_t word_class)
+{
+    return (__word_joins_underscore(word_class) || word_class == WORD_OTHER_LETTER);
+}
+
+// Add a codepoint of class `next` to the state.
+static inline void __word_add(__word_state_t *state, uint8_t next)
+{
+    next &= ~WORD_EXTENDED_PICTOGRAPHIC;
+    state->raw_last = next;
+
+    // Ignored codepoints are part of whatever is before them, unless it's a newline or nothing.
+    if (__word_ignored(next) && state->last != WORD_NONE && !__word_newline(state->last))
+        return;
+
+    state->odd_regional = (next == WORD_REGIONAL_INDICATOR && !state->odd_regional);
+    state->before_last = state->last;
+    state->last = next;
+}
+
+// Check whether deciding on a boundary before a codepoint of class `next` needs the class of the
+//   codepoint after it which isn't ignored.
+static inline bool __word_needs_lookahead(__word_state_t *state, uint8_t next)
+{
+    next &= ~WORD_EXTENDED_PICTOGRAPHIC;
+
+    return ((__word_ah_letter(state->last) && __word_mid_letter(next)) ||
+            (state->last == WORD_HEBREW_LETTER && next == WORD_DOUBLE_QUOTE) ||
+            (state->last == WORD_NUMERIC && __word_mid_num(next)));
+}
+
+// Check whether there's a word boundary before a codepoint of class `next`, followed by one of class
+//   `after_next` which isn't ignored, following the rules of UAX #29.
+static inline bool __word_break(__word_state_t *state, uint8_t next, uint8_t after_next)
+{
+    uint8_t raw_last = state->raw_last;
+    uint8_t last = state->last;
+    uint8_t before_last = state->before_last;
+    bool pictographic = (next & WORD_EXTENDED_PICTOGRAPHIC);
+
+    next &= ~WORD_EXTENDED_PICTOGRAPHIC;
+
+    if (__word_newline(raw_last) || __word_newline(next))
+        return !(raw_last == WORD_CR && next == WORD_LF);                                       // WB3, WB3a, WB3b
+
+    if ((raw_last == WORD_ZWJ && pictographic) ||                                               // WB3c
+        (raw_last == WORD_WSEG_SPACE && next == WORD_WSEG_SPACE) ||                             // WB3d
+        __word_ignored(next))                                                                   // WB4
+        return false;
+
+    if ((__word_ah_letter(last) && __word_ah_letter(next)) ||                                   // WB5
+        (__word_ah_letter(last) && __word_mid_letter(next) && __word_ah_letter(after_next)) ||  // WB6
+        (__word_ah_letter(before_last) && __word_mid_letter(last) && __word_ah_letter(next)) || // WB7
+        (last == WORD_HEBREW_LETTER && next == WORD_SINGLE_QUOTE) ||                            // WB7a
+        (last == WORD_HEBREW_LETTER && next == WORD_DOUBLE_QUOTE && after_next == WORD_HEBREW_LETTER) ||
+        (before_last == WORD_HEBREW_LETTER && last == WORD_DOUBLE_QUOTE && next == WORD_HEBREW_LETTER))
+        return false;                                                                           // WB7b, WB7c
+
+    if (((last == WORD_NUMERIC || __word_ah_letter(last)) && next == WORD_NUMERIC) ||           // WB8, WB9
+        (last == WORD_NUMERIC && __word_ah_letter(next)) ||                                     // WB10
+        (before_last == WORD_NUMERIC && __word_mid_num(last) && next == WORD_NUMERIC) ||        // WB11
+        (last == WORD_NUMERIC && __word_mid_num(next) && after_next == WORD_NUMERIC) ||         // WB12
+        (last == WORD_KATAKANA && next == WORD_KATAKANA))                                       // WB13
+        return false;
+
+    if ((next == WORD_EXTEND_NUM_LET && (__word_joins_underscore(last) || last == WORD_EXTEND_NUM_LET)) ||  // WB13a
+        (last == WORD_EXTEND_NUM_LET && __word_joins_underscore(next)))                         // WB13b
+        return false;
+
+    return !(last == WORD_REGIONAL_INDICATOR && next == WORD_REGIONAL_INDICATOR && state->odd_regional);
+}
+
+// Get the word break class of the codepoint at the start of UTF-8, storing its length in `consumed`.
+// Each char of an invalid sequence is an Other on its own. WORD_NONE if the sequence is cut off by
+//   the end of src, which might not be the end of the text.
+static inline uint8_t __utf8_word_class(utf8_char_t *src, size_t src_size, size_t *consumed)
+{
+    if (src[0] < UTF8_ONE_CHAR_LIMIT)
+    {
+        (*consumed) = 1;
+        return __ucd_lookup(UCD_WORD, src[0]);
+    }
+
+    int result = __utf8_sequence_check(src, src_size, consumed);
+
+    if (result)
+    {
+        bool cut_off = (result == 4 && (*consumed) == src_size);
+
+        (*consumed) = 1;
+        return ((cut_off) ? WORD_NONE : WORD_OTHER);
+    }
+
+    return __ucd_lookup(UCD_WORD, __utf8_decode(src, (*consumed)));
+}
+
+// Get the class of the first codepoint of UTF-8 which isn't ignored, or WORD_NONE if there's none.
+static inline uint8_t __utf8_word_lookahead(utf8_char_t *src, size_t src_size)
+{
+    for (size_t i = 0, consumed; i < src_size; i += consumed)
+    {
+        uint8_t word_class = __utf8_word_class(src + i, src_size - i, &consumed);
+
+        if (word_class == WORD_NONE)
+            break;
+
+        word_class &= ~WORD_EXTENDED_PICTOGRAPHIC;
+
+        if (!__word_ignored(word_class))
+            return word_class;
+    }
+
+    return WORD_NONE;
+}
+
+// Get the length of the prefix of ASCII letters and digits, a word at a time.
+static inline size_t __utf8_alnum_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & WORD_HIGH_BITS)
+            break;
+
+        // Setting 0x20 makes upper case letters lower case, and doesn't make anything else a letter.
+        uint64_t alnum = __ascii_word_range(word, '0', '9') | __ascii_word_range(word | (0x20 * WORD_LOW_BITS), 'a', 'z');
+
+        if (alnum != WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && (('0' <= src[i] && src[i] <= '9') || ('a' <= (src[i] | 0x20) && (src[i] | 0x20) <= 'z')))
+        i++;
+
+    return i;
+}
+
+// Get the length of the prefix of spaces, a word at a time.
+static inline size_t __utf8_space_prefix(utf8_char_t *src, size_t src_size)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word != ' ' * WORD_LOW_BITS)
+            break;
+    }
+
+    while (i < src_size && src[i] == ' ')
+        i++;
+
+    return i;
+}
+
+size_t utf8_words(unicode_span_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool final, bool)
+{
+    unicode_span_t *dest_ptr = dest;
+    unicode_span_t *dest_end = dest + (*dest_size);
+
+    __word_state_t state = { WORD_NONE, WORD_NONE, WORD_NONE, false };
+    size_t start = 0;       // Start of the current segment
+    bool word = false;      // Whether the current segment has letters or numbers
+    bool done = true;       // Whether the end of src was reached
+    size_t i = 0;
+
+    while (i < src_size)
+    {
+        // ASCII letters and digits always join letters and numbers, and spaces join spaces.
+        if (state.raw_last == WORD_ALETTER || state.raw_last == WORD_NUMERIC)
+        {
+            size_t run = __utf8_alnum_prefix(src + i, src_size - i);
+
+            if (run)
+            {
+                i += run;
+                state.before_last = ((run > 1) ? __ucd_lookup(UCD_WORD, src[i - 2]) : state.last);
+                state.last = state.raw_last = __ucd_lookup(UCD_WORD, src[i - 1]);
+                state.odd_regional = false;
+                word = true;
+
+                continue;
+            }
+        }
+        else if (state.raw_last == WORD_WSEG_SPACE)
+        {
+            size_t run = __utf8_space_prefix(src + i, src_size - i);
+
+            if (run)
+            {
+                i += run;
+                state.before_last = WORD_WSEG_SPACE;
+
+                continue;
+            }
+        }
+
+        size_t consumed;
+        uint8_t next = __utf8_word_class(src + i, src_size - i, &consumed);
+
+        if (next == WORD_NONE)
+        {
+            if (!final)
+            {
+                done = false;
+                break;
+            }
+
+            next = WORD_OTHER;
+        }
+
+        if (i)
+        {
+            uint8_t after_next = WORD_NONE;
+
+            // Some rules depend on what's after this codepoint. Without it, the segment isn't finished.
+            if (__word_needs_lookahead(&state, next))
+            {
+                after_next = __utf8_word_lookahead(src + i + consumed, src_size - i - consumed);
+
+                if (after_next == WORD_NONE && !final)
+                {
+                    done = false;
+                    break;
+                }
+            }
+
+            if (__word_break(&state, next, after_next))
+            {
+                if (word)
+                {
+                    if (dest == dest_end)
+                    {
+                        done = false;
+                        break;
+                    }
+
+                    dest->offset = start;
+                    dest->length = i - start;
+                    dest++;
+                }
+
+                start = i;
+                word = false;
+            }
+        }
+
+        __word_add(&state, next);
+        word |= __word_letter(next & ~WORD_EXTENDED_PICTOGRAPHIC);
+        i += consumed;
+    }
+
+    // The last segment is only finished at the end of the text.
+    if (done && final && start < src_size)
+    {
+        if (!word)
+            start = src_size;
+        else if (dest < dest_end)
+        {
+            dest->offset = start;
+            dest->length = src_size - start;
+            dest++;
+
+            start = src_size;
+        }
+    }
+
+    (*dest_size) = (dest - dest_ptr);
+
+    return start;
+}
+
+/* ******************************* */
+/* -*- line breaking functions -*- */
+/* ******************************* */
+
+// Line break classes, as in tables/gen_ucd.py, after the resolution of LB1. The flags are on top of them.
+#define LINE_AL                         0
+#define LINE_BK                         1
+#define LINE_CR                         2
+#define LINE_LF                         3
+#define LINE_NL                         4
+#define LINE_SP                         5
+#define LINE_ZW                         6
+#define LINE_ZWJ                        7
+#define LINE_CM                         8
+#define LINE_WJ                         9
+#define LINE_GL                         10
+#define LINE_BA                         11
+#define LINE_HY                         12
+#define LINE_BB                         13
+#define LINE_B2                         14
+#define LINE_CB                         15
+#define LINE_CL                         16
+#define LINE_CP                         17
+#define LINE_EX                         18
+#define LINE_IS                         19
+#define LINE_SY                         20
+#define LINE_OP                         21
+#define LINE_QU                         22
+#define LINE_NS                         23
+#define LINE_IN                         24
+#define LINE_HL                         25
+#define LINE_NU                         26
+#define LINE_PR                         27
+#define LINE_PO                         28
+#define LINE_ID                         29
+#define LINE_EB                         30
+#define LINE_EM                         31
+#define LINE_JL                         32
+#define LINE_JV                         33
+#define LINE_JT                         34
+#define LINE_H2                         35
+#define LINE_H3                         36
+#define LINE_RI                         37
+
+// OP and CP which are East Asian wide, and unassigned Extended_Pictographic codepoints.
+#define LINE_WIDE                       0x40
+#define LINE_RESERVED_PICTOGRAPHIC      0x80
+#define LINE_FLAGS                      (LINE_WIDE | LINE_RESERVED_PICTOGRAPHIC)
+
+// Class of nothing, before the start of the text or past its end.
+#define LINE_NONE                       0x3F
+
+// Where a number is in the tailoring of LB25 from example 7 of UAX #14: NU (NU | SY | IS)* (CL | CP)?
+#define LINE_NUMBER_NONE                0
+#define LINE_NUMBER_DIGITS              1
+#define LINE_NUMBER_CLOSED              2
+
+#define LINE_BREAK_PROHIBITED           0
+#define LINE_BREAK_ALLOWED              1
+#define LINE_BREAK_MANDATORY            2
+
+// What's known about the text before a possible line break.
+typedef struct {
+    uint8_t raw_last;       // Class of the last codepoint
+    uint8_t last;           // Class of the last codepoint that isn't a combining mark attached to another
+    uint8_t last_flags;     // Its flags
+    uint8_t before_last;    // Class of the one before that
+    uint8_t before_spaces;  // Class of the last one which isn't a space
+    uint8_t number;         // Where the last one is in a number
+    bool odd_regional;      // Whether the text ends with an odd number of regional indicators
+} __line_state_t;
+
+static inline bool __line_hard_break(uint8_t line_class)
+{
+    return (line_class == LINE_BK || line_class == LINE_CR || line_class == LINE_LF || line_class == LINE_NL);
+}
+
+// Combining marks and ZWJ attach to a codepoint of this class (LB9).
+static inline bool __line_attaches(uint8_t line_class)
+{
+    return !(line_class == LINE_NONE || __line_hard_break(line_class) || line_class == LINE_SP || line_class == LINE_ZW);
+}
+
+static inline bool __line_letter(uint8_t line_class)
+{
+    return (line_class == LINE_AL || line_class == LINE_HL);
+}
+
+static inline bool __line_prefix_or_postfix(uint8_t line_class)
+{
+    return (line_class == LINE_PR || line_class == LINE_PO);
+}
+
+static inline bool __line_hangul(uint8_t line_class)
+{
+    return (line_class == LINE_JL || line_class == LINE_JV || line_class == LINE_JT || line_class == LINE_H2 ||
+            line_class == LINE_H3);
+}
+
+// Add a codepoint of class `next` to the state.
+static inline void __line_add(__line_state_t *state, uint8_t next)
+{
+    uint8_t flags = next & LINE_FLAGS;
+
+    next &= ~LINE_FLAGS;
+    state->raw_last = next;
+
+    // Combining marks are part of whatever they're attached to, or alphabetic on their own (LB10).
+    if (next == LINE_CM || next == LINE_ZWJ)
+    {
+        if (__line_attaches(state->last))
+            return;
+
+        next = LINE_AL;
+        flags = 0;
+    }
+
+    if (next == LINE_NU)
+        state->number = LINE_NUMBER_DIGITS;
+    else if (next == LINE_SY || next == LINE_IS)
+        state->number = ((state->number == LINE_NUMBER_DIGITS) ? LINE_NUMBER_DIGITS : LINE_NUMBER_NONE);
+    else if (next == LINE_CL || next == LINE_CP)
+        state->number = ((state->number == LINE_NUMBER_DIGITS) ? LINE_NUMBER_CLOSED : LINE_NUMBER_NONE);
+    else
+        state->number = LINE_NUMBER_NONE;
+
+    state->odd_regional = (next == LINE_RI && !state->odd_regional);
+    state->before_last = state->last;
+    state->last = next;
+    state->last_flags = flags;
+
+    if (next != LINE_SP)
+        state->before_spaces = next;
+}
+
+// Check whether deciding on a break before a codepoint of class `next` needs the class of the codepoint
+//   after it which isn't a combining mark.
+static inline bool __line_needs_lookahead(__line_state_t *state, uint8_t next)
+{
+    next &= ~LINE_FLAGS;
+
+    return (__line_prefix_or_postfix(state->last) && (next == LINE_OP || next == LINE_HY));
+}
+
+// Check whether a line can be broken before a codepoint of class `next`, followed by one of class
+//   `after_next` which isn't a combining mark, following the rules of UAX #14.
+static inline int __line_break(__line_state_t *state, uint8_t next, uint8_t after_next)
+{
+    uint8_t last = state->last;
+    uint8_t before_spaces = state->before_spaces;
+    uint8_t flags = next & LINE_FLAGS;
+
+    next &= ~LINE_FLAGS;
+
+    if (last == LINE_BK || (last == LINE_CR && next != LINE_LF) || last == LINE_LF || last == LINE_NL)
+        return LINE_BREAK_MANDATORY;                                                                    // LB4, LB5
+
+    if (__line_hard_break(next) || next == LINE_SP || next == LINE_ZW)                                  // LB6, LB7
+        return LINE_BREAK_PROHIBITED;
+
+    if (before_spaces == LINE_ZW)                                                                       // LB8
+        return LINE_BREAK_ALLOWED;
+
+    if (state->raw_last == LINE_ZWJ)                                                                    // LB8a
+        return LINE_BREAK_PROHIBITED;
+
+    if (next == LINE_CM || next == LINE_ZWJ)
+    {
+        if (__line_attaches(last))                                                                      // LB9
+            return LINE_BREAK_PROHIBITED;
+
+        next = LINE_AL;                                                                                 // LB10
+        flags = 0;
+    }
+
+    if (last == LINE_WJ || next == LINE_WJ || last == LINE_GL ||                                        // LB11, LB12
+        (next == LINE_GL && last != LINE_SP && last != LINE_BA && last != LINE_HY) ||                   // LB12a
+        next == LINE_CL || next == LINE_CP || next == LINE_EX || next == LINE_IS || next == LINE_SY)    // LB13
+        return LINE_BREAK_PROHIBITED;
+
+    if (before_spaces == LINE_OP ||                                                                     // LB14
+        (before_spaces == LINE_QU && next == LINE_OP) ||                                                // LB15
+        ((before_spaces == LINE_CL || before_spaces == LINE_CP) && next == LINE_NS) ||                  // LB16
+        (before_spaces == LINE_B2 && next == LINE_B2))                                                  // LB17
+        return LINE_BREAK_PROHIBITED;
+
+    if (last == LINE_SP)                                                                                // LB18
+        return LINE_BREAK_ALLOWED;
+
+    if (last == LINE_QU || next == LINE_QU)                                                             // LB19
+        return LINE_BREAK_PROHIBITED;
+
+    if (last == LINE_CB || next == LINE_CB)                                                             // LB20
+        return LINE_BREAK_ALLOWED;
+
+    if (next == LINE_BA || next == LINE_HY || next == LINE_NS || last == LINE_BB ||                     // LB21
+        (state->before_last == LINE_HL && (last == LINE_HY || last == LINE_BA)) ||                      // LB21a
+        (last == LINE_SY && next == LINE_HL) ||                                                         // LB21b
+        next == LINE_IN)                                                                                // LB22
+        return LINE_BREAK_PROHIBITED;
+
+    if ((__line_letter(last) && next == LINE_NU) || (last == LINE_NU && __line_letter(next)) ||         // LB23
+        (last == LINE_PR && (next == LINE_ID || next == LINE_EB || next == LINE_EM)) ||                 // LB23a
+        ((last == LINE_ID || last == LINE_EB || last == LINE_EM) && next == LINE_PO) ||
+        (__line_prefix_or_postfix(last) && __line_letter(next)) ||                                      // LB24
+        (__line_letter(last) && __line_prefix_or_postfix(next)))
+        return LINE_BREAK_PROHIBITED;
+
+    // LB25, as tailored in example 7 of UAX #14 (which the Unicode test data follows).
+    if ((__line_prefix_or_postfix(last) && next == LINE_NU) ||
+        (__line_prefix_or_postfix(last) && (next == LINE_OP || next == LINE_HY) && after_next == LINE_NU) ||
+        ((last == LINE_OP || last == LINE_HY) && next == LINE_NU) ||
+        (state->number == LINE_NUMBER_DIGITS && (next == LINE_NU || next == LINE_SY || next == LINE_IS ||
+                                                 next == LINE_CL || next == LINE_CP)) ||
+        (state->number != LINE_NUMBER_NONE && __line_prefix_or_postfix(next)))
+        return LINE_BREAK_PROHIBITED;
+
+    if ((last == LINE_JL && (next == LINE_JL || next == LINE_JV || next == LINE_H2 || next == LINE_H3)) ||  // LB26
+        ((last == LINE_JV || last == LINE_H2) && (next == LINE_JV || next == LINE_JT)) ||
+        ((last == LINE_JT || last == LINE_H3) && next == LINE_JT) ||
+        (__line_hangul(last) && next == LINE_PO) || (last == LINE_PR && __line_hangul(next)))           // LB27
+        return LINE_BREAK_PROHIBITED;
+
+    if ((__line_letter(last) && __line_letter(next)) ||                                                 // LB28
+        (last == LINE_IS && __line_letter(next)) ||                                                     // LB29
+        ((__line_letter(last) || last == LINE_NU) && next == LINE_OP && !(flags & LINE_WIDE)) ||        // LB30
+        (last == LINE_CP && !(state->last_flags & LINE_WIDE) && (__line_letter(next) || next == LINE_NU)))
+        return LINE_BREAK_PROHIBITED;
+
+    if ((last == LINE_RI && next == LINE_RI && state->odd_regional) ||                                  // LB30a
+        (last == LINE_EB && next == LINE_EM) ||                                                         // LB30b
+        ((state->last_flags & LINE_RESERVED_PICTOGRAPHIC) && next == LINE_EM))
+        return LINE_BREAK_PROHIBITED;
+
+    return LINE_BREAK_ALLOWED;                                                                          // LB31
+}
+
+// Get the line break class of the codepoint at the start of UTF-X, storing its length in `consumed`.
+// Each char of an invalid sequence is alphabetic on its own, like unassigned codepoints (LB1).
+static inline uint8_t __utf8_line_class(utf8_char_t *src, size_t src_size, size_t *consumed)
+{
+    if (src[0] < UTF8_ONE_CHAR_LIMIT)
+    {
+        (*consumed) = 1;
+        return __ucd_lookup(UCD_LINE, src[0]);
+    }
+
+    if (__utf8_sequence_check(src, src_size, consumed))
+    {
+        (*consumed) = 1;
+        return LINE_AL;
+    }
+
+    return __ucd_lookup(UCD_LINE, __utf8_decode(src, (*consumed)));
+}
+
+static inline uint8_t __utf16_line_class(utf16_char_t *src, size_t src_size, size_t *consumed, bool swap)
+{
+    if (__utf16_sequence_check(src, src_size, consumed, swap))
+    {
+        (*consumed) = 1;
+        return LINE_AL;
+    }
+
+    return __ucd_lookup(UCD_LINE, __codepoint_from_utf16(src, (*consumed), NULL, swap));
+}
+
+#define LINE_CLASS_8(s, n, c)           (__utf8_line_class((s), (n), (c)))
+#define LINE_CLASS_16(s, n, c)          (__utf16_line_class((s), (n), (c), swap))
+#define LINE_ASCII_CLASS_8(c)           (__ucd_lookup(UCD_LINE, (c)))
+#define LINE_ASCII_CLASS_16(c)          (__ucd_lookup(UCD_LINE, __utf16_swap((c), swap)))
+#define LINE_ALNUM_PREFIX_8(s, n)       (__utf8_alnum_prefix((s), (n)))
+#define LINE_ALNUM_PREFIX_16(s, n)      (__utf16_alnum_prefix((s), (n), swap))
+#define LINE_SPACE_PREFIX_8(s, n)       (__utf8_space_prefix((s), (n)))
+#define LINE_SPACE_PREFIX_16(s, n)      (__utf16_space_prefix((s), (n), swap))
+
+// Get the class of the first codepoint of UTF-X which isn't a combining mark, or LINE_NONE if there's none.
+#define LINE_LOOKAHEAD_UTFX(X)                                                                              \
+    do {                                                                                                    \
+        for (size_t i = 0, consumed; i < src_size; i += consumed)                                           \
+        {                                                                                                   \
+            uint8_t line_class = LINE_CLASS_ ## X(src + i, src_size - i, &consumed) & ~LINE_FLAGS;          \
+                                                                                                            \
+            if (line_class != LINE_CM && line_class != LINE_ZWJ)                                            \
+                return line_class;                                                                          \
+        }                                                                                                   \
+                                                                                                            \
+        return LINE_NONE;                                                                                   \
+    } while (0)
+
+static inline uint8_t __utf8_line_lookahead(utf8_char_t *src, size_t src_size, bool)
+{ LINE_LOOKAHEAD_UTFX(8); }
+
+static inline uint8_t __utf16_line_lookahead(utf16_char_t *src, size_t src_size, bool swap)
+{ LINE_LOOKAHEAD_UTFX(16); }
+
+// Get the length of the prefix of ASCII letters and digits of UTF-16, 4 chars at a time.
+static inline size_t __utf16_alnum_prefix(utf16_char_t *src, size_t src_size, bool swap)
+{
+    // Bits that must be clear in each of the 4 chars of a word, and the high bits of their zero bytes,
+    //   before swapping.
+    uint64_t mask = ((swap) ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL);
+    uint64_t zeros = ((swap) ? 0x0080008000800080ULL : 0x8000800080008000ULL);
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word & mask)
+            break;
+
+        // The zero bytes are never in range, so they're counted separately.
+        uint64_t alnum = __ascii_word_range(word, '0', '9') | __ascii_word_range(word | (0x20 * WORD_LOW_BITS), 'a', 'z');
+
+        if ((alnum | zeros) != WORD_HIGH_BITS)
+            break;
+    }
+
+    for ( ; i < src_size; i++)
+    {
+        utf16_char_t c = __utf16_swap(src[i], swap);
+
+        if (!(('0' <= c && c <= '9') || ('a' <= (c | 0x20) && (c | 0x20) <= 'z')))
+            break;
+    }
+
+    return i;
+}
+
+// Get the length of the prefix of spaces of UTF-16, 4 chars at a time.
+static inline size_t __utf16_space_prefix(utf16_char_t *src, size_t src_size, bool swap)
+{
+    uint64_t spaces = __utf16_swap((utf16_char_t)' ', swap) * 0x0001000100010001ULL;
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if (word != spaces)
+            break;
+    }
+
+    while (i < src_size && __utf16_swap(src[i], swap) == ' ')
+        i++;
+
+    return i;
+}
+
+#define LINE_BREAKS_UTFX(X)                                                                                 \
+    do {                                                                                                    \
+        __line_state_t state = { LINE_NONE, LINE_NONE, 0, LINE_NONE, LINE_NONE, LINE_NUMBER_NONE, false };  \
+        size_t count = 0;                                                                                   \
+        size_t i = 0;                                                                                       \
+                                                                                                            \
+        memset(breaks, 0, src_size / 8 + 1);                                                                \
+                                                                                                            \
+        if (mandatory)                                                                                      \
+            memset(mandatory, 0, src_size / 8 + 1);                                                         \
+                                                                                                            \
+        while (i < src_size)                                                                                \
+        {                                                                                                   \
+            /* Nothing breaks between ASCII letters and digits after a letter or number (LB23, LB25, */     \
+            /*   LB28), or between spaces (LB7). */                                                         \
+            if (__line_letter(state.last) || state.last == LINE_NU)                                         \
+            {                                                                                               \
+                size_t run = LINE_ALNUM_PREFIX_ ## X(src + i, src_size - i);                                \
+                                                                                                            \
+                if (run)                                                                                    \
+                {                                                                                           \
+                    i += run;                                                                               \
+                    state.before_last = ((run > 1) ? LINE_ASCII_CLASS_ ## X(src[i - 2]) : state.last);      \
+                    state.last = LINE_ASCII_CLASS_ ## X(src[i - 1]);                                        \
+                    state.raw_last = state.before_spaces = state.last;                                      \
+                    state.last_flags = 0;                                                                   \
+                    state.number = ((state.last == LINE_NU) ? LINE_NUMBER_DIGITS : LINE_NUMBER_NONE);       \
+                    state.odd_regional = false;                                                             \
+                                                                                                            \
+                    continue;                                                                               \
+                }                                                                                           \
+            }                                                                                               \
+            else if (state.raw_last == LINE_SP)                                                             \
+            {                                                                                               \
+                size_t run = LINE_SPACE_PREFIX_ ## X(src + i, src_size - i);                                \
+                                                                                                            \
+                if (run)                                                                                    \
+                {                                                                                           \
+                    i += run;                                                                               \
+                    continue;                                                                               \
+                }                                                                                           \
+            }                                                                                               \
+                                                                                                            \
+            size_t consumed;                                                                                \
+            uint8_t next = LINE_CLASS_ ## X(src + i, src_size - i, &consumed);                              \
+                                                                                                            \
+            if (i)                                                                                          \
+            {                                                                                               \
+                uint8_t after_next = LINE_NONE;                                                             \
+                                                                                                            \
+                if (__line_needs_lookahead(&state, next))                                                   \
+                {                                                                                           \
+                    size_t after = i + consumed;                                                            \
+                                                                                                            \
+                    after_next = __utf ## X ## _line_lookahead(src + after, src_size - after, swap);        \
+                }                                                                                           \
+                                                                                                            \
+                int result = __line_break(&state, next, after_next);                                        \
+                                                                                                            \
+                if (result != LINE_BREAK_PROHIBITED)                                                        \
+                {                                                                                           \
+                    breaks[i / 8] |= (1 << (i % 8));                                                        \
+                    count++;                                                                                \
+                                                                                                            \
+                    if (mandatory && result == LINE_BREAK_MANDATORY)                                        \
+                        mandatory[i / 8] |= (1 << (i % 8));                                                 \
+                }                                                                                           \
+            }                                                                                               \
+                                                                                                            \
+            __line_add(&state, next);                                                                       \
+            i += consumed;                                                                                  \
+        }                                                                                                   \
+                                                                                                            \
+        /* Lines always end at the end of the text (LB3). */                                                \
+        if (src_size)                                                                                       \
+        {                                                                                                   \
+            breaks[src_size / 8] |= (1 << (src_size % 8));                                                  \
+            count++;                                                                                        \
+                                                                                                            \
+            if (mandatory)                                                                                  \
+                mandatory[src_size / 8] |= (1 << (src_size % 8));                                           \
+        }                                                                                                   \
+                                                                                                            \
+        return count;                                                                                       \
+    } while (0)
+
+size_t utf8_line_breaks(uint8_t *breaks, uint8_t *mandatory, utf8_char_t *src, size_t src_size, bool swap)
+{ LINE_BREAKS_UTFX(8); }
+
+size_t utf16_line_breaks(uint8_t *breaks, uint8_t *mandatory, utf16_char_t *src, size_t src_size, bool swap)
+{ LINE_BREAKS_UTFX(16); }
+
+#undef LINE_BREAKS_UTFX
+#undef LINE_LOOKAHEAD_UTFX
+#undef LINE_SPACE_PREFIX_16
+#undef LINE_SPACE_PREFIX_8
+#undef LINE_ALNUM_PREFIX_16
+#undef LINE_ALNUM_PREFIX_8
+#undef LINE_ASCII_CLASS_16
+#undef LINE_ASCII_CLASS_8
+#undef LINE_CLASS_16
+#undef LINE_CLASS_8
+
+/* ******************************* */
+/* -*- display width functions -*- */
+/* ******************************* */
+
+// Get the display width of the codepoint at the start of UTF-X, storing its length in `consumed`.
+// Each char of an invalid sequence takes a column on its own, like the replacement char it'd be shown as.
+static inline uint8_t __utf8_display_width(utf8_char_t *src, size_t src_size, size_t *consumed)
+{
+    if (src[0] < UTF8_ONE_CHAR_LIMIT)
+    {
+        (*consumed) = 1;
+        return __ucd_lookup(UCD_WIDTH, src[0]);
+    }
+
+    if (__utf8_sequence_check(src, src_size, consumed))
+    {
+        (*consumed) = 1;
+        return 1;
+    }
+
+    return __ucd_lookup(UCD_WIDTH, __utf8_decode(src, (*consumed)));
+}
+
+static inline uint8_t __utf16_display_width(utf16_char_t *src, size_t src_size, size_t *consumed, bool swap)
+{
+    if (__utf16_sequence_check(src, src_size, consumed, swap))
+    {
+        (*consumed) = 1;
+        return 1;
+    }
+
+    return __ucd_lookup(UCD_WIDTH, __codepoint_from_utf16(src, (*consumed), NULL, swap));
+}
+
+// Get the length of the prefix of printable ASCII of UTF-X, which takes a column a char, a word at a time.
+static inline size_t __utf8_printable_prefix(utf8_char_t *src, size_t src_size, bool)
+{
+    size_t i = 0;
+
+    for ( ; i + sizeof(uint64_t) <= src_size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if ((word & WORD_HIGH_BITS) || __ascii_word_range(word, ' ', '~') != WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && ' ' <= src[i] && src[i] <= '~')
+        i++;
+
+    return i;
+}
+
+static inline size_t __utf16_printable_prefix(utf16_char_t *src, size_t src_size, bool swap)
+{
+    // Bits that must be clear in each of the 4 chars of a word, and the high bits of their zero bytes,
+    //   before swapping.
+    uint64_t mask = ((swap) ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL);
+    uint64_t zeros = ((swap) ? 0x0080008000800080ULL : 0x8000800080008000ULL);
+    size_t i = 0;
+
+    for ( ; i + 4 <= src_size; i += 4)
+    {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+
+        if ((word & mask) || (__ascii_word_range(word, ' ', '~') | zeros) != WORD_HIGH_BITS)
+            break;
+    }
+
+    while (i < src_size && ' ' <= __utf16_swap(src[i], swap) && __utf16_swap(src[i], swap) <= '~')
+        i++;
+
+    return i;
+}
+
+#define DISPLAY_WIDTH_8(s, n, c)        (__utf8_display_width((s), (n), (c)))
+#define DISPLAY_WIDTH_16(s, n, c)       (__utf16_display_width((s), (n), (c), swap))
+
+#define DISPLAY_WIDTH_UTFX(X)                                                                               \
+    do {                                                                                                    \
+        size_t width = 0;                                                                                   \
+        size_t i = 0;                                                                                       \
+                                                                                                            \
+        while (i < src_size)                                                                                \
+        {                                                                                                   \
+            size_t run = __utf ## X ## _printable_prefix(src + i, src_size - i, swap);                      \
+                                                                                                            \
+            i += run;                                                                                       \
+            width += run;                                                                                   \
+                                                                                                            \
+            if (i < src_size)                                                                               \
+            {                                                                                               \
+                size_t consumed;                                                                            \
+                                                                                                            \
+                width += DISPLAY_WIDTH_ ## X(src + i, src_size - i, &consumed);                             \
+                i += consumed;                                                                              \
+            }                                                                                               \
+        }                                                                                                   \
+                                                                                                            \
+        return width;                                                                                       \
+    } while (0)
+
+size_t utf8_display_width(utf8_char_t *src, size_t src_size, bool swap)
+{ DISPLAY_WIDTH_UTFX(8); }
+
+size_t utf16_display_width(utf16_char_t *src, size_t src_size, bool swap)
+{ DISPLAY_WIDTH_UTFX(16); }
+
+#define TRUNCATE_TO_WIDTH_UTFX(X)                                                                           \
+    do {                                                                                                    \
+        size_t total = 0;                                                                                   \
+        size_t i = 0;                                                                                       \
+                                                                                                            \
+        while (i < src_size)                                                                                \
+        {                                                                                                   \
+            size_t run = __utf ## X ## _printable_prefix(src + i, src_size - i, swap);                      \
+                                                                                                            \
+            if (run > max_width - total)                                                                    \
+                run = max_width - total;                                                                    \
+                                                                                                            \
+            i += run;                                                                                       \
+            total += run;                                                                                   \
+                                                                                                            \
+            if (i == src_size)                                                                              \
+                break;                                                                                      \
+                                                                                                            \
+            /* Zero width chars still fit when the width is used up, so Mn/Me marks stay with their base. */\
+            size_t consumed;                                                                                \
+            uint8_t char_width = DISPLAY_WIDTH_ ## X(src + i, src_size - i, &consumed);                     \
+                                                                                                            \
+            if (char_width > max_width - total)                                                             \
+                break;                                                                                      \
+                                                                                                            \
+            total += char_width;                                                                            \
+            i += consumed;                                                                                  \
+        }                                                                                                   \
+                                                                                                            \
+        if (width)                                                                                          \
+            (*width) = total;                                                                               \
+                                                                                                            \
+        return i;                                                                                           \
+    } while (0)
+
+size_t utf8_truncate_to_width(utf8_char_t *src, size_t src_size, size_t max_width, size_t *width, bool swap)
+{ TRUNCATE_TO_WIDTH_UTFX(8); }
+
+size_t utf16_truncate_to_width(utf16_char_t *src, size_t src_size, size_t max_width, size_t *width, bool swap)
+{ TRUNCATE_TO_WIDTH_UTFX(16); }
+
+#undef TRUNCATE_TO_WIDTH_UTFX
+#undef DISPLAY_WIDTH_UTFX
+#undef DISPLAY_WIDTH_16
+#undef DISPLAY_WIDTH_8
@@ -61,6 +61,33 @@ extern size_t enc_utf16_to_utf32(utf32_char_t *dest, size_t *dest_size, utf16_ch
 extern size_t enc_utf32_to_utf16(utf16_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap);
 extern size_t enc_utf32_to_utf8(utf8_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap);
 
+// These are the same as the above, but are driven only by the length of the src buffer.
+// A '0' codepoint does not end the conversion, so strings containing U+0000 may be converted in one call.
+// A codepoint is never split over the end of the dest buffer. Conversion stops before it instead.
+extern size_t enc_utf8_to_utf16_bin(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf8_to_utf32_bin(utf32_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf16_to_utf8_bin(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf16_to_utf32_bin(utf32_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf32_to_utf16_bin(utf16_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf32_to_utf8_bin(utf8_char_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, bool swap);
+
+// Length-driven translation of UTF8 to UTFX which strictly checks every sequence.
+// Each malformed sequence (or each maximal run of malformed sequences if `collapse` is set) is
+//   replaced by the `replacement` codepoint, and conversion continues with the next valid sequence.
+// A `replacement` which is a surrogate or past U+10FFFF is taken to be U+FFFD, so the output is always valid.
+// Codepoints are never split over the end of the dest buffer.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_utf8_repl(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap);
+extern size_t enc_utf8_to_utf16_repl(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap);
+extern size_t enc_utf8_to_utf32_repl(utf32_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unipoint_t replacement, bool collapse, bool swap);
+
+// Length-driven translation of UTF8 to UTF16 for input which is expected to be valid.
+// Blocks of the src buffer are converted assuming they are valid, and only checked once converted.
+// A block with an error is converted again carefully, stopping right before the first malformed sequence.
+// Store the utf8_validate style result for the converted chars in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_utf16_optimistic(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
 /* ******************************* */
 /* -*- buffer sizing functions -*- */
 /* ******************************* */
@@ -106,6 +133,43 @@ extern int utf16_validate(utf16_char_t *str, bool swap);
 // Return is non-zero for malformed strings, 0 for valid strings.
 extern int utf32_validate(utf32_char_t *str, bool swap);
 
+// Validation profiles. Each flag rejects an additional class of otherwise valid codepoints.
+#define UNICODE_PROFILE_NONCHARACTERS   (1 << 0)    // U+FDD0-U+FDEF and the last two codepoints of every plane
+#define UNICODE_PROFILE_CONTROLS        (1 << 1)    // C0 controls other than tab, LF and CR, DEL, and C1 controls
+#define UNICODE_PROFILE_PRIVATE_USE     (1 << 2)    // U+E000-U+F8FF and planes 15 and 16
+#define UNICODE_PROFILE_BIDI            (1 << 3)    // Bidi embeddings and overrides (U+202A-U+202E) and isolates (U+2066-U+2069)
+#define UNICODE_PROFILE_XML10           (1 << 4)    // Anything which isn't an XML 1.0 Char
+#define UNICODE_PROFILE_INVISIBLE       (1 << 5)    // Zero width chars (U+200B-U+200D, U+2060-U+2064 and U+FEFF) and bidi marks (U+061C, U+200E and U+200F)
+
+// These are the same as the above, but also reject any codepoint in one of the classes
+//   selected by the `profile` flags, in the same pass over the string.
+// The above functions are the same as these with a profile of 0.
+// Return is non-zero for malformed or rejected strings, 0 for valid strings.
+extern int utf8_validate_profile(utf8_char_t *str, unsigned profile, bool swap);
+extern int utf16_validate_profile(utf16_char_t *str, unsigned profile, bool swap);
+extern int utf32_validate_profile(utf32_char_t *str, unsigned profile, bool swap);
+
+// The non-zero results of the validation functions are as follows:
+//   1: A UTF-16 high surrogate is not followed by a low surrogate
+//   2: A surrogate codepoint is encoded
+//   3: A codepoint past the end of unicode is encoded
+//   4: A UTF-8 sequence is missing trailing chars
+//   6: A UTF-8 sequence has a bad leading char or is overlong
+//   7: A codepoint is rejected by the validation profile
+//   8: A char or codepoint has no mapping in a single byte codepage or CJK encoding
+//   9: An escape sequence or punycode is malformed, or a char which must be escaped isn't
+//  10: A char is followed by too many combining marks to normalize
+
+// Copy UTFX to UTFX without the codepoints rejected by the validation `profile`, storing the # of
+//   consumed chars in dest_size. Byte swap if requested. With UNICODE_PROFILE_BIDI and
+//   UNICODE_PROFILE_INVISIBLE this removes the chars which can make text read differently than it runs.
+// The result is never longer than src. ASCII is copied a word at a time when the profile allows all of it.
+// This is length-driven, and conversion stops right before the first invalid sequence, storing its
+//   utf8_validate style result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t utf8_strip_profile(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, unsigned profile, int *status, bool swap);
+extern size_t utf16_strip_profile(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, unsigned profile, int *status, bool swap);
+
 /* ******************************* */
 /* -*- string length functions -*- */
 /* ******************************* */
@@ -115,4 +179,537 @@ extern size_t strlen_utf8(utf8_char_t *str);
 extern size_t strlen_utf16(utf16_char_t *str);
 extern size_t strlen_utf32(utf32_char_t *str);
 
+/* ************************************ */
+/* -*- fused validate/copy functions -*- */
+/* ************************************ */
+
+// Copy src_size chars from src to dest like memcpy, validating the UTF-8 in the same pass.
+// The buffers must not overlap, and may contain NULL chars. The whole buffer is always copied.
+// Return is the utf8_validate style result for src, 0 for valid buffers.
+extern int utf8_validate_copy(utf8_char_t *dest, utf8_char_t *src, size_t src_size);
+
+// The same as utf8_validate_copy, but using non-temporal stores where the CPU has them.
+// This avoids filling the cache with the destination of large copies which won't be read again soon.
+extern int utf8_validate_copy_stream(utf8_char_t *dest, utf8_char_t *src, size_t src_size);
+
+/* ********************************* */
+/* -*- line validation functions -*- */
+/* ********************************* */
+
+// An invalid line found by utf8_validate_lines.
+typedef struct {
+    size_t line;            // Index of the line in the buffer, starting from 0
+    size_t offset;          // Offset of the first char of the line
+    size_t length;          // Number of chars in the line, not counting the newline
+    int status;             // utf8_validate style result for the line
+} utf8_line_error_t;
+
+// Validate the src_size chars of src one '\n' terminated line at a time, splitting the work at
+//   line boundaries between up to `thread_count` threads (including the calling thread).
+// The buffer may contain NULL chars.
+// Store a malloc'd array of the invalid lines in order in `errors`, and their number in `error_count`.
+// Return false if memory could not be allocated.
+extern bool utf8_validate_lines(utf8_char_t *src, size_t src_size, unsigned thread_count, utf8_line_error_t **errors, size_t *error_count);
+
+// Copy the valid lines of src to `clean` and the invalid lines found by utf8_validate_lines to `quarantine`.
+// The sizes give the capacity of each buffer and are set to the number of chars used. Lines are never split,
+//   and whole lines are copied until one of the buffers is full.
+// Return the number of chars of the src buffer that were partitioned.
+extern size_t utf8_partition_lines(utf8_char_t *clean, size_t *clean_size, utf8_char_t *quarantine, size_t *quarantine_size,
+                                   utf8_char_t *src, size_t src_size, utf8_line_error_t *errors, size_t error_count);
+
+/* **************************************** */
+/* -*- incremental validation functions -*- */
+/* **************************************** */
+
+// These functions keep per-block validity summaries for a large UTF-8 buffer so that it can be
+//   revalidated after an edit by only checking the blocks around the edit.
+// Unlike most functions in this file, the buffers here are length driven and may contain NULL chars.
+
+// Summary of a single block of an indexed UTF-8 buffer.
+typedef struct {
+    size_t length;          // Number of UTF-8 chars in this block
+    size_t codepoints;      // Number of codepoints in this block. Invalid sequences count as one each.
+    size_t utf16_length;    // Number of UTF-16 chars needed to encode this block
+    int status;             // utf8_validate style result for this block
+} utf8_block_t;
+
+// Per-block summaries of a UTF-8 buffer, along with totals for the whole buffer.
+// The blocks are kept in a gap buffer: the first `gap` blocks start the array and the rest end it,
+//   with the free space in between. Edits move the gap to themselves, so nearby edits move few blocks.
+typedef struct {
+    utf8_block_t *blocks;
+    size_t block_count;
+    size_t block_capacity;
+    size_t gap;             // Number of blocks before the gap
+    size_t gap_offset;      // Number of UTF-8 chars in the blocks before the gap
+
+    size_t length;          // Total number of UTF-8 chars
+    size_t codepoints;      // Total number of codepoints
+    size_t utf16_length;    // Total number of UTF-16 chars needed to encode the buffer
+    size_t invalid_blocks;  // Number of blocks containing malformed sequences
+} utf8_index_t;
+
+// Build an index over the str_size chars of str. Return false if memory could not be allocated.
+extern bool utf8_index_build(utf8_index_t *index, utf8_char_t *str, size_t str_size);
+
+// Update an index after an edit. `str` is the edited buffer, in which the `removed` chars at
+//   `edit_offset` of the previously indexed buffer have been replaced with `inserted` chars.
+// Only the blocks touching the edit are revalidated, and only the blocks between this edit and the
+//   previous one are moved, so runs of nearby edits cost time proportional to their size.
+// Return false if memory could not be allocated, in which case the index should be rebuilt.
+extern bool utf8_index_update(utf8_index_t *index, utf8_char_t *str, size_t str_size, size_t edit_offset, size_t removed, size_t inserted);
+
+// Return the utf8_validate style result for the indexed buffer. 0 for valid buffers.
+// Valid buffers are answered from the totals. Otherwise blocks are checked up to the first invalid one.
+extern int utf8_index_validate(utf8_index_t *index);
+
+// Release the memory held by an index.
+extern void utf8_index_free(utf8_index_t *index);
+
+/* ************************************* */
+/* -*- C library multibyte functions -*- */
+/* ************************************* */
+
+// Locale independent replacements for the C library multibyte/wide char functions, which always
+//   take multibyte strings to be UTF-8. Invalid sequences and surrogates are strictly rejected.
+// These have the same signatures and semantics as their C library counterparts. Malformed input
+//   returns (size_t)-1 and sets errno to EILSEQ, and incomplete sequences return (size_t)-2.
+// They are only available where wchar_t holds UTF-32 (such as Linux).
+#if WCHAR_MAX >= 0x10FFFF
+
+// Conversion state for the restartable functions, like mbstate_t. A zeroed state is the initial state.
+typedef struct {
+    utf8_char_t pending[4]; // Leading chars of an incomplete sequence
+    uint8_t pending_count;  // Number of pending chars
+} uniconv_mbstate_t;
+
+// Return non-zero if `state` is NULL or in the initial state.
+extern int uniconv_mbsinit(uniconv_mbstate_t *state);
+
+// Restartable single char conversions, like mbrtowc/wcrtomb. A NULL state uses an internal one.
+// As in the C library, `n` is only an upper bound. No char past the one which completes (or breaks)
+//   a sequence is read, so passing MB_CUR_MAX near the end of a string is safe.
+extern size_t uniconv_mbrtowc(wchar_t *pwc, const char *s, size_t n, uniconv_mbstate_t *state);
+extern size_t uniconv_wcrtomb(char *s, wchar_t wc, uniconv_mbstate_t *state);
+
+// Restartable string conversions, like mbsrtowcs/wcsrtombs. `src` is updated as in the C library.
+extern size_t uniconv_mbsrtowcs(wchar_t *dest, const char **src, size_t len, uniconv_mbstate_t *state);
+extern size_t uniconv_wcsrtombs(char *dest, const wchar_t **src, size_t len, uniconv_mbstate_t *state);
+
+// String conversions, like mbstowcs/wcstombs.
+extern size_t uniconv_mbstowcs(wchar_t *dest, const char *src, size_t n);
+extern size_t uniconv_wcstombs(char *dest, const wchar_t *src, size_t n);
+
+#endif /* WCHAR_MAX >= 0x10FFFF */
+
+/* ************************************** */
+/* -*- single byte codepage functions -*- */
+/* ************************************** */
+
+// Conversions between UTF-8/16/32 and table driven single byte codepages. This includes ISO-8859-1
+//   through ISO-8859-16, Windows-1250 through Windows-1258, DOS, KOI8 and Mac codepages,
+//   and the EBCDIC codepages IBM037, IBM273, IBM500, IBM1026 and IBM1140.
+// The tables are generated by tables/gen_codepages.py, which lists every codepage and its names.
+
+// A single byte codepage.
+typedef struct uniconv_codepage uniconv_codepage_t;
+
+// Find a codepage by name (such as "Windows-1252", "latin9" or "IBM037"), ignoring case, '-' and '_'.
+// Return NULL for unknown codepages.
+extern const uniconv_codepage_t *uniconv_codepage(const char *name);
+
+// Get the canonical name of a codepage.
+extern const char *uniconv_codepage_name(const uniconv_codepage_t *codepage);
+
+// Translate a codepage to UTFX, or UTFX to a codepage, storing the # of consumed chars in dest_size.
+// The swap flag only applies to UTF-16 and UTF-32. These are length-driven.
+// Conversion stops right before the first byte or codepoint with no mapping, or malformed sequence,
+//   storing its utf8_validate style result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_codepage_to_utf8(utf8_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+extern size_t enc_codepage_to_utf16(utf16_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+extern size_t enc_codepage_to_utf32(utf32_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+
+extern size_t enc_utf8_to_codepage(uint8_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+extern size_t enc_utf16_to_codepage(uint8_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+extern size_t enc_utf32_to_codepage(uint8_t *dest, size_t *dest_size, utf32_char_t *src, size_t src_size, const uniconv_codepage_t *codepage, int *status, bool swap);
+
+/* ****************************** */
+/* -*- CJK decoding functions -*- */
+/* ****************************** */
+
+// Decoding of the legacy multibyte CJK encodings Shift_JIS, CP932 (Windows-31J), EUC-JP,
+//   GBK, GB18030 and Big5 to UTF-8/16/32. Two byte chars are looked up in two level tables
+//   generated by tables/gen_cjk.py, and GB18030's 4 char sequences are decoded algorithmically.
+// GBK is decoded with the two byte part of GB18030, which is a superset of it.
+
+// A CJK encoding.
+typedef struct uniconv_cjk uniconv_cjk_t;
+
+// Streaming state, for chars split between buffers. A zeroed state is the initial state.
+// If the state still has pending chars after the last buffer, the input was cut off partway through a char.
+typedef struct {
+    uint8_t pending[4];     // Leading chars of an incomplete char
+    uint8_t pending_count;  // Number of pending chars
+} uniconv_cjk_state_t;
+
+// Find an encoding by name (such as "Shift_JIS", "EUC-JP" or "GB18030"), ignoring case, '-' and '_'.
+// Return NULL for unknown encodings.
+extern const uniconv_cjk_t *uniconv_cjk(const char *name);
+
+// Get the canonical name of an encoding.
+extern const char *uniconv_cjk_name(const uniconv_cjk_t *encoding);
+
+// Translate a CJK encoding to UTFX, storing the # of consumed chars in dest_size. Byte swap if requested.
+// These are length-driven. When `state` is given, a char cut off by the end of the src buffer is kept
+//   in it (and counted as converted) to be finished by the next call. Without a state, it's an error.
+// Conversion stops right before the first malformed char or char with no mapping, storing its
+//   utf8_validate style result in `status`. 0 if no errors were found.
+// Codepoints are never split over the end of the dest buffer.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_cjk_to_utf8(utf8_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap);
+extern size_t enc_cjk_to_utf16(utf16_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap);
+extern size_t enc_cjk_to_utf32(utf32_char_t *dest, size_t *dest_size, uint8_t *src, size_t src_size, const uniconv_cjk_t *encoding, uniconv_cjk_state_t *state, int *status, bool swap);
+
+/* ********************************** */
+/* -*- iconv compatible functions -*- */
+/* ********************************** */
+
+// These work exactly like iconv_open, iconv and iconv_close, for UTF-8, UTF-16 and UTF-32 in either
+//   byte order (or with a BOM), ISO-8859-1, ASCII and the single byte codepages below.
+// Encoding names ignore case, '-' and '_'.
+// The iconv pointers and sizes are updated the same way, and errors are reported the same way:
+//   E2BIG when the output is full, EILSEQ for malformed or unencodable input and EINVAL for input
+//   ending partway through a sequence, as well as EINVAL from uniconv_iconv_open for unknown encodings.
+// UTF-16 and UTF-32 without a byte order are read in host order unless they start with a BOM,
+//   and are written in host order following a BOM, like glibc.
+// Building with UNICONV_ICONV_SHIM defined also exports these as iconv_open, iconv and iconv_close,
+//   passing unknown encodings on to the C library. See the build/libuniconv_iconv.so Makefile target.
+
+// Conversion descriptor, like iconv_t.
+typedef struct uniconv_iconv *uniconv_iconv_t;
+
+extern uniconv_iconv_t uniconv_iconv_open(const char *tocode, const char *fromcode);
+extern size_t uniconv_iconv(uniconv_iconv_t cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+extern int uniconv_iconv_close(uniconv_iconv_t cd);
+
+/* ****************************************************** */
+/* -*- Modified UTF-8 and CESU-8 conversion functions -*- */
+/* ****************************************************** */
+
+// CESU-8 encodes each UTF-16 char of a string separately, so supplementary codepoints take
+//   two 3 char sequences instead of one 4 char sequence.
+// Modified UTF-8 (Java's encoding, used by JNI) is CESU-8 with U+0000 encoded as C0 80,
+//   so encoded strings never contain NULL chars.
+// These are length-driven, and convert in a single pass. The swap flag only applies to UTF-16.
+// Conversion stops right before the first malformed sequence (including unpaired surrogates),
+//   storing its utf8_validate style result in `status`. 0 if no errors were found.
+// Codepoints are never split over the end of the dest buffer.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_mutf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_utf8_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_mutf8_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_cesu8_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+extern size_t enc_utf16_to_mutf8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_utf16_to_cesu8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_mutf8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_cesu8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+/* ********************************** */
+/* -*- WTF-8 conversion functions -*- */
+/* ********************************** */
+
+// WTF-8 is UTF-8 extended to encode unpaired surrogates (as 3 char sequences), so any UTF-16 string,
+//   well formed or not (such as Windows filenames or JavaScript strings), round trips through it losslessly.
+// Valid UTF-8 is always valid WTF-8. These are length-driven, and codepoints are never split over the
+//   end of the dest buffer.
+
+// Translate UTF16 to WTF8, storing the # of consumed chars in dest_size. Byte swap if requested.
+// This never fails. Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf16_to_wtf8(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap);
+
+// Translate WTF8 to UTF16, storing the # of consumed chars in dest_size. Byte swap if requested.
+// Conversion stops right before the first malformed sequence (including a surrogate pair encoded as
+//   two 3 char sequences), storing its utf8_validate style result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_wtf8_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+// Replace every unpaired surrogate in the str_size chars of str with U+FFFD, in place.
+// Return the number of surrogates replaced.
+extern size_t utf16_fix_lone_surrogates(utf16_char_t *str, size_t str_size, bool swap);
+
+/* ***************************** */
+/* -*- JSON string functions -*- */
+/* ***************************** */
+
+// Escaping and unescaping of JSON string contents (without the surrounding quotes), validating
+//   the UTF-8 in the same pass. These are length-driven, and neither codepoints nor escapes are
+//   ever split over the end of the dest buffer.
+
+// Escape UTF8 for a JSON string, storing the # of consumed chars in dest_size.
+// Quotes, backslashes and control chars are escaped, and everything else is copied as it is.
+// Conversion stops right before the first invalid sequence, storing its utf8_validate style result
+//   in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_json(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+// Unescape the contents of a JSON string to UTFX, storing the # of consumed chars in dest_size. Byte swap if requested.
+// \u escapes of supplementary codepoints must be surrogate pairs, and escaped lone surrogates are errors.
+// Conversion stops right before the first invalid sequence or escape, storing its utf8_validate style
+//   result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_json_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_json_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+/* ****************************** */
+/* -*- URL decoding functions -*- */
+/* ****************************** */
+
+// Percent decode a URL or URL component, storing the # of consumed chars in dest_size.
+// The decoded chars are strictly validated as UTF-8 in the same pass, so percent encoded overlong
+//   sequences (like "/%C0%AE./"), surrogates and codepoints past the end of unicode are all rejected,
+//   whether or not their chars are percent encoded. '+' is left as it is.
+// This is length-driven, and dest may be src for decoding in place. Codepoints are never split over
+//   the end of the dest buffer.
+// Conversion stops right before the first malformed percent encoding or invalid sequence, storing its
+//   utf8_validate style result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_url_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+/* *********************************** */
+/* -*- log-safe escaping functions -*- */
+/* *********************************** */
+
+// Escape untrusted UTF8/16 for writing to a UTF-8 log, storing the # of consumed chars in dest_size.
+// The output is always valid UTF-8 without any control chars, and can be unescaped back to the input:
+//   - Each char of an invalid UTF-8 sequence is written as \xNN.
+//   - Lone UTF-16 surrogates and C1 control chars are written as \uNNNN.
+//   - Newlines, carriage returns and tabs are written as \n, \r and \t, other C0 controls and DEL as \xNN.
+//   - Backslashes are doubled.
+// These are length-driven, and neither codepoints nor escapes are ever split over the end of the dest buffer.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_log(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool swap);
+extern size_t enc_utf16_to_log(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool swap);
+
+/* *********************************** */
+/* -*- Punycode and IDNA functions -*- */
+/* *********************************** */
+
+// Conversion of internationalized host names to and from their ASCII (punycode) form, label by label.
+// Labels are separated by '.' only, and are neither mapped nor normalized, so they should already be
+//   in the form wanted (usually lowercase NFC). Label lengths aren't limited.
+// These are length-driven, and labels are never split over the end of the dest buffer.
+
+// Translate a host name in UTFX to its ASCII form, storing the # of consumed chars in dest_size. Byte swap if requested.
+// Pure ASCII labels are copied as they are, and others are punycode encoded with an "xn--" prefix.
+// Conversion stops right before the label with the first invalid sequence, storing its utf8_validate style
+//   result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_utf8_to_idna(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_utf16_to_idna(utf8_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int *status, bool swap);
+
+// Translate a host name in its ASCII form to UTFX, storing the # of consumed chars in dest_size. Byte swap if requested.
+// Labels with an "xn--" prefix (in any case) are punycode decoded, and others are copied as they are.
+// Conversion stops right before the first label with malformed punycode (status 9) or an invalid
+//   sequence or decoded codepoint, storing its utf8_validate style result in `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t enc_idna_to_utf8(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+extern size_t enc_idna_to_utf16(utf16_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+/* ************************************ */
+/* -*- character property functions -*- */
+/* ************************************ */
+
+// Character properties from the Unicode Character Database, looked up in compact three stage tables
+//   generated by tables/gen_ucd.py.
+
+// General categories.
+#define UNICODE_CATEGORY_CN     0       // Unassigned (and anything past the end of unicode)
+#define UNICODE_CATEGORY_LU     1       // Uppercase letter
+#define UNICODE_CATEGORY_LL     2       // Lowercase letter
+#define UNICODE_CATEGORY_LT     3       // Titlecase letter
+#define UNICODE_CATEGORY_LM     4       // Modifier letter
+#define UNICODE_CATEGORY_LO     5       // Other letter
+#define UNICODE_CATEGORY_MN     6       // Nonspacing mark
+#define UNICODE_CATEGORY_MC     7       // Spacing mark
+#define UNICODE_CATEGORY_ME     8       // Enclosing mark
+#define UNICODE_CATEGORY_ND     9       // Decimal number
+#define UNICODE_CATEGORY_NL     10      // Letter number
+#define UNICODE_CATEGORY_NO     11      // Other number
+#define UNICODE_CATEGORY_PC     12      // Connector punctuation
+#define UNICODE_CATEGORY_PD     13      // Dash punctuation
+#define UNICODE_CATEGORY_PS     14      // Open punctuation
+#define UNICODE_CATEGORY_PE     15      // Close punctuation
+#define UNICODE_CATEGORY_PI     16      // Initial punctuation
+#define UNICODE_CATEGORY_PF     17      // Final punctuation
+#define UNICODE_CATEGORY_PO     18      // Other punctuation
+#define UNICODE_CATEGORY_SM     19      // Math symbol
+#define UNICODE_CATEGORY_SC     20      // Currency symbol
+#define UNICODE_CATEGORY_SK     21      // Modifier symbol
+#define UNICODE_CATEGORY_SO     22      // Other symbol
+#define UNICODE_CATEGORY_ZS     23      // Space separator
+#define UNICODE_CATEGORY_ZL     24      // Line separator
+#define UNICODE_CATEGORY_ZP     25      // Paragraph separator
+#define UNICODE_CATEGORY_CC     26      // Control
+#define UNICODE_CATEGORY_CF     27      // Format
+#define UNICODE_CATEGORY_CS     28      // Surrogate
+#define UNICODE_CATEGORY_CO     29      // Private use
+
+// Scripts with fixed codes. Other codes follow in alphabetical order of their names.
+#define UNICODE_SCRIPT_UNKNOWN      0
+#define UNICODE_SCRIPT_COMMON       1
+#define UNICODE_SCRIPT_INHERITED    2
+
+// Binary properties.
+#define UNICODE_PROPERTY_WHITE_SPACE            (1 << 0)
+#define UNICODE_PROPERTY_ALPHABETIC             (1 << 1)
+#define UNICODE_PROPERTY_LOWERCASE              (1 << 2)
+#define UNICODE_PROPERTY_UPPERCASE              (1 << 3)
+#define UNICODE_PROPERTY_IDEOGRAPHIC            (1 << 4)
+#define UNICODE_PROPERTY_EXTENDED_PICTOGRAPHIC  (1 << 5)
+#define UNICODE_PROPERTY_DEFAULT_IGNORABLE      (1 << 6)
+
+// Properties of a single codepoint.
+typedef struct {
+    uint8_t category;       // UNICODE_CATEGORY_* general category
+    uint8_t script;         // Script code
+    uint8_t properties;     // UNICODE_PROPERTY_* flags
+} unicode_properties_t;
+
+// Get the properties of a codepoint.
+extern unicode_properties_t unicode_properties(unipoint_t codepoint);
+
+// Get the name of a script (such as "Latin" or "Han"), or NULL for codes that aren't used.
+extern const char *unicode_script_name(uint8_t script);
+
+// Get the code of a script from its name, or -1 if there's no such script.
+extern int unicode_script_code(const char *name);
+
+// Look up the properties of each codepoint in UTF8, storing one entry per codepoint in dest and
+//   the # of entries used in dest_size. This is length-driven.
+// Conversion stops right before the first invalid sequence, storing its utf8_validate style result in
+//   `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were looked up.
+extern size_t utf8_properties(unicode_properties_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int *status, bool swap);
+
+/* ****************************** */
+/* -*- case folding functions -*- */
+/* ****************************** */
+
+// Case folding for caseless matching, with the mappings of the Unicode Character Database's CaseFolding.txt.
+// Simple folding maps every codepoint to a single codepoint. Full folding also maps some to two or
+//   three (like ß to "ss"), so the folded string can be longer. Turkic foldings aren't used.
+
+// Fold UTFX to UTFX, storing the # of consumed chars in dest_size. Byte swap if requested.
+// The folded string can take up to 3 times as many chars as the src buffer.
+// This is length-driven, and the folding of a codepoint is never split over the end of the dest buffer.
+// Conversion stops right before the first invalid sequence, storing its utf8_validate style result in
+//   `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t utf8_casefold(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool full, int *status, bool swap);
+extern size_t utf16_casefold(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, bool full, int *status, bool swap);
+
+// Compare two UTFX strings by the codepoints of their full case foldings, without allocating.
+// Each char of an invalid sequence sorts after every codepoint, by its value.
+// Return less than, equal to or greater than 0 like strcmp.
+extern int utf8_casecmp(utf8_char_t *a, size_t a_size, utf8_char_t *b, size_t b_size, bool swap);
+extern int utf16_casecmp(utf16_char_t *a, size_t a_size, utf16_char_t *b, size_t b_size, bool swap);
+
+/* ******************************* */
+/* -*- normalization functions -*- */
+/* ******************************* */
+
+// Normalization forms.
+#define UNICODE_NORMALIZATION_NFC   0
+#define UNICODE_NORMALIZATION_NFD   1
+
+// Get the length of the prefix of UTFX which is already in the normalization form `form`, using the
+//   quick check properties. Text below U+0300 (U+00C0 for NFD) is skipped a word at a time.
+// The whole string is normalized, and can be used as it is, if this is src_size.
+// Checking stops right before the first invalid sequence, storing its utf8_validate style result in
+//   `status`. 0 if no errors were found.
+extern size_t utf8_normalized_prefix(utf8_char_t *src, size_t src_size, int form, int *status, bool swap);
+extern size_t utf16_normalized_prefix(utf16_char_t *src, size_t src_size, int form, int *status, bool swap);
+
+// Normalize UTFX to NFC or NFD, storing the # of consumed chars in dest_size. Byte swap if requested.
+// The parts found normalized by the quick check are copied as they are, and only the rest is
+//   decomposed, reordered and composed. NFD can take up to 3 times as many chars as the src buffer.
+// This is length-driven, and a normalized sequence is never split over the end of the dest buffer.
+// Conversion stops right before the first invalid sequence, storing its utf8_validate style result in
+//   `status`. 0 if no errors were found.
+// Return the number of chars of the src buffer that were converted.
+extern size_t utf8_normalize(utf8_char_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, int form, int *status, bool swap);
+extern size_t utf16_normalize(utf16_char_t *dest, size_t *dest_size, utf16_char_t *src, size_t src_size, int form, int *status, bool swap);
+
+/* ********************************** */
+/* -*- grapheme cluster functions -*- */
+/* ********************************** */
+
+// Extended grapheme clusters (user-perceived characters) as defined by UAX #29. Each char of an invalid
+//   sequence is a cluster of its own.
+
+// Get the length of the grapheme cluster at the start of UTFX, in chars. 0 for an empty string.
+extern size_t utf8_grapheme_next(utf8_char_t *src, size_t src_size, bool swap);
+extern size_t utf16_grapheme_next(utf16_char_t *src, size_t src_size, bool swap);
+
+// Advance past up to `count` grapheme clusters of UTFX, storing the # of clusters advanced past in `count`.
+// Runs of ASCII without CR are skipped over in bulk. Use a count of SIZE_MAX to count every cluster.
+// Return the number of chars advanced past.
+extern size_t utf8_grapheme_advance(utf8_char_t *src, size_t src_size, size_t *count, bool swap);
+extern size_t utf16_grapheme_advance(utf16_char_t *src, size_t src_size, size_t *count, bool swap);
+
+/* *********************************** */
+/* -*- word segmentation functions -*- */
+/* *********************************** */
+
+// Span of a token, in chars from the start of the buffer it was found in.
+typedef struct {
+    size_t offset;
+    size_t length;
+} unicode_span_t;
+
+// Split UTF-8 into words at the word boundaries of UAX #29, storing the span of each word in dest and
+//   the # of spans used in dest_size. Segments without letters or numbers (like spaces and punctuation)
+//   are skipped. Each char of an invalid sequence is a separate segment which isn't a word.
+// Runs of ASCII letters, digits and spaces are skipped over a word at a time.
+// Unless `final` is set, the last segment of src isn't known to be finished, so it isn't stored. Call
+//   again with the rest of src and more text to continue.
+// Return the number of chars of the src buffer that were split, always at a boundary.
+extern size_t utf8_words(unicode_span_t *dest, size_t *dest_size, utf8_char_t *src, size_t src_size, bool final, bool swap);
+
+/* ******************************* */
+/* -*- line breaking functions -*- */
+/* ******************************* */
+
+// Find the line break opportunities of a paragraph of UTF-X, following the rules of UAX #14, and set
+//   bit (i % 8) of breaks[i / 8] when a line can be broken before src[i]. The bit of src_size is set
+//   for the end of the text, so breaks must hold src_size / 8 + 1 bytes.
+// If `mandatory` isn't NULL, it gets the breaks which must be taken (after hard line breaks, and at
+//   the end of the text) in the same way.
+// Each char of an invalid sequence is alphabetic on its own. Runs of ASCII letters, digits and spaces
+//   are skipped over a word at a time.
+// Return the number of break opportunities, including the mandatory ones.
+extern size_t utf8_line_breaks(uint8_t *breaks, uint8_t *mandatory, utf8_char_t *src, size_t src_size, bool swap);
+extern size_t utf16_line_breaks(uint8_t *breaks, uint8_t *mandatory, utf16_char_t *src, size_t src_size, bool swap);
+
+/* ******************************* */
+/* -*- display width functions -*- */
+/* ******************************* */
+
+// Get the number of columns UTF-X takes in a terminal, like wcswidth. East Asian wide and fullwidth
+//   codepoints (which include most emoji) take 2 columns, and nonspacing and enclosing marks (Mn and Me),
+//   format chars and controls take none. Everything else takes 1, including spacing marks (Mc), East Asian
+//   ambiguous codepoints and each char of an invalid sequence. Runs of printable ASCII are counted a word
+//   at a time.
+extern size_t utf8_display_width(utf8_char_t *src, size_t src_size, bool swap);
+extern size_t utf16_display_width(utf16_char_t *src, size_t src_size, bool swap);
+
+// Get the length of the longest prefix of UTF-X which fits in `max_width` columns, storing its width in
+//   `width` if it isn't NULL. Zero width codepoints after the last one which fits are kept, so nonspacing
+//   and enclosing marks aren't cut off from their base.
+extern size_t utf8_truncate_to_width(utf8_char_t *src, size_t src_size, size_t max_width, size_t *width, bool swap);
+extern size_t utf16_truncate_to_width(utf16_char_t *src, size_t src_size, size_t max_width, size_t *width, bool swap);
+
 #endif /* !defined(__UNICODE__) */